@@ -14,7 +14,10 @@
 
 package com.eprosima.fastrtps.idl.parser.typecode;
 
+import com.eprosima.idl.parser.typecode.ContainerTypeCode;
+import com.eprosima.idl.parser.typecode.Kind;
 import com.eprosima.idl.parser.typecode.Member;
+import com.eprosima.idl.parser.typecode.TypeCode;
 import com.eprosima.idl.parser.tree.Annotation;
 
 public class StructTypeCode extends com.eprosima.idl.parser.typecode.StructTypeCode
@@ -45,6 +48,46 @@ public class StructTypeCode extends com.eprosima.idl.parser.typecode.StructTypeC
         return returnedValue;
     }
 
+    /*!
+     * A struct is plain when its CDR representation is the memory of the generated class: all members are
+     * primitives of at most 4 bytes, or arrays of them. Strings, sequences, enumerations, unions and nested
+     * structures are not plain.
+     */
+    public boolean isIsPlain()
+    {
+        if(getMembers().isEmpty())
+            return false;
+
+        for(Member member : getMembers())
+        {
+            if(!isPlain(member.getTypecode()))
+                return false;
+        }
+
+        return true;
+    }
+
+    private static boolean isPlain(TypeCode typecode)
+    {
+        switch(typecode.getKind())
+        {
+            case Kind.KIND_SHORT:
+            case Kind.KIND_USHORT:
+            case Kind.KIND_LONG:
+            case Kind.KIND_ULONG:
+            case Kind.KIND_FLOAT:
+            case Kind.KIND_BOOLEAN:
+            case Kind.KIND_CHAR:
+            case Kind.KIND_OCTET:
+                return true;
+            case Kind.KIND_ARRAY:
+            case Kind.KIND_ALIAS:
+                return isPlain(((ContainerTypeCode)typecode).getContentTypeCode());
+            default:
+                return false;
+        }
+    }
+
     public void setIsTopic(boolean value)
     {
         istopic_ = value;
@@ -24,6 +24,7 @@
 #include "rtps/common/InstanceHandle.h"
 #include "utils/md5.h"
 #include <string>
+#include <vector>
 #include <functional>
 
 namespace eprosima {
@@ -80,6 +81,15 @@ class  TopicDataType {
          */
         RTPS_DllAPI virtual bool getKey(void* data, rtps::InstanceHandle_t* ihandle, bool force_md5 = false) = 0;
 
+        /**
+         * Whether the type is plain. The serialized payload of a plain type is the encapsulation header followed
+         * by the memory of the sample, which is m_typeSize - 4 bytes long and needs no more than 4 bytes of
+         * alignment. serialize and deserialize must follow that layout. Plain samples can be loaned, so they are
+         * written and read in place without any copy.
+         * @return True if the type is plain.
+         */
+        RTPS_DllAPI virtual bool is_plain() const { return false; }
+
         /**
          * Set topic data type name
          * @param nam Topic data type name
@@ -98,6 +108,52 @@ class  TopicDataType {
 
         //! Indicates whether the method to obtain the key has been implemented.
         bool m_isGetKeyDefined;
+
+    protected:
+        //! Size of the buffer on the stack where getKey serializes the keys that fit in it.
+        static const size_t keyStackBufferSize = 512;
+
+        /**
+         * Get a buffer of the calling thread where getKey serializes the keys that don't fit on the stack.
+         * As each thread uses its own buffer, the keys of several samples can be computed at the same time.
+         * @param size Size of the buffer in bytes.
+         * @return Pointer to the buffer.
+         */
+        static char* getThreadKeyBuffer(size_t size)
+        {
+            static thread_local std::vector<char> buffer;
+            if (buffer.size() < size)
+            {
+                buffer.resize(size);
+            }
+            return buffer.data();
+        }
+
+        /**
+         * Fill the instance handle from a key serialized in big endian CDR.
+         * The key is copied when its maximum serialized size is 16 bytes or less, unless force_md5 is set.
+         * Otherwise the handle is the MD5 of the serialized key.
+         * @param[in] key Pointer to the serialized key.
+         * @param[in] length Length of the serialized key.
+         * @param[in] maxLength Maximum serialized size of the key of the type.
+         * @param[in] force_md5 Whether to use the MD5 even if the key fits in the handle.
+         * @param[out] ihandle Pointer to the Handle.
+         */
+        RTPS_DllAPI static void getKeyHash(const char* key, size_t length, size_t maxLength, bool force_md5,
+                rtps::InstanceHandle_t* ihandle)
+        {
+            if (force_md5 || maxLength > 16)
+            {
+                MD5::hash(reinterpret_cast<const unsigned char*>(key), static_cast<MD5::size_type>(length),
+                        ihandle->value);
+            }
+            else
+            {
+                memcpy(ihandle->value, key, length);
+                memset(ihandle->value + length, 0, 16 - length);
+            }
+        }
+
     private:
         //! Data Type Name.
         std::string m_topicDataTypeName;
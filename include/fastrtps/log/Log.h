@@ -17,11 +17,16 @@
 #define _FASTRTPS_LOG_LOG_H_
 
 #include <fastrtps/utils/DBQueue.h>
+#include <fastrtps/utils/SPSCRecordBuffer.h>
 #include <fastrtps/fastrtps_dll.h>
 #include <thread>
 #include <sstream>
 #include <atomic>
+#include <chrono>
+#include <new>
 #include <regex>
+#include <tuple>
+#include <type_traits>
 
 /**
  * eProsima log layer. Logging categories and verbosities can be specified dynamically at runtime. However, even on a category
@@ -33,6 +38,15 @@
  * * #define LOG_NO_INFO
  *
  * Additionally. the lowest level (Info) is disabled by default on release branches.
+ *
+ * Categories can also be opted out at compile time, defining LOG_NO_CATEGORIES as a comma separated list of
+ * string literals with their names:
+ *
+ * * #define LOG_NO_CATEGORIES "RTPS_HISTORY", "RTPS_READER"
+ *
+ * The log*Fmt macros are meant for hot paths. They take a format where each "{}" is replaced by the next argument,
+ * and they neither allocate memory nor take locks: the arguments are copied into a buffer of the calling thread,
+ * and the logging thread formats them and applies the filters.
  */
 
 // Logging API:
@@ -44,6 +58,13 @@
 //! Logs an error. Disable reporting through #define LOG_NO_ERROR
 #define logError(cat, msg) logError_(cat, msg)
 
+//! Logs an info message, formatted by the logging thread. Disabled as logInfo.
+#define logInfoFmt(cat, ...) logInfoFmt_(cat, __VA_ARGS__)
+//! Logs a warning, formatted by the logging thread. Disabled as logWarning.
+#define logWarningFmt(cat, ...) logWarningFmt_(cat, __VA_ARGS__)
+//! Logs an error, formatted by the logging thread. Disabled as logError.
+#define logErrorFmt(cat, ...) logErrorFmt_(cat, __VA_ARGS__)
+
 namespace eprosima {
 namespace fastrtps {
 
@@ -126,7 +147,107 @@ class Log
     */
     RTPS_DllAPI static void QueueLog(const std::string &message, const Log::Context &, Log::Kind);
 
+    /**
+    * Not recommended to call this method directly! Use the following macros:
+    *  * logInfoFmt(cat, format, args...);
+    *  * logWarningFmt(cat, format, args...);
+    *  * logErrorFmt(cat, format, args...);
+    * The format and the pointers passed as arguments have to outlive the entry, as string literals do.
+    * If the buffer of the thread is full, the entry is dropped, and the logging thread reports how many were.
+    */
+    template<typename... Args>
+    static void QueueFormattedLog(const Log::Context &context, Log::Kind kind, const char *format,
+            const Args&... args)
+    {
+        typedef std::tuple<typename std::decay<Args>::type...> Arguments;
+        static_assert(alignof(Arguments) <= SPSCRecordBuffer::alignment, "Unsupported argument alignment");
+
+        SPSCRecordBuffer &buffer = GetThreadBuffer();
+        void *record = buffer.reserve(FormattedEntryArgumentsOffset() + sizeof(Arguments));
+        if (record == nullptr)
+        {
+            NotifyFormattedLog(true);
+            return;
+        }
+
+        new (record) FormattedEntry{context, kind, std::chrono::system_clock::now(), format,
+            &PrintArguments<Arguments>};
+        new (static_cast<unsigned char*>(record) + FormattedEntryArgumentsOffset()) Arguments(args...);
+        buffer.commit();
+        NotifyFormattedLog(false);
+    }
+
+    //! Returns true if the category is one of the given ones. Used to filter categories at compile time.
+    static constexpr bool CategoryIn(const char *)
+    {
+        return false;
+    }
+
+    template<typename... Categories>
+    static constexpr bool CategoryIn(const char *category, const char *first, Categories... rest)
+    {
+        return SameString(category, first) || CategoryIn(category, rest...);
+    }
+
   private:
+    //! Entry queued by QueueFormattedLog, followed by its arguments.
+    struct FormattedEntry
+    {
+        Log::Context context;
+        Log::Kind kind;
+        std::chrono::system_clock::time_point time;
+        const char *format;
+        //! Prints the message if a stream is given, and destroys the arguments.
+        void (*print)(std::ostream *, const char *format, void *arguments);
+    };
+
+    static constexpr size_t FormattedEntryArgumentsOffset()
+    {
+        return (sizeof(FormattedEntry) + SPSCRecordBuffer::alignment - 1) & ~(SPSCRecordBuffer::alignment - 1);
+    }
+
+    static constexpr bool SameString(const char *a, const char *b)
+    {
+        return *a == *b && (*a == '\0' || SameString(a + 1, b + 1));
+    }
+
+    template<typename Arguments>
+    static void PrintArguments(std::ostream *stream, const char *format, void *arguments)
+    {
+        Arguments &values = *static_cast<Arguments*>(arguments);
+        if (stream != nullptr)
+        {
+            PrintNextArgument<0>(*stream, format, values);
+        }
+        values.~Arguments();
+    }
+
+    template<size_t I, typename Arguments>
+    static typename std::enable_if<(I < std::tuple_size<Arguments>::value)>::type PrintNextArgument(
+            std::ostream &stream, const char *format, const Arguments &values)
+    {
+        format = PrintUntilPlaceholder(stream, format);
+        if (format != nullptr)
+        {
+            stream << std::get<I>(values);
+            PrintNextArgument<I + 1>(stream, format, values);
+        }
+    }
+
+    template<size_t I, typename Arguments>
+    static typename std::enable_if<(I >= std::tuple_size<Arguments>::value)>::type PrintNextArgument(
+            std::ostream &stream, const char *format, const Arguments &)
+    {
+        stream << format;
+    }
+
+    //! Prints the format up to the next "{}". Returns the rest of the format, or nullptr if there is no "{}".
+    RTPS_DllAPI static const char *PrintUntilPlaceholder(std::ostream &stream, const char *format);
+    //! Returns the buffer of the calling thread, registering it on its first call.
+    RTPS_DllAPI static SPSCRecordBuffer &GetThreadBuffer();
+    //! Wakes up the logging thread after queuing, or failing to queue, a formatted entry.
+    RTPS_DllAPI static void NotifyFormattedLog(bool dropped);
+
     struct Resources
     {
         DBQueue<Entry> mLogs;
@@ -150,6 +271,15 @@ class Log
 
         std::atomic<Log::Kind> mVerbosity;
 
+        // Formatted entries segment. Buffers are registered and released under the mutex.
+        std::mutex mThreadBuffersMutex;
+        std::vector<std::shared_ptr<SPSCRecordBuffer>> mThreadBuffers;
+        std::atomic<bool> mHasThreadBuffers;
+        std::atomic<bool> mFormattedPending;
+        std::atomic<uint32_t> mFormattedDropped;
+        //! Whether the logging thread runs, readable without taking mCvMutex.
+        std::atomic<bool> mLoggingActive;
+
         Resources();
         ~Resources();
     };
@@ -162,7 +292,10 @@ class Log
     static bool Preprocess(Entry &);
     static void LaunchThread();
     static void Run();
+    static void ConsumeFormattedLogs();
+    static void Dispatch(Entry &);
     static void GetTimestamp(std::string &);
+    static void GetTimestamp(const std::chrono::system_clock::time_point &, std::string &);
 };
 
 /**
@@ -186,43 +319,80 @@ class LogConsumer
 #define __func__ __FUNCTION__
 #endif
 
+#ifdef LOG_NO_CATEGORIES
+#define LOG_CATEGORY_ENABLED_(cat) \
+    (!std::integral_constant<bool, Log::CategoryIn(#cat, LOG_NO_CATEGORIES)>::value)
+#else
+#define LOG_CATEGORY_ENABLED_(cat) true
+#endif
+
 #ifndef LOG_NO_ERROR
-#define logError_(cat, msg)                                                                          \
-    {                                                                                                \
-        std::stringstream ss;                                                                        \
-        ss << msg;                                                                                   \
-        Log::QueueLog(ss.str(), Log::Context{__FILE__, __LINE__, __func__, #cat}, Log::Kind::Error); \
+#define logError_(cat, msg)                                                                              \
+    {                                                                                                    \
+        if (LOG_CATEGORY_ENABLED_(cat))                                                                  \
+        {                                                                                                \
+            std::stringstream ss;                                                                        \
+            ss << msg;                                                                                   \
+            Log::QueueLog(ss.str(), Log::Context{__FILE__, __LINE__, __func__, #cat}, Log::Kind::Error); \
+        }                                                                                                \
+    }
+#define logErrorFmt_(cat, ...)                                                                           \
+    {                                                                                                    \
+        if (LOG_CATEGORY_ENABLED_(cat))                                                                  \
+        {                                                                                                \
+            Log::QueueFormattedLog(Log::Context{__FILE__, __LINE__, __func__, #cat}, Log::Kind::Error,   \
+                    __VA_ARGS__);                                                                        \
+        }                                                                                                \
     }
 #else
 #define logError_(cat, msg)
+#define logErrorFmt_(cat, ...)
 #endif
 
 #ifndef LOG_NO_WARNING
 #define logWarning_(cat, msg)                                                                              \
     {                                                                                                      \
-        if (Log::GetVerbosity() >= Log::Kind::Warning)                                                     \
+        if (LOG_CATEGORY_ENABLED_(cat) && Log::GetVerbosity() >= Log::Kind::Warning)                       \
         {                                                                                                  \
             std::stringstream ss;                                                                          \
             ss << msg;                                                                                     \
             Log::QueueLog(ss.str(), Log::Context{__FILE__, __LINE__, __func__, #cat}, Log::Kind::Warning); \
         }                                                                                                  \
     }
+#define logWarningFmt_(cat, ...)                                                                           \
+    {                                                                                                      \
+        if (LOG_CATEGORY_ENABLED_(cat) && Log::GetVerbosity() >= Log::Kind::Warning)                       \
+        {                                                                                                  \
+            Log::QueueFormattedLog(Log::Context{__FILE__, __LINE__, __func__, #cat}, Log::Kind::Warning,   \
+                    __VA_ARGS__);                                                                          \
+        }                                                                                                  \
+    }
 #else
 #define logWarning_(cat, msg)
+#define logWarningFmt_(cat, ...)
 #endif
 
 #if (defined(__INTERNALDEBUG) || defined(_INTERNALDEBUG)) && (defined(_DEBUG) || defined(__DEBUG)) && (!defined(LOG_NO_INFO))
 #define logInfo_(cat, msg)                                                                              \
     {                                                                                                   \
-        if (Log::GetVerbosity() >= Log::Kind::Info)                                                     \
+        if (LOG_CATEGORY_ENABLED_(cat) && Log::GetVerbosity() >= Log::Kind::Info)                       \
         {                                                                                               \
             std::stringstream ss;                                                                       \
             ss << msg;                                                                                  \
             Log::QueueLog(ss.str(), Log::Context{__FILE__, __LINE__, __func__, #cat}, Log::Kind::Info); \
         }                                                                                               \
     }
+#define logInfoFmt_(cat, ...)                                                                           \
+    {                                                                                                   \
+        if (LOG_CATEGORY_ENABLED_(cat) && Log::GetVerbosity() >= Log::Kind::Info)                       \
+        {                                                                                               \
+            Log::QueueFormattedLog(Log::Context{__FILE__, __LINE__, __func__, #cat}, Log::Kind::Info,   \
+                    __VA_ARGS__);                                                                       \
+        }                                                                                               \
+    }
 #else
 #define logInfo_(cat, msg)
+#define logInfoFmt_(cat, ...)
 #endif
 
 } // namespace fastrtps
@@ -90,6 +90,21 @@ class RTPS_DllAPI Publisher
      */
     bool dispose_and_unregister(void*Data);
 
+    /**
+     * Get a sample allocated directly in the history of the publisher, so it is written without any copy.
+     * Only available for plain types (see TopicDataType::is_plain). The sample is consumed when it is
+     * successfully passed to write(). Otherwise it has to be given back with discard_loan().
+     * @return Pointer to the sample, or nullptr if no sample could be loaned.
+     */
+    void* loan_sample();
+
+    /**
+     * Give back a sample obtained with loan_sample() without writing it.
+     * @param sample Pointer to the loaned sample.
+     * @return True if correct.
+     */
+    bool discard_loan(void* sample);
+
     /**
      * Remove all the Changes in the associated RTPSWriter.
      * @param[out] removed Number of elements removed
@@ -25,6 +25,9 @@
 
 #include "../rtps/history/WriterHistory.h"
 #include "../qos/QosPolicies.h"
+#include "../utils/RingBuffer.h"
+
+#include <unordered_map>
 
 
 
@@ -41,8 +44,9 @@ class PublisherImpl;
 class PublisherHistory:public rtps::WriterHistory
 {
     public:
-        typedef std::pair<rtps::InstanceHandle_t,std::vector<rtps::CacheChange_t*>> t_p_I_Change;
-        typedef std::vector<t_p_I_Change> t_v_Inst_Caches;
+        //!Changes of an instance, ordered by sequence number.
+        typedef RingBuffer<rtps::CacheChange_t*> t_Inst_Changes;
+        typedef std::unordered_map<rtps::InstanceHandle_t, t_Inst_Changes, rtps::InstanceHandleHash> t_m_Inst_Caches;
         /**
          * Constructor of the PublisherHistory.
          * @param pimpl Pointer to the PublisherImpl.
@@ -89,21 +93,23 @@ class PublisherHistory:public rtps::WriterHistory
          * @param vit Pointer to the iterator of the Keyed history vector.
          * @return True if removed.
          */
-        bool remove_change_pub(rtps::CacheChange_t* change,t_v_Inst_Caches::iterator* vit=nullptr);
+        bool remove_change_pub(rtps::CacheChange_t* change,t_m_Inst_Caches::iterator* vit=nullptr);
 
         virtual bool remove_change_g(rtps::CacheChange_t* a_change);
 
     private:
-        //!Vector of pointer to the CacheChange_t divided by key.
-        t_v_Inst_Caches m_keyedChanges;
+        //!Pointers to the CacheChange_t divided by key.
+        t_m_Inst_Caches m_keyedChanges;
         //!HistoryQosPolicy values.
         HistoryQosPolicy m_historyQos;
         //!ResourceLimitsQosPolicy values.
         ResourceLimitsQosPolicy m_resourceLimitsQos;
+        //!Maximum number of changes kept for each instance.
+        size_t m_instanceCapacity;
         //!Publisher Pointer
         PublisherImpl* mp_pubImpl;
 
-        bool find_Key(rtps::CacheChange_t* a_change,t_v_Inst_Caches::iterator* vecPairIterrator);
+        bool find_Key(rtps::CacheChange_t* a_change,t_m_Inst_Caches::iterator* vecPairIterrator);
 };
 
 } /* namespace fastrtps */
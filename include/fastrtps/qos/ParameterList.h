@@ -83,6 +83,87 @@ class ParameterList
         static int32_t readParameterListfromCDRMsg(rtps::CDRMessage_t* msg, ParameterList_t* plist, rtps::CacheChange_t* change,
                 bool encapsulation);
 
+        /**
+         * Read a parameter list from a CDRMessage without storing it, calling a processor with each parameter.
+         * @param[in] msg Reference to the message (the pos should be correct, otherwise the behaviour is undefined).
+         * @param[in] processor Functor with signature bool(rtps::CDRMessage_t* msg, ParameterId_t pid, uint16_t plength).
+         * It is called with the message positioned at the value of each parameter, and returns false if the parameter
+         * is not valid. The next parameter is read after plength bytes, whatever the processor read.
+         * @param[in] use_encapsulation Whether the parameter list starts with its encapsulation.
+         * @param[out] qos_size Number of bytes of the parameter list.
+         * @return True if the parameter list was correctly read.
+         */
+        template<typename Pred>
+        static bool readParameterListfromCDRMsg(rtps::CDRMessage_t& msg, Pred processor, bool use_encapsulation,
+                uint32_t& qos_size)
+        {
+            qos_size = 0;
+
+            if(use_encapsulation)
+            {
+                // Read encapsulation
+                msg.pos += 1;
+                rtps::octet encapsulation = 0;
+                rtps::CDRMessage::readOctet(&msg, &encapsulation);
+                if(encapsulation == PL_CDR_BE)
+                {
+                    msg.msg_endian = rtps::BIGEND;
+                }
+                else if(encapsulation == PL_CDR_LE)
+                {
+                    msg.msg_endian = rtps::LITTLEEND;
+                }
+                else
+                {
+                    return false;
+                }
+                // Skip encapsulation options
+                msg.pos += 2;
+            }
+
+            while(true)
+            {
+                ParameterId_t pid;
+                uint16_t plength;
+                bool valid = rtps::CDRMessage::readUInt16(&msg, (uint16_t*)&pid);
+                valid &= rtps::CDRMessage::readUInt16(&msg, &plength);
+                if(!valid)
+                {
+                    return false;
+                }
+                qos_size += 4;
+
+                if(pid == PID_SENTINEL)
+                {
+                    return true;
+                }
+
+                if(plength > msg.length - msg.pos)
+                {
+                    return false;
+                }
+
+                uint32_t next_pos = msg.pos + plength;
+                if(!processor(&msg, pid, plength))
+                {
+                    return false;
+                }
+                msg.pos = next_pos;
+                qos_size += plength;
+            }
+        }
+
+        /**
+         * Read the inline QoS of a DATA or DATA_FRAG submessage, updating the cache change with the parameters
+         * that apply to it, without storing the parameter list.
+         * @param[in] msg Pointer to the message, positioned at the inline QoS.
+         * @param[in,out] change Cache change updated with the status info, key hash and related sample identity.
+         * @param[out] qos_size Number of bytes of the inline QoS.
+         * @return True if the inline QoS was correctly read.
+         */
+        static bool updateCacheChangeFromInlineQos(rtps::CDRMessage_t* msg, rtps::CacheChange_t& change,
+                uint32_t& qos_size);
+
         /**
          * Read change instanceHandle from the KEY_HASH or another specific PID parameter of a CDRMessage
          * @param[in-out] change Pointer to the cache change.
@@ -178,6 +178,13 @@ class ParameterKey_t:public Parameter_t{
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 /**
@@ -200,6 +207,13 @@ class ParameterLocator_t: public Parameter_t {
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 #define PARAMETER_LOCATOR_LENGTH 24
 
@@ -223,6 +237,13 @@ class ParameterString_t: public Parameter_t {
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
         inline const char* getName()const { return m_string.c_str(); };
         inline void setName(const char* name){ m_string = std::string(name); };
     private:
@@ -249,6 +270,13 @@ class ParameterPort_t: public Parameter_t {
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 #define PARAMETER_PORT_LENGTH 4
@@ -283,6 +311,13 @@ class ParameterGuid_t: public Parameter_t {
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 #define PARAMETER_GUID_LENGTH 16
@@ -306,6 +341,13 @@ class ParameterProtocolVersion_t: public Parameter_t {
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 #define PARAMETER_PROTOCOL_LENGTH 4
@@ -331,6 +373,13 @@ class ParameterVendorId_t:public Parameter_t{
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 #define PARAMETER_VENDOR_LENGTH 4
@@ -354,6 +403,13 @@ class ParameterIP4Address_t :public Parameter_t{
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
         void setIP4Address(rtps::octet o1, rtps::octet o2, rtps::octet o3, rtps::octet o4);
 };
 
@@ -379,6 +435,13 @@ class ParameterBool_t:public Parameter_t{
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 #define PARAMETER_BOOL_LENGTH 4
@@ -402,6 +465,13 @@ class ParameterCount_t:public Parameter_t{
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 #define PARAMETER_COUNT_LENGTH 4
@@ -425,6 +495,13 @@ class ParameterEntityId_t:public Parameter_t{
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 #define PARAMETER_ENTITYID_LENGTH 4
@@ -448,6 +525,13 @@ class ParameterTime_t:public Parameter_t{
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 #define PARAMETER_TIME_LENGTH 8
@@ -471,6 +555,13 @@ class ParameterBuiltinEndpointSet_t:public Parameter_t{
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 #define PARAMETER_BUILTINENDPOINTSET_LENGTH 4
@@ -502,6 +593,13 @@ class ParameterPropertyList_t : public Parameter_t {
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 /**
@@ -527,6 +625,13 @@ class ParameterSampleIdentity_t : public Parameter_t
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 #if HAVE_SECURITY
@@ -554,6 +659,13 @@ class ParameterToken_t : public Parameter_t
          * @return True if the parameter was correctly added.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 class ParameterParticipantSecurityInfo_t : public Parameter_t
@@ -581,6 +693,13 @@ class ParameterParticipantSecurityInfo_t : public Parameter_t
         * @return True if the parameter was correctly added.
         */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 #define PARAMETER_PARTICIPANT_SECURITY_INFO_LENGTH 8
@@ -610,6 +729,13 @@ class ParameterEndpointSecurityInfo_t : public Parameter_t
         * @return True if the parameter was correctly added.
         */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+         * Read the parameter from a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message, positioned at the value of the parameter.
+         * @param[in] size Length of the value of the parameter.
+         * @return True if the parameter was correctly read.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 #define PARAMETER_ENDPOINT_SECURITY_INFO_LENGTH 8
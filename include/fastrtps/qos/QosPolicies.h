@@ -140,6 +140,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
 public:
     DurabilityQosPolicyKind_t kind;
@@ -174,6 +181,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
 public:
     rtps::Duration_t period;
@@ -206,6 +220,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
 public:
     rtps::Duration_t duration;
@@ -258,6 +279,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
 public:
     LivelinessQosPolicyKind kind;
@@ -305,6 +333,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
 public:
     ReliabilityQosPolicyKind kind;
@@ -349,6 +384,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
 public:
     OwnershipQosPolicyKind kind;
@@ -393,6 +435,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
 public:
     DestinationOrderQosPolicyKind kind;
@@ -427,6 +476,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
     /**
      * Returns raw data vector.
@@ -473,6 +529,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
 public:
     rtps::Duration_t minimum_separation;
@@ -525,6 +588,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
 public:
     PresentationQosPolicyAccessScopeKind access_scope;
@@ -562,6 +632,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
     /**
      * Appends a name to the list of partition names.
@@ -615,6 +692,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
     /**
      * Appends topic data.
@@ -668,6 +752,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
     /**
      * Appends group data.
@@ -732,6 +823,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
 public:
     HistoryQosPolicyKind kind;
@@ -760,6 +858,13 @@ class ResourceLimitsQosPolicy : private Parameter_t, public QosPolicy {
          * @return True if the modified CDRMessage is valid.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+        * Reads QoS from the specified CDR message.
+        * @param msg Message positioned at the value of the QoS Policy.
+        * @param size Length of the value of the QoS Policy.
+        * @return True if the QoS Policy was correctly read.
+        */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 
@@ -806,6 +911,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
 public:
     rtps::Duration_t service_cleanup_delay;
@@ -845,6 +957,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
 public:
     rtps::Duration_t duration;
@@ -877,6 +996,13 @@ public:
      * @return True if the modified CDRMessage is valid.
      */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 
 public:
     uint32_t value;
@@ -900,6 +1026,13 @@ class TransportPriorityQosPolicy : private Parameter_t , public QosPolicy{
          * @return True if the modified CDRMessage is valid.
          */
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+        /**
+        * Reads QoS from the specified CDR message.
+        * @param msg Message positioned at the value of the QoS Policy.
+        * @param size Length of the value of the QoS Policy.
+        * @return True if the QoS Policy was correctly read.
+        */
+        bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 /**
@@ -945,6 +1078,13 @@ public:
     * @return True if the modified CDRMessage is valid.
     */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 enum TypeConsistencyKind : uint32_t
@@ -974,6 +1114,13 @@ public:
     * @return True if the modified CDRMessage is valid.
     */
     bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+    /**
+    * Reads QoS from the specified CDR message.
+    * @param msg Message positioned at the value of the QoS Policy.
+    * @param size Length of the value of the QoS Policy.
+    * @return True if the QoS Policy was correctly read.
+    */
+    bool readFromCDRMessage(rtps::CDRMessage_t* msg, uint32_t size);
 };
 
 /**
@@ -22,10 +22,13 @@
 #define RTPSRTPSParticipant_H_
 
 #include "common/Types.h"
+#include "common/Guid.h"
 
 #include "attributes/RTPSParticipantAttributes.h"
 
 #include <atomic>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <set>
 
@@ -44,6 +47,7 @@ class RTPSReader;
 class ReaderAttributes;
 class ReaderHistory;
 class ReaderListener;
+class LocalReaderPointer;
 
 
 /**
@@ -140,6 +144,15 @@ class RTPSDomain
         m_maxRTPSParticipantID = maxRTPSParticipantId;
     }
 
+    /**
+     * Look for a reader of this process a writer can deliver data to without using the transports.
+     * @param writer_guid GUID of the writer.
+     * @param reader_guid GUID of the reader.
+     * @return Pointer to the reader, or nullptr when any of the endpoints is not local or has intraprocess
+     * delivery disabled.
+     */
+    static std::shared_ptr<LocalReaderPointer> find_local_reader(const GUID_t& writer_guid, const GUID_t& reader_guid);
+
 
 
     private:
@@ -159,6 +172,35 @@ class RTPSDomain
 
     static void removeRTPSParticipant_nts(std::vector<t_p_RTPSParticipant>::iterator it);
 
+    friend class RTPSParticipantImpl;
+
+    /**
+     * Allow a writer to deliver its data to the local readers directly.
+     * @param writer_guid GUID of the writer.
+     */
+    static void register_local_writer(const GUID_t& writer_guid);
+
+    static void unregister_local_writer(const GUID_t& writer_guid);
+
+    /**
+     * Allow the local writers to deliver their data to a reader directly.
+     * @param reader Pointer to the reader.
+     */
+    static void register_local_reader(RTPSReader* reader);
+
+    /**
+     * Stop the direct delivery of data to a reader. Waits for the deliveries in progress.
+     * @param reader_guid GUID of the reader.
+     */
+    static void unregister_local_reader(const GUID_t& reader_guid);
+
+    //! Protects the local endpoints. No other mutex is taken while holding it.
+    static std::mutex m_local_endpoints_mutex;
+
+    static std::set<GUID_t> m_local_writers;
+
+    static std::map<GUID_t, std::shared_ptr<LocalReaderPointer>> m_local_readers;
+
 };
 
 
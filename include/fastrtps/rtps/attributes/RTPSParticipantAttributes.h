@@ -192,6 +192,9 @@ class RTPSParticipantAttributes
             listenSocketBufferSize = 0;
             participantID = -1;
             useBuiltinTransports = true;
+            useIntraprocessDelivery = false;
+            receiveWorkerThreads = 0;
+            asyncWriterThreads = 0;
         }
 
         virtual ~RTPSParticipantAttributes() {}
@@ -209,6 +212,9 @@ class RTPSParticipantAttributes
                    (this->participantID == b.participantID) &&
                    (this->throughputController == b.throughputController) &&
                    (this->useBuiltinTransports == b.useBuiltinTransports) &&
+                   (this->useIntraprocessDelivery == b.useIntraprocessDelivery) &&
+                   (this->receiveWorkerThreads == b.receiveWorkerThreads) &&
+                   (this->asyncWriterThreads == b.asyncWriterThreads) &&
                    (this->properties == b.properties);
         }
 
@@ -253,6 +259,24 @@ class RTPSParticipantAttributes
         std::vector<std::shared_ptr<TransportDescriptorInterface> > userTransports;
         //!Set as false to disable the default UDPv4 implementation.
         bool useBuiltinTransports;
+        //!Set as true to give the data of user endpoints to the readers of this process without the transports.
+        bool useIntraprocessDelivery;
+
+        /*!
+         * @brief Number of threads parsing the received messages and dispatching them to the endpoints.
+         * The messages of a writer are always processed by the same thread, so they keep their order.
+         * Zero value indicates that each receiving thread processes its own messages.
+         * Default value: 0.
+         */
+        uint32_t receiveWorkerThreads;
+
+        /*!
+         * @brief Number of threads sending the changes of the asynchronous writers of this participant.
+         * A writer is never sent by two threads at the same time, so a slow writer does not delay the rest.
+         * Zero value indicates that the writers share a single thread with the writers of other participants.
+         * Default value: 0.
+         */
+        uint32_t asyncWriterThreads;
 
         //! Property policies
         PropertyPolicy properties;
@@ -22,7 +22,10 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include <mutex>
+#include <string>
+#include <vector>
 #include "../../../common/Guid.h"
+#include "ProxyDataIndex.h"
 #include "../../../attributes/RTPSParticipantAttributes.h"
 
 #include "../../../../qos/QosPolicies.h"
@@ -163,7 +166,7 @@ class PDPSimple
      */
     ParticipantProxyData* getLocalParticipantProxyData()
     {
-        return m_participantProxies.front();
+        return m_index.participants().front();
     }
     /**
      * Get a pointer to the EDP object.
@@ -174,12 +177,28 @@ class PDPSimple
      * Get a cons_iterator to the beginning of the RTPSParticipant Proxies.
      * @return const_iterator.
      */
-    std::vector<ParticipantProxyData*>::const_iterator ParticipantProxiesBegin(){return m_participantProxies.begin();};
+    std::vector<ParticipantProxyData*>::const_iterator ParticipantProxiesBegin(){return m_index.participants().begin();};
     /**
      * Get a cons_iterator to the end RTPSParticipant Proxies.
      * @return const_iterator.
      */
-    std::vector<ParticipantProxyData*>::const_iterator ParticipantProxiesEnd(){return m_participantProxies.end();};
+    std::vector<ParticipantProxyData*>::const_iterator ParticipantProxiesEnd(){return m_index.participants().end();};
+
+    /**
+     * Get the readers of all the registered RTPSParticipants (including the local one) on a topic.
+     * The PDP mutex should be taken while the returned vector is used.
+     * @param topic_name Name of the topic.
+     * @return Pointer to the readers on the topic, or nullptr if there are none.
+     */
+    const std::vector<ReaderProxyData*>* readersOnTopic(const std::string& topic_name) const;
+
+    /**
+     * Get the writers of all the registered RTPSParticipants (including the local one) on a topic.
+     * The PDP mutex should be taken while the returned vector is used.
+     * @param topic_name Name of the topic.
+     * @return Pointer to the writers on the topic, or nullptr if there are none.
+     */
+    const std::vector<WriterProxyData*>* writersOnTopic(const std::string& topic_name) const;
 
     /**
      * Assert the liveliness of a Remote Participant.
@@ -232,8 +251,8 @@ class PDPSimple
     StatelessReader* mp_SPDPReader;
     //!Pointer to the EDP object.
     EDP* mp_EDP;
-    //!Registered RTPSParticipants (including the local one, that is the first one.)
-    std::vector<ParticipantProxyData*> m_participantProxies;
+    //!Registered RTPSParticipants (including the local one, that is the first one) and their endpoints.
+    ProxyDataIndex m_index;
     //!Variable to indicate if any parameter has changed.
     bool m_hasChangedLocalPDP;
     //!TimedEvent to periodically resend the local RTPSParticipant information.
@@ -250,6 +269,20 @@ class PDPSimple
      * @return True if correct.
      */
     bool createSPDPEndpoints();
+
+    /**
+     * Find a registered RTPSParticipant. Should be called with the PDP mutex taken.
+     * @param prefix GuidPrefix_t of the RTPSParticipant.
+     * @return Pointer to the ParticipantProxyData, or nullptr if it is not registered.
+     */
+    ParticipantProxyData* findParticipantProxyData(const GuidPrefix_t& prefix) const;
+
+    /**
+     * Register a RTPSParticipant. Should be called with the PDP mutex taken.
+     * @param pdata Pointer to the ParticipantProxyData, owned by this object from now on.
+     */
+    void addParticipantProxyData(ParticipantProxyData* pdata);
+
     std::recursive_mutex* mp_mutex;
 
 
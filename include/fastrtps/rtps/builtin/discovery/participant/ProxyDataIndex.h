@@ -0,0 +1,158 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ProxyDataIndex.h
+ *
+ */
+
+#ifndef PROXYDATAINDEX_H_
+#define PROXYDATAINDEX_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../../../common/Guid.h"
+
+namespace eprosima {
+namespace fastrtps{
+namespace rtps {
+
+class ParticipantProxyData;
+class ReaderProxyData;
+class WriterProxyData;
+
+/**
+ * Class ProxyDataIndex, that keeps the discovered RTPSParticipants and hash indexes over them and their endpoints.
+ * It does not own the proxy data objects and it is not thread safe, the PDP mutex protects it.
+ * @ingroup DISCOVERY_MODULE
+ */
+class ProxyDataIndex
+{
+    public:
+
+        /**
+         * Get the registered RTPSParticipants, in registration order.
+         * @return Vector with the registered RTPSParticipants.
+         */
+        const std::vector<ParticipantProxyData*>& participants() const { return m_participants; }
+
+        /**
+         * Register a RTPSParticipant and index the endpoints it already has.
+         * @param pdata Pointer to the ParticipantProxyData.
+         */
+        void addParticipant(ParticipantProxyData* pdata);
+
+        /**
+         * Unregister a RTPSParticipant and remove its endpoints from the indexes.
+         * Its endpoint lists are left untouched.
+         * @param pdata Pointer to the ParticipantProxyData.
+         * @return True if the RTPSParticipant was registered.
+         */
+        bool removeParticipant(ParticipantProxyData* pdata);
+
+        /**
+         * Find a registered RTPSParticipant.
+         * @param prefix GuidPrefix_t of the RTPSParticipant.
+         * @return Pointer to the ParticipantProxyData, or nullptr if it is not registered.
+         */
+        ParticipantProxyData* findParticipant(const GuidPrefix_t& prefix) const;
+
+        /**
+         * Add a reader to the list of its RTPSParticipant and to the indexes.
+         * @param pdata Pointer to the registered ParticipantProxyData the reader belongs to.
+         * @param rdata Pointer to the ReaderProxyData.
+         */
+        void addReader(ParticipantProxyData* pdata, ReaderProxyData* rdata);
+
+        /**
+         * Remove a reader from the list of its RTPSParticipant and from the indexes.
+         * @param rdata Pointer to the ReaderProxyData.
+         * @return True if the reader was registered.
+         */
+        bool removeReader(ReaderProxyData* rdata);
+
+        /**
+         * Find a reader of a registered RTPSParticipant.
+         * @param guid GUID_t of the reader.
+         * @return Pointer to the ReaderProxyData, or nullptr if it is not registered.
+         */
+        ReaderProxyData* findReader(const GUID_t& guid) const;
+
+        /**
+         * Add a writer to the list of its RTPSParticipant and to the indexes.
+         * @param pdata Pointer to the registered ParticipantProxyData the writer belongs to.
+         * @param wdata Pointer to the WriterProxyData.
+         */
+        void addWriter(ParticipantProxyData* pdata, WriterProxyData* wdata);
+
+        /**
+         * Remove a writer from the list of its RTPSParticipant and from the indexes.
+         * @param wdata Pointer to the WriterProxyData.
+         * @return True if the writer was registered.
+         */
+        bool removeWriter(WriterProxyData* wdata);
+
+        /**
+         * Find a writer of a registered RTPSParticipant.
+         * @param guid GUID_t of the writer.
+         * @return Pointer to the WriterProxyData, or nullptr if it is not registered.
+         */
+        WriterProxyData* findWriter(const GUID_t& guid) const;
+
+        /**
+         * Get the readers of the registered RTPSParticipants on a topic.
+         * @param topic_name Name of the topic.
+         * @return Pointer to the readers on the topic, or nullptr if there are none.
+         */
+        const std::vector<ReaderProxyData*>* readersOnTopic(const std::string& topic_name) const;
+
+        /**
+         * Get the writers of the registered RTPSParticipants on a topic.
+         * @param topic_name Name of the topic.
+         * @return Pointer to the writers on the topic, or nullptr if there are none.
+         */
+        const std::vector<WriterProxyData*>* writersOnTopic(const std::string& topic_name) const;
+
+    private:
+
+        void indexReader(ReaderProxyData* rdata);
+
+        void unindexReader(ReaderProxyData* rdata);
+
+        void indexWriter(WriterProxyData* wdata);
+
+        void unindexWriter(WriterProxyData* wdata);
+
+        //!Registered RTPSParticipants.
+        std::vector<ParticipantProxyData*> m_participants;
+        //!Registered RTPSParticipants indexed by GUID prefix.
+        std::unordered_map<GuidPrefix_t, ParticipantProxyData*, GuidPrefixHash> m_participantsByPrefix;
+        //!Readers of the registered RTPSParticipants indexed by GUID.
+        std::unordered_map<GUID_t, ReaderProxyData*, GUIDHash> m_readersByGuid;
+        //!Writers of the registered RTPSParticipants indexed by GUID.
+        std::unordered_map<GUID_t, WriterProxyData*, GUIDHash> m_writersByGuid;
+        //!Readers of the registered RTPSParticipants indexed by topic name.
+        std::unordered_map<std::string, std::vector<ReaderProxyData*>> m_readersByTopic;
+        //!Writers of the registered RTPSParticipants indexed by topic name.
+        std::unordered_map<std::string, std::vector<WriterProxyData*>> m_writersByTopic;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif
+#endif /* PROXYDATAINDEX_H_ */
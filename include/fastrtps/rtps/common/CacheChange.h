@@ -25,6 +25,7 @@
 #include "Time_t.h"
 #include "InstanceHandle.h"
 #include <fastrtps/rtps/common/FragmentNumber.h>
+#include <fastrtps/utils/DynamicBitmap.h>
 
 #include <vector>
 
@@ -87,7 +88,6 @@ namespace eprosima
                     kind(ALIVE),
                     isRead(false),
                     is_untyped_(true),
-                    dataFragments_(new std::vector<uint32_t>()),
                     fragment_size_(0)
                 {
                 }
@@ -105,7 +105,6 @@ namespace eprosima
                     serializedPayload(payload_size),
                     isRead(false),
                     is_untyped_(is_untyped),
-                    dataFragments_(new std::vector<uint32_t>()),
                     fragment_size_(0)
                 {
                 }
@@ -126,8 +125,8 @@ namespace eprosima
 
                     bool ret = serializedPayload.copy(&ch_ptr->serializedPayload, (ch_ptr->is_untyped_ ? false : true));
 
-                    setFragmentSize(ch_ptr->fragment_size_);
-                    dataFragments_->assign(ch_ptr->dataFragments_->begin(), ch_ptr->dataFragments_->end());
+                    fragment_size_ = ch_ptr->fragment_size_;
+                    dataFragments_ = ch_ptr->dataFragments_;
 
                     isRead = ch_ptr->isRead;
 
@@ -146,24 +145,34 @@ namespace eprosima
                     // Copy certain values from serializedPayload
                     serializedPayload.encapsulation = ch_ptr->serializedPayload.encapsulation;
 
-                    setFragmentSize(ch_ptr->fragment_size_);
-                    dataFragments_->assign(ch_ptr->dataFragments_->begin(), ch_ptr->dataFragments_->end());
+                    fragment_size_ = ch_ptr->fragment_size_;
+                    dataFragments_ = ch_ptr->dataFragments_;
 
                     isRead = ch_ptr->isRead;
                 }
 
                 ~CacheChange_t()
                 {
-                    if (dataFragments_)
-                        delete dataFragments_;
                 }
 
                 uint32_t getFragmentCount() const
                 { 
-                    return (uint32_t)dataFragments_->size();
+                    return dataFragments_.size();
                 }
 
-                std::vector<uint32_t>* getDataFragments() { return dataFragments_; }
+                /**
+                 * Get the status of the fragments. Bit i is set when fragment i + 1 is PRESENT.
+                 * @return Bitmap of the fragments.
+                 */
+                DynamicBitmap& getDataFragments() { return dataFragments_; }
+
+                const DynamicBitmap& getDataFragments() const { return dataFragments_; }
+
+                //! Number of fragments NOT_PRESENT.
+                uint32_t getMissingFragmentCount() const
+                {
+                    return dataFragments_.size() - dataFragments_.count();
+                }
 
                 uint16_t getFragmentSize() const { return fragment_size_; }
 
@@ -172,14 +181,14 @@ namespace eprosima
                     this->fragment_size_ = fragment_size;
 
                     if (fragment_size == 0) {
-                        dataFragments_->clear();
+                        dataFragments_.clear();
                     }
                     else
                     {
                         //TODO Mirar si cuando se compatibilice con RTI funciona el calculo, porque ellos
                         //en el sampleSize incluyen el padding.
                         uint32_t size = (serializedPayload.length + fragment_size - 1) / fragment_size;
-                        dataFragments_->assign(size, ChangeFragmentStatus_t::NOT_PRESENT);
+                        dataFragments_.assign(size, false);
                     }
                 }
 
@@ -187,7 +196,7 @@ namespace eprosima
                 private:
 
                 // Data fragments
-                std::vector<uint32_t>* dataFragments_;
+                DynamicBitmap dataFragments_;
 
                 // Fragment size
                 uint16_t fragment_size_;
@@ -199,7 +208,7 @@ namespace eprosima
              * Enum ChangeForReaderStatus_t, possible states for a CacheChange_t in a ReaderProxy.
              *  @ingroup COMMON_MODULE
              */
-            enum ChangeForReaderStatus_t{
+            enum ChangeForReaderStatus_t : uint8_t {
                 UNSENT = 0,        //!< UNSENT
                 REQUESTED = 1,     //!< REQUESTED
                 UNACKNOWLEDGED = 2,//!< UNACKNOWLEDGED
@@ -211,7 +220,7 @@ namespace eprosima
              * Enum ChangeFromWriterStatus_t, possible states for a CacheChange_t in a WriterProxy.
              *  @ingroup COMMON_MODULE
              */
-            enum ChangeFromWriterStatus_t{
+            enum ChangeFromWriterStatus_t : uint8_t {
                 UNKNOWN = 0,
                 MISSING = 1,
                 //REQUESTED_WITH_NACK,
@@ -245,9 +254,7 @@ namespace eprosima
                 ChangeForReader_t(CacheChange_t* change) : status_(UNSENT),
                 is_relevant_(true), seq_num_(change->sequenceNumber), change_(change)
                 {
-                   if (change->getFragmentSize() != 0)
-                    for (uint32_t i = 1; i != change->getFragmentCount() + 1; i++)
-                       unsent_fragments_.insert(i); // Indexed on 1
+                    markAllFragmentsAsUnsent();
                 }
 
                 ChangeForReader_t(const SequenceNumber_t& seq_num) : status_(UNSENT),
@@ -316,27 +323,35 @@ namespace eprosima
                     return change_ != nullptr;
                 }
 
-                FragmentNumberSet_t getUnsentFragments() const
+                /**
+                 * Get the fragments not sent yet. Bit i is set when fragment i + 1 is unsent.
+                 * @return Bitmap of the unsent fragments.
+                 */
+                const DynamicBitmap& getUnsentFragments() const
                 {
                     return unsent_fragments_;
                 }
 
                 void markAllFragmentsAsUnsent()
                 {
-                   if (change_ != nullptr && change_->getFragmentSize() != 0)
-                    for (uint32_t i = 1; i != change_->getFragmentCount() + 1; i++)
-                       unsent_fragments_.insert(i); // Indexed on 1
+                    if (change_ != nullptr && change_->getFragmentSize() != 0)
+                        unsent_fragments_.assign(change_->getFragmentCount(), true);
                 }
 
                 void markFragmentsAsSent(const FragmentNumber_t& sentFragment)
                 {
-                    unsent_fragments_.erase(sentFragment);
+                    // Indexed on 1
+                    if (sentFragment != 0)
+                        unsent_fragments_.reset(sentFragment - 1);
                 }
 
                 void markFragmentsAsUnsent(const FragmentNumberSet_t& unsentFragments)
                 {
-                    for(auto element : unsentFragments.set)
-                        unsent_fragments_.insert(element);
+                    unsentFragments.for_each([this](FragmentNumber_t element)
+                    {
+                        if (element != 0)
+                            unsent_fragments_.set(element - 1);
+                    });
                 }
 
                 private:
@@ -354,7 +369,7 @@ namespace eprosima
                 //const CacheChange_t* change_;
                 CacheChange_t* change_;
 
-                std::set<FragmentNumber_t> unsent_fragments_;
+                DynamicBitmap unsent_fragments_;
             };
 
             struct ChangeForReaderCmp
@@ -20,8 +20,8 @@
 #define RPTS_ELEM_FRAGNUM_H_
 #include "../../fastrtps_dll.h"
 #include "Types.h"
+#include "../../utils/Bitmap256.h"
 
-#include <set>
 #include <cmath>
 #include <algorithm>
 #include <sstream>
@@ -32,6 +32,7 @@ namespace rtps{
 typedef uint32_t FragmentNumber_t;
 
 //!Structure FragmentNumberSet_t, contains a group of fragmentnumbers.
+//!It is stored as the bitmap sent in the messages, so it holds up to 256 fragment numbers starting at base.
 //!@ingroup COMMON_MODULE
 class FragmentNumberSet_t
 {
@@ -40,40 +41,24 @@ class FragmentNumberSet_t
         //!Base fragment number
         FragmentNumber_t base;
 
+        FragmentNumberSet_t() : base(0) {}
+
         /**
-         * Assignment operator
-         * @param set2 FragmentNumberSet_t to copy the data from
+         * Constructor
+         * @param base_fn Base fragment number
          */
-        FragmentNumberSet_t& operator=(const FragmentNumberSet_t& set2)
-        {
-            base = set2.base;
-            set = set2.set;
-            return *this;
-        }
-
-        FragmentNumberSet_t(): base(0), set() {}
-
-        FragmentNumberSet_t(const std::set<FragmentNumber_t>& set2) : base(0)
-        {
-            set = set2;
-            auto min = set.begin();
-            if (min != set.end())
-                base = *min;
-        }
+        explicit FragmentNumberSet_t(FragmentNumber_t base_fn) : base(base_fn) {}
 
         /**
          * Compares object with other FragmentNumberSet_t.
          * @param other FragmentNumberSet_t to compare
          * @return True if equal
          */
-        bool operator==(const FragmentNumberSet_t& other) {
-
-            if (base != other.base)
-                return false;
-            return other.set == set;	
+        bool operator==(const FragmentNumberSet_t& other) const
+        {
+            return base == other.base && bitmap_ == other.bitmap_;
         }
 
-
         /**
          * Add a fragment number to the set
          * @param in FragmentNumberSet_t to add
@@ -81,11 +66,53 @@ class FragmentNumberSet_t
          */
         bool add(FragmentNumber_t in)
         {
-            if (in >= base && in <= base + 255)
-                set.insert(in);
-            else
+            return in >= base && bitmap_.set(in - base);
+        }
+
+        /**
+         * Add the fragment numbers in [from, to) to the set.
+         * Fragment numbers out of the range of the set are not added.
+         * @param from First fragment number to add
+         * @param to Fragment number after the last one to add
+         * @return True if all of them were added
+         */
+        bool add_range(FragmentNumber_t from, FragmentNumber_t to)
+        {
+            if(from >= to)
+            {
+                return true;
+            }
+
+            bool all_added = from >= base;
+            uint32_t first = all_added ? from - base : 0;
+            if(to <= base || first >= Bitmap256::NUM_BITS)
+            {
                 return false;
-            return true;
+            }
+
+            return bitmap_.set_range(first, to - base) && all_added;
+        }
+
+        /**
+         * Remove a fragment number from the set
+         * @param in Fragment number to remove
+         */
+        void remove(FragmentNumber_t in)
+        {
+            if(in >= base)
+            {
+                bitmap_.reset(in - base);
+            }
+        }
+
+        /**
+         * Check if a fragment number is in the set
+         * @param in Fragment number to check
+         * @return True if it is in the set
+         */
+        bool is_set(FragmentNumber_t in) const
+        {
+            return in >= base && bitmap_.test(in - base);
         }
 
         /**
@@ -94,70 +121,100 @@ class FragmentNumberSet_t
          */
         bool isSetEmpty() const
         {
-            return set.empty();
+            return bitmap_.empty();
         }
 
         /**
-         * Get the begin of the set
-         * @return Vector iterator pointing to the begin of the set
+         * Get the maximum fragment number in the set
+         * @return maximum fragment number in the set
          */
-        std::set<FragmentNumber_t>::const_iterator get_begin() const
+        FragmentNumber_t get_maxFragNum() const
         {
-            return set.begin();
+            return base + bitmap_.num_bits() - 1;
         }
 
         /**
-         * Get the end of the set
-         * @return Vector iterator pointing to the end of the set
+         * Get the number of FragmentNumbers in the set
+         * @return Size of the set
          */
-        std::set<FragmentNumber_t>::const_iterator get_end() const
+        size_t get_size() const
         {
-            return set.end();
+            return bitmap_.count();
         }
 
         /**
-         * Get the number of FragmentNumbers in the set
-         * @return Size of the set
+         * Call a functor with each fragment number in the set, in increasing order.
+         * @param f Functor receiving a FragmentNumber_t
+         */
+        template<class Functor>
+        void for_each(Functor f) const
+        {
+            FragmentNumber_t first = base;
+            bitmap_.for_each([first, &f](uint32_t offset)
+            {
+                f(first + offset);
+            });
+        }
+
+        //! Get the bitmap, with the layout used in the messages.
+        const Bitmap256& bitmap() const
+        {
+            return bitmap_;
+        }
+
+        /**
+         * Replace the fragment numbers in the set with a bitmap read from a message.
+         * @param num_bits Number of bits in the bitmap
+         * @param words Words of the bitmap
+         * @return False if the bitmap is bigger than 256 bits
          */
-        size_t get_size()
+        bool bitmap_set(uint32_t num_bits, const uint32_t* words)
         {
-            return set.size();
+            return bitmap_.assign(num_bits, words);
         }
 
         /**
          * Get a string representation of the set
          * @return string representation of the set
          */
-        std::string print()
+        std::string print() const
         {
             std::stringstream ss;
             ss << base << ":";
-            for (auto it = set.begin(); it != set.end(); ++it)
-                ss << *it << "-";
+            for_each([&ss](FragmentNumber_t it)
+            {
+                ss << it << "-";
+            });
             return ss.str();
         }
 
         FragmentNumberSet_t& operator-=(const FragmentNumberSet_t& rhs)
         {
-            for ( auto element : rhs.set)
-                set.erase(element);
+            rhs.for_each([this](FragmentNumber_t element)
+            {
+                remove(element);
+            });
             return *this;
         }
 
         FragmentNumberSet_t& operator-=(const FragmentNumber_t& fragment_number)
         {
-            set.erase(fragment_number);
+            remove(fragment_number);
             return *this;
         }
 
         FragmentNumberSet_t& operator+=(const FragmentNumberSet_t& rhs)
         {
-            for ( auto element : rhs.set )
+            rhs.for_each([this](FragmentNumber_t element)
+            {
                 add(element);
+            });
             return *this;
         }
 
-        std::set<FragmentNumber_t> set;
+    private:
+
+        Bitmap256 bitmap_;
 };
 
 /**
@@ -166,22 +223,18 @@ class FragmentNumberSet_t
  * @param sns SequenceNumber set
  * @return OStream.
  */
-inline std::ostream& operator<<(std::ostream& output, FragmentNumberSet_t& sns){
+inline std::ostream& operator<<(std::ostream& output, const FragmentNumberSet_t& sns){
     return output << sns.print();
 }
 
 inline FragmentNumberSet_t operator-(FragmentNumberSet_t lhs, const FragmentNumberSet_t& rhs)
 {
-    for ( auto element : rhs.set)
-        lhs.set.erase(element);
-    return lhs;
+    return lhs -= rhs;
 }
 
 inline FragmentNumberSet_t operator+(FragmentNumberSet_t lhs, const FragmentNumberSet_t& rhs)
 {
-    for ( auto element : rhs.set)
-        lhs.add(element);
-    return lhs;
+    return lhs += rhs;
 }
 
 }
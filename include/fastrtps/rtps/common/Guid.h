@@ -458,6 +458,58 @@ inline bool operator<(const GUID_t& g1, const GUID_t& g2){
 
 const GUID_t c_Guid_Unknown;
 
+/*!
+ * @brief Defines the STL hash function for type EntityId_t (FNV-1a).
+ */
+struct EntityIdHash
+{
+    std::size_t operator()(const EntityId_t& id) const
+    {
+        uint32_t hash = 2166136261u;
+        for(uint8_t i = 0; i < EntityId_t::size; ++i)
+        {
+            hash = (hash ^ id.value[i]) * 16777619u;
+        }
+        return static_cast<std::size_t>(hash);
+    };
+};
+
+/*!
+ * @brief Defines the STL hash function for type GuidPrefix_t (FNV-1a).
+ */
+struct GuidPrefixHash
+{
+    std::size_t operator()(const GuidPrefix_t& prefix) const
+    {
+        uint32_t hash = 2166136261u;
+        for(uint8_t i = 0; i < GuidPrefix_t::size; ++i)
+        {
+            hash = (hash ^ prefix.value[i]) * 16777619u;
+        }
+        return static_cast<std::size_t>(hash);
+    };
+};
+
+/*!
+ * @brief Defines the STL hash function for type GUID_t (FNV-1a).
+ */
+struct GUIDHash
+{
+    std::size_t operator()(const GUID_t& guid) const
+    {
+        uint32_t hash = 2166136261u;
+        for(uint8_t i = 0; i < GuidPrefix_t::size; ++i)
+        {
+            hash = (hash ^ guid.guidPrefix.value[i]) * 16777619u;
+        }
+        for(uint8_t i = 0; i < EntityId_t::size; ++i)
+        {
+            hash = (hash ^ guid.entityId.value[i]) * 16777619u;
+        }
+        return static_cast<std::size_t>(hash);
+    };
+};
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 /**
@@ -110,6 +110,23 @@ inline bool operator==(const InstanceHandle_t & ihandle1, const InstanceHandle_t
 }
 #endif
 
+/*!
+ * @brief Defines the STL hash function for type InstanceHandle_t.
+ * Keys shorter than the handle are padded with zeros, so all the bytes are mixed (FNV-1a).
+ */
+struct InstanceHandleHash
+{
+    std::size_t operator()(const InstanceHandle_t& ihandle) const
+    {
+        uint32_t hash = 2166136261u;
+        for(uint8_t i = 0; i < 16; ++i)
+        {
+            hash = (hash ^ ihandle.value[i]) * 16777619u;
+        }
+        return static_cast<std::size_t>(hash);
+    };
+};
+
 /**
 * Convert InstanceHandle_t to GUID
 * @param guid GUID to store the results
@@ -20,6 +20,7 @@
 #define RPTS_ELEM_SEQNUM_H_
 #include "../../fastrtps_dll.h"
 #include "Types.h"
+#include "../../utils/Bitmap256.h"
 
 #include <vector>
 #include <algorithm>
@@ -353,6 +354,7 @@ struct SequenceNumberHash
 #endif
 
 //!Structure SequenceNumberSet_t, contains a group of sequencenumbers.
+//!It is stored as the bitmap sent in the messages, so it holds up to 256 sequence numbers starting at base.
 //!@ingroup COMMON_MODULE
 class SequenceNumberSet_t
 {
@@ -360,15 +362,22 @@ class SequenceNumberSet_t
         //!Base sequence number
         SequenceNumber_t base;
 
+        SequenceNumberSet_t() : base(0, 0) {}
+
+        /**
+         * Constructor
+         * @param base_sn Base sequence number
+         */
+        explicit SequenceNumberSet_t(const SequenceNumber_t& base_sn) : base(base_sn) {}
+
         /**
-         * Assignment operator
-         * @param set2 SequenceNumberSet_t to copy the data from
+         * Compares object with other SequenceNumberSet_t.
+         * @param other SequenceNumberSet_t to compare
+         * @return True if equal
          */
-        SequenceNumberSet_t& operator=(const SequenceNumberSet_t& set2)
+        bool operator==(const SequenceNumberSet_t& other) const
         {
-            base = set2.base;
-            set = set2.set;
-            return *this;
+            return base == other.base && bitmap_ == other.bitmap_;
         }
 
         /**
@@ -378,13 +387,70 @@ class SequenceNumberSet_t
          */
         bool add(const SequenceNumber_t& in)
         {
-            SequenceNumber_t max = base + 255;
-            if(in >= base && in < max)
-                set.push_back(in);
-            else
+            uint32_t offset;
+            return get_offset(in, offset) && bitmap_.set(offset);
+        }
+
+        /**
+         * Add the sequence numbers in [from, to) to the set.
+         * Sequence numbers out of the range of the set are not added.
+         * @param from First sequence number to add
+         * @param to Sequence number after the last one to add
+         * @return True if all of them were added
+         */
+        bool add_range(const SequenceNumber_t& from, const SequenceNumber_t& to)
+        {
+            if(!(from < to))
+            {
+                return true;
+            }
+
+            // The range is clipped to the sequence numbers that fit in the set.
+            bool all_added = !(from < base);
+            SequenceNumber_t first = all_added ? from : base;
+            uint32_t first_offset;
+            if(!(first < to) || !get_offset(first, first_offset))
+            {
                 return false;
+            }
 
-            return true;
+            uint32_t last = Bitmap256::NUM_BITS;
+            SequenceNumber_t distance = to - base;
+            if(distance.high == 0 && distance.low <= Bitmap256::NUM_BITS)
+            {
+                last = distance.low;
+            }
+            else
+            {
+                all_added = false;
+            }
+
+            bitmap_.set_range(first_offset, last);
+            return all_added;
+        }
+
+        /**
+         * Remove a sequence number from the set
+         * @param in Sequence number to remove
+         */
+        void remove(const SequenceNumber_t& in)
+        {
+            uint32_t offset;
+            if(get_offset(in, offset))
+            {
+                bitmap_.reset(offset);
+            }
+        }
+
+        /**
+         * Check if a sequence number is in the set
+         * @param in Sequence number to check
+         * @return True if it is in the set
+         */
+        bool is_set(const SequenceNumber_t& in) const
+        {
+            uint32_t offset;
+            return get_offset(in, offset) && bitmap_.test(offset);
         }
 
         /**
@@ -393,7 +459,18 @@ class SequenceNumberSet_t
          */
         SequenceNumber_t get_maxSeqNum() const
         {
-            return *std::max_element(set.begin(),set.end(),sort_seqNum);
+            assert(!bitmap_.empty());
+            return base + (bitmap_.num_bits() - 1);
+        }
+
+        /**
+         * Get the minimum sequence number in the set
+         * @return minimum sequence number in the set
+         */
+        SequenceNumber_t get_minSeqNum() const
+        {
+            assert(!bitmap_.empty());
+            return base + bitmap_.find_first();
         }
 
         /**
@@ -402,50 +479,54 @@ class SequenceNumberSet_t
          */
         bool isSetEmpty() const
         {
-            return set.empty();
+            return bitmap_.empty();
         }
 
         /**
-         * Get the begin of the set
-         * @return Vector iterator pointing to the begin of the set
+         * Get the number of SequenceNumbers in the set
+         * @return Size of the set
          */
-        std::vector<SequenceNumber_t>::const_iterator get_begin() const
+        size_t get_size() const
         {
-            return set.begin();
+            return bitmap_.count();
         }
 
         /**
-         * Get the end of the set
-         * @return Vector iterator pointing to the end of the set
+         * Call a functor with each sequence number in the set, in increasing order.
+         * @param f Functor receiving a const SequenceNumber_t&
          */
-        std::vector<SequenceNumber_t>::const_iterator get_end() const
+        template<class Functor>
+        void for_each(Functor f) const
         {
-            return set.end();
+            const SequenceNumber_t& first = base;
+            bitmap_.for_each([&first, &f](uint32_t offset)
+            {
+                f(first + offset);
+            });
         }
 
-        /**
-         * Get the number of SequenceNumbers in the set
-         * @return Size of the set
-         */
-        size_t get_size()
+        //! Get the bitmap, with the layout used in the messages.
+        const Bitmap256& bitmap() const
         {
-            return set.size();
+            return bitmap_;
         }
 
         /**
-         * Get the set of SequenceNumbers 
-         * @return Set of SequenceNumbers
+         * Replace the sequence numbers in the set with a bitmap read from a message.
+         * @param num_bits Number of bits in the bitmap
+         * @param words Words of the bitmap
+         * @return False if the bitmap is bigger than 256 bits
          */
-        std::vector<SequenceNumber_t> get_set() const
+        bool bitmap_set(uint32_t num_bits, const uint32_t* words)
         {
-            return set;
+            return bitmap_.assign(num_bits, words);
         }
 
         /**
          * Get a string representation of the set
          * @return string representation of the set
          */
-        std::string print()
+        std::string print() const
         {
             std::stringstream ss;
 
@@ -454,19 +535,38 @@ class SequenceNumberSet_t
 #else
             ss << "{high: " << base.high << ", low: " << base.low << "} :";
 #endif
-            for(std::vector<SequenceNumber_t>::iterator it = set.begin(); it != set.end(); ++it)
+            for_each([&ss](const SequenceNumber_t& it)
             {
 #ifdef LLONG_MAX
-                ss << it->to64long() << "-";
+                ss << it.to64long() << "-";
 #else
-                ss << "{high: " << it->high << ", low: " << it->low << "} -";
+                ss << "{high: " << it.high << ", low: " << it.low << "} -";
 #endif
-            }
+            });
             return ss.str();
         }
 
     private:
-        std::vector<SequenceNumber_t> set;
+
+        //! Get the position of a sequence number in the bitmap.
+        bool get_offset(const SequenceNumber_t& in, uint32_t& offset) const
+        {
+            if(in < base)
+            {
+                return false;
+            }
+
+            SequenceNumber_t distance = in - base;
+            if(distance.high != 0 || distance.low >= Bitmap256::NUM_BITS)
+            {
+                return false;
+            }
+
+            offset = distance.low;
+            return true;
+        }
+
+        Bitmap256 bitmap_;
 };
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
@@ -477,7 +577,7 @@ class SequenceNumberSet_t
  * @param sns SequenceNumber set
  * @return OStream.
  */
-inline std::ostream& operator<<(std::ostream& output, SequenceNumberSet_t& sns)
+inline std::ostream& operator<<(std::ostream& output, const SequenceNumberSet_t& sns)
 {
     return output << sns.print();
 }
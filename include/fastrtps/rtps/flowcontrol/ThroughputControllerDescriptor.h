@@ -22,6 +22,14 @@ namespace eprosima{
 namespace fastrtps{
 namespace rtps{
 
+/**
+ * Enum ThroughputControllerKind_t, algorithm used by a Throughput Controller.
+ */
+typedef enum ThroughputControllerKind{
+    PERIODIC_THROUGHPUT_CONTROLLER, //!< Each sent payload is restored 'periodMillisecs' after it was sent.
+    TOKEN_BUCKET_THROUGHPUT_CONTROLLER //!< Token bucket refilled at 'bytesPerPeriod' every 'periodMillisecs', up to 'burstBytes'.
+}ThroughputControllerKind_t;
+
 /**
  * Descriptor for a Throughput Controller, containing all constructor information
  * for it.
@@ -33,14 +41,25 @@ struct ThroughputControllerDescriptor
     uint32_t bytesPerPeriod;
     //! Window of time in which no more than 'bytesPerPeriod' bytes are allowed.
     uint32_t periodMillisecs;
+    //! Algorithm of the controller. PERIODIC_THROUGHPUT_CONTROLLER by default.
+    ThroughputControllerKind_t kind;
+    //! Token bucket only. Capacity of the bucket in bytes. 0 means 'bytesPerPeriod'.
+    uint32_t burstBytes;
+    //! Token bucket only. Granularity in ms with which the bucket is refilled. 0 means 1 ms.
+    uint32_t refillMillisecs;
 
     RTPS_DllAPI ThroughputControllerDescriptor();
     RTPS_DllAPI ThroughputControllerDescriptor(uint32_t size, uint32_t time);
+    RTPS_DllAPI ThroughputControllerDescriptor(uint32_t size, uint32_t time, ThroughputControllerKind_t controllerKind,
+            uint32_t burst = 0, uint32_t refill = 1);
 
     bool operator==(const ThroughputControllerDescriptor& b) const
     {
         return (this->bytesPerPeriod == b.bytesPerPeriod) &&
-               (this->periodMillisecs == b.periodMillisecs);
+               (this->periodMillisecs == b.periodMillisecs) &&
+               (this->kind == b.kind) &&
+               (this->burstBytes == b.burstBytes) &&
+               (this->refillMillisecs == b.refillMillisecs);
     }
 };
 
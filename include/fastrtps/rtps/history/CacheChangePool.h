@@ -29,6 +29,7 @@
 #include <cstdint>
 #include <cstddef>
 #include <mutex>
+#include <atomic>
 
 
 namespace eprosima {
@@ -36,12 +37,14 @@ namespace fastrtps{
 namespace rtps {
 
 struct CacheChange_t;
+class SizeClassFreeList;
 
 /**
  * Class CacheChangePool, used by the HistoryCache to pre-reserve a number of CacheChange_t to avoid dynamically reserving memory in the middle of execution loops.
  * @ingroup COMMON_MODULE
  */
 class CacheChangePool {
+    friend class CacheChangePoolSizeClassTests;
     public:
         virtual ~CacheChangePool();
         /**
@@ -57,8 +60,8 @@ class CacheChangePool {
          * @brief Reserves a CacheChange from the pool.
          * @param chan Returned pointer to the reserved CacheChange.
          * @param calculateSizeFunc Function that returns the size of the data which will go into the CacheChange.
-         * This function is executed depending on the memory management policy (DYNAMIC_RESERVE_MEMORY_MODE and
-         * PREALLOCATED_WITH_REALLOC_MEMORY_MODE)
+         * This function is executed depending on the memory management policy (DYNAMIC_RESERVE_MEMORY_MODE,
+         * PREALLOCATED_WITH_REALLOC_MEMORY_MODE and POOLED_SIZE_CLASS_MEMORY_MODE)
          * @return True whether the CacheChange could be allocated. In other case returns false.
          */
         bool reserve_Cache(CacheChange_t** chan, const std::function<uint32_t()>& calculateSizeFunc);
@@ -67,7 +70,8 @@ class CacheChangePool {
          * @brief Reserves a CacheChange from the pool.
          * @param chan Returned pointer to the reserved CacheChange.
          * @param dataSize Size of the data which will go into the CacheChange if it is necessary (on memory management
-         * policy DYNAMIC_RESERVE_MEMORY_MODE and PREALLOCATED_WITH_REALLOC_MEMORY_MODE). In other case this variable is not used.
+         * policy DYNAMIC_RESERVE_MEMORY_MODE, PREALLOCATED_WITH_REALLOC_MEMORY_MODE and POOLED_SIZE_CLASS_MEMORY_MODE).
+         * In other case this variable is not used.
          * @return True whether the CacheChange could be allocated. In other case returns false.
          */
         bool reserve_Cache(CacheChange_t** chan, uint32_t dataSize);
@@ -91,6 +95,19 @@ class CacheChangePool {
         CacheChange_t* allocateSingle(uint32_t dataSize);
         std::mutex mp_mutex;
         MemoryManagementPolicy_t memoryMode;
+
+        //!Smallest size class in POOLED_SIZE_CLASS_MEMORY_MODE is 2^min_size_class_bits bytes.
+        static const uint32_t min_size_class_bits = 6;
+        //!Number of size classes in POOLED_SIZE_CLASS_MEMORY_MODE.
+        static const uint32_t size_class_count = 26;
+        //!Free changes of each size class, created on first use.
+        std::atomic<SizeClassFreeList*> m_sizeClasses[size_class_count];
+        //!Capacity of the free list of each size class.
+        uint32_t m_sizeClassCapacity;
+        SizeClassFreeList* getSizeClass(uint32_t index);
+        CacheChange_t* reserveSized(uint32_t dataSize);
+        CacheChange_t* allocateSized(uint32_t index, uint32_t dataSize);
+        void releaseSized(CacheChange_t* ch);
 };
 }
 } /* namespace rtps */
@@ -67,6 +67,14 @@ public:
      */
     RTPS_DllAPI bool remove_change(CacheChange_t* a_change);
 
+    /**
+     * Remove a CacheChange_t from the ReaderHistory without giving it back to the pool.
+     * The caller has to release it with release_Cache.
+     * @param a_change Pointer to the CacheChange to remove.
+     * @return True if removed.
+     */
+    RTPS_DllAPI bool detach_change(CacheChange_t* a_change);
+
     /**
      * Remove all changes from the History that have a certain guid.
      * @param a_guid Pointer to the target guid to search for.
@@ -88,6 +88,16 @@ class WriterHistory : public History
     RTPS_DllAPI SequenceNumber_t next_sequence_number() const { return m_lastCacheChangeSeqNum + 1; }
 
     protected:
+
+    /**
+     * Add a CacheChange_t to the WriterHistory without delivering it to the readers of this process.
+     * The caller delivers it with RTPSWriter::deliver_to_local_readers once the writer mutex is released.
+     * @param a_change Pointer to the CacheChange_t to be added.
+     * @param wparams Extra write parameters.
+     * @return True if added.
+     */
+    bool add_change_(CacheChange_t* a_change, WriteParams &wparams);
+
     //!Last CacheChange Sequence Number added to the History.
     SequenceNumber_t m_lastCacheChangeSeqNum;
     //!Pointer to the associated RTPSWriter;
@@ -159,24 +159,17 @@ inline bool CDRMessage::readSequenceNumberSet(CDRMessage_t* msg,SequenceNumberSe
     valid &=CDRMessage::readSequenceNumber(msg,&sns->base);
     uint32_t numBits = 0;
     valid &=CDRMessage::readUInt32(msg,&numBits);
-    int32_t bitmap;
-    SequenceNumber_t seqNum;
+    if(!valid || numBits > Bitmap256::NUM_BITS)
+    {
+        return false;
+    }
+
+    uint32_t bitmap[Bitmap256::NUM_WORDS];
     for(uint32_t i=0;i<(numBits+31)/32;++i)
     {
-        valid &= CDRMessage::readInt32(msg,&bitmap);
-        for(uint8_t bit=0;bit<32;++bit)
-        {
-            if((bitmap & (1<<(31-bit%32)))==(1<<(31-bit%32)))
-            {
-                seqNum = sns->base+(i*32+bit);
-                if(!sns->add(seqNum))
-                {
-                    return false;
-                }
-            }
-        }
+        valid &= CDRMessage::readUInt32(msg,&bitmap[i]);
     }
-    return valid;
+    return valid && sns->bitmap_set(numBits, bitmap);
 }
 
 inline bool CDRMessage::readFragmentNumberSet(CDRMessage_t* msg, FragmentNumberSet_t* fns)
@@ -185,24 +178,17 @@ inline bool CDRMessage::readFragmentNumberSet(CDRMessage_t* msg, FragmentNumberS
     valid &= CDRMessage::readUInt32(msg, &fns->base);
     uint32_t numBits = 0;
     valid &= CDRMessage::readUInt32(msg, &numBits);
-    int32_t bitmap;
-    FragmentNumber_t fragNum;
+    if(!valid || numBits > Bitmap256::NUM_BITS)
+    {
+        return false;
+    }
+
+    uint32_t bitmap[Bitmap256::NUM_WORDS];
     for (uint32_t i = 0; i<(numBits + 31) / 32; ++i)
     {
-        valid &= CDRMessage::readInt32(msg, &bitmap);
-        for (uint8_t bit = 0; bit<32; ++bit)
-        {
-            if ((bitmap & (1 << (31 - bit % 32))) == (1 << (31 - bit % 32)))
-            {
-                fragNum = fns->base + (i * 32 + bit);
-                if (!fns->add(fragNum))
-                {
-                    return false;
-                }
-            }
-        }
+        valid &= CDRMessage::readUInt32(msg, &bitmap[i]);
     }
-    return valid;
+    return valid && fns->bitmap_set(numBits, bitmap);
 }
 
 inline bool CDRMessage::readTimestamp(CDRMessage_t* msg, Time_t* ts)
@@ -300,11 +286,7 @@ inline bool CDRMessage::readString(CDRMessage_t*msg, std::string* stri)
     stri->clear();
     if(str_size>1)
     {
-        stri->resize(str_size-1);
-        for (uint32_t i = 0; i < str_size - 1; i++)
-        {
-            stri->at(i) = msg->buffer[msg->pos + i];
-        }
+        stri->assign(reinterpret_cast<const char*>(&msg->buffer[msg->pos]), str_size - 1);
     }
     msg->pos += str_size;
     int rest = (str_size) % 4;
@@ -528,47 +510,18 @@ inline bool CDRMessage::addSequenceNumberSet(CDRMessage_t* msg,
     CDRMessage::addSequenceNumber(msg, &sns->base);
 
     //Add set
-    if(sns->isSetEmpty())
-    {
-        addUInt32(msg,0); //numbits 0
-        return true;
-    }
-
-    SequenceNumber_t maxseqNum = sns->get_maxSeqNum();
-
-    uint32_t numBits = (maxseqNum - sns->base + 1).low;
-    assert((maxseqNum - sns->base + 1).high == 0);
-
-    if(numBits >= 256)
-        numBits = 255;
-
-    addUInt32(msg, numBits);
-    uint8_t n_longs = (uint8_t)((numBits + 31) / 32);
-    uint32_t bitmap[8];
+    const Bitmap256& bitmap = sns->bitmap();
+    addUInt32(msg, bitmap.num_bits());
 
-    for(uint32_t i = 0; i < n_longs; i++)
-        bitmap[i] = 0;
-
-    uint32_t deltaN = 0;
-    for(auto it = sns->get_begin();
-            it != sns->get_end(); ++it)
-    {
-        deltaN = (*it - sns->base).low;
-        assert((*it - sns->base).high == 0);
-        if(deltaN < 256)
-            bitmap[(uint32_t)(deltaN/32)] = (bitmap[(uint32_t)(deltaN/32)] | (1<<(31-deltaN%32)));
-        else
-            break;
-    }
-
-    for(uint32_t i= 0;i<n_longs;i++)
-        addInt32(msg,bitmap[i]);
+    const uint32_t* words = bitmap.words();
+    for(uint32_t i = 0; i < bitmap.num_words(); i++)
+        addUInt32(msg, words[i]);
 
     return true;
 }
 
 inline bool CDRMessage::addFragmentNumberSet(CDRMessage_t* msg,
-        FragmentNumberSet_t* fns) {
+        const FragmentNumberSet_t* fns) {
 
     if (fns->base == 0)
         return false;
@@ -576,39 +529,12 @@ inline bool CDRMessage::addFragmentNumberSet(CDRMessage_t* msg,
     CDRMessage::addUInt32(msg, fns->base);
 
     //Add set
-    if (fns->isSetEmpty())
-    {
-        addUInt32(msg, 0); //numbits 0
-        return true;
-    }
-
-    FragmentNumber_t maxfragNum = *(std::prev(fns->set.end()));
-
-    uint32_t numBits = (uint32_t)(maxfragNum - fns->base + 1);
-
-    if (numBits > 256)
-        return false;
-
-    addUInt32(msg, numBits);
-    uint8_t n_longs = (uint8_t)((numBits + 31) / 32);
-    int32_t* bitmap = new int32_t[n_longs];
-
-    for (uint32_t i = 0; i<n_longs; i++)
-        bitmap[i] = 0;
-
-    uint32_t deltaN = 0;
-
-    for (auto it = fns->get_begin();
-            it != fns->get_end(); ++it)
-    {
-        deltaN = (uint32_t)(*it - fns->base);
-        bitmap[(uint32_t)(deltaN / 32)] = (bitmap[(uint32_t)(deltaN / 32)] | (1 << (31 - deltaN % 32)));
-    }
-
-    for (uint32_t i = 0; i<n_longs; i++)
-        addInt32(msg, bitmap[i]);
+    const Bitmap256& bitmap = fns->bitmap();
+    addUInt32(msg, bitmap.num_bits());
 
-    delete[] bitmap;
+    const uint32_t* words = bitmap.words();
+    for (uint32_t i = 0; i < bitmap.num_words(); i++)
+        addUInt32(msg, words[i]);
 
     return true;
 }
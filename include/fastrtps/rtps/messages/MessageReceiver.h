@@ -25,6 +25,9 @@
 #include "../../qos/ParameterList.h"
 #include <fastrtps/rtps/writer/StatelessWriter.h>
 #include <fastrtps/rtps/writer/StatefulWriter.h>
+#include "ReaderRoutes.h"
+
+#include <unordered_map>
 
 
 namespace eprosima {
@@ -79,6 +82,10 @@ class MessageReceiver
     private:
         std::vector<RTPSWriter *> AssociatedWriters;
         std::vector<RTPSReader *> AssociatedReaders;
+        //!Associated writers indexed by GUID.
+        std::unordered_map<GUID_t, RTPSWriter*, GUIDHash> WritersByGuid;
+        //!Routes from the received submessages to the associated readers.
+        ReaderRoutes AssociatedReaderRoutes;
         std::mutex mtx;
         //!Protocol version of the message
         ProtocolVersion_t sourceVersion;
@@ -142,6 +149,14 @@ class MessageReceiver
         bool proc_Submsg_SecureMessage(CDRMessage_t*msg, SubmessageHeader_t* smh);
         bool proc_Submsg_SecureSubMessage(CDRMessage_t*msg, SubmessageHeader_t* smh);
 
+        /**
+         * Get the readers that have to process a submessage. Must be called with mtx locked.
+         * @param readerID Entity id of the reader the submessage is directed to.
+         * @param writerGUID GUID of the writer that sent the submessage.
+         * @return Readers that have to process the submessage.
+         */
+        const std::vector<RTPSReader*>& destinationReaders(const EntityId_t& readerID, const GUID_t& writerGUID);
+
         RTPSParticipantImpl* participant_;
 };
 }
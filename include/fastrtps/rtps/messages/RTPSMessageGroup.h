@@ -25,6 +25,7 @@
 #include "../../qos/ParameterList.h"
 #include <fastrtps/rtps/common/FragmentNumber.h>
 
+#include <set>
 #include <vector>
 #include <cassert>
 
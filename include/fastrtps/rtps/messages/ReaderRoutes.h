@@ -0,0 +1,96 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderRoutes.h
+ *
+ */
+
+#ifndef READERROUTES_H_
+#define READERROUTES_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "../common/Guid.h"
+
+namespace eprosima {
+namespace fastrtps{
+namespace rtps {
+
+class RTPSReader;
+
+/**
+ * Class ReaderRoutes, that finds the readers of a MessageReceiver that have to process a submessage.
+ * Submessages directed to a specific reader are routed by its entity id. The rest are routed to the readers
+ * accepting the writer, which are computed once per writer and kept until the reader matching generation of
+ * the participant changes.
+ * It is not thread safe, the mutex of the MessageReceiver protects it.
+ * @ingroup MANAGEMENT_MODULE
+ */
+class ReaderRoutes
+{
+    public:
+
+        ReaderRoutes();
+
+        /**
+         * Add a reader to the routes.
+         * @param reader Pointer to the RTPSReader.
+         */
+        void addReader(RTPSReader* reader);
+
+        /**
+         * Remove a reader from the routes.
+         * @param reader Pointer to the RTPSReader.
+         */
+        void removeReader(RTPSReader* reader);
+
+        /**
+         * Tells us if some reader may process a submessage directed to a reader.
+         * @param readerID Entity id of the reader the submessage is directed to.
+         * @return True if there is a reader with that entity id, or any reader accepting submessages directed to
+         * an unknown reader when readerID is unknown.
+         */
+        bool hasReaders(const EntityId_t& readerID) const;
+
+        /**
+         * Get the readers that have to process a submessage.
+         * @param readerID Entity id of the reader the submessage is directed to.
+         * @param writerGUID GUID of the writer that sent the submessage.
+         * @param generation Current reader matching generation of the participant.
+         * @return Readers that have to process the submessage. Valid until the routes are modified.
+         */
+        const std::vector<RTPSReader*>& destinationReaders(const EntityId_t& readerID, const GUID_t& writerGUID,
+                uint32_t generation);
+
+    private:
+
+        //!Readers indexed by entity id, for submessages directed to a specific reader.
+        std::unordered_map<EntityId_t, std::vector<RTPSReader*>, EntityIdHash> m_readersByEntityId;
+        //!Readers accepting submessages directed to an unknown reader.
+        std::vector<RTPSReader*> m_readersAcceptingUnknown;
+        //!Readers of m_readersAcceptingUnknown that accept the submessages of each writer. Filled on demand.
+        std::unordered_map<GUID_t, std::vector<RTPSReader*>, GUIDHash> m_readersByWriter;
+        //!Reader matching generation of the participant when m_readersByWriter was filled.
+        uint32_t m_readersByWriterGeneration;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif
+#endif /* READERROUTES_H_ */
@@ -15,9 +15,11 @@
 #ifndef RECEIVER_RESOURCE_H
 #define RECEIVER_RESOURCE_H
 
+#include <condition_variable>
 #include <functional>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include "../messages/MessageReceiver.h"
 #include "../../transport/TransportInterface.h"
 
@@ -25,6 +27,8 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class ReceivePipeline;
+
 /**
  * RAII object that encapsulates the Receive operation over one channel in an unknown transport.
  * A Receiver resource is always univocally associated to a transport channel; the
@@ -64,10 +68,19 @@ public:
 
     /**
     * Unregister a MessageReceiver object to be called upon reception of data.
+    * Waits for the datagrams being handed to the receive pipeline, if any.
     * @param receiver The message receiver to unregister.
     */
     void UnregisterReceiver(MessageReceiver* receiver);
 
+    /**
+    * Hands the received data to a receive pipeline instead of processing it on the receiving thread.
+    * The pipeline is detached together with the registered MessageReceiver.
+    * @param pipeline The receive pipeline.
+    * @param receivers Message receivers to be used by the workers of the pipeline, one per worker.
+    */
+    void RegisterPipeline(ReceivePipeline* pipeline, MessageReceiver* const* receivers);
+
     /**
      * Resources can only be transfered through move semantics. Copy, assignment, and
      * construction outside of the factory are forbidden.
@@ -87,6 +100,11 @@ private:
 
     std::mutex mtx;
     MessageReceiver* receiver;
+    ReceivePipeline* pipeline;
+    MessageReceiver* const* pipeline_receivers;
+    //! Number of datagrams being pushed to the pipeline without holding mtx.
+    uint32_t pipeline_pushes;
+    std::condition_variable pipeline_pushes_done;
     CDRMessage_t msg;
 };
 
@@ -52,6 +52,16 @@ public:
     */
    bool Send(const octet* data, uint32_t dataLength, const Locator_t& destinationLocator);
 
+   /**
+    * Sends to several destination locators, through the channel managed by this resource.
+    * The transport may hand all the datagrams to the system in a single call.
+    * @param data Raw data slice to be sent.
+    * @param dataLength Length of the data to be sent.
+    * @param destinationLocators Locators describing the destination endpoints.
+    * @return Success of the send operation for at least one destination.
+    */
+   bool Send(const octet* data, uint32_t dataLength, const LocatorList_t& destinationLocators);
+
    /**
    * Reports whether this resource supports the given local locator (i.e., said locator
    * maps to the transport channel managed by this resource).
@@ -87,6 +97,7 @@ private:
    std::function<void()> Cleanup;
    std::function<bool(const Locator_t&)> AddSenderLocatorToManagedChannel;
    std::function<bool(const octet*, uint32_t, const Locator_t&, ChannelResource*)> SendThroughAssociatedChannel;
+   std::function<bool(const octet*, uint32_t, const LocatorList_t&)> SendBatchThroughAssociatedChannel;
    std::function<bool(const Locator_t&)> LocatorMapsToManagedChannel;
    std::function<bool(const Locator_t&)> ManagedChannelMapsToRemote;
    bool mValid; // Post-construction validity check for the NetworkFactory
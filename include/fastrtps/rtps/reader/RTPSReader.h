@@ -79,6 +79,16 @@ namespace eprosima
                  */
                 RTPS_DllAPI virtual bool matched_writer_is_matched(const RemoteWriterAttributes& wdata) = 0;
 
+                /**
+                 * Tells us if the messages sent by a writer are accepted by this reader.
+                 * The MessageReceiver uses it to find the readers interested in messages not directed to a
+                 * specific reader. The default implementation accepts every writer, leaving the filtering to the
+                 * process methods.
+                 * @param writerGUID GUID of the writer.
+                 * @return True if they are accepted.
+                 */
+                RTPS_DllAPI virtual bool acceptMsgFromWriter(const GUID_t& writerGUID);
+
                 /**
                  * Returns true if the reader accepts a message directed to entityId.
                  */
@@ -112,6 +122,15 @@ namespace eprosima
 
                 RTPS_DllAPI virtual bool processGapMsg(GUID_t &writerGUID, SequenceNumber_t &gapStart, SequenceNumberSet_t &gapList) = 0;
 
+                /**
+                 * Fills the state a writer of this process would receive in an ACKNACK message.
+                 * Used by the writers delivering data to this reader without the transports.
+                 * @param writerGUID GUID of the writer.
+                 * @param sns Set filled with the first change not received yet and the missing changes.
+                 * @return false if the reader does not acknowledge the changes of the writer.
+                 */
+                virtual bool intraprocess_acknack(const GUID_t& writerGUID, SequenceNumberSet_t& sns);
+
                 /**
                  * Method to indicate the reader that some change has been removed due to HistoryQos requirements.
                  * @param change Pointer to the CacheChange_t.
@@ -190,11 +209,7 @@ namespace eprosima
                 virtual bool isInCleanState() const = 0;
 
                 protected:
-                void setTrustedWriter(EntityId_t writer)
-                {
-                    m_acceptMessagesFromUnkownWriters=false;
-                    m_trustedWriterEntityId = writer;
-                }
+                void setTrustedWriter(EntityId_t writer);
 
                 /*!
                  * @brief Add a remote writer to the persistence_guid map
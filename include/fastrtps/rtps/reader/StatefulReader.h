@@ -22,6 +22,7 @@
 
 #include "RTPSReader.h"
 #include <mutex>
+#include <unordered_map>
 
 namespace eprosima {
 namespace fastrtps{
@@ -72,6 +73,12 @@ class StatefulReader:public RTPSReader
          * @return True if it is matched.
          */
         bool matched_writer_is_matched(const RemoteWriterAttributes& wdata);
+        /**
+         * Tells us if the messages of a writer are accepted, that is, if the writer is matched.
+         * @param writerGUID GUID of the writer.
+         * @return True if it is matched.
+         */
+        bool acceptMsgFromWriter(const GUID_t& writerGUID);
         /**
          * Look for a specific WriterProxy.
          * @param writerGUID GUID_t of the writer we are looking for.
@@ -106,6 +113,8 @@ class StatefulReader:public RTPSReader
 
         bool processGapMsg(GUID_t &writerGUID, SequenceNumber_t &gapStart, SequenceNumberSet_t &gapList);
 
+        bool intraprocess_acknack(const GUID_t& writerGUID, SequenceNumberSet_t& sns) override;
+
         /**
          * Method to indicate the reader that some change has been removed due to HistoryQos requirements.
          * @param change Pointer to the CacheChange_t.
@@ -193,6 +202,8 @@ class StatefulReader:public RTPSReader
         ReaderTimes m_times;
         //! Vector containing pointers to the matched writers.
         std::vector<WriterProxy*> matched_writers;
+        //! Matched writers indexed by GUID, so incoming messages find their WriterProxy in constant time.
+        std::unordered_map<GUID_t, WriterProxy*, GUIDHash> matched_writers_index;
 };
 
 }
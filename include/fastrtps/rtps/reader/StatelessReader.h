@@ -25,6 +25,7 @@
 
 #include <mutex>
 #include <map>
+#include <unordered_set>
 
 namespace eprosima {
 namespace fastrtps{
@@ -64,6 +65,13 @@ public:
      */
     bool matched_writer_is_matched(const RemoteWriterAttributes& wdata);
 
+    /**
+     * Tells us if the messages of a writer are accepted.
+     * @param writerGUID GUID of the writer.
+     * @return True if they are accepted.
+     */
+    bool acceptMsgFromWriter(const GUID_t& writerGUID);
+
     /**
      * Method to indicate the reader that some change has been removed due to HistoryQos requirements.
      * @param change Pointer to the CacheChange_t.
@@ -146,6 +154,8 @@ private:
     //!List of GUID_t os matched writers.
     //!Is only used in the Discovery, to correctly notify the user using SubscriptionListener::onSubscriptionMatched();
     std::vector<RemoteWriterAttributes> m_matched_writers;
+    //!GUIDs of the matched writers, so incoming messages are checked in constant time.
+    std::unordered_set<GUID_t, GUIDHash> m_matched_writers_index;
 };
 
 }
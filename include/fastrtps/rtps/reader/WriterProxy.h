@@ -25,9 +25,9 @@
 #include "../common/Types.h"
 #include "../common/Locator.h"
 #include "../common/CacheChange.h"
+#include "../common/SequenceNumber.h"
 #include "../attributes/ReaderAttributes.h"
-
-#include<set>
+#include "../../utils/RingBuffer.h"
 
 // Testing purpose
 #ifndef TEST_FRIENDS
@@ -110,10 +110,11 @@ namespace eprosima
                     bool areThereMissing();
 
                     /**
-                     * The method returns a vector containing all missing changes.
-                     * @return Vector of missing changes..
+                     * Fills a set with the missing changes, using as base the first change not available.
+                     * Missing changes out of the range of the set are not included.
+                     * @param[out] sns Set of missing changes.
                      */
-                    const std::vector<ChangeFromWriter_t>  missing_changes();
+                    void missing_changes(SequenceNumberSet_t& sns);
 
                     size_t unknown_missing_changes_up_to(const SequenceNumber_t& seqNum);
 
@@ -193,20 +194,30 @@ namespace eprosima
                     //!Mutex Pointer
                     std::recursive_mutex* mp_mutex;
 
-                    //!Vector containing the ChangeFromWriter_t objects.
-                    std::set<ChangeFromWriter_t, ChangeFromWriterCmp> m_changesFromW;
+                    /*!
+                     * Window of the changes after changesFromWLowMark_, one per sequence number without gaps,
+                     * so the change of a sequence number is found by its distance to the low mark.
+                     */
+                    RingBuffer<ChangeFromWriter_t> m_changesFromW;
                     SequenceNumber_t changesFromWLowMark_;
 
                     //! Store last ChacheChange_t notified.
                     SequenceNumber_t lastNotified_;
 
-                    void for_each_set_status_from(decltype(m_changesFromW)::iterator first,
-                            decltype(m_changesFromW)::iterator last,
+                    /*!
+                     * @brief Looks for the change of a sequence number in m_changesFromW.
+                     * @return Iterator to the change, or m_changesFromW.end() if it is not in the window.
+                     * @remarks No thread-safe.
+                     */
+                    RingBuffer<ChangeFromWriter_t>::iterator find_change(const SequenceNumber_t& seq_num);
+
+                    void for_each_set_status_from(RingBuffer<ChangeFromWriter_t>::iterator first,
+                            RingBuffer<ChangeFromWriter_t>::iterator last,
                             ChangeFromWriterStatus_t status,
                             ChangeFromWriterStatus_t new_status);
 
-                    void for_each_set_status_from_and_maybe_remove(decltype(m_changesFromW)::iterator first,
-                            decltype(m_changesFromW)::iterator last,
+                    void for_each_set_status_from_and_maybe_remove(RingBuffer<ChangeFromWriter_t>::iterator first,
+                            RingBuffer<ChangeFromWriter_t>::iterator last,
                             ChangeFromWriterStatus_t status,
                             ChangeFromWriterStatus_t orstatus,
                             ChangeFromWriterStatus_t new_status);
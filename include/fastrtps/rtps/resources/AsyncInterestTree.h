@@ -23,6 +23,11 @@ namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
+/**
+ * Set of writers interested in an asynchronous write, double buffered.
+ * @deprecated It is no longer used by AsyncWriterThread, that wakes up the writers through their scheduler.
+ * It is kept for compatibility and will be removed in a future version.
+ */
 class AsyncInterestTree
 {
 public:
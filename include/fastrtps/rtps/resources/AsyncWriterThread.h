@@ -19,32 +19,27 @@
 #ifndef _RTPS_RESOURCES_ASYNCWRITERTHREAD_H_
 #define _RTPS_RESOURCES_ASYNCWRITERTHREAD_H_
 
-#include <thread>
-#include <atomic>
-#include <mutex>
-#include <condition_variable>
-#include <list>
-
-#include <fastrtps/rtps/resources/AsyncInterestTree.h>
-
 namespace eprosima{
 namespace fastrtps{
 namespace rtps{
 class RTPSWriter;
+class RTPSParticipantImpl;
 
 /**
- * @brief This static class owns a thread that manages asynchronous writes.
+ * @brief This static class dispatches the asynchronous writes to the threads that manage them.
  * Asynchronous writes happen directly (when using an async writer) and
  * indirectly (when responding to a NACK).
+ * Writers of a participant with asyncWriterThreads set are sent by the threads of that participant.
+ * The rest of the writers share a single thread.
  * @ingroup COMMON_MODULE
  */
 class AsyncWriterThread
 {
 public:
     /**
-     * @brief Adds a writer to be managed by this thread.
-     * Only asynchronous writers are permitted.
-     * @param writer Asynchronous writer to be added. 
+     * @brief Adds a writer to be managed by the threads of its participant, or by the shared thread.
+     * Its priority is taken from the property "fastrtps.async_writer.priority" of the writer. Default is 0.
+     * @param writer Writer to be added.
      * @return Result of the operation.
      */
     static bool addWriter(RTPSWriter& writer);
@@ -57,14 +52,14 @@ public:
     static bool removeWriter(RTPSWriter& writer);
 
     /**
-     * Wakes the thread up.
+     * Wakes up the writers of a participant.
      * @param interestedParticipant The participant interested in an async write.
      */
     static void wakeUp(const RTPSParticipantImpl* interestedParticipant);
 
     /**
-     * Wakes the thread up.
-     * @param interestedParticipant The writer interested in an async write.
+     * Wakes up a writer. It does not block if the writer was already woken up.
+     * @param interestedWriter The writer interested in an async write.
      */
     static void wakeUp(const RTPSWriter* interestedWriter);
 
@@ -73,21 +68,6 @@ private:
     ~AsyncWriterThread() = delete;
     AsyncWriterThread(const AsyncWriterThread&) = delete;
     const AsyncWriterThread& operator=(const AsyncWriterThread&) = delete;
-
-    //! @brief runs main method
-    static void run();
-
-    static std::thread* thread_;
-    static std::mutex data_structure_mutex_;
-    static std::mutex condition_variable_mutex_;
-    
-    //! List of asynchronous writers.
-    static std::list<RTPSWriter*> async_writers;
-    static AsyncInterestTree interestTree;
-
-    static bool running_;
-    static bool run_scheduled_;
-    static std::condition_variable cv_;
 };
 
 } // namespace rtps
@@ -32,7 +32,8 @@ namespace rtps{
 typedef enum MemoryManagementPolicy{
     PREALLOCATED_MEMORY_MODE, //!< Preallocated memory. Size set to the data type maximum. Largest memory footprint but smalles allocation count.
     PREALLOCATED_WITH_REALLOC_MEMORY_MODE, //!< Default size preallocated, requires reallocation when a bigger message arrives. Smaller memory footprint at the cost of an increased allocation count.
-    DYNAMIC_RESERVE_MEMORY_MODE //< Dynamic allocation at the time of message arrival. Least memory footprint but highest allocation count.
+    DYNAMIC_RESERVE_MEMORY_MODE, //< Dynamic allocation at the time of message arrival. Least memory footprint but highest allocation count.
+    POOLED_SIZE_CLASS_MEMORY_MODE //< Allocation on demand in power of two size classes. Released changes are kept in lock-free lists of their class for reuse. Suited for samples of very different sizes.
 }MemoryManagementPolicy_t;
 
 
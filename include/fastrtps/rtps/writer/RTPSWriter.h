@@ -23,9 +23,11 @@
 #include "../messages/RTPSMessageGroup.h"
 #include "../attributes/WriterAttributes.h"
 #include <vector>
+#include <set>
 #include <memory>
 #include <functional>
 #include <chrono>
+#include <atomic>
 
 namespace eprosima {
 namespace fastrtps{
@@ -34,6 +36,8 @@ namespace rtps {
 class WriterListener;
 class WriterHistory;
 class FlowController;
+class AsyncWriterScheduler;
+class LocalReaderPointer;
 struct CacheChange_t;
 
 
@@ -46,6 +50,7 @@ class RTPSWriter : public Endpoint
     friend class WriterHistory;
     friend class RTPSParticipantImpl;
     friend class RTPSMessageGroup;
+    friend class AsyncWriterScheduler;
     protected:
     RTPSWriter(RTPSParticipantImpl*,GUID_t& guid,WriterAttributes& att,WriterHistory* hist,WriterListener* listen=nullptr);
     virtual ~RTPSWriter();
@@ -184,8 +189,65 @@ class RTPSWriter : public Endpoint
      */
     bool get_separate_sending () const { return m_separateSendingEnabled; }
 
+    /**
+     * Delivers the messages queued for the readers of this process.
+     * The mutex of the writer must not be held: readers lock their own mutex and may call user listeners,
+     * which can use other writers.
+     */
+    void deliver_to_local_readers();
+
     protected:
 
+    //! Message for a reader of this process, queued while the writer mutex is held.
+    struct LocalReaderMessage
+    {
+        enum Kind
+        {
+            DATA,
+            GAP,
+            HEARTBEAT,
+            ACKNACK
+        };
+
+        LocalReaderMessage(Kind k, const GUID_t& guid, const std::shared_ptr<LocalReaderPointer>& pointer)
+            : kind(k), reader_guid(guid), reader(pointer), count(0), process_nacks(false) {}
+
+        Kind kind;
+        GUID_t reader_guid;
+        std::shared_ptr<LocalReaderPointer> reader;
+        //!DATA: Copy of the change, as the original may be removed from the history before being delivered.
+        std::shared_ptr<CacheChange_t> change;
+        //!GAP: Sequence numbers not relevant for the reader.
+        std::set<SequenceNumber_t> seq_nums;
+        //!HEARTBEAT: Sequence numbers available in the history.
+        SequenceNumber_t first_seq;
+        SequenceNumber_t last_seq;
+        Count_t count;
+        //!ACKNACK: Whether the changes missing in the reader are requested again.
+        bool process_nacks;
+    };
+
+    /**
+     * Queues a message for a reader of this process. The mutex of the writer must be held.
+     * @param message Message to queue.
+     */
+    void add_local_reader_message_nts(LocalReaderMessage&& message);
+
+    /**
+     * Queues a change for a reader of this process. The mutex of the writer must be held.
+     * @param reader_guid GUID of the reader.
+     * @param reader Pointer to the reader.
+     * @param change Change to deliver. It is copied, sharing the copy with other readers receiving the same change.
+     */
+    void add_local_reader_data_nts(const GUID_t& reader_guid, const std::shared_ptr<LocalReaderPointer>& reader,
+            const CacheChange_t* change);
+
+    /**
+     * Gives a message to its reader. Called by deliver_to_local_readers without holding the mutex of the writer.
+     * @param message Message to deliver.
+     */
+    virtual void process_local_reader_message(LocalReaderMessage& message);
+
     //!Is the data sent directly or announced by HB and THEN send to the ones who ask for it?.
     bool m_pushMode;
     //!Group created to send messages more efficiently
@@ -234,6 +296,16 @@ class RTPSWriter : public Endpoint
 
     private:
 
+    //!Scheduler sending the asynchronous changes. nullptr when the writer is not managed by any.
+    std::atomic<AsyncWriterScheduler*> async_scheduler_;
+    //!Scheduling state of the writer, only used by its scheduler.
+    mutable std::atomic<uint32_t> async_state_;
+
+    //!Messages waiting to be delivered to readers of this process.
+    std::vector<LocalReaderMessage> local_reader_messages_;
+    //!Whether a thread is delivering the queued messages. The others leave theirs to it.
+    bool delivering_local_reader_messages_;
+
     RTPSWriter& operator=(const RTPSWriter&) = delete;
 };
 }
@@ -20,6 +20,7 @@
 #define READERPROXY_H_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 #include <algorithm>
+#include <memory>
 #include <mutex>
 #include <set>
 #include "../common/Types.h"
@@ -28,8 +29,7 @@
 #include "../common/CacheChange.h"
 #include "../common/FragmentNumber.h"
 #include "../attributes/WriterAttributes.h"
-
-#include <set>
+#include "../../utils/RingBuffer.h"
 
 namespace eprosima
 {
@@ -40,6 +40,7 @@ namespace eprosima
 
             class StatefulWriter;
             class NackSupressionDuration;
+            class LocalReaderPointer;
 
 
             /**
@@ -75,24 +76,40 @@ namespace eprosima
                 void acked_changes_set(const SequenceNumber_t& seqNum);
 
                 /**
-                 * Mark all changes in the vector as requested.
-                 * @param seqNumSet Vector of sequenceNumbers
+                 * Mark all changes in the set as requested.
+                 * @param seqNumSet Set of sequenceNumbers
                  * @return False if any change was set REQUESTED.
                  */
-                bool requested_changes_set(std::vector<SequenceNumber_t>& seqNumSet);
+                bool requested_changes_set(const SequenceNumberSet_t& seqNumSet);
 
                 /*!
-                 * @brief Lists all unsent changes. These changes are also relevants and valid.
-                 * @return STL vector with the unsent change list.
-                 */
-                //TODO(Ricardo) Temporal
-                //std::vector<const ChangeForReader_t*> get_unsent_changes() const;
-                std::vector<ChangeForReader_t*> get_unsent_changes();
-                /*!
-                 * @brief Lists all requested changes.
-                 * @return STL vector with the requested change list.
+                 * @brief Calls a functor with each unsent change, in sequence number order.
+                 * The functor can change the status of the change it receives. Changes set as ACKNOWLEDGED at the
+                 * beginning of the window are removed afterwards.
+                 * Changes added by the functor are also visited, and the received change cannot be accessed after
+                 * adding one.
+                 * @param f Functor receiving a ChangeForReader_t&.
+                 * @return Number of unsent changes visited.
                  */
-                std::vector<const ChangeForReader_t*> get_requested_changes() const;
+                template<class Functor>
+                size_t for_each_unsent_change(Functor f)
+                {
+                    std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+                    size_t visited = 0;
+
+                    // Positions are stable while changes are only added at the end.
+                    for(size_t i = 0; i < m_changesForReader.size(); ++i)
+                    {
+                        if(m_changesForReader[i].getStatus() == UNSENT)
+                        {
+                            ++visited;
+                            f(m_changesForReader[i]);
+                        }
+                    }
+
+                    remove_acknowledged_front();
+                    return visited;
+                }
 
                 /*!
                  * @brief Sets a change to a particular status (if present in the ReaderProxy)
@@ -119,13 +136,6 @@ namespace eprosima
                  */
                 bool thereIsUnacknowledged() const;
 
-                /**
-                 * Get a vector of all unacked changes by this Reader.
-                 * @param reqChanges Pointer to a vector of pointers.
-                 * @return True if correct.
-                 */
-                bool unacked_changes(std::vector<const ChangeForReader_t*>* reqChanges);
-
                 //!Attributes of the Remote Reader
                 RemoteReaderAttributes m_att;
 
@@ -174,17 +184,41 @@ namespace eprosima
 
                 SequenceNumber_t get_low_mark() const { return changesFromRLowMark_; }
 
+                /*!
+                 * @brief Returns whether the reader lives in this process and receives the data directly.
+                 * @return True if the data is delivered without the transports.
+                 */
+                bool is_local_reader() const { return static_cast<bool>(local_reader_); }
+
+                //! Pointer to the reader when it lives in this process.
+                const std::shared_ptr<LocalReaderPointer>& local_reader() const { return local_reader_; }
+
                 //!Mutex
                 std::recursive_mutex* mp_mutex;
 
-                std::set<ChangeForReader_t, ChangeForReaderCmp> m_changesForReader;
-
-                //!Set of the changes and its state.
                 private:
+
+                /*!
+                 * @brief Looks for the change of a sequence number in m_changesForReader.
+                 * @return Iterator to the change, or m_changesForReader.end() if it is not in the window.
+                 */
+                RingBuffer<ChangeForReader_t>::iterator find_change(const SequenceNumber_t& seq_num);
+
+                //! Removes the ACKNOWLEDGED changes at the beginning of the window, moving the low mark.
+                void remove_acknowledged_front();
+
+                /*!
+                 * Window of the changes after changesFromRLowMark_ and their state, in sequence number order.
+                 * Changes removed from the history before the reader was matched leave gaps.
+                 */
+                RingBuffer<ChangeForReader_t> m_changesForReader;
+
                 //! Last  NACKFRAG count.
                 uint32_t lastNackfragCount_;
 
                 SequenceNumber_t changesFromRLowMark_;
+
+                std::shared_ptr<LocalReaderPointer> local_reader_;
             };
         }
     } /* namespace rtps */
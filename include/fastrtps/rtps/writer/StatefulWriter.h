@@ -213,6 +213,16 @@ namespace eprosima
 
                 void check_acked_status();
 
+                /*!
+                 * @brief Queues a heartbeat for a local reader, followed by the processing of its acknowledgement state.
+                 * @param reader_proxy Proxy of the local reader.
+                 */
+                void add_local_reader_heartbeat_nts(ReaderProxy& reader_proxy);
+
+                void process_local_reader_message(LocalReaderMessage& message) override;
+
+                void send_unsent_changes_to_local_reader_nts(ReaderProxy& reader_proxy);
+
                 bool disableHeartbeatPiggyback_;
 
                 const uint32_t sendBufferSize_;
@@ -26,11 +26,13 @@
 #include "ReaderLocator.h"
 
 #include <list>
+#include <memory>
 
 namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
+class LocalReaderPointer;
 
 /**
  * Class StatelessWriter, specialization of RTPSWriter that manages writers that don't keep state of the matched readers.
@@ -100,7 +102,7 @@ class StatelessWriter : public RTPSWriter
      * Get the number of matched readers
      * @return Number of matched readers
      */
-    inline size_t getMatchedReadersSize() const {return m_matched_readers.size();};
+    inline size_t getMatchedReadersSize() const {return m_matched_readers.size() + local_readers_.size();};
 
     bool is_acked_by_all(const CacheChange_t* a_change) const override;
 
@@ -116,8 +118,19 @@ class StatelessWriter : public RTPSWriter
 
     void update_locators_nts_(const GUID_t& optionalGuid);
 
+    //! Reader of this process receiving the data without the transports.
+    struct LocalReader
+    {
+        GUID_t guid;
+        std::shared_ptr<LocalReaderPointer> pointer;
+        std::vector<ChangeForReader_t> unsent_changes;
+    };
+
+    void send_unsent_changes_to_local_readers_nts();
+
     std::vector<ReaderLocator> reader_locators, fixed_locators;
     std::vector<RemoteReaderAttributes> m_matched_readers;
+    std::vector<LocalReader> local_readers_;
     std::vector<std::unique_ptr<FlowController> > m_controllers;
 };
 }
@@ -74,6 +74,24 @@ public:
      */
     bool takeNextData(void* data,SampleInfo_t* info);
 
+    /**
+     * Take next Data from the Subscriber without copying it. The sample is accessed in place, inside the
+     * received message, until it is given back with return_loan(). Only available for plain types
+     * (see TopicDataType::is_plain). Samples received with another endianness or size are deserialized into a
+     * copy, which must be given back with return_loan() as well.
+     * @param[out] sample Pointer to the loaned sample. Set to nullptr when the taken change has no data.
+     * @param info Pointer to a SampleInfo_t structure that informs you about your sample.
+     * @return True if a sample was taken.
+     */
+    bool take_loan(void** sample, SampleInfo_t* info);
+
+    /**
+     * Give back a sample obtained with take_loan().
+     * @param sample Pointer to the loaned sample.
+     * @return True if correct.
+     */
+    bool return_loan(void* sample);
+
     /**
      * Update the Attributes of the subscriber;
      * @param att Reference to a SubscriberAttributes object to update the parameters;
@@ -24,6 +24,9 @@
 #include <fastrtps/rtps/resources/ResourceManagement.h>
 #include "../rtps/history/ReaderHistory.h"
 #include "../qos/QosPolicies.h"
+#include "../utils/RingBuffer.h"
+
+#include <unordered_map>
 #include "SampleInfo.h"
 
 
@@ -46,8 +49,9 @@ class SubscriberHistory: public rtps::ReaderHistory
 {
     public:
 
-        typedef std::pair<rtps::InstanceHandle_t,std::vector<rtps::CacheChange_t*>> t_p_I_Change;
-        typedef std::vector<t_p_I_Change> t_v_Inst_Caches;
+        //!Changes of an instance, ordered by sequence number.
+        typedef RingBuffer<rtps::CacheChange_t*> t_Inst_Changes;
+        typedef std::unordered_map<rtps::InstanceHandle_t, t_Inst_Changes, rtps::InstanceHandleHash> t_m_Inst_Caches;
 
         /**
          * Constructor. Requires information about the subscriner
@@ -90,6 +94,14 @@ class SubscriberHistory: public rtps::ReaderHistory
         bool readNextBuffer(SerializedPayload_t* data, SampleInfo_t* info);
         bool takeNextBuffer(SerializedPayload_t* data, SampleInfo_t* info);
 
+        /** @name Loan methods.
+         * Methods to take plain samples in place and give them back to the pool.
+         */
+        ///@{
+        bool take_loan(void** sample, SampleInfo_t* info);
+        bool return_loan(void* sample);
+        ///@}
+
 
         /**
          * This method is called to remove a change from the SubscriberHistory.
@@ -97,7 +109,7 @@ class SubscriberHistory: public rtps::ReaderHistory
          * @param vit Pointer to the iterator of the key-ordered cacheChange vector.
          * @return True if removed.
          */
-        bool remove_change_sub(rtps::CacheChange_t* change,t_v_Inst_Caches::iterator* vit=nullptr);
+        bool remove_change_sub(rtps::CacheChange_t* change,t_m_Inst_Caches::iterator* vit=nullptr);
 
         //!Increase the unread count.
         inline void increaseUnreadCount()
@@ -124,20 +136,29 @@ class SubscriberHistory: public rtps::ReaderHistory
 
         //!Number of unread CacheChange_t.
         uint64_t m_unreadCacheCount;
-        //!Vector of pointer to the CacheChange_t divided by key.
-        t_v_Inst_Caches m_keyedChanges;
+        //!Pointers to the CacheChange_t divided by key.
+        t_m_Inst_Caches m_keyedChanges;
         //!HistoryQosPolicy values.
         HistoryQosPolicy m_historyQos;
         //!ResourceLimitsQosPolicy values.
         ResourceLimitsQosPolicy m_resourceLimitsQos;
+        //!Maximum number of changes kept for each instance.
+        size_t m_instanceCapacity;
         //!Publisher Pointer
         SubscriberImpl* mp_subImpl;
 
         //!Type object to deserialize Key
         void * mp_getKeyObject;
 
+        //!Changes taken by the user in place, waiting to be given back to the pool.
+        std::vector<rtps::CacheChange_t*> m_loanedChanges;
+        //!Samples that could not be loaned in place and were deserialized into a new object.
+        std::vector<void*> m_loanedCopies;
+
+        bool remove_change_sub(rtps::CacheChange_t* change, t_m_Inst_Caches::iterator* vit_in, bool release);
+
 
-        bool find_Key(rtps::CacheChange_t* a_change,t_v_Inst_Caches::iterator* vecPairIterrator);
+        bool find_Key(rtps::CacheChange_t* a_change,t_m_Inst_Caches::iterator* vecPairIterrator);
 };
 
 } /* namespace fastrtps */
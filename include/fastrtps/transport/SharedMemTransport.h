@@ -0,0 +1,203 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SHARED_MEM_TRANSPORT_H
+#define SHARED_MEM_TRANSPORT_H
+
+#include "TransportInterface.h"
+#include "ChannelResource.h"
+#include "SharedMemTransportDescriptor.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+class SharedMemPort;
+
+/**
+ * Channel resource listening on a shared memory port.
+ * @ingroup TRANSPORT_MODULE
+ */
+class SharedMemChannelResource : public ChannelResource
+{
+public:
+
+    SharedMemChannelResource(std::unique_ptr<SharedMemPort>&& port, const Locator_t& locator,
+        TransportReceiverInterface* receiver);
+
+    virtual ~SharedMemChannelResource();
+
+    virtual void Disable() override;
+
+    inline SharedMemPort* GetPort()
+    {
+        return mPort.get();
+    }
+
+    inline const Locator_t& GetLocator() const
+    {
+        return mLocator;
+    }
+
+    inline TransportReceiverInterface* GetMessageReceiver()
+    {
+        return mMsgReceiver;
+    }
+
+private:
+
+    std::unique_ptr<SharedMemPort> mPort;
+    Locator_t mLocator;
+    TransportReceiverInterface* mMsgReceiver;
+
+    SharedMemChannelResource(const SharedMemChannelResource&) = delete;
+    SharedMemChannelResource& operator=(const SharedMemChannelResource&) = delete;
+};
+
+/**
+ * Transport for participants running on the same host.
+ *    - Locators are of kind LOCATOR_KIND_SHM. The first twelve octets of their address identify the shared memory
+ *      namespace (the host) they belong to. The last four hold the domain and the participant listening on them,
+ *      which select the segment the listener created together with the port.
+ *
+ *    - Opening an input channel creates a POSIX shared memory segment holding a lock-free ring of message slots,
+ *      and a thread that delivers the messages to the receiver straight from the segment.
+ *
+ *    - Sending copies the message once into a free slot of the destination ring. No system call is made unless
+ *      the listener is sleeping.
+ *
+ *    - There is no multicast. Discovery still needs a network transport to find the remote participants.
+ * @ingroup TRANSPORT_MODULE
+ */
+class SharedMemTransport : public TransportInterface
+{
+public:
+
+    RTPS_DllAPI SharedMemTransport(const SharedMemTransportDescriptor&);
+
+    virtual ~SharedMemTransport() override;
+
+    bool init() override;
+
+    //! Checks whether this process is listening on the port of the given locator.
+    virtual bool IsInputChannelOpen(const Locator_t&) const override;
+
+    virtual bool IsOutputChannelOpen(const Locator_t&) const override;
+
+    //! Checks for SHM kinds.
+    virtual bool IsLocatorSupported(const Locator_t&) const override;
+
+    //! Only locators living in the same shared memory namespace are allowed.
+    virtual bool IsLocatorAllowed(const Locator_t&) const override;
+
+    virtual Locator_t RemoteToMainLocal(const Locator_t&) const override;
+
+    virtual bool OpenOutputChannel(const Locator_t&) override;
+    virtual bool OpenExtraOutputChannel(const Locator_t&) override;
+
+    //! Creates the shared memory segment for the given port and starts listening on it.
+    virtual bool OpenInputChannel(const Locator_t&, TransportReceiverInterface*, uint32_t) override;
+
+    virtual bool CloseOutputChannel(const Locator_t&) override;
+
+    virtual bool CloseInputChannel(const Locator_t&) override;
+
+    virtual bool DoInputLocatorsMatch(const Locator_t&, const Locator_t&) const override;
+    virtual bool DoOutputLocatorsMatch(const Locator_t&, const Locator_t&) const override;
+
+    /**
+     * Copies the message into the ring of the remote port. Never blocks: when the listener is gone or
+     * its ring is full the message is dropped, as it would be by a datagram transport.
+     */
+    virtual bool Send(const octet* sendBuffer, uint32_t sendBufferSize, const Locator_t& localLocator,
+        const Locator_t& remoteLocator) override;
+
+    virtual bool Send(const octet* sendBuffer, uint32_t sendBufferSize, const Locator_t& localLocator,
+        const Locator_t& remoteLocator, ChannelResource* pChannelResource) override;
+
+    virtual LocatorList_t NormalizeLocator(const Locator_t& locator) override;
+
+    virtual LocatorList_t ShrinkLocatorLists(const std::vector<LocatorList_t>& locatorLists) override;
+
+    virtual bool is_local_locator(const Locator_t& locator) const override;
+
+    TransportDescriptorInterface* get_configuration() override { return &mConfiguration_; }
+
+    virtual void AddDefaultOutputLocator(LocatorList_t &defaultList) override;
+
+    virtual bool getDefaultMetatrafficMulticastLocators(LocatorList_t &locators,
+        uint32_t metatraffic_multicast_port) const override;
+
+    virtual bool getDefaultMetatrafficUnicastLocators(LocatorList_t &locators,
+        uint32_t metatraffic_unicast_port) const override;
+
+    virtual bool getDefaultUnicastLocators(LocatorList_t &locators, uint32_t unicast_port) const override;
+
+    virtual bool fillMetatrafficMulticastLocator(Locator_t &locator,
+        uint32_t metatraffic_multicast_port) const override;
+
+    virtual bool fillMetatrafficUnicastLocator(Locator_t &locator, uint32_t metatraffic_unicast_port) const override;
+
+    virtual bool configureInitialPeerLocator(Locator_t &locator, const PortParameters &port_params, uint32_t domainId,
+        LocatorList_t& list) const override;
+
+    virtual bool fillUnicastLocator(Locator_t &locator, uint32_t well_known_port) const override;
+
+    virtual void Shutdown() override;
+
+    /**
+     * Stores the domain and the participant listening on a locator in its address.
+     * Participants of different domains, or with different identifiers, never share a segment.
+     */
+    RTPS_DllAPI static void SetParticipantScope(Locator_t& locator, uint32_t domainId, uint32_t participantId);
+
+    //! Domain of the participant listening on a locator.
+    RTPS_DllAPI static uint16_t GetDomainId(const Locator_t& locator);
+
+    //! Identifier of the participant listening on a locator.
+    RTPS_DllAPI static uint16_t GetParticipantId(const Locator_t& locator);
+
+protected:
+
+    SharedMemTransportDescriptor mConfiguration_;
+
+    //! Identifier of the shared memory namespace, used as address of the local locators.
+    octet mHostId[12];
+
+    mutable std::recursive_mutex mInputMapMutex;
+    //! Input channels, by domain, participant and port.
+    std::map<uint64_t, SharedMemChannelResource*> mInputPorts;
+
+    mutable std::mutex mOutputMapMutex;
+    bool mOutputChannelOpen;
+    //! Remote segments, by domain, participant and port.
+    std::map<uint64_t, std::unique_ptr<SharedMemPort>> mOutputPorts;
+
+    //! Fills the address of the locator with the local host identifier.
+    void FillLocalAddress(Locator_t& locator) const;
+
+    //! Loop run by the thread of each input channel.
+    void performListenOperation(SharedMemChannelResource* pChannelResource);
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // SHARED_MEM_TRANSPORT_H
@@ -0,0 +1,58 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SHARED_MEM_TRANSPORT_DESCRIPTOR_H
+#define SHARED_MEM_TRANSPORT_DESCRIPTOR_H
+
+#include "./TransportDescriptorInterface.h"
+#include "../fastrtps_dll.h"
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+class TransportInterface;
+
+static const uint32_t s_defaultSharedMemPortQueueCapacity = 512;
+
+/**
+ * Shared memory transport configuration
+ *
+ * - port_queue_capacity: Number of messages each listening port is able to hold before
+ *                        senders start dropping them. Rounded up to a power of two.
+ *
+ * - maxMessageSize:      Size of every slot in the port queues.
+ * @ingroup TRANSPORT_MODULE
+ */
+typedef struct SharedMemTransportDescriptor: public TransportDescriptorInterface
+{
+    virtual ~SharedMemTransportDescriptor(){}
+
+    virtual TransportInterface* create_transport() const override;
+
+    virtual uint32_t min_send_buffer_size() const override { return maxMessageSize; }
+
+    RTPS_DllAPI SharedMemTransportDescriptor();
+
+    RTPS_DllAPI SharedMemTransportDescriptor(const SharedMemTransportDescriptor& t);
+
+    //! Number of messages each listening port is able to queue.
+    uint32_t port_queue_capacity;
+} SharedMemTransportDescriptor;
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // SHARED_MEM_TRANSPORT_DESCRIPTOR_H
@@ -21,6 +21,9 @@
 #include <fastrtps/transport/tcp/RTCPMessageManager.h>
 #include <fastrtps/rtps/common/Locator.h>
 
+#include <atomic>
+#include <chrono>
+
 namespace eprosima{
 namespace fastrtps{
 namespace rtps{
@@ -184,6 +187,18 @@ public:
 
     bool WaitUntilPortIsOpenOrConnectionIsClosed(uint16_t port);
 
+    //! Whether the remote side asked not to calculate the CRC of the messages sent to it.
+    inline bool GetSkipCRC() const
+    {
+        return mSkipCRC;
+    }
+
+    //! Whether there are asynchronous operations on the io_service still referencing this channel.
+    inline bool HasPendingAsyncOperations() const
+    {
+        return mPendingAsyncOperations > 0;
+    }
+
 protected:
     inline bool ChangeStatus(eConnectionStatus s)
     {
@@ -214,7 +229,8 @@ private:
     RTCPMessageManager* mRTCPManager;
     Locator_t mLocator;
     bool m_inputSocket;
-    bool mWaitingForKeepAlive;
+    std::atomic<bool> mWaitingForKeepAlive;
+    std::atomic<bool> mSkipCRC; // The remote side doesn't check the CRC of the messages it receives.
     std::map<TCPTransactionId, uint16_t> mNegotiatingLogicalPorts; // Must be accessed after lock mPendingLogicalMutex
     std::map<TCPTransactionId, uint16_t> mLastCheckedLogicalPort;
     std::thread* mRTCPThread;
@@ -229,6 +245,24 @@ private:
     eConnectionStatus mConnectionStatus;
     std::mutex mStatusMutex;
 
+    // Asynchronous reception, used when the transport descriptor enables async_io.
+    std::vector<octet> mAsyncBuffer;
+    size_t mAsyncBufferBegin; // First byte not processed yet.
+    size_t mAsyncBufferEnd; // Byte after the last one received.
+    size_t mAsyncDiscardBytes; // Bytes of a dropped message still to be received.
+    asio::io_service::strand mKeepAliveStrand; // Serializes all the operations on mKeepAliveTimer.
+    asio::steady_timer mKeepAliveTimer;
+    std::chrono::steady_clock::time_point mNextKeepAlive;
+    std::chrono::steady_clock::time_point mKeepAliveTimeout;
+    std::atomic<uint32_t> mPendingAsyncOperations;
+
+    // Coalescing of the outgoing messages, used when the transport descriptor sets a send_coalescing_window_us.
+    // Must be accessed after lock mWriteMutex.
+    std::vector<octet> mSendQueue; // TCP headers and payloads waiting to be written.
+    asio::steady_timer mSendQueueTimer;
+    bool mSendQueueTimerArmed;
+
+    void CancelKeepAliveTimer();
     void PrepareAndSendCheckLogicalPortsRequest(uint16_t closedPort);
     void SendPendingOpenLogicalPorts();
     void CopyPendingPortsFrom(TCPChannelResource* from);
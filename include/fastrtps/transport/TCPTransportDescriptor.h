@@ -23,6 +23,16 @@ namespace rtps{
 
 /**
 * Transport configuration
+*
+* - async_io:   all the connections are served by a pool of io_threads threads, reading asynchronously into a
+*               buffer per connection. Otherwise, each connection has its own reception and keep alive threads.
+*               Received data is delivered from the pool threads, so io_threads lower than 2 are raised to 2.
+*
+* - check_crc:  when disabled on a trusted link, the transport tells its peers on the connection handshake, and they
+*               stop calculating the CRC of the messages they send through that connection.
+*
+* - send_coalescing_window_us: when not zero, small messages sent through a connection are queued for up to this
+*               time, or until send_coalescing_bytes are queued, and then written together with a single call.
 * @ingroup TRANSPORT_MODULE
 */
 typedef struct TCPTransportDescriptor : public SocketTransportDescriptor {
@@ -39,6 +49,10 @@ typedef struct TCPTransportDescriptor : public SocketTransportDescriptor {
     bool wait_for_tcp_negotiation;
     bool calculate_crc;
     bool check_crc;
+    bool async_io;
+    uint32_t io_threads;
+    uint32_t send_coalescing_window_us;
+    uint32_t send_coalescing_bytes;
 
     void add_listener_port(uint16_t port)
     {
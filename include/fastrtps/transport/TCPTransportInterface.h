@@ -22,6 +22,7 @@
 #include <fastrtps/transport/TCPChannelResource.h>
 
 #include <asio.hpp>
+#include <chrono>
 #include <thread>
 #include <vector>
 #include <map>
@@ -261,6 +262,7 @@ protected:
     int32_t mTransportKind;
     asio::io_service mService;
     std::shared_ptr<std::thread> ioServiceThread;
+    std::vector<std::thread> mIOPoolThreads; // Additional threads running mService when async_io is enabled.
     RTCPMessageManager* mRTCPMessageManager;
     mutable std::mutex mSocketsMapMutex;
     std::atomic<bool> mSendRetryActive;
@@ -288,10 +290,15 @@ protected:
     //! Methods to manage the TCP headers and their CRC values.
     bool CheckCRC(const TCPHeader &header, const octet *data, uint32_t size) const;
     void CalculateCRC(TCPHeader &header, const octet *data, uint32_t size) const;
-    void FillTCPHeader(TCPHeader& header, const octet* sendBuffer, uint32_t sendBufferSize, uint16_t logicalPort) const;
+    void FillTCPHeader(TCPHeader& header, const octet* sendBuffer, uint32_t sendBufferSize, uint16_t logicalPort,
+        const TCPChannelResource* pChannelResource) const;
 
-    //! Cleans the sockets pending to delete.
-    void CleanDeletedSockets();
+    /**
+     * Cleans the sockets pending to delete.
+     * @param force Deletes also the sockets with pending asynchronous operations. Only valid once the io_service
+     * has been stopped.
+     */
+    void CleanDeletedSockets(bool force = false);
 
     //! Closes the given pChannelResource and unbind it from every resource.
     void CloseTCPSocket(TCPChannelResource* pChannelResource);
@@ -319,19 +326,67 @@ protected:
     //! Intermediate method to open an output socket.
     bool OpenOutputSockets(const Locator_t& locator, SenderResource *senderResource);
 
+    //! Starts receiving on a connected socket, with its own threads or on the io_service depending on async_io.
+    void StartReceiving(TCPChannelResource* pChannelResource);
+
     //! Functions to be called from new threads, which takes cares of performing a blocking receive
     void performListenOperation(TCPChannelResource* pChannelResource);
     void performRTPCManagementThread(TCPChannelResource* pChannelResource);
 
+    //! Sends a keep alive request when it is due. Returns false if the channel was closed because of a timeout.
+    bool ManageKeepAlive(TCPChannelResource* pChannelResource);
+
+    //! Asynchronous counterparts of the threads above, run by the io_service.
+    void AsyncReceive(TCPChannelResource* pChannelResource);
+    void OnAsyncReceive(TCPChannelResource* pChannelResource, const asio::error_code& error, std::size_t bytes);
+    bool ProcessAsyncBuffer(TCPChannelResource* pChannelResource);
+    void ScheduleKeepAlive(TCPChannelResource* pChannelResource, std::chrono::steady_clock::duration delay);
+    void OnKeepAliveTimer(TCPChannelResource* pChannelResource, const asio::error_code& error);
+
+    /**
+     * Processes a message once its body has been received: checks its CRC and handles the RTCP control messages.
+     * @return True if the message has to be delivered to the receiver of its logical port.
+     */
+    bool ProcessReceivedMessage(TCPChannelResource* pChannelResource, const TCPHeader& header, octet* body,
+        uint32_t body_size, Locator_t& remoteLocator);
+
+    //! Delivers a received message to the receiver registered for the logical port of the remote locator.
+    void DeliverReceivedMessage(TCPChannelResource* pChannelResource, const octet* data, uint32_t size,
+        const Locator_t& remoteLocator);
+
     bool ReadBody(octet* receiveBuffer, uint32_t receiveBufferCapacity, uint32_t* bytes_received,
         TCPChannelResource* pChannelResource, std::size_t body_size);
 
     size_t Send(TCPChannelResource* pChannelResource, const octet* data, size_t size, eSocketErrorCodes &error) const;
     size_t Send(TCPChannelResource* pChannelResource, const octet* data, size_t size) const;
 
-    //! Sends the given buffer by the given socket.
-    bool SendThroughSocket(const octet* sendBuffer, uint32_t sendBufferSize, const Locator_t& remoteLocator,
-        TCPChannelResource* socket);
+    //! Writes all the given buffers with a single gathering call.
+    template<typename ConstBufferSequence>
+    size_t SendBuffers(TCPChannelResource* pChannelResource, const ConstBufferSequence& buffers,
+        eSocketErrorCodes &error) const;
+
+    //! Sends the given buffers by the given socket. The caller closes the socket when errorCode is not eNoError.
+    template<typename ConstBufferSequence>
+    bool SendThroughSocket(const ConstBufferSequence& buffers, uint32_t sendBufferSize,
+        const Locator_t& remoteLocator, TCPChannelResource* socket, eSocketErrorCodes &errorCode);
+
+    /**
+     * Sends a message with its TCP header. They are written together, or queued on the channel to be written
+     * with other messages when send coalescing is enabled.
+     */
+    bool SendMessage(TCPChannelResource* pChannelResource, const TCPHeader& header, const octet* sendBuffer,
+        uint32_t sendBufferSize, const Locator_t& remoteLocator);
+
+    //! Body of SendMessage. Must be called with the write mutex of the channel locked.
+    bool QueueOrSendMessage(TCPChannelResource* pChannelResource, const TCPHeader& header, const octet* sendBuffer,
+        uint32_t sendBufferSize, const Locator_t& remoteLocator, eSocketErrorCodes &errorCode);
+
+    //! Writes the messages queued on the channel. Must be called with the write mutex of the channel locked.
+    bool FlushSendQueue(TCPChannelResource* pChannelResource, const Locator_t& remoteLocator,
+        eSocketErrorCodes &errorCode);
+
+    //! Flushes the send queue once the coalescing window expires.
+    void OnSendQueueTimer(TCPChannelResource* pChannelResource, const asio::error_code& error);
 
     virtual void SetReceiveBufferSize(uint32_t size) = 0;
     virtual void SetSendBufferSize(uint32_t size) = 0;
@@ -119,6 +119,23 @@ public:
 
     virtual bool Send(const octet* sendBuffer, uint32_t sendBufferSize, const Locator_t& localLocator, const Locator_t& remoteLocator, ChannelResource* pChannelResource) = 0;
 
+    /**
+     * Sends the same buffer to several remote locators, through the outbound channel that maps to the localLocator.
+     * Transports able to hand all the datagrams to the system at once should override it. By default it calls
+     * Send once per remote locator.
+     * @return True if the buffer was sent to at least one of the remote locators.
+     */
+    virtual bool SendBatch(const octet* sendBuffer, uint32_t sendBufferSize, const Locator_t& localLocator,
+        const LocatorList_t& remoteLocators)
+    {
+        bool success = false;
+        for (const Locator_t& remoteLocator : remoteLocators)
+        {
+            success |= Send(sendBuffer, sendBufferSize, localLocator, remoteLocator);
+        }
+        return success;
+    }
+
     //virtual ChannelResource* FindSocket(const Locator_t& remoteLocator) = 0;
 
     virtual LocatorList_t NormalizeLocator(const Locator_t& locator) = 0;
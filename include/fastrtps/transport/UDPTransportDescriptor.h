@@ -31,6 +31,10 @@ class TransportInterface;
  *                  fail.
  *
  * - interfaceWhiteList: Lists the allowed interfaces.
+ *
+ * - batched_io:    hands all the datagrams of a send, and all the datagrams waiting
+ *                  in a socket, to the system in a single call (sendmmsg/recvmmsg).
+ *                  Only available on Linux; ignored on other platforms.
  * @ingroup TRANSPORT_MODULE
  */
 typedef struct UDPTransportDescriptor: public SocketTransportDescriptor
@@ -42,6 +46,8 @@ typedef struct UDPTransportDescriptor: public SocketTransportDescriptor
    RTPS_DllAPI UDPTransportDescriptor(const UDPTransportDescriptor& t);
 
    uint16_t m_output_udp_socket;
+
+   bool batched_io;
 } UDPTransportDescriptor;
 
 } // namespace rtps
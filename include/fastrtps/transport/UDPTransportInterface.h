@@ -104,6 +104,14 @@ public:
    virtual bool Send(const octet* sendBuffer, uint32_t sendBufferSize, const Locator_t& localLocator,
        const Locator_t& remoteLocator, ChannelResource* pChannelResource) override;
 
+   /**
+   * Blocking Send of the same buffer to several remote destinations. When the descriptor enables batched_io,
+   * all the datagrams for an output socket are handed to the system with a single sendmmsg call, each one
+   * pointing to sendBuffer, so the data is not copied.
+   */
+   virtual bool SendBatch(const octet* sendBuffer, uint32_t sendBufferSize, const Locator_t& localLocator,
+       const LocatorList_t& remoteLocators) override;
+
    virtual LocatorList_t ShrinkLocatorLists(const std::vector<LocatorList_t>& locatorLists) override;
 
     virtual bool fillMetatrafficMulticastLocator(Locator_t &locator,
@@ -177,6 +185,18 @@ protected:
     bool SendThroughSocket(const octet* sendBuffer, uint32_t sendBufferSize, const Locator_t& remoteLocator,
         eProsimaUDPSocketRef socket);
 
+#if defined(__linux__)
+    /** Same as performListenOperation, but drains the socket with recvmmsg into a ring of receive buffers.
+    Used when the descriptor enables batched_io.
+    @param input_locator - Locator that triggered the creation of the resource
+    */
+    void performBatchedListenOperation(UDPChannelResource* pChannelResource, Locator_t input_locator);
+
+    //! Sends the given buffer to all the supported remote locators with sendmmsg.
+    bool SendBatchThroughSocket(const octet* sendBuffer, uint32_t sendBufferSize,
+        const LocatorList_t& remoteLocators, UDPChannelResource* socket);
+#endif
+
     virtual void SetReceiveBufferSize(uint32_t size) = 0;
     virtual void SetSendBufferSize(uint32_t size) = 0;
     virtual void SetSocketOutboundInterface(eProsimaUDPSocket&, const std::string&) = 0;
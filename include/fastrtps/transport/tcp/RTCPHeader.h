@@ -209,7 +209,7 @@ struct TCPControlMsgHeader
         // Endianess flag has inverse logic than Endianness_t :-/
         if (endianess == Endianness_t::BIGEND)
         {
-            flags &= 0xFE;
+            flags &= ~BIT(1);
         }
         else
         {
@@ -225,7 +225,7 @@ struct TCPControlMsgHeader
         }
         else
         {
-            flags &= 0xFD;
+            flags &= ~BIT(2);
         }
     }
 
@@ -237,7 +237,7 @@ struct TCPControlMsgHeader
         }
         else
         {
-            flags &= 0xFB;
+            flags &= ~BIT(3);
         }
     }
 
@@ -256,6 +256,24 @@ struct TCPControlMsgHeader
         return (flags & BIT(3)) != 0;
     }
 
+    // Sent on the bind messages when the sender doesn't check the CRC of the messages it receives.
+    void setSkipCRC(bool skipCRC)
+    {
+        if (skipCRC)
+        {
+            flags |= BIT(4);
+        }
+        else
+        {
+            flags &= ~BIT(4);
+        }
+    }
+
+    bool getSkipCRC()
+    {
+        return (flags & BIT(4)) != 0;
+    }
+
     static inline size_t getSize()
     {
         return 16;
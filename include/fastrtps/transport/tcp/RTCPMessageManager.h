@@ -105,6 +105,15 @@ public:
 
     static uint32_t& addToCRC(uint32_t &crc, octet data);
 
+    /**
+     * Adds a whole buffer to the CRC, with the same result as calling addToCRC with each of its bytes.
+     * It uses SSE2 when available and addToCRCWordwise otherwise.
+     */
+    static uint32_t addToCRC(uint32_t crc, const octet* data, size_t size);
+
+    //! Portable version of the buffer addToCRC, which adds the bytes eight at a time.
+    static uint32_t addToCRCWordwise(uint32_t crc, const octet* data, size_t size);
+
 protected:
     TCPTransportInterface* mTransport;
     std::set<TCPTransactionId> mUnconfirmedTransactions;
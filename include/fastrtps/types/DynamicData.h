@@ -26,6 +26,7 @@ namespace fastrtps {
 namespace types {
 
 class DynamicType;
+class DynamicTypeLayout;
 class MemberDescriptor;
 
 class DynamicData
@@ -332,6 +333,17 @@ protected:
     void SortMemberIds(MemberId startId);
     void SetUnionDiscriminator(DynamicData* pData);
 
+    // Access to the values of the types with a flat layout.
+    template<typename T>
+    ResponseCode GetFlatValue(T& value, MemberId id, TypeKind kind) const;
+    template<typename T>
+    ResponseCode SetFlatValue(const T& value, MemberId id, TypeKind kind);
+    DynamicData* CreateFlatMemberData(MemberId id) const;
+    void StoreFlatMemberData(const DynamicData* data, MemberId id);
+    bool CompareFlatValues(const DynamicData* other) const;
+    void SerializeFlatValues(eprosima::fastcdr::Cdr &cdr, TypeKind kind, size_t offset, uint32_t count) const;
+    void DeserializeFlatValues(eprosima::fastcdr::Cdr &cdr, TypeKind kind, size_t offset, uint32_t count);
+
     // Serializes and deserializes the Dynamic Data.
     bool deserialize(eprosima::fastcdr::Cdr &cdr);
     static size_t getCdrSerializedSize(const DynamicData* data, size_t current_alignment = 0);
@@ -371,6 +383,12 @@ protected:
     MemberId mUnionId;
     DynamicData* mUnionDiscriminator;
 
+    // Types with a flat layout keep every value in mFlatBuffer instead of a DynamicData per member. The loaned
+    // members are copies, written back to the buffer when they are returned.
+    const DynamicTypeLayout* mLayout;
+    std::vector<octet> mFlatBuffer;
+    std::map<MemberId, DynamicData*> mFlatLoans;
+
     friend class DynamicDataFactory;
     friend class DynamicPubSubType;
 };
@@ -49,8 +49,7 @@ protected:
     void UpdateDynamicTypeInfo();
 
     DynamicType_ptr mDynamicType;
-    MD5 m_md5;
-    unsigned char* m_keyBuffer;
+    size_t m_keyBufferSize;     // Maximum serialized size of the key.
 };
 
 } // namespace types
@@ -26,6 +26,7 @@ class AnnotationDescriptor;
 class TypeDescriptor;
 class DynamicTypeMember;
 class DynamicTypeBuilder;
+class DynamicTypeLayout;
 
 class DynamicType
 {
@@ -55,6 +56,12 @@ public:
         return mDescriptor;
     }
 
+    //! Flat memory layout of the type, only available for the structures built in the flat layout mode.
+    const DynamicTypeLayout* GetLayout() const
+    {
+        return mLayout;
+    }
+
     bool HasChildren() const;
     bool IsConsistent() const;
     bool IsComplexKind() const;
@@ -109,6 +116,7 @@ protected:
     std::string mName;
     TypeKind mKind;
     bool mIsKeyDefined;
+    DynamicTypeLayout* mLayout;
 };
 
 } // namespace types
@@ -33,6 +33,7 @@ class MemberDescriptor;
 class TypeObject;
 class DynamicType;
 class DynamicType_ptr;
+class DynamicTypeLayout;
 
 class DynamicTypeBuilderFactory
 {
@@ -116,6 +117,11 @@ public:
 
     RTPS_DllAPI bool IsEmpty() const;
 
+    // In the flat layout mode, the structures built from now on whose members are primitives, enumerations or
+    // other flat structures get a DynamicTypeLayout, and their DynamicData store every value in a single buffer.
+    RTPS_DllAPI void SetFlatLayoutEnabled(bool enabled);
+    RTPS_DllAPI bool IsFlatLayoutEnabled() const;
+
 protected:
     DynamicTypeBuilderFactory();
 
@@ -123,6 +129,8 @@ protected:
 
     DynamicType_ptr BuildType(DynamicType_ptr other);
 
+    DynamicTypeLayout* CreateLayout(const DynamicType_ptr type) const;
+
     void BuildAliasTypeObject(const TypeDescriptor* descriptor, TypeObject& object, bool complete = true) const;
     void BuildEnumTypeObject(const TypeDescriptor* descriptor, TypeObject& object,
         const std::vector<const MemberDescriptor*> members, bool complete = true) const;
@@ -135,6 +143,7 @@ protected:
     std::vector<DynamicTypeBuilder*> mBuildersList;
     mutable std::recursive_mutex mMutex;
 #endif
+    bool mFlatLayoutEnabled;
 };
 
 } // namespace types
@@ -0,0 +1,109 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES_DYNAMIC_TYPE_LAYOUT_H
+#define TYPES_DYNAMIC_TYPE_LAYOUT_H
+
+#include <fastrtps/types/TypesBase.h>
+#include <fastrtps/types/DynamicTypePtr.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+class DynamicType;
+
+/**
+ * Flat memory layout of a structure whose members are primitives, enumerations or other flat structures.
+ * It is computed by the DynamicTypeBuilderFactory when the flat layout mode is enabled. The DynamicData of these
+ * types keep all their values in a single buffer of GetSize() bytes, and (de)serialize it running mOperations.
+ */
+class DynamicTypeLayout
+{
+public:
+
+    // Member of the structure, ordered by MemberId.
+    struct Member
+    {
+        MemberId mId;
+        std::string mName;
+        uint32_t mIndex;
+        TypeKind mKind;                     // Kind of the member, with the aliases resolved.
+        DynamicType_ptr mType;              // Type of the member, with the aliases resolved.
+        const DynamicTypeLayout* mLayout;   // Layout of the nested structures.
+        size_t mOffset;
+        size_t mSize;
+    };
+
+    // Primitive value, following the serialization order and including those of the nested structures.
+    struct Value
+    {
+        TypeKind mKind;
+        size_t mOffset;
+        const DynamicType* mType;           // Used to check the key annotation.
+    };
+
+    // Run of consecutive values of the same kind, (de)serialized as an array.
+    struct Operation
+    {
+        TypeKind mKind;
+        size_t mOffset;
+        uint32_t mCount;
+    };
+
+    DynamicTypeLayout()
+        : mSize(0)
+        , mAlignment(1)
+    {
+    }
+
+    inline size_t GetSize() const
+    {
+        return mSize;
+    }
+
+    inline size_t GetAlignment() const
+    {
+        return mAlignment;
+    }
+
+    const Member* GetMember(MemberId id) const
+    {
+        // Members use consecutive ids starting from zero unless they were given explicitly.
+        if (id < mMembers.size() && mMembers[id].mId == id)
+        {
+            return &mMembers[id];
+        }
+
+        auto it = std::lower_bound(mMembers.begin(), mMembers.end(), id,
+            [](const Member& member, MemberId value) { return member.mId < value; });
+        if (it != mMembers.end() && it->mId == id)
+        {
+            return &(*it);
+        }
+        return nullptr;
+    }
+
+    std::vector<Member> mMembers;
+    std::vector<Value> mValues;
+    std::vector<Operation> mOperations;
+    size_t mSize;
+    size_t mAlignment;
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // TYPES_DYNAMIC_TYPE_LAYOUT_H
@@ -0,0 +1,352 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Bitmap256.h
+ *
+ */
+
+#ifndef BITMAP256_H_
+#define BITMAP256_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Fixed bitmap of 256 bits, with the layout of the bitmaps of the RTPS number sets: bit 0 is the most significant
+ * bit of the first 32 bit word. It also keeps the number of bits up to the last one set, so the words that have to
+ * be sent are known without scanning them.
+ * @ingroup UTILITIESMODULE
+ */
+class Bitmap256
+{
+    public:
+
+        enum : uint32_t
+        {
+            NUM_BITS = 256,
+            NUM_WORDS = NUM_BITS / 32
+        };
+
+        Bitmap256() : num_bits_(0)
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            std::memset(words_, 0, sizeof(words_));
+            num_bits_ = 0;
+        }
+
+        bool empty() const
+        {
+            return num_bits_ == 0;
+        }
+
+        //! Number of bits up to the last one set, which is 0 when the bitmap is empty.
+        uint32_t num_bits() const
+        {
+            return num_bits_;
+        }
+
+        //! Number of words holding num_bits().
+        uint32_t num_words() const
+        {
+            return (num_bits_ + 31) / 32;
+        }
+
+        const uint32_t* words() const
+        {
+            return words_;
+        }
+
+        bool test(uint32_t bit) const
+        {
+            return bit < NUM_BITS && (words_[bit / 32] & mask(bit)) != 0;
+        }
+
+        /**
+         * Sets a bit.
+         * @return False if the bit is out of the bitmap.
+         */
+        bool set(uint32_t bit)
+        {
+            if(bit >= NUM_BITS)
+            {
+                return false;
+            }
+
+            words_[bit / 32] |= mask(bit);
+            if(bit >= num_bits_)
+            {
+                num_bits_ = bit + 1;
+            }
+            return true;
+        }
+
+        void reset(uint32_t bit)
+        {
+            if(bit < num_bits_)
+            {
+                words_[bit / 32] &= ~mask(bit);
+                if(bit + 1 == num_bits_)
+                {
+                    update_num_bits();
+                }
+            }
+        }
+
+        /**
+         * Sets the bits in [from, to). Bits out of the bitmap are ignored.
+         * @return False if some bit was out of the bitmap.
+         */
+        bool set_range(uint32_t from, uint32_t to)
+        {
+            bool fits = to <= NUM_BITS;
+            if(!fits)
+            {
+                to = NUM_BITS;
+            }
+
+            if(from < to)
+            {
+                for_each_word(from, to, [](uint32_t& word, uint32_t bits) { word |= bits; });
+                if(to > num_bits_)
+                {
+                    num_bits_ = to;
+                }
+            }
+            return fits;
+        }
+
+        //! Resets the bits in [from, to).
+        void reset_range(uint32_t from, uint32_t to)
+        {
+            if(to > num_bits_)
+            {
+                to = num_bits_;
+            }
+
+            if(from < to)
+            {
+                for_each_word(from, to, [](uint32_t& word, uint32_t bits) { word &= ~bits; });
+                if(to == num_bits_)
+                {
+                    update_num_bits();
+                }
+            }
+        }
+
+        /**
+         * Looks for the first bit set, starting at the given one.
+         * @return Position of the bit, or NUM_BITS if there is none.
+         */
+        uint32_t find_first(uint32_t from = 0) const
+        {
+            if(from >= num_bits_)
+            {
+                return NUM_BITS;
+            }
+
+            uint32_t index = from / 32;
+            uint32_t word = words_[index] & (0xFFFFFFFFu >> (from % 32));
+            uint32_t last = (num_bits_ - 1) / 32;
+            while(word == 0)
+            {
+                if(++index > last)
+                {
+                    return NUM_BITS;
+                }
+                word = words_[index];
+            }
+
+            return index * 32 + leading_zeros(word);
+        }
+
+        //! Number of bits set.
+        uint32_t count() const
+        {
+            uint32_t n = 0;
+            for(uint32_t i = 0; i < num_words(); ++i)
+            {
+                n += population(words_[i]);
+            }
+            return n;
+        }
+
+        //! Calls a functor with the position of each bit set, in increasing order.
+        template<class Functor>
+        void for_each(Functor f) const
+        {
+            for(uint32_t i = 0; i < num_words(); ++i)
+            {
+                uint32_t word = words_[i];
+                while(word != 0)
+                {
+                    uint32_t bit = leading_zeros(word);
+                    word &= ~(0x80000000u >> bit);
+                    f(i * 32 + bit);
+                }
+            }
+        }
+
+        /**
+         * Replaces the contents with words read from a number set.
+         * @param num_bits Number of valid bits. Bits after them are ignored.
+         * @param words At least (num_bits + 31) / 32 words.
+         * @return False if num_bits is bigger than the bitmap.
+         */
+        bool assign(uint32_t num_bits, const uint32_t* words)
+        {
+            if(num_bits > NUM_BITS)
+            {
+                return false;
+            }
+
+            clear();
+            uint32_t n_words = (num_bits + 31) / 32;
+            std::memcpy(words_, words, n_words * sizeof(uint32_t));
+            if(num_bits % 32 != 0)
+            {
+                words_[n_words - 1] &= ~(0xFFFFFFFFu >> (num_bits % 32));
+            }
+            num_bits_ = num_bits;
+            update_num_bits();
+            return true;
+        }
+
+        bool operator==(const Bitmap256& other) const
+        {
+            return num_bits_ == other.num_bits_ &&
+                std::memcmp(words_, other.words_, num_words() * sizeof(uint32_t)) == 0;
+        }
+
+        bool operator!=(const Bitmap256& other) const
+        {
+            return !(*this == other);
+        }
+
+        //! Number of leading zero bits of a word which is not 0.
+        static uint32_t leading_zeros(uint32_t word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<uint32_t>(__builtin_clz(word));
+#elif defined(_MSC_VER)
+            unsigned long index;
+            _BitScanReverse(&index, word);
+            return 31 - static_cast<uint32_t>(index);
+#else
+            uint32_t n = 0;
+            while((word & 0x80000000u) == 0)
+            {
+                word <<= 1;
+                ++n;
+            }
+            return n;
+#endif
+        }
+
+    private:
+
+        static uint32_t mask(uint32_t bit)
+        {
+            return 0x80000000u >> (bit % 32);
+        }
+
+        static uint32_t population(uint32_t word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<uint32_t>(__builtin_popcount(word));
+#else
+            word = word - ((word >> 1) & 0x55555555u);
+            word = (word & 0x33333333u) + ((word >> 2) & 0x33333333u);
+            return (((word + (word >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+#endif
+        }
+
+        //! Applies an operation to the words covering [from, to), with the mask of the bits of each word.
+        template<class Operation>
+        void for_each_word(uint32_t from, uint32_t to, Operation op)
+        {
+            uint32_t first = from / 32;
+            uint32_t last = (to - 1) / 32;
+            for(uint32_t i = first; i <= last; ++i)
+            {
+                uint32_t bits = 0xFFFFFFFFu;
+                if(i == first)
+                {
+                    bits &= 0xFFFFFFFFu >> (from % 32);
+                }
+                if(i == last && to % 32 != 0)
+                {
+                    bits &= ~(0xFFFFFFFFu >> (to % 32));
+                }
+                op(words_[i], bits);
+            }
+        }
+
+        //! Recomputes num_bits_ after clearing bits at the end.
+        void update_num_bits()
+        {
+            uint32_t i = num_words();
+            while(i > 0)
+            {
+                --i;
+                if(words_[i] != 0)
+                {
+                    num_bits_ = i * 32 + 32 - trailing_zeros(words_[i]);
+                    return;
+                }
+            }
+            num_bits_ = 0;
+        }
+
+        static uint32_t trailing_zeros(uint32_t word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<uint32_t>(__builtin_ctz(word));
+#elif defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, word);
+            return static_cast<uint32_t>(index);
+#else
+            uint32_t n = 0;
+            while((word & 1u) == 0)
+            {
+                word >>= 1;
+                ++n;
+            }
+            return n;
+#endif
+        }
+
+        uint32_t words_[NUM_WORDS];
+
+        uint32_t num_bits_;
+};
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif
+#endif // BITMAP256_H_
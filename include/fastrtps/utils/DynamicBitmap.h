@@ -0,0 +1,308 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DynamicBitmap.h
+ *
+ */
+
+#ifndef DYNAMICBITMAP_H_
+#define DYNAMICBITMAP_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Bitmap with a size given at runtime, which keeps the number of bits set.
+ * Checking if all or none of the bits are set is O(1), and looking for the next bit set or unset skips whole words.
+ * Assigning a new size reuses the storage when it is big enough.
+ * @ingroup UTILITIESMODULE
+ */
+class DynamicBitmap
+{
+    public:
+
+        DynamicBitmap() : size_(0), count_(0) {}
+
+        explicit DynamicBitmap(uint32_t size, bool value = false) : size_(0), count_(0)
+        {
+            assign(size, value);
+        }
+
+        //! Resizes the bitmap, setting all its bits to the given value.
+        void assign(uint32_t size, bool value)
+        {
+            size_ = size;
+            words_.assign((size + 63) / 64, value ? ~uint64_t(0) : 0);
+            if(value && size % 64 != 0)
+            {
+                words_.back() = (uint64_t(1) << (size % 64)) - 1;
+            }
+            count_ = value ? size : 0;
+        }
+
+        void clear()
+        {
+            words_.clear();
+            size_ = 0;
+            count_ = 0;
+        }
+
+        uint32_t size() const
+        {
+            return size_;
+        }
+
+        //! Number of bits set.
+        uint32_t count() const
+        {
+            return count_;
+        }
+
+        bool all() const
+        {
+            return count_ == size_;
+        }
+
+        bool none() const
+        {
+            return count_ == 0;
+        }
+
+        bool test(uint32_t bit) const
+        {
+            return bit < size_ && (words_[bit / 64] & mask(bit)) != 0;
+        }
+
+        /**
+         * Sets a bit.
+         * @return True if the bit was not set.
+         */
+        bool set(uint32_t bit)
+        {
+            if(bit >= size_ || (words_[bit / 64] & mask(bit)) != 0)
+            {
+                return false;
+            }
+
+            words_[bit / 64] |= mask(bit);
+            ++count_;
+            return true;
+        }
+
+        /**
+         * Resets a bit.
+         * @return True if the bit was set.
+         */
+        bool reset(uint32_t bit)
+        {
+            if(bit >= size_ || (words_[bit / 64] & mask(bit)) == 0)
+            {
+                return false;
+            }
+
+            words_[bit / 64] &= ~mask(bit);
+            --count_;
+            return true;
+        }
+
+        /**
+         * Sets the bits in [from, to). Bits out of the bitmap are ignored.
+         * @return Number of bits that were not set.
+         */
+        uint32_t set_range(uint32_t from, uint32_t to)
+        {
+            uint32_t changed = 0;
+            for_each_word(from, to, [&changed](uint64_t& word, uint64_t bits)
+            {
+                changed += population(bits & ~word);
+                word |= bits;
+            });
+            count_ += changed;
+            return changed;
+        }
+
+        /**
+         * Resets the bits in [from, to). Bits out of the bitmap are ignored.
+         * @return Number of bits that were set.
+         */
+        uint32_t reset_range(uint32_t from, uint32_t to)
+        {
+            uint32_t changed = 0;
+            for_each_word(from, to, [&changed](uint64_t& word, uint64_t bits)
+            {
+                changed += population(bits & word);
+                word &= ~bits;
+            });
+            count_ -= changed;
+            return changed;
+        }
+
+        /**
+         * Looks for the first bit set, starting at the given one.
+         * @return Position of the bit, or size() if there is none.
+         */
+        uint32_t find_first_set(uint32_t from = 0) const
+        {
+            return find_first(from, 0);
+        }
+
+        /**
+         * Looks for the first bit not set, starting at the given one.
+         * @return Position of the bit, or size() if there is none.
+         */
+        uint32_t find_first_unset(uint32_t from = 0) const
+        {
+            return find_first(from, ~uint64_t(0));
+        }
+
+        //! Calls a functor with the position of each bit set, in increasing order.
+        template<class Functor>
+        void for_each_set(Functor f) const
+        {
+            uint32_t n_words = static_cast<uint32_t>(words_.size());
+            for(uint32_t i = 0; i < n_words && count_ != 0; ++i)
+            {
+                uint64_t word = words_[i];
+                while(word != 0)
+                {
+                    f(i * 64 + trailing_zeros(word));
+                    word &= word - 1;
+                }
+            }
+        }
+
+        bool operator==(const DynamicBitmap& other) const
+        {
+            return size_ == other.size_ && count_ == other.count_ && words_ == other.words_;
+        }
+
+        bool operator!=(const DynamicBitmap& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+
+        static uint64_t mask(uint32_t bit)
+        {
+            return uint64_t(1) << (bit % 64);
+        }
+
+        //! Looks for the first bit which differs from the bits of the given word.
+        uint32_t find_first(uint32_t from, uint64_t skipped) const
+        {
+            if(from >= size_)
+            {
+                return size_;
+            }
+
+            uint32_t index = from / 64;
+            uint64_t word = (words_[index] ^ skipped) & (~uint64_t(0) << (from % 64));
+            uint32_t n_words = static_cast<uint32_t>(words_.size());
+            while(word == 0)
+            {
+                if(++index == n_words)
+                {
+                    return size_;
+                }
+                word = words_[index] ^ skipped;
+            }
+
+            uint32_t bit = index * 64 + trailing_zeros(word);
+            return bit < size_ ? bit : size_;
+        }
+
+        //! Applies an operation to the words covering [from, to), with the mask of the bits of each word.
+        template<class Operation>
+        void for_each_word(uint32_t from, uint32_t to, Operation op)
+        {
+            if(to > size_)
+            {
+                to = size_;
+            }
+            if(from >= to)
+            {
+                return;
+            }
+
+            uint32_t first = from / 64;
+            uint32_t last = (to - 1) / 64;
+            for(uint32_t i = first; i <= last; ++i)
+            {
+                uint64_t bits = ~uint64_t(0);
+                if(i == first)
+                {
+                    bits &= ~uint64_t(0) << (from % 64);
+                }
+                if(i == last && to % 64 != 0)
+                {
+                    bits &= (uint64_t(1) << (to % 64)) - 1;
+                }
+                op(words_[i], bits);
+            }
+        }
+
+        //! Number of trailing zero bits of a word which is not 0.
+        static uint32_t trailing_zeros(uint64_t word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<uint32_t>(__builtin_ctzll(word));
+#elif defined(_MSC_VER) && defined(_WIN64)
+            unsigned long index;
+            _BitScanForward64(&index, word);
+            return static_cast<uint32_t>(index);
+#else
+            uint32_t n = 0;
+            while((word & 1u) == 0)
+            {
+                word >>= 1;
+                ++n;
+            }
+            return n;
+#endif
+        }
+
+        static uint32_t population(uint64_t word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<uint32_t>(__builtin_popcountll(word));
+#else
+            word = word - ((word >> 1) & 0x5555555555555555ull);
+            word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+            word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+            return static_cast<uint32_t>((word * 0x0101010101010101ull) >> 56);
+#endif
+        }
+
+        std::vector<uint64_t> words_;
+
+        uint32_t size_;
+
+        uint32_t count_;
+};
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif
+#endif // DYNAMICBITMAP_H_
@@ -0,0 +1,268 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RingBuffer.h
+ *
+ */
+
+#ifndef RINGBUFFER_H_
+#define RINGBUFFER_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Double ended queue stored in a circular buffer with a maximum size.
+ * Storage is only allocated as elements are added, doubling it each time, so a buffer with a big maximum size
+ * and few elements stays small. Adding or removing at both ends is O(1), and iterators are random access.
+ * @ingroup UTILITIESMODULE
+ */
+template <typename T>
+class RingBuffer
+{
+    template<typename Buffer, typename Value>
+    class base_iterator
+    {
+        friend class RingBuffer;
+
+        public:
+
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef typename std::remove_const<Value>::type value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef Value* pointer;
+            typedef Value& reference;
+
+            base_iterator() : buffer_(nullptr), pos_(0) {}
+
+            Value& operator*() const { return (*buffer_)[pos_]; }
+            Value* operator->() const { return &(*buffer_)[pos_]; }
+            Value& operator[](std::ptrdiff_t n) const { return (*buffer_)[pos_ + n]; }
+
+            base_iterator& operator++() { ++pos_; return *this; }
+            base_iterator operator++(int) { base_iterator tmp(*this); ++pos_; return tmp; }
+            base_iterator& operator--() { --pos_; return *this; }
+            base_iterator operator--(int) { base_iterator tmp(*this); --pos_; return tmp; }
+            base_iterator& operator+=(std::ptrdiff_t n) { pos_ += n; return *this; }
+            base_iterator& operator-=(std::ptrdiff_t n) { pos_ -= n; return *this; }
+            base_iterator operator+(std::ptrdiff_t n) const { return base_iterator(buffer_, pos_ + n); }
+            base_iterator operator-(std::ptrdiff_t n) const { return base_iterator(buffer_, pos_ - n); }
+            std::ptrdiff_t operator-(const base_iterator& it) const
+            {
+                return static_cast<std::ptrdiff_t>(pos_) - static_cast<std::ptrdiff_t>(it.pos_);
+            }
+
+            bool operator==(const base_iterator& it) const { return pos_ == it.pos_; }
+            bool operator!=(const base_iterator& it) const { return pos_ != it.pos_; }
+            bool operator<(const base_iterator& it) const { return pos_ < it.pos_; }
+            bool operator>(const base_iterator& it) const { return pos_ > it.pos_; }
+            bool operator<=(const base_iterator& it) const { return pos_ <= it.pos_; }
+            bool operator>=(const base_iterator& it) const { return pos_ >= it.pos_; }
+
+        private:
+
+            base_iterator(Buffer* buffer, size_t pos) : buffer_(buffer), pos_(pos) {}
+
+            Buffer* buffer_;
+
+            size_t pos_;
+    };
+
+    public:
+
+        typedef base_iterator<RingBuffer, T> iterator;
+        typedef base_iterator<const RingBuffer, const T> const_iterator;
+
+        /**
+         * @param max_size Maximum number of elements the buffer can hold.
+         */
+        explicit RingBuffer(size_t max_size)
+            : head_(0)
+            , size_(0)
+            , max_size_(max_size)
+        {
+        }
+
+        size_t size() const { return size_; }
+
+        size_t max_size() const { return max_size_; }
+
+        bool empty() const { return size_ == 0; }
+
+        bool full() const { return size_ == max_size_; }
+
+        T& operator[](size_t pos) { return storage_[index(pos)]; }
+        const T& operator[](size_t pos) const { return storage_[index(pos)]; }
+
+        T& front() { return storage_[head_]; }
+        const T& front() const { return storage_[head_]; }
+
+        T& back() { return storage_[index(size_ - 1)]; }
+        const T& back() const { return storage_[index(size_ - 1)]; }
+
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, size_); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, size_); }
+
+        /**
+         * Add an element at the end.
+         * @return False if the buffer is full.
+         */
+        bool push_back(const T& value)
+        {
+            if(!reserve_one())
+            {
+                return false;
+            }
+
+            storage_[index(size_)] = value;
+            ++size_;
+            return true;
+        }
+
+        void pop_front()
+        {
+            head_ = index(1);
+            --size_;
+        }
+
+        void pop_back()
+        {
+            --size_;
+        }
+
+        /**
+         * Insert an element before the given position, moving the elements of the shorter side.
+         * @return Iterator to the inserted element, or end() if the buffer is full.
+         */
+        iterator insert(iterator it, const T& value)
+        {
+            size_t pos = it.pos_;
+            if(!reserve_one())
+            {
+                return end();
+            }
+
+            if(pos < size_ / 2)
+            {
+                head_ = index(storage_.size() - 1);
+                for(size_t i = 0; i < pos; ++i)
+                {
+                    (*this)[i] = std::move((*this)[i + 1]);
+                }
+            }
+            else
+            {
+                for(size_t i = size_; i > pos; --i)
+                {
+                    (*this)[i] = std::move((*this)[i - 1]);
+                }
+            }
+
+            ++size_;
+            (*this)[pos] = value;
+            return iterator(this, pos);
+        }
+
+        /**
+         * Remove an element, moving the elements of the shorter side.
+         * @return Iterator to the element that followed the removed one.
+         */
+        iterator erase(iterator it)
+        {
+            size_t pos = it.pos_;
+            if(pos < size_ / 2)
+            {
+                for(size_t i = pos; i > 0; --i)
+                {
+                    (*this)[i] = std::move((*this)[i - 1]);
+                }
+                head_ = index(1);
+            }
+            else
+            {
+                for(size_t i = pos; i + 1 < size_; ++i)
+                {
+                    (*this)[i] = std::move((*this)[i + 1]);
+                }
+            }
+
+            --size_;
+            return iterator(this, pos);
+        }
+
+        void clear()
+        {
+            head_ = 0;
+            size_ = 0;
+        }
+
+    private:
+
+        size_t index(size_t pos) const
+        {
+            pos += head_;
+            return pos < storage_.size() ? pos : pos - storage_.size();
+        }
+
+        bool reserve_one()
+        {
+            if(size_ < storage_.size())
+            {
+                return true;
+            }
+
+            if(size_ >= max_size_)
+            {
+                return false;
+            }
+
+            size_t new_size = storage_.empty() ? 1 : storage_.size() * 2;
+            if(new_size > max_size_)
+            {
+                new_size = max_size_;
+            }
+
+            std::vector<T> new_storage(new_size);
+            for(size_t i = 0; i < size_; ++i)
+            {
+                new_storage[i] = std::move((*this)[i]);
+            }
+            storage_.swap(new_storage);
+            head_ = 0;
+            return true;
+        }
+
+        std::vector<T> storage_;
+
+        size_t head_;
+
+        size_t size_;
+
+        size_t max_size_;
+};
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
+#endif
+#endif /* RINGBUFFER_H_ */
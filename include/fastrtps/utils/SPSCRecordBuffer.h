@@ -0,0 +1,176 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SPSCRecordBuffer.h
+ *
+ */
+
+#ifndef SPSCRECORDBUFFER_H_
+#define SPSCRECORDBUFFER_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Lock-free circular buffer of variable sized records, for one producer thread and one consumer thread.
+ * Each record is stored contiguously and aligned to std::max_align_t. The storage is allocated once, on construction.
+ * @ingroup UTILITIESMODULE
+ */
+class SPSCRecordBuffer
+{
+    public:
+
+        static const size_t alignment = alignof(std::max_align_t);
+
+        /**
+         * @param capacity Size of the storage in bytes. It is rounded up to a power of two.
+         */
+        explicit SPSCRecordBuffer(size_t capacity)
+            : head_(0)
+            , tail_(0)
+            , pending_size_(0)
+        {
+            size_t size = alignment * 2;
+            while(size < capacity)
+            {
+                size *= 2;
+            }
+            storage_.resize(size / sizeof(std::max_align_t));
+            mask_ = size - 1;
+        }
+
+        size_t capacity() const
+        {
+            return mask_ + 1;
+        }
+
+        /**
+         * Reserves space for a record. Only called from the producer thread.
+         * The record is not visible to the consumer until commit() is called.
+         * @param size Size of the record in bytes.
+         * @return Pointer to the space of the record, or nullptr if there is not enough free space.
+         */
+        void* reserve(size_t size)
+        {
+            size_t needed = align(sizeof(Header)) + align(size);
+            size_t head = head_.load(std::memory_order_relaxed);
+            size_t tail = tail_.load(std::memory_order_acquire);
+            size_t offset = head & mask_;
+            size_t contiguous = capacity() - offset;
+            size_t padding = needed > contiguous ? contiguous : 0;
+
+            if(head + padding + needed - tail > capacity())
+            {
+                return nullptr;
+            }
+
+            if(padding != 0)
+            {
+                // The record does not fit at the end, so the consumer skips it.
+                header_at(offset)->size = padding;
+                header_at(offset)->skip = true;
+                head += padding;
+                offset = 0;
+            }
+
+            Header* header = header_at(offset);
+            header->size = needed;
+            header->skip = false;
+            pending_size_ = padding + needed;
+            return reinterpret_cast<unsigned char*>(header) + align(sizeof(Header));
+        }
+
+        //! Makes the last reserved record visible to the consumer. Only called from the producer thread.
+        void commit()
+        {
+            head_.store(head_.load(std::memory_order_relaxed) + pending_size_, std::memory_order_release);
+            pending_size_ = 0;
+        }
+
+        /**
+         * Calls a functor with each committed record, releasing its space afterwards.
+         * Only called from the consumer thread.
+         * @param f Functor receiving a void* to the record.
+         * @return Number of records consumed.
+         */
+        template<class Functor>
+        size_t consume(Functor f)
+        {
+            size_t consumed = 0;
+            size_t tail = tail_.load(std::memory_order_relaxed);
+            size_t head = head_.load(std::memory_order_acquire);
+
+            while(tail != head)
+            {
+                Header* header = header_at(tail & mask_);
+                if(!header->skip)
+                {
+                    f(reinterpret_cast<unsigned char*>(header) + align(sizeof(Header)));
+                    ++consumed;
+                }
+                tail += header->size;
+                tail_.store(tail, std::memory_order_release);
+            }
+
+            return consumed;
+        }
+
+        bool empty() const
+        {
+            return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+        }
+
+    private:
+
+        struct Header
+        {
+            size_t size;
+            bool skip;
+        };
+
+        static size_t align(size_t size)
+        {
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+
+        Header* header_at(size_t offset)
+        {
+            return reinterpret_cast<Header*>(reinterpret_cast<unsigned char*>(storage_.data()) + offset);
+        }
+
+        std::vector<std::max_align_t> storage_;
+
+        size_t mask_;
+
+        //! Written by the producer. Position after the last committed record.
+        std::atomic<size_t> head_;
+
+        //! Written by the consumer. Position of the first record not consumed.
+        std::atomic<size_t> tail_;
+
+        //! Bytes used by the last reserved record, including the skipped space.
+        size_t pending_size_;
+};
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif
+#endif // SPSCRECORDBUFFER_H_
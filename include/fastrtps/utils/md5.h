@@ -63,6 +63,8 @@ public:
   void update(const char *buf, size_type length);
   MD5& finalize();
   std::string hexdigest() const;
+  // computes the digest of a whole buffer at once, keeping the state on the stack
+  static void hash(const unsigned char *buf, size_type length, uint1 output[16]);
   friend std::ostream& operator<<(std::ostream&, MD5& md5);
     uint1 digest[16]; // the result
 
@@ -73,7 +75,7 @@ private:
   typedef unsigned int uint4;  // 32bit
   enum {blocksize = 64}; // VC6 won't eat a const static int here
 
-  void transform(const uint1 block[blocksize]);
+  static void transform(uint4 state[4], const uint1 block[blocksize]);
   static void decode(uint4 output[], const uint1 input[], size_type len);
   static void encode(uint1 output[], const uint4 input[], size_type len);
 
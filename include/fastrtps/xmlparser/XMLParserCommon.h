@@ -51,6 +51,7 @@ extern const char* LOG;
 extern const char* TRANSPORT_DESCRIPTOR;
 extern const char* TRANSPORT_ID;
 extern const char* UDP_OUTPUT_PORT;
+extern const char* UDP_BATCHED_IO;
 extern const char* TCP_WAN_ADDR;
 extern const char* RECEIVE_BUFFER_SIZE;
 extern const char* SEND_BUFFER_SIZE;
@@ -68,6 +69,10 @@ extern const char* METADATA_LOGICAL_PORT;
 extern const char* LISTENING_PORTS;
 extern const char* CALCULATE_CRC;
 extern const char* CHECK_CRC;
+extern const char* TCP_ASYNC_IO;
+extern const char* TCP_IO_THREADS;
+extern const char* TCP_SEND_COALESCING_WINDOW;
+extern const char* TCP_SEND_COALESCING_BYTES;
 
 extern const char* QOS_PROFILE;
 extern const char* APPLICATION;
@@ -93,6 +98,9 @@ extern const char* IP6_TO_SEND;
 extern const char* THROUGHPUT_CONT;
 extern const char* USER_TRANS;
 extern const char* USE_BUILTIN_TRANS;
+extern const char* USE_INTRAPROCESS;
+extern const char* RECEIVE_WORKER_THREADS;
+extern const char* ASYNC_WRITER_THREADS;
 extern const char* PROPERTIES_POLICY;
 extern const char* NAME;
 
@@ -119,6 +127,7 @@ extern const char* PROPAGATE;
 extern const char* PREALLOCATED;
 extern const char* PREALLOCATED_WITH_REALLOC;
 extern const char* DYNAMIC;
+extern const char* POOLED_SIZE_CLASS;
 extern const char* LOCATOR;
 extern const char* UDPv4_LOCATOR;
 extern const char* UDPv6_LOCATOR;
@@ -208,6 +217,10 @@ extern const char* DEPTH;
 extern const char* ALLOCATED_SAMPLES;
 extern const char* BYTES_PER_SECOND;
 extern const char* PERIOD_MILLISECS;
+extern const char* BURST_BYTES;
+extern const char* REFILL_MILLISECS;
+extern const char* PERIODIC;
+extern const char* TOKEN_BUCKET;
 extern const char* PORT_BASE;
 extern const char* DOMAIN_ID_GAIN;
 extern const char* PARTICIPANT_ID_GAIN;
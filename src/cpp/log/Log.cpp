@@ -11,13 +11,22 @@ using namespace std;
 namespace eprosima {
 namespace fastrtps {
 
+//! Size in bytes of the buffer of formatted entries of each thread.
+static const size_t c_ThreadBufferSize = 64 * 1024;
+//! Period on which the logging thread looks for formatted entries whose notification was missed.
+static const std::chrono::milliseconds c_FormattedPollPeriod(100);
+
 struct Log::Resources Log::mResources;
 
 Log::Resources::Resources() : mLogging(false),
         mWork(false),
         mFilenames(false),
         mFunctions(true),
-        mVerbosity(Log::Error)
+        mVerbosity(Log::Error),
+        mHasThreadBuffers(false),
+        mFormattedPending(false),
+        mFormattedDropped(0),
+        mLoggingActive(false)
 {
     mResources.mConsumers.emplace_back(new StdoutConsumer);
 }
@@ -62,31 +71,89 @@ void Log::Run()
     std::unique_lock<std::mutex> guard(mResources.mCvMutex);
     while (mResources.mLogging)
     {
-        while (mResources.mWork)
+        while (mResources.mWork || mResources.mFormattedPending)
         {
             mResources.mWork = false;
             guard.unlock();
             {
                 mResources.mLogs.Swap();
+                std::unique_lock<std::mutex> configGuard(mResources.mConfigMutex);
                 while (!mResources.mLogs.Empty())
                 {
-                    std::unique_lock<std::mutex> configGuard(mResources.mConfigMutex);
-                    if (Preprocess(mResources.mLogs.Front()))
-                    {
-                        for (auto &consumer : mResources.mConsumers)
-                        {
-                            consumer->Consume(mResources.mLogs.Front());
-                        }
-                    }
-
+                    Dispatch(mResources.mLogs.Front());
                     mResources.mLogs.Pop();
                 }
             }
+            ConsumeFormattedLogs();
             guard.lock();
         }
         mResources.mCv.notify_one();
         if (mResources.mLogging)
-            mResources.mCv.wait(guard);
+        {
+            // Formatted entries are notified without taking the mutex, so a notification can be missed.
+            if (mResources.mHasThreadBuffers)
+                mResources.mCv.wait_for(guard, c_FormattedPollPeriod);
+            else
+                mResources.mCv.wait(guard);
+        }
+    }
+}
+
+void Log::ConsumeFormattedLogs()
+{
+    mResources.mFormattedPending = false;
+
+    std::vector<std::shared_ptr<SPSCRecordBuffer>> buffers;
+    {
+        std::unique_lock<std::mutex> guard(mResources.mThreadBuffersMutex);
+        // Buffers only referenced here belong to finished threads, and are released once consumed.
+        auto it = mResources.mThreadBuffers.begin();
+        while (it != mResources.mThreadBuffers.end())
+        {
+            if (it->use_count() == 1 && (*it)->empty())
+                it = mResources.mThreadBuffers.erase(it);
+            else
+                buffers.push_back(*it++);
+        }
+        mResources.mHasThreadBuffers = !mResources.mThreadBuffers.empty();
+    }
+
+    std::unique_lock<std::mutex> configGuard(mResources.mConfigMutex);
+    for (auto &buffer : buffers)
+    {
+        buffer->consume([](void *record)
+        {
+            FormattedEntry *formatted = static_cast<FormattedEntry*>(record);
+            std::stringstream message;
+            formatted->print(&message, formatted->format,
+                    static_cast<unsigned char*>(record) + FormattedEntryArgumentsOffset());
+
+            Log::Entry entry{message.str(), formatted->context, formatted->kind, std::string()};
+            GetTimestamp(formatted->time, entry.timestamp);
+            Dispatch(entry);
+        });
+    }
+
+    uint32_t dropped = mResources.mFormattedDropped.exchange(0);
+    if (dropped > 0)
+    {
+        std::stringstream message;
+        message << dropped << " log entries dropped because the buffer of their thread was full";
+        Log::Entry entry{message.str(), Log::Context{__FILE__, __LINE__, __func__, "LOG"}, Log::Kind::Warning,
+            std::string()};
+        GetTimestamp(entry.timestamp);
+        Dispatch(entry);
+    }
+}
+
+void Log::Dispatch(Log::Entry &entry)
+{
+    if (Preprocess(entry))
+    {
+        for (auto &consumer : mResources.mConsumers)
+        {
+            consumer->Consume(entry);
+        }
     }
 }
 
@@ -118,11 +185,23 @@ bool Log::Preprocess(Log::Entry &entry)
     return true;
 }
 
+void Log::LaunchThread()
+{
+    std::unique_lock<std::mutex> guard(mResources.mCvMutex);
+    if (!mResources.mLogging && !mResources.mLoggingThread)
+    {
+        mResources.mLogging = true;
+        mResources.mLoggingActive = true;
+        mResources.mLoggingThread.reset(new thread(Log::Run));
+    }
+}
+
 void Log::KillThread()
 {
     {
         std::unique_lock<std::mutex> guard(mResources.mCvMutex);
         mResources.mLogging = false;
+        mResources.mLoggingActive = false;
         mResources.mWork = false;
     }
 
@@ -141,14 +220,7 @@ void Log::KillThread()
 
 void Log::QueueLog(const std::string &message, const Log::Context &context, Log::Kind kind)
 {
-    {
-        std::unique_lock<std::mutex> guard(mResources.mCvMutex);
-        if (!mResources.mLogging && !mResources.mLoggingThread)
-        {
-            mResources.mLogging = true;
-            mResources.mLoggingThread.reset(new thread(Log::Run));
-        }
-    }
+    LaunchThread();
 
     std::string timestamp;
     GetTimestamp(timestamp);
@@ -160,6 +232,48 @@ void Log::QueueLog(const std::string &message, const Log::Context &context, Log:
     mResources.mCv.notify_all();
 }
 
+SPSCRecordBuffer &Log::GetThreadBuffer()
+{
+    // The buffer outlives the thread while it has entries to consume.
+    static thread_local std::shared_ptr<SPSCRecordBuffer> buffer;
+    if (!buffer)
+    {
+        buffer = std::make_shared<SPSCRecordBuffer>(c_ThreadBufferSize);
+        std::unique_lock<std::mutex> guard(mResources.mThreadBuffersMutex);
+        mResources.mThreadBuffers.push_back(buffer);
+        mResources.mHasThreadBuffers = true;
+    }
+    return *buffer;
+}
+
+void Log::NotifyFormattedLog(bool dropped)
+{
+    if (dropped)
+        mResources.mFormattedDropped.fetch_add(1, std::memory_order_relaxed);
+
+    if (!mResources.mLoggingActive.load(std::memory_order_acquire))
+        LaunchThread();
+
+    if (!mResources.mFormattedPending.exchange(true))
+        mResources.mCv.notify_all();
+}
+
+const char *Log::PrintUntilPlaceholder(std::ostream &stream, const char *format)
+{
+    const char *current = format;
+    while (*current != '\0')
+    {
+        if (current[0] == '{' && current[1] == '}')
+        {
+            stream.write(format, current - format);
+            return current + 2;
+        }
+        ++current;
+    }
+    stream.write(format, current - format);
+    return nullptr;
+}
+
 Log::Kind Log::GetVerbosity()
 {
     return mResources.mVerbosity;
@@ -190,9 +304,13 @@ void Log::SetErrorStringFilter(const std::regex &filter)
 }
 
 void Log::GetTimestamp(std::string &timestamp)
+{
+    GetTimestamp(std::chrono::system_clock::now(), timestamp);
+}
+
+void Log::GetTimestamp(const std::chrono::system_clock::time_point &now, std::string &timestamp)
 {
     std::stringstream stream;
-    auto now = std::chrono::system_clock::now();
     std::time_t now_c = std::chrono::system_clock::to_time_t(now);
     std::chrono::system_clock::duration tp = now.time_since_epoch();
     tp -= std::chrono::duration_cast<std::chrono::seconds>(tp);
@@ -44,6 +44,16 @@ bool Publisher::write(void* Data, WriteParams &wparams) {
     return mp_impl->create_new_change_with_params(ALIVE, Data, wparams);
 }
 
+void* Publisher::loan_sample()
+{
+    return mp_impl->loan_sample();
+}
+
+bool Publisher::discard_loan(void* sample)
+{
+    return mp_impl->discard_loan(sample);
+}
+
 bool Publisher::dispose(void* Data)
 {
     logInfo(PUBLISHER,"Disposing of Data");
@@ -17,8 +17,6 @@
  *
  */
 
-#include <mutex>
-
 #include <fastrtps/publisher/PublisherHistory.h>
 
 #include "PublisherImpl.h"
@@ -27,6 +25,7 @@
 
 #include <fastrtps/log/Log.h>
 
+#include <algorithm>
 #include <mutex>
 
 extern eprosima::fastrtps::rtps::WriteParams WRITE_PARAM_DEFAULT;
@@ -53,6 +52,8 @@ PublisherHistory::PublisherHistory(
                             history.depth * resource.max_instances))
     , m_historyQos(history)
     , m_resourceLimitsQos(resource)
+    , m_instanceCapacity(static_cast<size_t>(std::max(1, history.kind == KEEP_LAST_HISTORY_QOS ?
+                    history.depth : resource.max_samples_per_instance)))
     , mp_pubImpl(pimpl)
 {
     // TODO Auto-generated constructor stub
@@ -94,7 +95,7 @@ bool PublisherHistory::add_pub_change(CacheChange_t* change, WriteParams &wparam
     //NO KEY HISTORY
     if(mp_pubImpl->getAttributes().topic.getTopicKind() == NO_KEY)
     {
-        if(this->add_change(change, wparams))
+        if(this->add_change_(change, wparams))
         {
             returnedValue = true;
         }
@@ -102,7 +103,7 @@ bool PublisherHistory::add_pub_change(CacheChange_t* change, WriteParams &wparam
     //HISTORY WITH KEY
     else if(mp_pubImpl->getAttributes().topic.getTopicKind() == WITH_KEY)
     {
-        t_v_Inst_Caches::iterator vit;
+        t_m_Inst_Caches::iterator vit;
         if(find_Key(change,&vit))
         {
             logInfo(RTPS_HISTORY,"Found key: "<< vit->first);
@@ -135,7 +136,7 @@ bool PublisherHistory::add_pub_change(CacheChange_t* change, WriteParams &wparam
 
             if(add)
             {
-                if(this->add_change(change, wparams))
+                if(this->add_change_(change, wparams))
                 {
                     logInfo(RTPS_HISTORY,this->mp_pubImpl->getGuid().entityId <<" Change "
                             << change->sequenceNumber << " added with key: "<<change->instanceHandle
@@ -151,45 +152,32 @@ bool PublisherHistory::add_pub_change(CacheChange_t* change, WriteParams &wparam
     return returnedValue;
 }
 
-bool PublisherHistory::find_Key(CacheChange_t* a_change,t_v_Inst_Caches::iterator* vit_out)
+bool PublisherHistory::find_Key(CacheChange_t* a_change,t_m_Inst_Caches::iterator* vit_out)
 {
-    t_v_Inst_Caches::iterator vit;
-    bool found = false;
-    for(vit= m_keyedChanges.begin();vit!=m_keyedChanges.end();++vit)
+    t_m_Inst_Caches::iterator vit = m_keyedChanges.find(a_change->instanceHandle);
+    if(vit != m_keyedChanges.end())
     {
-        if(a_change->instanceHandle == vit->first)
-        {
-            *vit_out = vit;
-            return true;
-        }
+        *vit_out = vit;
+        return true;
+    }
+
+    if((int)m_keyedChanges.size() < m_resourceLimitsQos.max_instances)
+    {
+        *vit_out = m_keyedChanges.emplace(a_change->instanceHandle, t_Inst_Changes(m_instanceCapacity)).first;
+        return true;
     }
-    if(!found)
+
+    // Reuse the entry of an instance without changes.
+    for(vit = m_keyedChanges.begin(); vit != m_keyedChanges.end(); ++vit)
     {
-        if((int)m_keyedChanges.size() < m_resourceLimitsQos.max_instances)
+        if(vit->second.empty())
         {
-            t_p_I_Change newpair;
-            newpair.first = a_change->instanceHandle;
-            m_keyedChanges.push_back(newpair);
-            *vit_out = m_keyedChanges.end()-1;
+            m_keyedChanges.erase(vit);
+            *vit_out = m_keyedChanges.emplace(a_change->instanceHandle, t_Inst_Changes(m_instanceCapacity)).first;
             return true;
         }
-        else
-        {
-            for (vit = m_keyedChanges.begin(); vit != m_keyedChanges.end(); ++vit)
-            {
-                if (vit->second.size() == 0)
-                {
-                    m_keyedChanges.erase(vit);
-                    t_p_I_Change newpair;
-                    newpair.first = a_change->instanceHandle;
-                    m_keyedChanges.push_back(newpair);
-                    *vit_out = m_keyedChanges.end() - 1;
-                    return true;
-                }
-            }
-            logWarning(SUBSCRIBER, "History has reached the maximum number of instances" << endl;)
-        }
     }
+    logWarning(SUBSCRIBER, "History has reached the maximum number of instances" << endl;)
     return false;
 }
 
@@ -229,7 +217,7 @@ bool PublisherHistory::removeMinChange()
     return false;
 }
 
-bool PublisherHistory::remove_change_pub(CacheChange_t* change,t_v_Inst_Caches::iterator* vit_in)
+bool PublisherHistory::remove_change_pub(CacheChange_t* change,t_m_Inst_Caches::iterator* vit_in)
 {
 
     if(mp_writer == nullptr || mp_mutex == nullptr)
@@ -251,27 +239,31 @@ bool PublisherHistory::remove_change_pub(CacheChange_t* change,t_v_Inst_Caches::
     }
     else
     {
-        t_v_Inst_Caches::iterator vit;
+        t_m_Inst_Caches::iterator vit;
         if(vit_in!=nullptr)
             vit = *vit_in;
-        else if(this->find_Key(change,&vit))
-        {
-
-        }
         else
-            return false;
-        for(auto chit = vit->second.begin();
-                chit!= vit->second.end();++chit)
         {
-            if( ((*chit)->sequenceNumber == change->sequenceNumber)
-                    && ((*chit)->writerGUID == change->writerGUID) )
+            vit = m_keyedChanges.find(change->instanceHandle);
+            if(vit == m_keyedChanges.end())
             {
-                if(remove_change(change))
+                logError(PUBLISHER,"Instance of change not found, something is wrong");
+                return false;
+            }
+        }
+        // All the changes come from this writer, so they are ordered by sequence number.
+        auto chit = std::lower_bound(vit->second.begin(), vit->second.end(), change,
+                [](const CacheChange_t* c1, const CacheChange_t* c2)
                 {
-                    vit->second.erase(chit);
-                    m_isHistoryFull = false;
-                    return true;
-                }
+                    return c1->sequenceNumber < c2->sequenceNumber;
+                });
+        if(chit != vit->second.end() && (*chit)->sequenceNumber == change->sequenceNumber)
+        {
+            if(remove_change(change))
+            {
+                vit->second.erase(chit);
+                m_isHistoryFull = false;
+                return true;
             }
         }
         logError(PUBLISHER,"Change not found, something is wrong");
@@ -68,6 +68,12 @@ PublisherImpl::~PublisherImpl()
         logInfo(PUBLISHER, this->getGuid().entityId << " in topic: " << this->m_att.topic.topicName);
     }
 
+    for(CacheChange_t* ch : loaned_changes_)
+    {
+        m_history.release_Cache(ch);
+    }
+    loaned_changes_.clear();
+
     RTPSDomain::removeRTPSWriter(mp_writer);
     delete(this->mp_userPublisher);
 }
@@ -117,10 +123,23 @@ bool PublisherImpl::create_new_change_with_params(
     // Block lowlevel writer
     std::unique_lock<std::recursive_mutex> lock(*mp_writer->getMutex());
 
-    CacheChange_t* ch = mp_writer->new_change(mp_type->getSerializedSizeProvider(data), changeKind, handle);
+    // A loaned sample is already in its cache change, so it is only consumed when writing data.
+    CacheChange_t* ch = changeKind == ALIVE ? take_loaned_change_nts(data) : nullptr;
+    bool loaned = ch != nullptr;
+    if(loaned)
+    {
+        ch->kind = changeKind;
+        ch->instanceHandle = handle;
+        ch->writerGUID = mp_writer->getGuid();
+    }
+    else
+    {
+        ch = mp_writer->new_change(mp_type->getSerializedSizeProvider(data), changeKind, handle);
+    }
+
     if(ch != nullptr)
     {
-        if(changeKind == ALIVE)
+        if(changeKind == ALIVE && !loaned)
         {
             //If these two checks are correct, we asume the cachechange is valid and thwn we can write to it.
             if(!mp_type->serialize(data, &ch->serializedPayload))
@@ -165,7 +184,7 @@ bool PublisherImpl::create_new_change_with_params(
                 logError(PUBLISHER, "Data cannot be sent. It's serialized size is " <<
                         ch->serializedPayload.length << "' which exceeds the maximum payload size of '" <<
                         final_high_mark_for_frag << "' and therefore ASYNCHRONOUS_PUBLISH_MODE must be used.");
-                m_history.release_Cache(ch);
+                release_change_nts(ch, loaned);
                 return false;
             }
 
@@ -177,16 +196,91 @@ bool PublisherImpl::create_new_change_with_params(
 
         if(!this->m_history.add_pub_change(ch, wparams, lock))
         {
-            m_history.release_Cache(ch);
+            release_change_nts(ch, loaned);
             return false;
         }
 
+        lock.unlock();
+        mp_writer->deliver_to_local_readers();
+
         return true;
     }
 
     return false;
 }
 
+void* PublisherImpl::loan_sample()
+{
+    if(!mp_type->is_plain())
+    {
+        logError(PUBLISHER, "Type " << mp_type->getName() << " is not plain. Samples cannot be loaned");
+        return nullptr;
+    }
+
+    std::lock_guard<std::recursive_mutex> guard(*mp_writer->getMutex());
+
+    CacheChange_t* ch = nullptr;
+    if(!m_history.reserve_Cache(&ch, mp_type->m_typeSize))
+    {
+        logWarning(PUBLISHER, "Problem reserving Cache from the History");
+        return nullptr;
+    }
+
+    // Encapsulation header in host endianness, as a plain type is stored in memory.
+    ch->serializedPayload.encapsulation = DEFAULT_ENDIAN == BIGEND ? CDR_BE : CDR_LE;
+    ch->serializedPayload.data[0] = 0;
+    ch->serializedPayload.data[1] = static_cast<octet>(ch->serializedPayload.encapsulation);
+    ch->serializedPayload.data[2] = 0;
+    ch->serializedPayload.data[3] = 0;
+    ch->serializedPayload.length = mp_type->m_typeSize;
+    loaned_changes_.push_back(ch);
+
+    return ch->serializedPayload.data + SerializedPayload_t::representation_header_size;
+}
+
+bool PublisherImpl::discard_loan(void* sample)
+{
+    std::lock_guard<std::recursive_mutex> guard(*mp_writer->getMutex());
+
+    CacheChange_t* ch = take_loaned_change_nts(sample);
+    if(ch == nullptr)
+    {
+        logError(PUBLISHER, "The sample was not loaned by this publisher");
+        return false;
+    }
+
+    m_history.release_Cache(ch);
+    return true;
+}
+
+CacheChange_t* PublisherImpl::take_loaned_change_nts(void* sample)
+{
+    for(auto it = loaned_changes_.begin(); it != loaned_changes_.end(); ++it)
+    {
+        if((*it)->serializedPayload.data + SerializedPayload_t::representation_header_size == sample)
+        {
+            CacheChange_t* ch = *it;
+            loaned_changes_.erase(it);
+            return ch;
+        }
+    }
+
+    return nullptr;
+}
+
+void PublisherImpl::release_change_nts(CacheChange_t* ch, bool loaned)
+{
+    // A sample that could not be written stays loaned to the user.
+    if(loaned)
+    {
+        loaned_changes_.push_back(ch);
+    }
+    else
+    {
+        m_history.release_Cache(ch);
+    }
+}
+
 
 bool PublisherImpl::removeMinSeqChange()
 {
@@ -31,6 +31,8 @@
 
 #include <fastrtps/rtps/writer/WriterListener.h>
 
+#include <vector>
+
 namespace eprosima {
 namespace fastrtps{
 namespace rtps
@@ -90,6 +92,19 @@ class PublisherImpl
         void* Data,
         rtps::WriteParams& wparams);
 
+    /**
+     * Get a sample of a plain type allocated in a cache change of the history.
+     * @return Pointer to the sample, or nullptr if the type is not plain or there are no free cache changes.
+     */
+    void* loan_sample();
+
+    /**
+     * Give back a loaned sample that is not going to be written.
+     * @param sample Pointer returned by loan_sample.
+     * @return True if the sample was loaned by this publisher.
+     */
+    bool discard_loan(void* sample);
+
     /**
      * Removes the cache change with the minimum sequence number
      * @return True if correct.
@@ -159,6 +174,13 @@ class PublisherImpl
 	rtps::RTPSParticipant* mp_rtpsParticipant;
 
     uint32_t high_mark_for_frag_;
+
+    //!Changes whose sample is loaned to the user. Protected by the writer mutex.
+    std::vector<rtps::CacheChange_t*> loaned_changes_;
+
+    rtps::CacheChange_t* take_loaned_change_nts(void* sample);
+
+    void release_change_nts(rtps::CacheChange_t* ch, bool loaned);
 };
 
 
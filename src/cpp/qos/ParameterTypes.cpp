@@ -38,6 +38,16 @@ bool ParameterLocator_t::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool ParameterLocator_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_LOCATOR_LENGTH)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    return CDRMessage::readLocator(msg, &this->locator);
+}
+
 //PARAMTERKEY
 bool ParameterKey_t::addToCDRMessage(CDRMessage_t* msg)
 {
@@ -45,6 +55,12 @@ bool ParameterKey_t::addToCDRMessage(CDRMessage_t* msg)
 
 }
 
+bool ParameterKey_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    this->length = (uint16_t)size;
+    return CDRMessage::readData(msg, this->key.value, 16);
+}
+
 // PARAMETER_ STRING
 bool ParameterString_t::addToCDRMessage(CDRMessage_t* msg)
 {
@@ -70,6 +86,17 @@ bool ParameterString_t::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool ParameterString_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size > 256)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    this->m_string.clear();
+    return CDRMessage::readString(msg, &this->m_string);
+}
+
 // PARAMETER_ PORT
 bool ParameterPort_t::addToCDRMessage(CDRMessage_t* msg)
 {
@@ -79,6 +106,16 @@ bool ParameterPort_t::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool ParameterPort_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_PORT_LENGTH)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    return CDRMessage::readUInt32(msg, &this->port);
+}
+
 //PARAMETER_ GUID
 bool ParameterGuid_t::addToCDRMessage(CDRMessage_t* msg)
 {
@@ -89,6 +126,18 @@ bool ParameterGuid_t::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool ParameterGuid_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_GUID_LENGTH)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    bool valid = CDRMessage::readData(msg, this->guid.guidPrefix.value, 12);
+    valid &= CDRMessage::readData(msg, this->guid.entityId.value, 4);
+    return valid;
+}
+
 
 //PARAMETER_ PROTOCOL VERSION
 bool ParameterProtocolVersion_t::addToCDRMessage(CDRMessage_t* msg)
@@ -101,6 +150,19 @@ bool ParameterProtocolVersion_t::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool ParameterProtocolVersion_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_PROTOCOL_LENGTH)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    bool valid = CDRMessage::readOctet(msg, &protocolVersion.m_major);
+    valid &= CDRMessage::readOctet(msg, &protocolVersion.m_minor);
+    msg->pos += 2;
+    return valid;
+}
+
 bool ParameterVendorId_t::addToCDRMessage(CDRMessage_t* msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -111,6 +173,19 @@ bool ParameterVendorId_t::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool ParameterVendorId_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_VENDOR_LENGTH)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    bool valid = CDRMessage::readOctet(msg, &vendorId[0]);
+    valid &= CDRMessage::readOctet(msg, &vendorId[1]);
+    msg->pos += 2;
+    return valid;
+}
+
 
 //PARAMETER_ IP4ADDRESS
 bool ParameterIP4Address_t::addToCDRMessage(CDRMessage_t* msg)
@@ -120,6 +195,16 @@ bool ParameterIP4Address_t::addToCDRMessage(CDRMessage_t* msg)
     valid &= CDRMessage::addData(msg,this->address,4);
     return valid;
 }
+
+bool ParameterIP4Address_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_IP4_LENGTH)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    return CDRMessage::readData(msg, this->address, 4);
+}
 void ParameterIP4Address_t::setIP4Address(octet o1,octet o2,octet o3,octet o4){
     address[0] = o1;
     address[1] = o2;
@@ -138,6 +223,20 @@ bool ParameterBool_t::addToCDRMessage(CDRMessage_t* msg){
     return valid;
 }
 
+bool ParameterBool_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_BOOL_LENGTH)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    octet val = 0;
+    bool valid = CDRMessage::readOctet(msg, &val);
+    value = val != 0;
+    msg->pos += 3;
+    return valid;
+}
+
 
 bool ParameterCount_t::addToCDRMessage(CDRMessage_t* msg){
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -146,6 +245,16 @@ bool ParameterCount_t::addToCDRMessage(CDRMessage_t* msg){
     return valid;
 }
 
+bool ParameterCount_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_COUNT_LENGTH)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    return CDRMessage::readUInt32(msg, &count);
+}
+
 
 bool ParameterEntityId_t::addToCDRMessage(CDRMessage_t* msg)
 {
@@ -155,6 +264,16 @@ bool ParameterEntityId_t::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool ParameterEntityId_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_ENTITYID_LENGTH)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    return CDRMessage::readEntityId(msg, &entityId);
+}
+
 bool ParameterTime_t::addToCDRMessage(CDRMessage_t* msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -164,6 +283,18 @@ bool ParameterTime_t::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool ParameterTime_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_TIME_LENGTH)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    bool valid = CDRMessage::readInt32(msg, &time.seconds);
+    valid &= CDRMessage::readUInt32(msg, &time.fraction);
+    return valid;
+}
+
 bool ParameterBuiltinEndpointSet_t::addToCDRMessage(CDRMessage_t*msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -172,6 +303,16 @@ bool ParameterBuiltinEndpointSet_t::addToCDRMessage(CDRMessage_t*msg)
     return valid;
 }
 
+bool ParameterBuiltinEndpointSet_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_BUILTINENDPOINTSET_LENGTH)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    return CDRMessage::readUInt32(msg, &this->endpointSet);
+}
+
 bool ParameterPropertyList_t::addToCDRMessage(CDRMessage_t*msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -198,6 +339,31 @@ bool ParameterPropertyList_t::addToCDRMessage(CDRMessage_t*msg)
     return valid;
 }
 
+bool ParameterPropertyList_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    uint32_t pos_ref = msg->pos;
+    uint32_t num_properties = 0;
+    bool valid = CDRMessage::readUInt32(msg, &num_properties);
+
+    this->properties.clear();
+    std::pair<std::string, std::string> pair;
+    for(uint32_t n_prop = 0; valid && n_prop < num_properties; ++n_prop)
+    {
+        pair.first.clear();
+        valid &= CDRMessage::readString(msg, &pair.first);
+        pair.second.clear();
+        valid &= CDRMessage::readString(msg, &pair.second);
+        valid &= msg->pos - pos_ref <= size;
+        if(valid)
+        {
+            this->properties.push_back(pair);
+        }
+    }
+
+    this->length = (uint16_t)size;
+    return valid && msg->pos - pos_ref == size;
+}
+
 bool ParameterSampleIdentity_t::addToCDRMessage(CDRMessage_t*msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -209,6 +375,20 @@ bool ParameterSampleIdentity_t::addToCDRMessage(CDRMessage_t*msg)
     return valid;
 }
 
+bool ParameterSampleIdentity_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != 24)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    bool valid = CDRMessage::readData(msg, sample_id.writer_guid().guidPrefix.value, GuidPrefix_t::size);
+    valid &= CDRMessage::readData(msg, sample_id.writer_guid().entityId.value, EntityId_t::size);
+    valid &= CDRMessage::readInt32(msg, &sample_id.sequence_number().high);
+    valid &= CDRMessage::readUInt32(msg, &sample_id.sequence_number().low);
+    return valid;
+}
+
 #if HAVE_SECURITY
 
 bool ParameterToken_t::addToCDRMessage(CDRMessage_t*msg)
@@ -231,6 +411,12 @@ bool ParameterToken_t::addToCDRMessage(CDRMessage_t*msg)
     return valid;
 }
 
+bool ParameterToken_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    this->length = (uint16_t)size;
+    return CDRMessage::readDataHolder(msg, this->token);
+}
+
 bool ParameterParticipantSecurityInfo_t::addToCDRMessage(CDRMessage_t*msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -240,6 +426,18 @@ bool ParameterParticipantSecurityInfo_t::addToCDRMessage(CDRMessage_t*msg)
     return valid;
 }
 
+bool ParameterParticipantSecurityInfo_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_PARTICIPANT_SECURITY_INFO_LENGTH)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    bool valid = CDRMessage::readUInt32(msg, &this->security_attributes);
+    valid &= CDRMessage::readUInt32(msg, &this->plugin_security_attributes);
+    return valid;
+}
+
 bool ParameterEndpointSecurityInfo_t::addToCDRMessage(CDRMessage_t*msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -249,4 +447,16 @@ bool ParameterEndpointSecurityInfo_t::addToCDRMessage(CDRMessage_t*msg)
     return valid;
 }
 
+bool ParameterEndpointSecurityInfo_t::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_ENDPOINT_SECURITY_INFO_LENGTH)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    bool valid = CDRMessage::readUInt32(msg, &this->security_attributes);
+    valid &= CDRMessage::readUInt32(msg, &this->plugin_security_attributes);
+    return valid;
+}
+
 #endif
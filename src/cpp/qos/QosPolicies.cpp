@@ -37,6 +37,17 @@ bool DurabilityQosPolicy::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool DurabilityQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_KIND_LENGTH)
+    {
+        return false;
+    }
+    bool valid = CDRMessage::readOctet(msg, (octet*)&kind);
+    msg->pos += 3;
+    return valid;
+}
+
 bool DeadlineQosPolicy::addToCDRMessage(CDRMessage_t* msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -46,6 +57,17 @@ bool DeadlineQosPolicy::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool DeadlineQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_TIME_LENGTH)
+    {
+        return false;
+    }
+    bool valid = CDRMessage::readInt32(msg, &period.seconds);
+    valid &= CDRMessage::readUInt32(msg, &period.fraction);
+    return valid;
+}
+
 
 bool LatencyBudgetQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -55,6 +77,17 @@ bool LatencyBudgetQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool LatencyBudgetQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_TIME_LENGTH)
+    {
+        return false;
+    }
+    bool valid = CDRMessage::readInt32(msg, &duration.seconds);
+    valid &= CDRMessage::readUInt32(msg, &duration.fraction);
+    return valid;
+}
+
 bool LivelinessQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
     valid &= CDRMessage::addUInt16(msg, this->length);//this->length);
@@ -67,6 +100,19 @@ bool LivelinessQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool LivelinessQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_KIND_LENGTH + PARAMETER_TIME_LENGTH)
+    {
+        return false;
+    }
+    bool valid = CDRMessage::readOctet(msg, (octet*)&kind);
+    msg->pos += 3;
+    valid &= CDRMessage::readInt32(msg, &lease_duration.seconds);
+    valid &= CDRMessage::readUInt32(msg, &lease_duration.fraction);
+    return valid;
+}
+
 bool OwnershipQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
     valid &= CDRMessage::addUInt16(msg, this->length);//this->length);
@@ -77,6 +123,17 @@ bool OwnershipQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool OwnershipQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_KIND_LENGTH)
+    {
+        return false;
+    }
+    bool valid = CDRMessage::readOctet(msg, (octet*)&kind);
+    msg->pos += 3;
+    return valid;
+}
+
 bool ReliabilityQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
     valid &= CDRMessage::addUInt16(msg, this->length);//this->length);
@@ -89,6 +146,19 @@ bool ReliabilityQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool ReliabilityQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_KIND_LENGTH + PARAMETER_TIME_LENGTH)
+    {
+        return false;
+    }
+    bool valid = CDRMessage::readOctet(msg, (octet*)&kind);
+    msg->pos += 3;
+    valid &= CDRMessage::readInt32(msg, &max_blocking_time.seconds);
+    valid &= CDRMessage::readUInt32(msg, &max_blocking_time.fraction);
+    return valid;
+}
+
 bool DestinationOrderQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
     valid &= CDRMessage::addUInt16(msg, this->length);//this->length);
@@ -99,6 +169,17 @@ bool DestinationOrderQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool DestinationOrderQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_KIND_LENGTH)
+    {
+        return false;
+    }
+    bool valid = CDRMessage::readOctet(msg, (octet*)&kind);
+    msg->pos += 3;
+    return valid;
+}
+
 bool TimeBasedFilterQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
     valid &= CDRMessage::addUInt16(msg, this->length);//this->length);
@@ -107,6 +188,17 @@ bool TimeBasedFilterQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool TimeBasedFilterQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_TIME_LENGTH)
+    {
+        return false;
+    }
+    bool valid = CDRMessage::readInt32(msg, &minimum_separation.seconds);
+    valid &= CDRMessage::readUInt32(msg, &minimum_separation.fraction);
+    return valid;
+}
+
 bool PresentationQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
     valid &= CDRMessage::addUInt16(msg, PARAMETER_PRESENTATION_LENGTH);//this->length);
@@ -123,6 +215,20 @@ bool PresentationQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool PresentationQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_PRESENTATION_LENGTH)
+    {
+        return false;
+    }
+    bool valid = CDRMessage::readOctet(msg, (octet*)&access_scope);
+    msg->pos += 3;
+    valid &= CDRMessage::readOctet(msg, (octet*)&coherent_access);
+    valid &= CDRMessage::readOctet(msg, (octet*)&ordered_access);
+    msg->pos += 2;
+    return valid;
+}
+
 bool PartitionQosPolicy::addToCDRMessage(CDRMessage_t* msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -145,6 +251,23 @@ bool PartitionQosPolicy::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool PartitionQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    uint32_t pos_ref = msg->pos;
+    uint32_t namessize = 0;
+    bool valid = CDRMessage::readUInt32(msg, &namessize);
+
+    this->length = (uint16_t)size;
+    names.clear();
+    for(uint32_t i = 0; valid && i < namessize; ++i)
+    {
+        names.emplace_back();
+        valid &= CDRMessage::readString(msg, &names.back());
+        valid &= msg->pos - pos_ref <= size;
+    }
+    return valid;
+}
+
 bool UserDataQosPolicy::addToCDRMessage(CDRMessage_t* msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -160,6 +283,19 @@ bool UserDataQosPolicy::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool UserDataQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    uint32_t vec_size = 0;
+    bool valid = CDRMessage::readUInt32(msg, &vec_size);
+    if(!valid || size < 4 || vec_size > size - 4)
+    {
+        return false;
+    }
+    this->length = (uint16_t)size;
+    dataVec.resize(vec_size);
+    return CDRMessage::readData(msg, dataVec.data(), vec_size);
+}
+
 bool TopicDataQosPolicy::addToCDRMessage(CDRMessage_t* msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -168,6 +304,15 @@ bool TopicDataQosPolicy::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool TopicDataQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    uint32_t pos_ref = msg->pos;
+    this->length = (uint16_t)size;
+    value.clear();
+    bool valid = CDRMessage::readOctetVector(msg, &value);
+    return valid && msg->pos - pos_ref == size;
+}
+
 bool GroupDataQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
     valid &= CDRMessage::addUInt16(msg, this->length);//this->length);
@@ -175,6 +320,15 @@ bool GroupDataQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool GroupDataQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    uint32_t pos_ref = msg->pos;
+    this->length = (uint16_t)size;
+    value.clear();
+    bool valid = CDRMessage::readOctetVector(msg, &value);
+    return valid && msg->pos - pos_ref == size;
+}
+
 bool HistoryQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
     valid &= CDRMessage::addUInt16(msg, this->length);//this->length);
@@ -186,6 +340,18 @@ bool HistoryQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool HistoryQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_KIND_LENGTH + 4)
+    {
+        return false;
+    }
+    bool valid = CDRMessage::readOctet(msg, (octet*)&kind);
+    msg->pos += 3;
+    valid &= CDRMessage::readInt32(msg, &depth);
+    return valid;
+}
+
 bool DurabilityServiceQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
     valid &= CDRMessage::addUInt16(msg, this->length);//this->length);
@@ -202,6 +368,23 @@ bool DurabilityServiceQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool DurabilityServiceQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_TIME_LENGTH + PARAMETER_KIND_LENGTH + 16)
+    {
+        return false;
+    }
+    bool valid = CDRMessage::readInt32(msg, &service_cleanup_delay.seconds);
+    valid &= CDRMessage::readUInt32(msg, &service_cleanup_delay.fraction);
+    valid &= CDRMessage::readOctet(msg, (octet*)&history_kind);
+    msg->pos += 3;
+    valid &= CDRMessage::readInt32(msg, &history_depth);
+    valid &= CDRMessage::readInt32(msg, &max_samples);
+    valid &= CDRMessage::readInt32(msg, &max_instances);
+    valid &= CDRMessage::readInt32(msg, &max_samples_per_instance);
+    return valid;
+}
+
 bool LifespanQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
     valid &= CDRMessage::addUInt16(msg, this->length);//this->length);
@@ -210,6 +393,17 @@ bool LifespanQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool LifespanQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != PARAMETER_TIME_LENGTH)
+    {
+        return false;
+    }
+    bool valid = CDRMessage::readInt32(msg, &duration.seconds);
+    valid &= CDRMessage::readUInt32(msg, &duration.fraction);
+    return valid;
+}
+
 bool OwnershipStrengthQosPolicy::addToCDRMessage(CDRMessage_t* msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -218,6 +412,15 @@ bool OwnershipStrengthQosPolicy::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool OwnershipStrengthQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != 4)
+    {
+        return false;
+    }
+    return CDRMessage::readUInt32(msg, &value);
+}
+
 bool ResourceLimitsQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
     valid &= CDRMessage::addUInt16(msg, this->length);//this->length);
@@ -228,6 +431,18 @@ bool ResourceLimitsQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool ResourceLimitsQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != 12)
+    {
+        return false;
+    }
+    bool valid = CDRMessage::readInt32(msg, &max_samples);
+    valid &= CDRMessage::readInt32(msg, &max_instances);
+    valid &= CDRMessage::readInt32(msg, &max_samples_per_instance);
+    return valid;
+}
+
 bool TransportPriorityQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
     valid &= CDRMessage::addUInt16(msg, this->length);//this->length);
@@ -235,6 +450,15 @@ bool TransportPriorityQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool TransportPriorityQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    if(size != 4)
+    {
+        return false;
+    }
+    return CDRMessage::readUInt32(msg, &value);
+}
+
 bool DataRepresentationQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     bool valid = CDRMessage::addUInt32(msg, (uint32_t)m_value.size());
     for (std::vector<DataRepresentationId_t>::iterator it = m_value.begin(); it != m_value.end(); ++it)
@@ -242,6 +466,25 @@ bool DataRepresentationQosPolicy::addToCDRMessage(CDRMessage_t* msg) {
     return valid;
 }
 
+bool DataRepresentationQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    uint32_t count = 0;
+    bool valid = CDRMessage::readUInt32(msg, &count);
+    if(!valid || size < 4 || count > (size - 4) / 2)
+    {
+        return false;
+    }
+
+    m_value.clear();
+    int16_t temp = 0;
+    for(uint32_t i = 0; valid && i < count; ++i)
+    {
+        valid &= CDRMessage::readInt16(msg, &temp);
+        m_value.push_back(static_cast<DataRepresentationId_t>(temp));
+    }
+    return valid;
+}
+
 bool TypeConsistencyEnforcementQosPolicy::addToCDRMessage(CDRMessage_t* msg)
 {
     bool valid = CDRMessage::addUInt32(msg, this->m_kind);
@@ -253,6 +496,46 @@ bool TypeConsistencyEnforcementQosPolicy::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+bool TypeConsistencyEnforcementQosPolicy::readFromCDRMessage(CDRMessage_t* msg, uint32_t size)
+{
+    uint16_t uKind = 0;
+    octet temp = 0;
+    m_ignore_sequence_bounds = false;
+    m_ignore_string_bounds = false;
+    m_ignore_member_names = false;
+    m_prevent_type_widening = false;
+    m_force_type_validation = false;
+
+    bool valid = size >= 2 && CDRMessage::readUInt16(msg, &uKind);
+    m_kind = static_cast<TypeConsistencyKind>(uKind);
+    if(valid && size >= 3)
+    {
+        valid &= CDRMessage::readOctet(msg, &temp);
+        m_ignore_sequence_bounds = temp != 0;
+    }
+    if(valid && size >= 4)
+    {
+        valid &= CDRMessage::readOctet(msg, &temp);
+        m_ignore_string_bounds = temp != 0;
+    }
+    if(valid && size >= 5)
+    {
+        valid &= CDRMessage::readOctet(msg, &temp);
+        m_ignore_member_names = temp != 0;
+    }
+    if(valid && size >= 6)
+    {
+        valid &= CDRMessage::readOctet(msg, &temp);
+        m_prevent_type_widening = temp != 0;
+    }
+    if(valid && size >= 7)
+    {
+        valid &= CDRMessage::readOctet(msg, &temp);
+        m_force_type_validation = temp != 0;
+    }
+    return valid;
+}
+
 bool TypeIdV1::addToCDRMessage(CDRMessage_t* msg)
 {
     size_t size = TypeIdentifier::getCdrSerializedSize(*m_type_identifier) + 4;
@@ -35,6 +35,7 @@
 
 #include <fastrtps/rtps/writer/RTPSWriter.h>
 #include <fastrtps/rtps/reader/RTPSReader.h>
+#include "reader/LocalReaderPointer.h"
 
 namespace eprosima {
 namespace fastrtps{
@@ -44,6 +45,9 @@ std::mutex RTPSDomain::m_mutex;
 std::atomic<uint32_t> RTPSDomain::m_maxRTPSParticipantID(1);
 std::vector<RTPSDomain::t_p_RTPSParticipant> RTPSDomain::m_RTPSParticipants;
 std::set<uint32_t> RTPSDomain::m_RTPSParticipantIDs;
+std::mutex RTPSDomain::m_local_endpoints_mutex;
+std::set<GUID_t> RTPSDomain::m_local_writers;
+std::map<GUID_t, std::shared_ptr<LocalReaderPointer>> RTPSDomain::m_local_readers;
 
 void RTPSDomain::stopAll()
 {
@@ -263,6 +267,61 @@ bool RTPSDomain::removeRTPSReader(RTPSReader* reader)
     return false;
 }
 
+std::shared_ptr<LocalReaderPointer> RTPSDomain::find_local_reader(const GUID_t& writer_guid,
+        const GUID_t& reader_guid)
+{
+    std::lock_guard<std::mutex> guard(m_local_endpoints_mutex);
+    if(m_local_writers.find(writer_guid) == m_local_writers.end())
+    {
+        return nullptr;
+    }
+
+    auto it = m_local_readers.find(reader_guid);
+    if(it == m_local_readers.end())
+    {
+        return nullptr;
+    }
+
+    return it->second;
+}
+
+void RTPSDomain::register_local_writer(const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> guard(m_local_endpoints_mutex);
+    m_local_writers.insert(writer_guid);
+}
+
+void RTPSDomain::unregister_local_writer(const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> guard(m_local_endpoints_mutex);
+    m_local_writers.erase(writer_guid);
+}
+
+void RTPSDomain::register_local_reader(RTPSReader* reader)
+{
+    std::lock_guard<std::mutex> guard(m_local_endpoints_mutex);
+    m_local_readers[reader->getGuid()] = std::make_shared<LocalReaderPointer>(reader);
+}
+
+void RTPSDomain::unregister_local_reader(const GUID_t& reader_guid)
+{
+    std::shared_ptr<LocalReaderPointer> local_reader;
+
+    {
+        std::lock_guard<std::mutex> guard(m_local_endpoints_mutex);
+        auto it = m_local_readers.find(reader_guid);
+        if(it == m_local_readers.end())
+        {
+            return;
+        }
+        local_reader = it->second;
+        m_local_readers.erase(it);
+    }
+
+    // Writers may still hold the pointer. Wait for their deliveries outside the mutex.
+    local_reader->deactivate();
+}
+
 } /* namespace  rtps */
 } /* namespace  fastrtps */
 } /* namespace eprosima */
@@ -202,150 +202,163 @@ ParameterList_t ParticipantProxyData::AllQostoParameterList()
 
 bool ParticipantProxyData::readFromCDRMessage(CDRMessage_t* msg, bool use_encapsulation)
 {
-    ParameterList_t parameter_list;
-
-    if(ParameterList::readParameterListfromCDRMsg(msg, &parameter_list, NULL, use_encapsulation) > 0)
+    auto param_process = [this](CDRMessage_t* msg, const ParameterId_t pid, uint16_t plength)
     {
-        for(std::vector<Parameter_t*>::iterator it = parameter_list.m_parameters.begin();
-                it!=parameter_list.m_parameters.end();++it)
+        switch(pid)
         {
-            switch((*it)->Pid)
-            {
-                case PID_KEY_HASH:
-                    {
-                        ParameterKey_t*p = (ParameterKey_t*)(*it);
-                        GUID_t guid;
-                        iHandle2GUID(guid,p->key);
-                        this->m_guid = guid;
-                        this->m_key = p->key;
-                        break;
-                    }
-                case PID_PROTOCOL_VERSION:
-                    {
-                        ParameterProtocolVersion_t * p = (ParameterProtocolVersion_t*)(*it);
-                        if(p->protocolVersion.m_major < c_ProtocolVersion.m_major)
-                        {
-                            return false;
-                        }
-                        this->m_protocolVersion = p->protocolVersion;
-                        break;
-                    }
-                case PID_VENDORID:
-                    {
-                        ParameterVendorId_t * p = (ParameterVendorId_t*)(*it);
-                        this->m_VendorId[0] = p->vendorId[0];
-                        this->m_VendorId[1] = p->vendorId[1];
-                        break;
-                    }
-                case PID_EXPECTS_INLINE_QOS:
-                    {
-                        ParameterBool_t * p = (ParameterBool_t*)(*it);
-                        this->m_expectsInlineQos = p->value;
-                        break;
-                    }
-                case PID_PARTICIPANT_GUID:
+            case PID_KEY_HASH:
+                {
+                    if(!CDRMessage::readData(msg, this->m_key.value, 16))
                     {
-                        ParameterGuid_t * p = (ParameterGuid_t*)(*it);
-                        this->m_guid = p->guid;
-                        this->m_key = p->guid;
-                        break;
+                        return false;
                     }
-                case PID_METATRAFFIC_MULTICAST_LOCATOR:
+                    iHandle2GUID(this->m_guid, this->m_key);
+                    break;
+                }
+            case PID_PROTOCOL_VERSION:
+                {
+                    ParameterProtocolVersion_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength) || p.protocolVersion.m_major < c_ProtocolVersion.m_major)
                     {
-                        ParameterLocator_t* p = (ParameterLocator_t*)(*it);
-                        this->m_metatrafficMulticastLocatorList.push_back(p->locator);
-                        break;
+                        return false;
                     }
-                case PID_METATRAFFIC_UNICAST_LOCATOR:
+                    this->m_protocolVersion = p.protocolVersion;
+                    break;
+                }
+            case PID_VENDORID:
+                {
+                    ParameterVendorId_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength))
                     {
-                        ParameterLocator_t* p = (ParameterLocator_t*)(*it);
-                        this->m_metatrafficUnicastLocatorList.push_back(p->locator);
-                        break;
+                        return false;
                     }
-                case PID_DEFAULT_UNICAST_LOCATOR:
+                    this->m_VendorId[0] = p.vendorId[0];
+                    this->m_VendorId[1] = p.vendorId[1];
+                    break;
+                }
+            case PID_EXPECTS_INLINE_QOS:
+                {
+                    ParameterBool_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength))
                     {
-                        ParameterLocator_t* p = (ParameterLocator_t*)(*it);
-                        this->m_defaultUnicastLocatorList.push_back(p->locator);
-                        break;
+                        return false;
                     }
-                case PID_DEFAULT_MULTICAST_LOCATOR:
+                    this->m_expectsInlineQos = p.value;
+                    break;
+                }
+            case PID_PARTICIPANT_GUID:
+                {
+                    ParameterGuid_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength))
                     {
-                        ParameterLocator_t* p = (ParameterLocator_t*)(*it);
-                        this->m_defaultMulticastLocatorList.push_back(p->locator);
-                        break;
+                        return false;
                     }
-                case PID_PARTICIPANT_LEASE_DURATION:
+                    this->m_guid = p.guid;
+                    this->m_key = p.guid;
+                    break;
+                }
+            case PID_METATRAFFIC_MULTICAST_LOCATOR:
+            case PID_METATRAFFIC_UNICAST_LOCATOR:
+            case PID_DEFAULT_UNICAST_LOCATOR:
+            case PID_DEFAULT_MULTICAST_LOCATOR:
+                {
+                    ParameterLocator_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength))
                     {
-                        ParameterTime_t* p = (ParameterTime_t*)(*it);
-                        this->m_leaseDuration = p->time;
-                        break;
+                        return false;
                     }
-                case PID_BUILTIN_ENDPOINT_SET:
+                    LocatorList_t& locators =
+                        pid == PID_METATRAFFIC_MULTICAST_LOCATOR ? this->m_metatrafficMulticastLocatorList :
+                        pid == PID_METATRAFFIC_UNICAST_LOCATOR ? this->m_metatrafficUnicastLocatorList :
+                        pid == PID_DEFAULT_UNICAST_LOCATOR ? this->m_defaultUnicastLocatorList :
+                        this->m_defaultMulticastLocatorList;
+                    locators.push_back(p.locator);
+                    break;
+                }
+            case PID_PARTICIPANT_LEASE_DURATION:
+                {
+                    ParameterTime_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength))
                     {
-                        ParameterBuiltinEndpointSet_t* p = (ParameterBuiltinEndpointSet_t*)(*it);
-                        this->m_availableBuiltinEndpoints = p->endpointSet;
-                        break;
+                        return false;
                     }
-                case PID_ENTITY_NAME:
+                    this->m_leaseDuration = p.time;
+                    break;
+                }
+            case PID_BUILTIN_ENDPOINT_SET:
+                {
+                    ParameterBuiltinEndpointSet_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength))
                     {
-
-                        ParameterString_t* p = (ParameterString_t*)(*it);
-                        //cout << "ENTITY NAME " << p->m_string<<endl;
-                        this->m_participantName = std::string(p->getName());
-                        break;
+                        return false;
                     }
-                case PID_PROPERTY_LIST:
+                    this->m_availableBuiltinEndpoints = p.endpointSet;
+                    break;
+                }
+            case PID_ENTITY_NAME:
+                return plength <= 256 && CDRMessage::readString(msg, &this->m_participantName);
+            case PID_PROPERTY_LIST:
+                {
+                    // Property lists with an unexpected length are dropped.
+                    if(!this->m_properties.readFromCDRMessage(msg, plength))
                     {
-                        ParameterPropertyList_t*p = (ParameterPropertyList_t*)(*it);
-                        this->m_properties = *p;
-                        break;
+                        this->m_properties.properties.clear();
                     }
-                case PID_USER_DATA:
+                    break;
+                }
+            case PID_USER_DATA:
+                {
+                    uint32_t vec_size = 0;
+                    if(plength < 4 || !CDRMessage::readUInt32(msg, &vec_size) || vec_size > plength - 4u)
                     {
-                        UserDataQosPolicy*p = (UserDataQosPolicy*)(*it);
-                        this->m_userData = p->getDataVec();
-                        break;
+                        return false;
                     }
-                case PID_IDENTITY_TOKEN:
-                    {
+                    this->m_userData.resize(vec_size);
+                    return CDRMessage::readData(msg, this->m_userData.data(), vec_size);
+                }
+            case PID_IDENTITY_TOKEN:
+                {
 #if HAVE_SECURITY
-                        ParameterToken_t* p = (ParameterToken_t*)(*it);
-                        this->identity_token_ = std::move(p->token);
+                    return CDRMessage::readDataHolder(msg, this->identity_token_);
 #else
-                        logWarning(RTPS_PARTICIPANT, "Received PID_IDENTITY_TOKEN but security is disabled");
+                    logWarning(RTPS_PARTICIPANT, "Received PID_IDENTITY_TOKEN but security is disabled");
+                    break;
 #endif
-                        break;
-                    }
-                case PID_PERMISSIONS_TOKEN:
-                    {
+                }
+            case PID_PERMISSIONS_TOKEN:
+                {
 #if HAVE_SECURITY
-                        ParameterToken_t* p = (ParameterToken_t*)(*it);
-                        this->permissions_token_ = std::move(p->token);
+                    return CDRMessage::readDataHolder(msg, this->permissions_token_);
 #else
-                        logWarning(RTPS_PARTICIPANT, "Received PID_PERMISSIONS_TOKEN but security is disabled");
+                    logWarning(RTPS_PARTICIPANT, "Received PID_PERMISSIONS_TOKEN but security is disabled");
+                    break;
 #endif
-                        break;
-                    }
-                case PID_PARTICIPANT_SECURITY_INFO:
-                    {
+                }
+            case PID_PARTICIPANT_SECURITY_INFO:
+                {
 #if HAVE_SECURITY
-                        ParameterParticipantSecurityInfo_t* p = (ParameterParticipantSecurityInfo_t*)(*it);
-                        this->security_attributes_ = p->security_attributes;
-                        this->plugin_security_attributes_ = p->plugin_security_attributes;
+                    ParameterParticipantSecurityInfo_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength))
+                    {
+                        return false;
+                    }
+                    this->security_attributes_ = p.security_attributes;
+                    this->plugin_security_attributes_ = p.plugin_security_attributes;
 #else
-                        logWarning(RTPS_PARTICIPANT, "Received PID_PARTICIPANT_SECURITY_INFO but security is disabled");
+                    logWarning(RTPS_PARTICIPANT, "Received PID_PARTICIPANT_SECURITY_INFO but security is disabled");
 #endif
-                        break;
-                    }
-
-                    default: break;
+                    break;
                 }
-            }
-            return true;
+
+            default: break;
         }
 
-        return false;
-    }
+        return true;
+    };
+
+    uint32_t qos_size;
+    return ParameterList::readParameterListfromCDRMsg(*msg, param_process, use_encapsulation, qos_size);
+}
 
 
     void ParticipantProxyData::clear()
@@ -273,218 +273,157 @@ ParameterList_t ReaderProxyData::toParameterList()
 
 bool ReaderProxyData::readFromCDRMessage(CDRMessage_t* msg)
 {
-    ParameterList_t parameter_list;
-    if(ParameterList::readParameterListfromCDRMsg(msg, &parameter_list, NULL, true)>0)
+    auto param_process = [this](CDRMessage_t* msg, const ParameterId_t pid, uint16_t plength)
     {
-        for(std::vector<Parameter_t*>::iterator it = parameter_list.m_parameters.begin();
-                it!=parameter_list.m_parameters.end();++it)
+        switch(pid)
         {
-            switch((*it)->Pid)
-            {
-                case PID_DURABILITY:
-                    {
-                        DurabilityQosPolicy * p = (DurabilityQosPolicy*)(*it);
-                        m_qos.m_durability = *p;
-                        break;
-                    }
-                case PID_DURABILITY_SERVICE:
-                    {
-                        DurabilityServiceQosPolicy * p = (DurabilityServiceQosPolicy*)(*it);
-                        m_qos.m_durabilityService = *p;
-                        break;
-                    }
-                case PID_DEADLINE:
-                    {
-                        DeadlineQosPolicy * p = (DeadlineQosPolicy*)(*it);
-                        m_qos.m_deadline = *p;
-                        break;
-                    }
-                case PID_LATENCY_BUDGET:
-                    {
-                        LatencyBudgetQosPolicy * p = (LatencyBudgetQosPolicy*)(*it);
-                        m_qos.m_latencyBudget = *p;
-                        break;
-                    }
-                case PID_LIVELINESS:
-                    {
-                        LivelinessQosPolicy * p = (LivelinessQosPolicy*)(*it);
-                        m_qos.m_liveliness = *p;
-                        break;
-                    }
-                case PID_RELIABILITY:
-                    {
-                        ReliabilityQosPolicy * p = (ReliabilityQosPolicy*)(*it);
-                        m_qos.m_reliability = *p;
-                        break;
-                    }
-                case PID_LIFESPAN:
-                    {
-
-                        LifespanQosPolicy * p = (LifespanQosPolicy*)(*it);
-                        m_qos.m_lifespan = *p;
-                        break;
-                    }
-                case PID_USER_DATA:
-                    {
-                        UserDataQosPolicy * p = (UserDataQosPolicy*)(*it);
-                        m_qos.m_userData = *p;
-                        break;
-                    }
-                case PID_TIME_BASED_FILTER:
-                    {
-                        TimeBasedFilterQosPolicy * p = (TimeBasedFilterQosPolicy*)(*it);
-                        m_qos.m_timeBasedFilter = *p;
-                        break;
-                    }
-                case PID_OWNERSHIP:
-                    {
-                        OwnershipQosPolicy * p = (OwnershipQosPolicy*)(*it);
-                        m_qos.m_ownership = *p;
-                        break;
-                    }
-                case PID_DESTINATION_ORDER:
-                    {
-                        DestinationOrderQosPolicy * p = (DestinationOrderQosPolicy*)(*it);
-                        m_qos.m_destinationOrder = *p;
-                        break;
-                    }
-
-                case PID_PRESENTATION:
-                    {
-                        PresentationQosPolicy * p = (PresentationQosPolicy*)(*it);
-                        m_qos.m_presentation = *p;
-                        break;
-                    }
-                case PID_PARTITION:
-                    {
-                        PartitionQosPolicy * p = (PartitionQosPolicy*)(*it);
-                        m_qos.m_partition = *p;
-                        break;
-                    }
-                case PID_TOPIC_DATA:
-                    {
-                        TopicDataQosPolicy * p = (TopicDataQosPolicy*)(*it);
-                        m_qos.m_topicData = *p;
-                        break;
-                    }
-                case PID_GROUP_DATA:
-                    {
-
-                        GroupDataQosPolicy * p = (GroupDataQosPolicy*)(*it);
-                        m_qos.m_groupData = *p;
-                        break;
-                    }
-                case PID_TOPIC_NAME:
+            case PID_DURABILITY:
+                return m_qos.m_durability.readFromCDRMessage(msg, plength);
+            case PID_DURABILITY_SERVICE:
+                return m_qos.m_durabilityService.readFromCDRMessage(msg, plength);
+            case PID_DEADLINE:
+                return m_qos.m_deadline.readFromCDRMessage(msg, plength);
+            case PID_LATENCY_BUDGET:
+                return m_qos.m_latencyBudget.readFromCDRMessage(msg, plength);
+            case PID_LIVELINESS:
+                return m_qos.m_liveliness.readFromCDRMessage(msg, plength);
+            case PID_RELIABILITY:
+                return m_qos.m_reliability.readFromCDRMessage(msg, plength);
+            case PID_LIFESPAN:
+                return m_qos.m_lifespan.readFromCDRMessage(msg, plength);
+            case PID_USER_DATA:
+                return m_qos.m_userData.readFromCDRMessage(msg, plength);
+            case PID_TIME_BASED_FILTER:
+                return m_qos.m_timeBasedFilter.readFromCDRMessage(msg, plength);
+            case PID_OWNERSHIP:
+                return m_qos.m_ownership.readFromCDRMessage(msg, plength);
+            case PID_DESTINATION_ORDER:
+                return m_qos.m_destinationOrder.readFromCDRMessage(msg, plength);
+            case PID_PRESENTATION:
+                return m_qos.m_presentation.readFromCDRMessage(msg, plength);
+            case PID_PARTITION:
+                return m_qos.m_partition.readFromCDRMessage(msg, plength);
+            case PID_TOPIC_DATA:
+                return m_qos.m_topicData.readFromCDRMessage(msg, plength);
+            case PID_GROUP_DATA:
+                return m_qos.m_groupData.readFromCDRMessage(msg, plength);
+            case PID_TOPIC_NAME:
+                return plength <= 256 && CDRMessage::readString(msg, &m_topicName);
+            case PID_TYPE_NAME:
+                return plength <= 256 && CDRMessage::readString(msg, &m_typeName);
+            case PID_PARTICIPANT_GUID:
+                {
+                    ParameterGuid_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength))
                     {
-                        ParameterString_t*p = (ParameterString_t*)(*it);
-                        m_topicName = std::string(p->getName());
-                        break;
+                        return false;
                     }
-                case PID_TYPE_NAME:
+                    m_RTPSParticipantKey = p.guid;
+                    break;
+                }
+            case PID_ENDPOINT_GUID:
+                {
+                    ParameterGuid_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength))
                     {
-                        ParameterString_t*p = (ParameterString_t*)(*it);
-                        m_typeName = std::string(p->getName());
-                        break;
+                        return false;
                     }
-                case PID_PARTICIPANT_GUID:
+                    m_guid = p.guid;
+                    m_key = p.guid;
+                    break;
+                }
+            case PID_UNICAST_LOCATOR:
+                {
+                    ParameterLocator_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength))
                     {
-                        ParameterGuid_t * p = (ParameterGuid_t*)(*it);
-                        for(uint8_t i = 0; i < 16; ++i)
-                        {
-                            if(i < 12)
-                                m_RTPSParticipantKey.value[i] = p->guid.guidPrefix.value[i];
-                            else
-                                m_RTPSParticipantKey.value[i] = p->guid.entityId.value[i - 12];
-                        }
-                        break;
+                        return false;
                     }
-                case PID_ENDPOINT_GUID:
+                    m_unicastLocatorList.push_back(p.locator);
+                    break;
+                }
+            case PID_MULTICAST_LOCATOR:
+                {
+                    ParameterLocator_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength))
                     {
-                        ParameterGuid_t * p = (ParameterGuid_t*)(*it);
-                        m_guid = p->guid;
-                        for(uint8_t i=0;i<16;++i)
-                        {
-                            if(i<12)
-                                m_key.value[i] = p->guid.guidPrefix.value[i];
-                            else
-                                m_key.value[i] = p->guid.entityId.value[i - 12];
-                        }
-                        break;
+                        return false;
                     }
-                case PID_UNICAST_LOCATOR:
+                    m_multicastLocatorList.push_back(p.locator);
+                    break;
+                }
+            case PID_EXPECTS_INLINE_QOS:
+                {
+                    ParameterBool_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength))
                     {
-                        ParameterLocator_t* p = (ParameterLocator_t*)(*it);
-                        m_unicastLocatorList.push_back(p->locator);
-                        break;
+                        return false;
                     }
-                case PID_MULTICAST_LOCATOR:
+                    m_expectsInlineQos = p.value;
+                    break;
+                }
+            case PID_KEY_HASH:
+                {
+                    if(!CDRMessage::readData(msg, m_key.value, 16))
                     {
-                        ParameterLocator_t* p = (ParameterLocator_t*)(*it);
-                        m_multicastLocatorList.push_back(p->locator);
-                        break;
+                        return false;
                     }
-                case PID_EXPECTS_INLINE_QOS:
+                    iHandle2GUID(m_guid, m_key);
+                    break;
+                }
+            case PID_DATA_REPRESENTATION:
+                return m_qos.m_dataRepresentation.readFromCDRMessage(msg, plength);
+            case PID_TYPE_CONSISTENCY_ENFORCEMENT:
+                return m_qos.m_typeConsistency.readFromCDRMessage(msg, plength);
+            case PID_TYPE_IDV1:
+                {
+                    if(!m_type_id.readFromCDRMessage(msg, plength))
                     {
-                        ParameterBool_t*p =(ParameterBool_t*)(*it);
-                        m_expectsInlineQos = p->value;
-                        break;
+                        return false;
                     }
-                case PID_KEY_HASH:
+                    m_topicDiscoveryKind = MINIMAL;
+                    if (m_type_id.m_type_identifier->_d() == EK_COMPLETE)
                     {
-                        ParameterKey_t*p=(ParameterKey_t*)(*it);
-                        m_key = p->key;
-                        iHandle2GUID(m_guid,m_key);
-                        break;
+                        m_topicDiscoveryKind = COMPLETE;
                     }
-                case PID_DATA_REPRESENTATION:
-                {
-                    DataRepresentationQosPolicy * p = (DataRepresentationQosPolicy*)(*it);
-                    m_qos.m_dataRepresentation = *p;
                     break;
                 }
-                case PID_TYPE_CONSISTENCY_ENFORCEMENT:
+            case PID_TYPE_OBJECTV1:
                 {
-                    TypeConsistencyEnforcementQosPolicy * p = (TypeConsistencyEnforcementQosPolicy*)(*it);
-                    m_qos.m_typeConsistency = *p;
-                    break;
-                }
-                case PID_TYPE_IDV1:
+                    if(!m_type.readFromCDRMessage(msg, plength))
                     {
-                        TypeIdV1 * p = (TypeIdV1*)(*it);
-                        m_type_id = *p;
-                        m_topicDiscoveryKind = MINIMAL;
-                        if (m_type_id.m_type_identifier->_d() == EK_COMPLETE)
-                        {
-                            m_topicDiscoveryKind = COMPLETE;
-                        }
-                        break;
+                        return false;
                     }
-                case PID_TYPE_OBJECTV1:
+                    m_topicDiscoveryKind = MINIMAL;
+                    if (m_type.m_type_object->_d() == EK_COMPLETE)
                     {
-                        TypeObjectV1 * p = (TypeObjectV1*)(*it);
-                        m_type = *p;
-                        m_topicDiscoveryKind = MINIMAL;
-                        if (m_type.m_type_object->_d() == EK_COMPLETE)
-                        {
-                            m_topicDiscoveryKind = COMPLETE;
-                        }
-                        break;
+                        m_topicDiscoveryKind = COMPLETE;
                     }
+                    break;
+                }
 #if HAVE_SECURITY
-                case PID_ENDPOINT_SECURITY_INFO:
+            case PID_ENDPOINT_SECURITY_INFO:
+                {
+                    ParameterEndpointSecurityInfo_t p(pid, plength);
+                    if(!p.readFromCDRMessage(msg, plength))
                     {
-                        ParameterEndpointSecurityInfo_t*p=(ParameterEndpointSecurityInfo_t*)(*it);
-                        security_attributes_ = p->security_attributes;
-                        plugin_security_attributes_ = p->plugin_security_attributes;
+                        return false;
                     }
+                    security_attributes_ = p.security_attributes;
+                    plugin_security_attributes_ = p.plugin_security_attributes;
+                    break;
+                }
 #endif
-                default:
-                    {
-                        //logInfo(RTPS_PROXY_DATA,"Parameter with ID: "  <<(uint16_t)(*it)->Pid << " NOT CONSIDERED");
-                        break;
-                    }
-            }
+            default:
+                break;
         }
+
+        return true;
+    };
+
+    uint32_t qos_size;
+    if(ParameterList::readParameterListfromCDRMsg(*msg, param_process, true, qos_size))
+    {
         if(m_guid.entityId.value[3] == 0x04)
             m_topicKind = NO_KEY;
         else if(m_guid.entityId.value[3] == 0x07)
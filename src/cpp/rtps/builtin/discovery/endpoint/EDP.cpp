@@ -88,6 +88,7 @@ bool EDP::newLocalReaderProxyData(RTPSReader* reader, const TopicAttributes& att
     }
 #endif
     reader->m_acceptMessagesFromUnkownWriters = false;
+    mp_RTPSParticipant->reader_matching_changed();
 
     if (att.getTopicDiscoveryKind() != NO_CHECK)
     {
@@ -595,56 +596,60 @@ bool EDP::pairingReader(RTPSReader* R, const ParticipantProxyData& pdata, const
     logInfo(RTPS_EDP, rdata.guid() <<" in topic: \"" << rdata.topicName() <<"\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    for(std::vector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-            pit!=mp_PDP->ParticipantProxiesEnd(); ++pit)
+    // Only the writers on the same topic can match.
+    const std::vector<WriterProxyData*>* writers = mp_PDP->writersOnTopic(rdata.topicName());
+    if(writers == nullptr)
     {
-        for(std::vector<WriterProxyData*>::iterator wdatait = (*pit)->m_writers.begin();
-                wdatait != (*pit)->m_writers.end(); ++wdatait)
-        {
-            bool valid = validMatching(&rdata, *wdatait);
+        return true;
+    }
 
-            if(valid)
-            {
+    for(std::vector<WriterProxyData*>::const_iterator wdatait = writers->begin();
+            wdatait != writers->end(); ++wdatait)
+    {
+        bool valid = validMatching(&rdata, *wdatait);
+
+        if(valid)
+        {
 #if HAVE_SECURITY
-                if(!mp_RTPSParticipant->security_manager().discovered_writer(R->m_guid, (*pit)->m_guid,
-                            **wdatait, R->getAttributes().security_attributes()))
-                {
-                    logError(RTPS_EDP, "Security manager returns an error for reader " << R->getGuid());
-                }
+            if(!mp_RTPSParticipant->security_manager().discovered_writer(R->m_guid,
+                        GUID_t((*wdatait)->guid().guidPrefix, c_EntityId_RTPSParticipant),
+                        **wdatait, R->getAttributes().security_attributes()))
+            {
+                logError(RTPS_EDP, "Security manager returns an error for reader " << R->getGuid());
+            }
 #else
-				RemoteWriterAttributes rwatt = (*wdatait)->toRemoteWriterAttributes();
-                if(R->matched_writer_add(rwatt))
+            RemoteWriterAttributes rwatt = (*wdatait)->toRemoteWriterAttributes();
+            if(R->matched_writer_add(rwatt))
+            {
+                logInfo(RTPS_EDP, "Valid Matching to writerProxy: " << (*wdatait)->guid());
+                //MATCHED AND ADDED CORRECTLY:
+                if(R->getListener()!=nullptr)
                 {
-                    logInfo(RTPS_EDP, "Valid Matching to writerProxy: " << (*wdatait)->guid());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if(R->getListener()!=nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = (*wdatait)->guid();
-                        R->getListener()->onReaderMatched(R,info);
-                    }
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = (*wdatait)->guid();
+                    R->getListener()->onReaderMatched(R,info);
                 }
-#endif
             }
-            else
+#endif
+        }
+        else
+        {
+            //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<(*wdatait)->m_guid<<RTPS_DEF<<endl);
+            if(R->matched_writer_is_matched((*wdatait)->toRemoteWriterAttributes())
+                    && R->matched_writer_remove((*wdatait)->toRemoteWriterAttributes()))
             {
-                //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<(*wdatait)->m_guid<<RTPS_DEF<<endl);
-                if(R->matched_writer_is_matched((*wdatait)->toRemoteWriterAttributes())
-                        && R->matched_writer_remove((*wdatait)->toRemoteWriterAttributes()))
-                {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_writer(R->getGuid(), pdata.m_guid, (*wdatait)->guid());
+                mp_RTPSParticipant->security_manager().remove_writer(R->getGuid(), pdata.m_guid, (*wdatait)->guid());
 #endif
 
-                    //MATCHED AND ADDED CORRECTLY:
-                    if(R->getListener()!=nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = (*wdatait)->guid();
-                        R->getListener()->onReaderMatched(R,info);
-                    }
+                //MATCHED AND ADDED CORRECTLY:
+                if(R->getListener()!=nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = (*wdatait)->guid();
+                    R->getListener()->onReaderMatched(R,info);
                 }
             }
         }
@@ -660,55 +665,59 @@ bool EDP::pairingWriter(RTPSWriter* W, const ParticipantProxyData& pdata, const
     logInfo(RTPS_EDP, W->getGuid() << " in topic: \"" << wdata.topicName() <<"\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    for(std::vector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-            pit!=mp_PDP->ParticipantProxiesEnd(); ++pit)
+    // Only the readers on the same topic can match.
+    const std::vector<ReaderProxyData*>* readers = mp_PDP->readersOnTopic(wdata.topicName());
+    if(readers == nullptr)
     {
-        for(std::vector<ReaderProxyData*>::iterator rdatait = (*pit)->m_readers.begin();
-                rdatait!=(*pit)->m_readers.end(); ++rdatait)
-        {
-            bool valid = validMatching(&wdata, *rdatait);
+        return true;
+    }
 
-            if(valid)
-            {
+    for(std::vector<ReaderProxyData*>::const_iterator rdatait = readers->begin();
+            rdatait != readers->end(); ++rdatait)
+    {
+        bool valid = validMatching(&wdata, *rdatait);
+
+        if(valid)
+        {
 #if HAVE_SECURITY
-                if(!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(), (*pit)->m_guid,
-                            **rdatait, W->getAttributes().security_attributes()))
-                {
-                    logError(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
-                }
+            if(!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(),
+                        GUID_t((*rdatait)->guid().guidPrefix, c_EntityId_RTPSParticipant),
+                        **rdatait, W->getAttributes().security_attributes()))
+            {
+                logError(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
+            }
 #else
-				RemoteReaderAttributes rratt = (*rdatait)->toRemoteReaderAttributes();
-				if(W->matched_reader_add(rratt))
+            RemoteReaderAttributes rratt = (*rdatait)->toRemoteReaderAttributes();
+            if(W->matched_reader_add(rratt))
+            {
+                logInfo(RTPS_EDP,"Valid Matching to readerProxy: " << (*rdatait)->guid());
+                //MATCHED AND ADDED CORRECTLY:
+                if(W->getListener()!=nullptr)
                 {
-                    logInfo(RTPS_EDP,"Valid Matching to readerProxy: " << (*rdatait)->guid());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if(W->getListener()!=nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = (*rdatait)->guid();
-                        W->getListener()->onWriterMatched(W,info);
-                    }
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = (*rdatait)->guid();
+                    W->getListener()->onWriterMatched(W,info);
                 }
-#endif
             }
-            else
+#endif
+        }
+        else
+        {
+            //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<(*wdatait)->m_guid<<RTPS_DEF<<endl);
+            if(W->matched_reader_is_matched((*rdatait)->toRemoteReaderAttributes()) &&
+                    W->matched_reader_remove((*rdatait)->toRemoteReaderAttributes()))
             {
-                //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<(*wdatait)->m_guid<<RTPS_DEF<<endl);
-                if(W->matched_reader_is_matched((*rdatait)->toRemoteReaderAttributes()) &&
-                        W->matched_reader_remove((*rdatait)->toRemoteReaderAttributes()))
-                {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), pdata.m_guid, (*rdatait)->guid());
+                mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), pdata.m_guid, (*rdatait)->guid());
 #endif
-                    //MATCHED AND ADDED CORRECTLY:
-                    if(W->getListener()!=nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = (*rdatait)->guid();
-                        W->getListener()->onWriterMatched(W,info);
-                    }
+                //MATCHED AND ADDED CORRECTLY:
+                if(W->getListener()!=nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = (*rdatait)->guid();
+                    W->getListener()->onWriterMatched(W,info);
                 }
             }
         }
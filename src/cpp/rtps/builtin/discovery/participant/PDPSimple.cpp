@@ -53,6 +53,7 @@
 
 #include <fastrtps/log/Log.h>
 
+#include <algorithm>
 #include <mutex>
 
 using namespace eprosima::fastrtps;
@@ -96,10 +97,9 @@ PDPSimple::~PDPSimple()
     delete(mp_SPDPReaderHistory);
 
     delete(mp_listener);
-    for(auto it = this->m_participantProxies.begin();
-            it!=this->m_participantProxies.end();++it)
+    for(ParticipantProxyData* pdata : m_index.participants())
     {
-        delete(*it);
+        delete(pdata);
     }
 
     delete(mp_mutex);
@@ -224,8 +224,12 @@ bool PDPSimple::initPDP(RTPSParticipantImpl* part)
     }
     //UPDATE METATRAFFIC.
     mp_builtin->updateMetatrafficLocators(this->mp_SPDPReader->getAttributes().unicastLocatorList);
-    m_participantProxies.push_back(new ParticipantProxyData());
-    initializeParticipantProxyData(m_participantProxies.front());
+    ParticipantProxyData* local_participant = new ParticipantProxyData();
+    initializeParticipantProxyData(local_participant);
+    {
+        std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
+        addParticipantProxyData(local_participant);
+    }
 
     //INIT EDP
     if(m_discovery.use_STATIC_EndpointDiscoveryProtocol)
@@ -363,19 +367,12 @@ void PDPSimple::announceParticipantState(bool new_change, bool dispose)
 bool PDPSimple::lookupReaderProxyData(const GUID_t& reader, ReaderProxyData& rdata, ParticipantProxyData& pdata)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (auto pit = m_participantProxies.begin();
-            pit != m_participantProxies.end();++pit)
+    ReaderProxyData* rdata_ptr = m_index.findReader(reader);
+    if(rdata_ptr != nullptr)
     {
-        for (auto rit = (*pit)->m_readers.begin();
-                rit != (*pit)->m_readers.end();++rit)
-        {
-            if((*rit)->guid() == reader)
-            {
-                rdata.copy(*rit);
-                pdata.copy(**pit);
-                return true;
-            }
-        }
+        rdata.copy(rdata_ptr);
+        pdata.copy(*findParticipantProxyData(reader.guidPrefix));
+        return true;
     }
     return false;
 }
@@ -383,19 +380,12 @@ bool PDPSimple::lookupReaderProxyData(const GUID_t& reader, ReaderProxyData& rda
 bool PDPSimple::lookupWriterProxyData(const GUID_t& writer, WriterProxyData& wdata, ParticipantProxyData& pdata)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (auto pit = m_participantProxies.begin();
-            pit != m_participantProxies.end(); ++pit)
+    WriterProxyData* wdata_ptr = m_index.findWriter(writer);
+    if(wdata_ptr != nullptr)
     {
-        for (auto wit = (*pit)->m_writers.begin();
-                wit != (*pit)->m_writers.end(); ++wit)
-        {
-            if((*wit)->guid() == writer)
-            {
-                wdata.copy(*wit);
-                pdata.copy(**pit);
-                return true;
-            }
-        }
+        wdata.copy(wdata_ptr);
+        pdata.copy(*findParticipantProxyData(writer.guidPrefix));
+        return true;
     }
     return false;
 }
@@ -405,33 +395,27 @@ bool PDPSimple::removeReaderProxyData(const GUID_t& reader_guid)
     logInfo(RTPS_PDP, "Removing reader proxy data " << reader_guid);
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (auto pit = m_participantProxies.begin();
-            pit != m_participantProxies.end(); ++pit)
+    ReaderProxyData* rdata = m_index.findReader(reader_guid);
+    if(rdata == nullptr)
     {
-        for (auto rit = (*pit)->m_readers.begin();
-                rit != (*pit)->m_readers.end(); ++rit)
-        {
-            if((*rit)->guid() == reader_guid)
-            {
-                mp_EDP->unpairReaderProxy((*pit)->m_guid, reader_guid);
+        return false;
+    }
 
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if(listener)
-                {
-                    ReaderDiscoveryInfo info;
-                    info.status = ReaderDiscoveryInfo::REMOVED_READER;
-                    info.info = std::move(**rit);
-                    listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                }
+    ParticipantProxyData* pdata = findParticipantProxyData(reader_guid.guidPrefix);
+    mp_EDP->unpairReaderProxy(pdata->m_guid, reader_guid);
+    m_index.removeReader(rdata);
 
-                delete *rit;
-                (*pit)->m_readers.erase(rit);
-                return true;
-            }
-        }
+    RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+    if(listener)
+    {
+        ReaderDiscoveryInfo info;
+        info.status = ReaderDiscoveryInfo::REMOVED_READER;
+        info.info = std::move(*rdata);
+        listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
     }
 
-    return false;
+    delete rdata;
+    return true;
 }
 
 bool PDPSimple::removeWriterProxyData(const GUID_t& writer_guid)
@@ -439,33 +423,27 @@ bool PDPSimple::removeWriterProxyData(const GUID_t& writer_guid)
     logInfo(RTPS_PDP, "Removing writer proxy data " << writer_guid);
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (auto pit = m_participantProxies.begin();
-            pit != m_participantProxies.end(); ++pit)
+    WriterProxyData* wdata = m_index.findWriter(writer_guid);
+    if(wdata == nullptr)
     {
-        for (auto wit = (*pit)->m_writers.begin();
-                wit != (*pit)->m_writers.end(); ++wit)
-        {
-            if((*wit)->guid() == writer_guid)
-            {
-                mp_EDP->unpairWriterProxy((*pit)->m_guid, writer_guid);
+        return false;
+    }
 
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if(listener)
-                {
-                    WriterDiscoveryInfo info;
-                    info.status = WriterDiscoveryInfo::REMOVED_WRITER;
-                    info.info = std::move(**wit);
-                    listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                }
+    ParticipantProxyData* pdata = findParticipantProxyData(writer_guid.guidPrefix);
+    mp_EDP->unpairWriterProxy(pdata->m_guid, writer_guid);
+    m_index.removeWriter(wdata);
 
-                delete *wit;
-                (*pit)->m_writers.erase(wit);
-                return true;
-            }
-        }
+    RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+    if(listener)
+    {
+        WriterDiscoveryInfo info;
+        info.status = WriterDiscoveryInfo::REMOVED_WRITER;
+        info.info = std::move(*wdata);
+        listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
     }
 
-    return false;
+    delete wdata;
+    return true;
 }
 
 
@@ -473,18 +451,35 @@ bool PDPSimple::lookupParticipantProxyData(const GUID_t& pguid, ParticipantProxy
 {
     logInfo(RTPS_PDP,pguid);
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for(std::vector<ParticipantProxyData*>::iterator pit = m_participantProxies.begin();
-            pit!=m_participantProxies.end();++pit)
+    ParticipantProxyData* participant = findParticipantProxyData(pguid.guidPrefix);
+    if(participant != nullptr && participant->m_guid == pguid)
     {
-        if((*pit)->m_guid == pguid)
-        {
-            pdata.copy(**pit);
-            return true;
-        }
+        pdata.copy(*participant);
+        return true;
     }
     return false;
 }
 
+const std::vector<ReaderProxyData*>* PDPSimple::readersOnTopic(const std::string& topic_name) const
+{
+    return m_index.readersOnTopic(topic_name);
+}
+
+const std::vector<WriterProxyData*>* PDPSimple::writersOnTopic(const std::string& topic_name) const
+{
+    return m_index.writersOnTopic(topic_name);
+}
+
+ParticipantProxyData* PDPSimple::findParticipantProxyData(const GuidPrefix_t& prefix) const
+{
+    return m_index.findParticipant(prefix);
+}
+
+void PDPSimple::addParticipantProxyData(ParticipantProxyData* pdata)
+{
+    m_index.addParticipant(pdata);
+}
+
 bool PDPSimple::createSPDPEndpoints()
 {
     logInfo(RTPS_PDP,"Beginning");
@@ -595,61 +590,55 @@ bool PDPSimple::addReaderProxyData(ReaderProxyData* rdata, ParticipantProxyData&
 
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for(std::vector<ParticipantProxyData*>::iterator pit = m_participantProxies.begin();
-            pit!=m_participantProxies.end();++pit)
+    ParticipantProxyData* participant = findParticipantProxyData(rdata->guid().guidPrefix);
+    if(participant == nullptr)
     {
-        if((*pit)->m_guid.guidPrefix == rdata->guid().guidPrefix)
-        {
-            // Set locators information if not defined by ReaderProxyData.
-            if(rdata->unicastLocatorList().empty() && rdata->multicastLocatorList().empty())
-            {
-                rdata->unicastLocatorList((*pit)->m_defaultUnicastLocatorList);
-                rdata->multicastLocatorList((*pit)->m_defaultMulticastLocatorList);
-            }
-            // Set as alive.
-            rdata->isAlive(true);
+        return false;
+    }
 
-            // Copy participant data to be used outside.
-            pdata.copy(**pit);
+    // Set locators information if not defined by ReaderProxyData.
+    if(rdata->unicastLocatorList().empty() && rdata->multicastLocatorList().empty())
+    {
+        rdata->unicastLocatorList(participant->m_defaultUnicastLocatorList);
+        rdata->multicastLocatorList(participant->m_defaultMulticastLocatorList);
+    }
+    // Set as alive.
+    rdata->isAlive(true);
 
-            // Check that it is not already there:
-            for(std::vector<ReaderProxyData*>::iterator rit = (*pit)->m_readers.begin();
-                    rit!=(*pit)->m_readers.end();++rit)
-            {
-                if((*rit)->guid().entityId == rdata->guid().entityId)
-                {
-                    (*rit)->update(rdata);
+    // Copy participant data to be used outside.
+    pdata.copy(*participant);
 
-                    RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                    if(listener)
-                    {
-                        ReaderDiscoveryInfo info;
-                        info.status = ReaderDiscoveryInfo::CHANGED_QOS_READER;
-                        info.info = *rdata;
-                        listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                    }
+    // Check that it is not already there:
+    ReaderProxyData* registered = m_index.findReader(rdata->guid());
+    if(registered != nullptr)
+    {
+        registered->update(rdata);
 
-                    return true;
-                }
-            }
+        RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+        if(listener)
+        {
+            ReaderDiscoveryInfo info;
+            info.status = ReaderDiscoveryInfo::CHANGED_QOS_READER;
+            info.info = *rdata;
+            listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
+        }
 
-            ReaderProxyData* newRPD = new ReaderProxyData(*rdata);
-            (*pit)->m_readers.push_back(newRPD);
+        return true;
+    }
 
-            RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-            if(listener)
-            {
-                ReaderDiscoveryInfo info;
-                info.status = ReaderDiscoveryInfo::DISCOVERED_READER;
-                info.info = *rdata;
-                listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-            }
+    ReaderProxyData* newRPD = new ReaderProxyData(*rdata);
+    m_index.addReader(participant, newRPD);
 
-            return true;
-        }
+    RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+    if(listener)
+    {
+        ReaderDiscoveryInfo info;
+        info.status = ReaderDiscoveryInfo::DISCOVERED_READER;
+        info.info = *rdata;
+        listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
     }
 
-    return false;
+    return true;
 }
 
 bool PDPSimple::addWriterProxyData(WriterProxyData* wdata, ParticipantProxyData& pdata)
@@ -658,60 +647,55 @@ bool PDPSimple::addWriterProxyData(WriterProxyData* wdata, ParticipantProxyData&
 
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for(std::vector<ParticipantProxyData*>::iterator pit = m_participantProxies.begin();
-            pit!=m_participantProxies.end();++pit)
+    ParticipantProxyData* participant = findParticipantProxyData(wdata->guid().guidPrefix);
+    if(participant == nullptr)
     {
-        if((*pit)->m_guid.guidPrefix == wdata->guid().guidPrefix)
-        {
-            // Set locators information if not defined by ReaderProxyData.
-            if(wdata->unicastLocatorList().empty() && wdata->multicastLocatorList().empty())
-            {
-                wdata->unicastLocatorList((*pit)->m_defaultUnicastLocatorList);
-                wdata->multicastLocatorList((*pit)->m_defaultMulticastLocatorList);
-            }
-            // Set as alive.
-            wdata->isAlive(true);
+        return false;
+    }
 
-            // Copy participant data to be used outside.
-            pdata.copy(**pit);
+    // Set locators information if not defined by ReaderProxyData.
+    if(wdata->unicastLocatorList().empty() && wdata->multicastLocatorList().empty())
+    {
+        wdata->unicastLocatorList(participant->m_defaultUnicastLocatorList);
+        wdata->multicastLocatorList(participant->m_defaultMulticastLocatorList);
+    }
+    // Set as alive.
+    wdata->isAlive(true);
 
-            //CHECK THAT IT IS NOT ALREADY THERE:
-            for(std::vector<WriterProxyData*>::iterator wit = (*pit)->m_writers.begin();
-                    wit!=(*pit)->m_writers.end();++wit)
-            {
-                if((*wit)->guid().entityId == wdata->guid().entityId)
-                {
-                    (*wit)->update(wdata);
+    // Copy participant data to be used outside.
+    pdata.copy(*participant);
 
-                    RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                    if(listener)
-                    {
-                        WriterDiscoveryInfo info;
-                        info.status = WriterDiscoveryInfo::CHANGED_QOS_WRITER;
-                        info.info = *wdata;
-                        listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                    }
+    //CHECK THAT IT IS NOT ALREADY THERE:
+    WriterProxyData* registered = m_index.findWriter(wdata->guid());
+    if(registered != nullptr)
+    {
+        registered->update(wdata);
 
-                    return true;
-                }
-            }
+        RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+        if(listener)
+        {
+            WriterDiscoveryInfo info;
+            info.status = WriterDiscoveryInfo::CHANGED_QOS_WRITER;
+            info.info = *wdata;
+            listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
+        }
 
-            WriterProxyData* newWPD = new WriterProxyData(*wdata);
-            (*pit)->m_writers.push_back(newWPD);
+        return true;
+    }
 
-            RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-            if(listener)
-            {
-                WriterDiscoveryInfo info;
-                info.status = WriterDiscoveryInfo::DISCOVERED_WRITER;
-                info.info = *wdata;
-                listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-            }
+    WriterProxyData* newWPD = new WriterProxyData(*wdata);
+    m_index.addWriter(participant, newWPD);
 
-            return true;
-        }
+    RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+    if(listener)
+    {
+        WriterDiscoveryInfo info;
+        info.status = WriterDiscoveryInfo::DISCOVERED_WRITER;
+        info.info = *wdata;
+        listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
     }
-    return false;
+
+    return true;
 }
 
 void PDPSimple::assignRemoteEndpoints(ParticipantProxyData* pdata)
@@ -807,15 +791,14 @@ bool PDPSimple::removeRemoteParticipant(GUID_t& partGUID)
 
     //Remove it from our vector or RTPSParticipantProxies:
     this->mp_mutex->lock();
-    for(std::vector<ParticipantProxyData*>::iterator pit = m_participantProxies.begin();
-            pit!=m_participantProxies.end();++pit)
+    pdata = findParticipantProxyData(partGUID.guidPrefix);
+    if(pdata != nullptr && pdata->m_guid == partGUID)
     {
-        if((*pit)->m_guid == partGUID)
-        {
-            pdata = *pit;
-            m_participantProxies.erase(pit);
-            break;
-        }
+        m_index.removeParticipant(pdata);
+    }
+    else
+    {
+        pdata = nullptr;
     }
     this->mp_mutex->unlock();
 
@@ -884,20 +867,16 @@ bool PDPSimple::removeRemoteParticipant(GUID_t& partGUID)
 void PDPSimple::assertRemoteParticipantLiveliness(const GuidPrefix_t& guidP)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for(std::vector<ParticipantProxyData*>::iterator it = this->m_participantProxies.begin();
-            it!=this->m_participantProxies.end();++it)
+    ParticipantProxyData* pdata = findParticipantProxyData(guidP);
+    if(pdata != nullptr)
     {
-        if((*it)->m_guid.guidPrefix == guidP)
+        logInfo(RTPS_LIVELINESS,"RTPSParticipant "<< pdata->m_guid << " is Alive");
+        // TODO Ricardo: Study if isAlive attribute is necessary.
+        pdata->isAlive = true;
+        if(pdata->mp_leaseDurationTimer != nullptr)
         {
-            logInfo(RTPS_LIVELINESS,"RTPSParticipant "<< (*it)->m_guid << " is Alive");
-            // TODO Ricardo: Study if isAlive attribute is necessary.
-            (*it)->isAlive = true;
-            if((*it)->mp_leaseDurationTimer != nullptr)
-            {
-                (*it)->mp_leaseDurationTimer->cancel_timer();
-                (*it)->mp_leaseDurationTimer->restart_timer();
-            }
-            break;
+            pdata->mp_leaseDurationTimer->cancel_timer();
+            pdata->mp_leaseDurationTimer->restart_timer();
         }
     }
 }
@@ -907,8 +886,9 @@ void PDPSimple::assertLocalWritersLiveliness(LivelinessQosPolicyKind kind)
     logInfo(RTPS_LIVELINESS,"of type " << (kind==AUTOMATIC_LIVELINESS_QOS?"AUTOMATIC":"")
             <<(kind==MANUAL_BY_PARTICIPANT_LIVELINESS_QOS?"MANUAL_BY_PARTICIPANT":""));
     std::lock_guard<std::recursive_mutex> guard(*this->mp_mutex);
-    for(std::vector<WriterProxyData*>::iterator wit = this->m_participantProxies.front()->m_writers.begin();
-            wit!=this->m_participantProxies.front()->m_writers.end();++wit)
+    ParticipantProxyData* local_participant = getLocalParticipantProxyData();
+    for(std::vector<WriterProxyData*>::iterator wit = local_participant->m_writers.begin();
+            wit!=local_participant->m_writers.end();++wit)
     {
         if((*wit)->m_qos.m_liveliness.kind == kind)
         {
@@ -925,34 +905,30 @@ void PDPSimple::assertRemoteWritersLiveliness(GuidPrefix_t& guidP,LivelinessQosP
     logInfo(RTPS_LIVELINESS,"of type " << (kind==AUTOMATIC_LIVELINESS_QOS?"AUTOMATIC":"")
             <<(kind==MANUAL_BY_PARTICIPANT_LIVELINESS_QOS?"MANUAL_BY_PARTICIPANT":""));
 
-    for(std::vector<ParticipantProxyData*>::iterator pit=this->m_participantProxies.begin();
-            pit!=this->m_participantProxies.end();++pit)
+    ParticipantProxyData* pdata = findParticipantProxyData(guidP);
+    if(pdata != nullptr)
     {
-        if((*pit)->m_guid.guidPrefix == guidP)
+        for(std::vector<WriterProxyData*>::iterator wit = pdata->m_writers.begin();
+                wit != pdata->m_writers.end();++wit)
         {
-            for(std::vector<WriterProxyData*>::iterator wit = (*pit)->m_writers.begin();
-                    wit != (*pit)->m_writers.end();++wit)
+            if((*wit)->m_qos.m_liveliness.kind == kind)
             {
-                if((*wit)->m_qos.m_liveliness.kind == kind)
+                (*wit)->isAlive(true);
+                for(std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
+                        rit!=mp_RTPSParticipant->userReadersListEnd();++rit)
                 {
-                    (*wit)->isAlive(true);
-                    for(std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
-                            rit!=mp_RTPSParticipant->userReadersListEnd();++rit)
+                    if((*rit)->getAttributes().reliabilityKind == RELIABLE)
                     {
-                        if((*rit)->getAttributes().reliabilityKind == RELIABLE)
+                        StatefulReader* sfr = (StatefulReader*)(*rit);
+                        WriterProxy* WP;
+                        if(sfr->matched_writer_lookup((*wit)->guid(), &WP))
                         {
-                            StatefulReader* sfr = (StatefulReader*)(*rit);
-                            WriterProxy* WP;
-                            if(sfr->matched_writer_lookup((*wit)->guid(), &WP))
-                            {
-                                WP->assertLiveliness();
-                                continue;
-                            }
+                            WP->assertLiveliness();
+                            continue;
                         }
                     }
                 }
             }
-            break;
         }
     }
 }
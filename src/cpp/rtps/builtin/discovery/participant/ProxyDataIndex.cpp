@@ -0,0 +1,188 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ProxyDataIndex.cpp
+ *
+ */
+
+#include <fastrtps/rtps/builtin/discovery/participant/ProxyDataIndex.h>
+#include <fastrtps/rtps/builtin/data/ParticipantProxyData.h>
+#include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
+#include <fastrtps/rtps/builtin/data/WriterProxyData.h>
+
+#include <algorithm>
+
+namespace eprosima {
+namespace fastrtps{
+namespace rtps {
+
+void ProxyDataIndex::addParticipant(ParticipantProxyData* pdata)
+{
+    m_participants.push_back(pdata);
+    m_participantsByPrefix[pdata->m_guid.guidPrefix] = pdata;
+    for(ReaderProxyData* rdata : pdata->m_readers)
+    {
+        indexReader(rdata);
+    }
+    for(WriterProxyData* wdata : pdata->m_writers)
+    {
+        indexWriter(wdata);
+    }
+}
+
+bool ProxyDataIndex::removeParticipant(ParticipantProxyData* pdata)
+{
+    auto it = std::find(m_participants.begin(), m_participants.end(), pdata);
+    if(it == m_participants.end())
+    {
+        return false;
+    }
+
+    m_participants.erase(it);
+    m_participantsByPrefix.erase(pdata->m_guid.guidPrefix);
+    for(ReaderProxyData* rdata : pdata->m_readers)
+    {
+        unindexReader(rdata);
+    }
+    for(WriterProxyData* wdata : pdata->m_writers)
+    {
+        unindexWriter(wdata);
+    }
+    return true;
+}
+
+ParticipantProxyData* ProxyDataIndex::findParticipant(const GuidPrefix_t& prefix) const
+{
+    auto it = m_participantsByPrefix.find(prefix);
+    return (it == m_participantsByPrefix.end()) ? nullptr : it->second;
+}
+
+void ProxyDataIndex::addReader(ParticipantProxyData* pdata, ReaderProxyData* rdata)
+{
+    pdata->m_readers.push_back(rdata);
+    indexReader(rdata);
+}
+
+bool ProxyDataIndex::removeReader(ReaderProxyData* rdata)
+{
+    auto index_it = m_readersByGuid.find(rdata->guid());
+    if(index_it == m_readersByGuid.end() || index_it->second != rdata)
+    {
+        return false;
+    }
+
+    unindexReader(rdata);
+    ParticipantProxyData* pdata = findParticipant(rdata->guid().guidPrefix);
+    if(pdata != nullptr)
+    {
+        pdata->m_readers.erase(std::remove(pdata->m_readers.begin(), pdata->m_readers.end(), rdata),
+                pdata->m_readers.end());
+    }
+    return true;
+}
+
+ReaderProxyData* ProxyDataIndex::findReader(const GUID_t& guid) const
+{
+    auto it = m_readersByGuid.find(guid);
+    return (it == m_readersByGuid.end()) ? nullptr : it->second;
+}
+
+void ProxyDataIndex::addWriter(ParticipantProxyData* pdata, WriterProxyData* wdata)
+{
+    pdata->m_writers.push_back(wdata);
+    indexWriter(wdata);
+}
+
+bool ProxyDataIndex::removeWriter(WriterProxyData* wdata)
+{
+    auto index_it = m_writersByGuid.find(wdata->guid());
+    if(index_it == m_writersByGuid.end() || index_it->second != wdata)
+    {
+        return false;
+    }
+
+    unindexWriter(wdata);
+    ParticipantProxyData* pdata = findParticipant(wdata->guid().guidPrefix);
+    if(pdata != nullptr)
+    {
+        pdata->m_writers.erase(std::remove(pdata->m_writers.begin(), pdata->m_writers.end(), wdata),
+                pdata->m_writers.end());
+    }
+    return true;
+}
+
+WriterProxyData* ProxyDataIndex::findWriter(const GUID_t& guid) const
+{
+    auto it = m_writersByGuid.find(guid);
+    return (it == m_writersByGuid.end()) ? nullptr : it->second;
+}
+
+const std::vector<ReaderProxyData*>* ProxyDataIndex::readersOnTopic(const std::string& topic_name) const
+{
+    auto it = m_readersByTopic.find(topic_name);
+    return (it == m_readersByTopic.end()) ? nullptr : &it->second;
+}
+
+const std::vector<WriterProxyData*>* ProxyDataIndex::writersOnTopic(const std::string& topic_name) const
+{
+    auto it = m_writersByTopic.find(topic_name);
+    return (it == m_writersByTopic.end()) ? nullptr : &it->second;
+}
+
+void ProxyDataIndex::indexReader(ReaderProxyData* rdata)
+{
+    m_readersByGuid[rdata->guid()] = rdata;
+    m_readersByTopic[rdata->topicName()].push_back(rdata);
+}
+
+void ProxyDataIndex::unindexReader(ReaderProxyData* rdata)
+{
+    m_readersByGuid.erase(rdata->guid());
+    auto topic_it = m_readersByTopic.find(rdata->topicName());
+    if(topic_it != m_readersByTopic.end())
+    {
+        std::vector<ReaderProxyData*>& readers = topic_it->second;
+        readers.erase(std::remove(readers.begin(), readers.end(), rdata), readers.end());
+        if(readers.empty())
+        {
+            m_readersByTopic.erase(topic_it);
+        }
+    }
+}
+
+void ProxyDataIndex::indexWriter(WriterProxyData* wdata)
+{
+    m_writersByGuid[wdata->guid()] = wdata;
+    m_writersByTopic[wdata->topicName()].push_back(wdata);
+}
+
+void ProxyDataIndex::unindexWriter(WriterProxyData* wdata)
+{
+    m_writersByGuid.erase(wdata->guid());
+    auto topic_it = m_writersByTopic.find(wdata->topicName());
+    if(topic_it != m_writersByTopic.end())
+    {
+        std::vector<WriterProxyData*>& writers = topic_it->second;
+        writers.erase(std::remove(writers.begin(), writers.end(), wdata), writers.end());
+        if(writers.empty())
+        {
+            m_writersByTopic.erase(topic_it);
+        }
+    }
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
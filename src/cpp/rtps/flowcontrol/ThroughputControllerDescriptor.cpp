@@ -18,11 +18,19 @@ namespace eprosima{
 namespace fastrtps{
 namespace rtps{
 
-ThroughputControllerDescriptor::ThroughputControllerDescriptor(): bytesPerPeriod(UINT32_MAX), periodMillisecs(0)
+ThroughputControllerDescriptor::ThroughputControllerDescriptor(): bytesPerPeriod(UINT32_MAX), periodMillisecs(0),
+    kind(PERIODIC_THROUGHPUT_CONTROLLER), burstBytes(0), refillMillisecs(1)
 {
 }
 
-ThroughputControllerDescriptor::ThroughputControllerDescriptor(uint32_t size, uint32_t time): bytesPerPeriod(size), periodMillisecs(time)
+ThroughputControllerDescriptor::ThroughputControllerDescriptor(uint32_t size, uint32_t time): bytesPerPeriod(size), periodMillisecs(time),
+    kind(PERIODIC_THROUGHPUT_CONTROLLER), burstBytes(0), refillMillisecs(1)
+{
+}
+
+ThroughputControllerDescriptor::ThroughputControllerDescriptor(uint32_t size, uint32_t time,
+        ThroughputControllerKind_t controllerKind, uint32_t burst, uint32_t refill): bytesPerPeriod(size), periodMillisecs(time),
+    kind(controllerKind), burstBytes(burst), refillMillisecs(refill)
 {
 }
 
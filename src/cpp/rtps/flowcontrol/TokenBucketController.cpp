@@ -0,0 +1,235 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "TokenBucketController.h"
+#include <fastrtps/rtps/resources/AsyncWriterThread.h>
+#include <asio.hpp>
+#include <asio/steady_timer.hpp>
+#include <cassert>
+
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+static std::chrono::milliseconds refill_period(const ThroughputControllerDescriptor& descriptor)
+{
+    return std::chrono::milliseconds(descriptor.refillMillisecs == 0 ? 1 : descriptor.refillMillisecs);
+}
+
+static uint64_t burst_bytes(const ThroughputControllerDescriptor& descriptor)
+{
+    return descriptor.burstBytes == 0 ? descriptor.bytesPerPeriod : descriptor.burstBytes;
+}
+
+TokenBucketController::TokenBucketController(const ThroughputControllerDescriptor& descriptor, const RTPSWriter* associatedWriter):
+    mBytesPerPeriod(descriptor.bytesPerPeriod),
+    mPeriodMillisecs(descriptor.periodMillisecs),
+    mBurstBytes(burst_bytes(descriptor)),
+    mRefillPeriod(refill_period(descriptor)),
+    mTokens(mBurstBytes),
+    mTokenRemainder(0),
+    mLastRefill(std::chrono::steady_clock::now()),
+    mWakeUpState(std::make_shared<WakeUpState>()),
+    mWakeUpTimer(*FlowController::ControllerService)
+{
+    mWakeUpState->alive = true;
+    mWakeUpState->pending = false;
+    mWakeUpState->participant = nullptr;
+    mWakeUpState->writer = associatedWriter;
+}
+
+TokenBucketController::TokenBucketController(const ThroughputControllerDescriptor& descriptor, const RTPSParticipantImpl* associatedParticipant):
+    mBytesPerPeriod(descriptor.bytesPerPeriod),
+    mPeriodMillisecs(descriptor.periodMillisecs),
+    mBurstBytes(burst_bytes(descriptor)),
+    mRefillPeriod(refill_period(descriptor)),
+    mTokens(mBurstBytes),
+    mTokenRemainder(0),
+    mLastRefill(std::chrono::steady_clock::now()),
+    mWakeUpState(std::make_shared<WakeUpState>()),
+    mWakeUpTimer(*FlowController::ControllerService)
+{
+    mWakeUpState->alive = true;
+    mWakeUpState->pending = false;
+    mWakeUpState->participant = associatedParticipant;
+    mWakeUpState->writer = nullptr;
+}
+
+TokenBucketController::~TokenBucketController()
+{
+    std::unique_lock<std::mutex> scopedLock(mTokenBucketMutex);
+    {
+        std::unique_lock<std::mutex> wakeUpLock(mWakeUpState->mutex);
+        mWakeUpState->alive = false;
+    }
+    mWakeUpTimer.cancel();
+}
+
+void TokenBucketController::operator()(RTPSWriterCollector<ReaderLocator*>& changesToSend)
+{
+    filter_nts_(changesToSend);
+}
+
+void TokenBucketController::operator()(RTPSWriterCollector<ReaderProxy*>& changesToSend)
+{
+    filter_nts_(changesToSend);
+}
+
+uint32_t TokenBucketController::available_bytes()
+{
+    std::unique_lock<std::mutex> scopedLock(mTokenBucketMutex);
+    refill_nts_(std::chrono::steady_clock::now());
+    return static_cast<uint32_t>(mTokens);
+}
+
+template<class T>
+void TokenBucketController::filter_nts_(RTPSWriterCollector<T>& changesToSend)
+{
+    std::unique_lock<std::mutex> scopedLock(mTokenBucketMutex);
+
+    // The clock is read once for the whole collection.
+    refill_nts_(std::chrono::steady_clock::now());
+
+    auto it = changesToSend.items().begin();
+
+    while(it != changesToSend.items().end())
+    {
+        if(!process_change_nts_(it->cacheChange, it->fragmentNumber))
+            break;
+
+        ++it;
+    }
+
+    changesToSend.items().erase(it, changesToSend.items().end());
+}
+
+bool TokenBucketController::process_change_nts_(CacheChange_t* change, const FragmentNumber_t fragNum)
+{
+    assert(change != nullptr);
+
+    uint64_t dataLength = change->serializedPayload.length;
+
+    // Fragment numbers start at 1. The last fragment carries the rest of the payload.
+    if (fragNum != 0)
+        dataLength = fragNum != change->getFragmentCount() ?
+            change->getFragmentSize() : change->serializedPayload.length - ((fragNum - 1) * change->getFragmentSize());
+
+    if(dataLength <= mTokens)
+    {
+        mTokens -= dataLength;
+        return true;
+    }
+
+    if(dataLength > mBurstBytes)
+    {
+        // It would never fit, so it takes the whole bucket.
+        if(mTokens == mBurstBytes)
+        {
+            mTokens = 0;
+            return true;
+        }
+
+        dataLength = mBurstBytes;
+    }
+
+    schedule_wake_up_nts_(dataLength);
+    return false;
+}
+
+void TokenBucketController::refill_nts_(std::chrono::steady_clock::time_point now)
+{
+    if(now < mLastRefill + mRefillPeriod)
+        return;
+
+    std::chrono::milliseconds::rep elapsedGranules = (now - mLastRefill) / mRefillPeriod;
+    mLastRefill += elapsedGranules * mRefillPeriod;
+    uint64_t granules = static_cast<uint64_t>(elapsedGranules);
+
+    if(mTokens >= mBurstBytes)
+        return;
+
+    uint64_t bytesPerGranule = static_cast<uint64_t>(mRefillPeriod.count()) * mBytesPerPeriod;
+    if(bytesPerGranule == 0)
+        return;
+
+    // Checked first so the computation below cannot overflow after a long idle time.
+    uint64_t missing = (mBurstBytes - mTokens) * mPeriodMillisecs;
+    if(granules >= (missing + bytesPerGranule - 1) / bytesPerGranule)
+    {
+        mTokens = mBurstBytes;
+        mTokenRemainder = 0;
+        return;
+    }
+
+    uint64_t accumulated = granules * bytesPerGranule + mTokenRemainder;
+    mTokens += accumulated / mPeriodMillisecs;
+    mTokenRemainder = accumulated % mPeriodMillisecs;
+
+    if(mTokens >= mBurstBytes)
+    {
+        mTokens = mBurstBytes;
+        mTokenRemainder = 0;
+    }
+}
+
+void TokenBucketController::schedule_wake_up_nts_(uint64_t neededBytes)
+{
+    uint64_t bytesPerGranule = static_cast<uint64_t>(mRefillPeriod.count()) * mBytesPerPeriod;
+    if(bytesPerGranule == 0)
+        return;
+
+    std::shared_ptr<WakeUpState> state = mWakeUpState;
+
+    {
+        std::unique_lock<std::mutex> wakeUpLock(state->mutex);
+        if(state->pending)
+            return;
+        state->pending = true;
+    }
+
+    uint64_t missing = (neededBytes - mTokens) * mPeriodMillisecs;
+    missing = missing > mTokenRemainder ? missing - mTokenRemainder : 0;
+    uint64_t granules = (missing + bytesPerGranule - 1) / bytesPerGranule;
+    if(granules == 0)
+        granules = 1;
+
+    mWakeUpTimer.expires_at(mLastRefill + static_cast<std::chrono::milliseconds::rep>(granules) * mRefillPeriod);
+    mWakeUpTimer.async_wait([state](const asio::error_code& error)
+        {
+            if(error == asio::error::operation_aborted)
+                return;
+
+            const RTPSParticipantImpl* participant = nullptr;
+            const RTPSWriter* writer = nullptr;
+
+            {
+                std::unique_lock<std::mutex> wakeUpLock(state->mutex);
+                if(!state->alive)
+                    return;
+                state->pending = false;
+                participant = state->participant;
+                writer = state->writer;
+            }
+
+            if (writer)
+                AsyncWriterThread::wakeUp(writer);
+            else if (participant)
+                AsyncWriterThread::wakeUp(participant);
+        });
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,94 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOKEN_BUCKET_CONTROLLER_H
+#define TOKEN_BUCKET_CONTROLLER_H
+
+#include "FlowController.h"
+#include <fastrtps/rtps/flowcontrol/ThroughputControllerDescriptor.h>
+
+#include <chrono>
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+class RTPSWriter;
+class RTPSParticipantImpl;
+
+/**
+ * Filter that clears changes while there are tokens (bytes) left in a bucket.
+ * The bucket holds up to 'burstBytes' and it is refilled at 'bytesPerPeriod' every 'periodMillisecs',
+ * in steps of 'refillMillisecs'. Refilling is done lazily from the monotonic clock when the filter runs,
+ * so clearing a change does not arm any timer. A single timer is armed when the bucket drains, to wake up
+ * the writer when there are enough tokens for the first change that was held back.
+ * A change bigger than the bucket is cleared when the bucket is full.
+ */
+class TokenBucketController : public FlowController
+{
+public:
+   TokenBucketController(const ThroughputControllerDescriptor&, const RTPSWriter* associatedWriter);
+   TokenBucketController(const ThroughputControllerDescriptor&, const RTPSParticipantImpl* associatedParticipant);
+   virtual ~TokenBucketController();
+
+   virtual void operator()(RTPSWriterCollector<ReaderLocator*>& changesToSend);
+   virtual void operator()(RTPSWriterCollector<ReaderProxy*>& changesToSend);
+
+   //! Tokens currently in the bucket. Mainly for testing.
+   uint32_t available_bytes();
+
+private:
+
+   //! State shared with the wake up timer, so it can outlive the controller.
+   struct WakeUpState
+   {
+       std::mutex mutex;
+       bool alive;
+       bool pending;
+       const RTPSParticipantImpl* participant;
+       const RTPSWriter* writer;
+   };
+
+   template<class T>
+   void filter_nts_(RTPSWriterCollector<T>& changesToSend);
+
+   bool process_change_nts_(CacheChange_t* change, const FragmentNumber_t fragNum);
+
+   //! Adds the tokens accumulated since the last refill.
+   void refill_nts_(std::chrono::steady_clock::time_point now);
+
+   //! Arms the wake up timer, if not armed, for when the bucket has 'neededBytes' tokens.
+   void schedule_wake_up_nts_(uint64_t neededBytes);
+
+   uint64_t mBytesPerPeriod;
+   uint64_t mPeriodMillisecs;
+   uint64_t mBurstBytes;
+   std::chrono::milliseconds mRefillPeriod;
+
+   uint64_t mTokens;
+   //! Fraction of token accumulated by previous refills, in units of 1/periodMillisecs bytes.
+   uint64_t mTokenRemainder;
+   std::chrono::steady_clock::time_point mLastRefill;
+
+   std::mutex mTokenBucketMutex;
+
+   std::shared_ptr<WakeUpState> mWakeUpState;
+   asio::steady_timer mWakeUpTimer;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif
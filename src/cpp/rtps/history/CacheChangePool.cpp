@@ -20,7 +20,9 @@
 #include <fastrtps/rtps/history/CacheChangePool.h>
 #include <fastrtps/rtps/common/CacheChange.h>
 #include <fastrtps/log/Log.h>
+#include "SizeClassFreeList.h"
 
+#include <algorithm>
 #include <mutex>
 
 #include <cassert>
@@ -30,6 +32,25 @@ namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
+static void reset_cache(CacheChange_t* ch)
+{
+    ch->kind = ALIVE;
+    ch->sequenceNumber.high = 0;
+    ch->sequenceNumber.low = 0;
+    ch->writerGUID = c_Guid_Unknown;
+    ch->serializedPayload.length = 0;
+    ch->serializedPayload.pos = 0;
+    for(uint8_t i=0;i<16;++i)
+        ch->instanceHandle.value[i] = 0;
+    ch->isRead = 0;
+    ch->sourceTimestamp.seconds = 0;
+    ch->sourceTimestamp.fraction = 0;
+}
+
+static inline uint64_t size_of_class(uint32_t index, uint32_t min_bits)
+{
+    return uint64_t(1) << (index + min_bits);
+}
 
 CacheChangePool::~CacheChangePool()
 {
@@ -39,6 +60,11 @@ CacheChangePool::~CacheChangePool()
     {
         delete(*it);
     }
+
+    for(uint32_t i = 0; i < size_class_count; ++i)
+    {
+        delete m_sizeClasses[i].load();
+    }
 }
 
 CacheChangePool::CacheChangePool(int32_t pool_size, uint32_t payload_size, int32_t max_pool_size, MemoryManagementPolicy_t memoryPolicy) : 
@@ -51,6 +77,10 @@ CacheChangePool::CacheChangePool(int32_t pool_size, uint32_t payload_size, int32
     m_payload_size = payload_size;
     m_initial_payload_size = payload_size;
     m_pool_size = 0;
+    for(uint32_t i = 0; i < size_class_count; ++i)
+    {
+        m_sizeClasses[i].store(nullptr);
+    }
     if(max_pool_size > 0)
     {
         if (pool_size > max_pool_size)
@@ -76,7 +106,13 @@ CacheChangePool::CacheChangePool(int32_t pool_size, uint32_t payload_size, int32
         case DYNAMIC_RESERVE_MEMORY_MODE:
             logInfo(RTPS_UTILS,"Dynamic Mode is active, CacheChanges are allocated on request");
             break;
+        case POOLED_SIZE_CLASS_MEMORY_MODE:
+            logInfo(RTPS_UTILS,"Pooled Size Class Mode is active, CacheChanges are allocated on request and reused");
+            break;
     }
+
+    // Every size class may end up holding all the changes of a bounded pool.
+    m_sizeClassCapacity = m_max_pool_size > 0 ? m_max_pool_size : std::max<uint32_t>(pool_size, 64);
 }
 
 bool CacheChangePool::reserve_Cache(CacheChange_t** chan, const std::function<uint32_t()>& calculateSizeFunc)
@@ -97,6 +133,13 @@ bool CacheChangePool::reserve_Cache(CacheChange_t** chan, const std::function<ui
 
 bool CacheChangePool::reserve_Cache(CacheChange_t** chan, uint32_t dataSize)
 {
+    if(memoryMode == POOLED_SIZE_CLASS_MEMORY_MODE)
+    {
+        // Only takes the mutex when a new change has to be allocated.
+        *chan = reserveSized(dataSize);
+        return *chan != nullptr;
+    }
+
     std::lock_guard<std::mutex> guard(this->mp_mutex);
 
     switch(memoryMode)
@@ -143,6 +186,10 @@ bool CacheChangePool::reserve_Cache(CacheChange_t** chan, uint32_t dataSize)
             *chan = allocateSingle(dataSize); //Allocates a single, empty CacheChange. Allocated on Copy
             if(*chan == nullptr) return false;
             break;
+
+        case POOLED_SIZE_CLASS_MEMORY_MODE:
+            // Handled without the mutex.
+            return false;
     }
 
     return true;
@@ -150,38 +197,27 @@ bool CacheChangePool::reserve_Cache(CacheChange_t** chan, uint32_t dataSize)
 
 void CacheChangePool::release_Cache(CacheChange_t* ch)
 {
+    if(memoryMode == POOLED_SIZE_CLASS_MEMORY_MODE)
+    {
+        releaseSized(ch);
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(this->mp_mutex);
 
     switch(memoryMode)
     {
         case PREALLOCATED_MEMORY_MODE:
-            ch->kind = ALIVE;
-            ch->sequenceNumber.high = 0;
-            ch->sequenceNumber.low = 0;
-            ch->writerGUID = c_Guid_Unknown;
-            ch->serializedPayload.length = 0;
-            ch->serializedPayload.pos = 0;
-            for(uint8_t i=0;i<16;++i)
-                ch->instanceHandle.value[i] = 0;
-            ch->isRead = 0;
-            ch->sourceTimestamp.seconds = 0;
-            ch->sourceTimestamp.fraction = 0;
+            reset_cache(ch);
             m_freeCaches.push_back(ch);
             break;
         case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
-            ch->kind = ALIVE;
-            ch->sequenceNumber.high = 0;
-            ch->sequenceNumber.low = 0;
-            ch->writerGUID = c_Guid_Unknown;
-            ch->serializedPayload.length = 0;
-            ch->serializedPayload.pos = 0;
-            for(uint8_t i=0;i<16;++i)
-                ch->instanceHandle.value[i] = 0;
-            ch->isRead = 0;
-            ch->sourceTimestamp.seconds = 0;
-            ch->sourceTimestamp.fraction = 0;
+            reset_cache(ch);
             m_freeCaches.push_back(ch);
             break;
+        case POOLED_SIZE_CLASS_MEMORY_MODE:
+            // Handled without the mutex.
+            break;
         case DYNAMIC_RESERVE_MEMORY_MODE:
             // Find pointer in CacheChange vector, remove element, then delete it
             std::vector<CacheChange_t*>::iterator target = m_allCaches.begin();	
@@ -196,14 +232,13 @@ void CacheChangePool::release_Cache(CacheChange_t* ch)
             delete(ch);
             --m_pool_size;
             break;
-
     }
 }
 
 bool CacheChangePool::allocateGroup(uint32_t group_size)
 {
     // This method should only called from within PREALLOCATED_MEMORY_MODE
-    assert(memoryMode != DYNAMIC_RESERVE_MEMORY_MODE);
+    assert(memoryMode != DYNAMIC_RESERVE_MEMORY_MODE && memoryMode != POOLED_SIZE_CLASS_MEMORY_MODE);
 
     logInfo(RTPS_UTILS,"Allocating group of cache changes of size: "<< group_size);
     bool added = false;
@@ -270,6 +305,143 @@ CacheChange_t* CacheChangePool::allocateSingle(uint32_t dataSize)
     return ch;
 }
 
+SizeClassFreeList* CacheChangePool::getSizeClass(uint32_t index)
+{
+    SizeClassFreeList* free_list = m_sizeClasses[index].load(std::memory_order_acquire);
+    if(free_list == nullptr)
+    {
+        std::lock_guard<std::mutex> guard(this->mp_mutex);
+        free_list = m_sizeClasses[index].load(std::memory_order_relaxed);
+        if(free_list == nullptr)
+        {
+            free_list = new SizeClassFreeList(m_sizeClassCapacity);
+            m_sizeClasses[index].store(free_list, std::memory_order_release);
+        }
+    }
+    return free_list;
+}
+
+CacheChange_t* CacheChangePool::reserveSized(uint32_t dataSize)
+{
+    /*
+     *   In Pooled Size Class Mode, payloads are allocated with the smallest power of two size that holds the data,
+     *   starting at 2^min_size_class_bits bytes. Released changes are kept in a lock-free free list of their size
+     *   class, so samples of any size are reused without contending on the pool mutex. The mutex is only taken to
+     *   allocate a change when the free list of its class is empty.
+     */
+    uint32_t index = 0;
+    while(index + 1 < size_class_count && size_of_class(index, min_size_class_bits) < dataSize)
+    {
+        ++index;
+    }
+
+    CacheChange_t* ch = nullptr;
+    if(getSizeClass(index)->pop(&ch))
+    {
+        return ch;
+    }
+
+    return allocateSized(index, dataSize);
+}
+
+CacheChange_t* CacheChangePool::allocateSized(uint32_t index, uint32_t dataSize)
+{
+    std::lock_guard<std::mutex> guard(this->mp_mutex);
+    CacheChange_t* ch = nullptr;
+
+    if((m_max_pool_size == 0) || (m_pool_size < m_max_pool_size))
+    {
+        try
+        {
+            ch = new CacheChange_t(static_cast<uint32_t>(
+                        std::max<uint64_t>(size_of_class(index, min_size_class_bits), dataSize)));
+        }
+        catch(std::bad_alloc& ex)
+        {
+            logError(RTPS_HISTORY, "Failed to allocate memory for the serializedPayload, exception caught: " << ex.what());
+            return nullptr;
+        }
+
+        m_allCaches.push_back(ch);
+        ++m_pool_size;
+        return ch;
+    }
+
+    // The pool is full. A change of its own class may have been released since reserveSized found the list empty.
+    if(getSizeClass(index)->pop(&ch))
+    {
+        return ch;
+    }
+
+    // Reuse a free change of a bigger class, or grow one of a smaller class.
+    for(uint32_t i = index + 1; i < size_class_count; ++i)
+    {
+        SizeClassFreeList* free_list = m_sizeClasses[i].load(std::memory_order_acquire);
+        if(free_list != nullptr && free_list->pop(&ch))
+        {
+            return ch;
+        }
+    }
+
+    for(uint32_t i = index; i-- > 0;)
+    {
+        SizeClassFreeList* free_list = m_sizeClasses[i].load(std::memory_order_acquire);
+        if(free_list != nullptr && free_list->pop(&ch))
+        {
+            try
+            {
+                ch->serializedPayload.reserve(static_cast<uint32_t>(
+                            std::max<uint64_t>(size_of_class(index, min_size_class_bits), dataSize)));
+            }
+            catch(std::bad_alloc& ex)
+            {
+                logError(RTPS_HISTORY, "Failed to allocate memory for the serializedPayload, exception caught: " << ex.what());
+                free_list->push(ch);
+                return nullptr;
+            }
+            return ch;
+        }
+    }
+
+    logWarning(RTPS_HISTORY, "Maximum number of allowed reserved caches reached");
+    return nullptr;
+}
+
+void CacheChangePool::releaseSized(CacheChange_t* ch)
+{
+    reset_cache(ch);
+
+    // The change goes to the biggest class it can hold.
+    uint32_t max_size = ch->serializedPayload.max_size;
+    if(max_size >= size_of_class(0, min_size_class_bits))
+    {
+        uint32_t index = 0;
+        while(index + 1 < size_class_count && size_of_class(index + 1, min_size_class_bits) <= max_size)
+        {
+            ++index;
+        }
+
+        if(getSizeClass(index)->push(ch))
+        {
+            return;
+        }
+    }
+
+    // Not reusable, or there are enough free changes of its class.
+    std::lock_guard<std::mutex> guard(this->mp_mutex);
+    std::vector<CacheChange_t*>::iterator target = find(m_allCaches.begin(), m_allCaches.end(), ch);
+    if(target != m_allCaches.end())
+    {
+        m_allCaches.erase(target);
+        delete(ch);
+        --m_pool_size;
+    }
+    else
+    {
+        logInfo(RTPS_UTILS,"Tried to release a CacheChange that is not logged in the Pool");
+    }
+}
+
 }
 } /* namespace rtps */
 } /* namespace eprosima */
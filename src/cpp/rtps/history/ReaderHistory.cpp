@@ -24,6 +24,7 @@
 #include <fastrtps/rtps/reader/RTPSReader.h>
 #include <fastrtps/rtps/reader/ReaderListener.h>
 
+#include <algorithm>
 #include <mutex>
 
 namespace eprosima {
@@ -81,8 +82,16 @@ bool ReaderHistory::add_change(CacheChange_t* a_change)
         logError(RTPS_HISTORY,"The Writer GUID_t must be defined");
     }
 
-    m_changes.push_back(a_change);
-    sortCacheChanges();
+    // Changes usually arrive in order, so they are appended. Otherwise the position is found by binary search.
+    if(m_changes.empty() || !sort_ReaderHistoryCache(a_change, m_changes.back()))
+    {
+        m_changes.push_back(a_change);
+    }
+    else
+    {
+        m_changes.insert(std::upper_bound(m_changes.begin(), m_changes.end(), a_change, sort_ReaderHistoryCache),
+                a_change);
+    }
     updateMaxMinSeqNum();
     logInfo(RTPS_HISTORY, "Change " << a_change->sequenceNumber << " added with " << a_change->serializedPayload.length << " bytes");
 
@@ -90,6 +99,17 @@ bool ReaderHistory::add_change(CacheChange_t* a_change)
 }
 
 bool ReaderHistory::remove_change(CacheChange_t* a_change)
+{
+    if(detach_change(a_change))
+    {
+        m_changePool.release_Cache(a_change);
+        return true;
+    }
+
+    return false;
+}
+
+bool ReaderHistory::detach_change(CacheChange_t* a_change)
 {
 
     if(mp_reader == nullptr || mp_mutex == nullptr)
@@ -104,22 +124,21 @@ bool ReaderHistory::remove_change(CacheChange_t* a_change)
         logError(RTPS_HISTORY,"Pointer is not valid")
         return false;
     }
-    for(std::vector<CacheChange_t*>::iterator chit = m_changes.begin();
-            chit!=m_changes.end();++chit)
+    // Changes of different writers may share the sequence number.
+    for(std::vector<CacheChange_t*>::iterator chit =
+            std::lower_bound(m_changes.begin(), m_changes.end(), a_change, sort_ReaderHistoryCache);
+            chit!=m_changes.end() && (*chit)->sequenceNumber == a_change->sequenceNumber;++chit)
     {
-        if((*chit)->sequenceNumber == a_change->sequenceNumber &&
-                (*chit)->writerGUID == a_change->writerGUID)
+        if((*chit)->writerGUID == a_change->writerGUID)
         {
             logInfo(RTPS_HISTORY,"Removing change "<< a_change->sequenceNumber);
             mp_reader->change_removed_by_history(a_change);
-            m_changePool.release_Cache(a_change);
             m_changes.erase(chit);
-            sortCacheChanges();
             updateMaxMinSeqNum();
             return true;
         }
     }
-    logWarning(RTPS_HISTORY,"SequenceNumber "<<a_change->sequenceNumber << " not found");
+    logWarningFmt(RTPS_HISTORY, "SequenceNumber {} not found", a_change->sequenceNumber);
     return false;
 }
 
@@ -0,0 +1,99 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SizeClassFreeList.cpp
+ */
+
+#include "SizeClassFreeList.h"
+
+using namespace eprosima::fastrtps::rtps;
+
+SizeClassFreeList::SizeClassFreeList(uint32_t capacity)
+    : mask_(0)
+    , push_pos_(0)
+    , pop_pos_(0)
+{
+    size_t size = 2;
+    while(size < capacity)
+    {
+        size <<= 1;
+    }
+
+    cells_.reset(new Cell[size]);
+    mask_ = size - 1;
+    for(size_t i = 0; i < size; ++i)
+    {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+        cells_[i].change = nullptr;
+    }
+}
+
+bool SizeClassFreeList::push(CacheChange_t* change)
+{
+    size_t pos = push_pos_.load(std::memory_order_relaxed);
+    for(;;)
+    {
+        Cell& cell = cells_[pos & mask_];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if(diff == 0)
+        {
+            if(push_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.change = change;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if(diff < 0)
+        {
+            // The cell has not been read since the previous lap.
+            return false;
+        }
+        else
+        {
+            pos = push_pos_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool SizeClassFreeList::pop(CacheChange_t** change)
+{
+    size_t pos = pop_pos_.load(std::memory_order_relaxed);
+    for(;;)
+    {
+        Cell& cell = cells_[pos & mask_];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+        if(diff == 0)
+        {
+            if(pop_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                *change = cell.change;
+                cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if(diff < 0)
+        {
+            // The cell has not been written yet.
+            return false;
+        }
+        else
+        {
+            pos = pop_pos_.load(std::memory_order_relaxed);
+        }
+    }
+}
@@ -0,0 +1,84 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SizeClassFreeList.h
+ */
+#ifndef _RTPS_HISTORY_SIZECLASSFREELIST_H_
+#define _RTPS_HISTORY_SIZECLASSFREELIST_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace eprosima
+{
+    namespace fastrtps
+    {
+        namespace rtps
+        {
+            struct CacheChange_t;
+
+            /*!
+             * @brief Lock-free bounded list of free cache changes of a size class.
+             * It is a multi-producer multi-consumer queue on a circular array, where each cell carries a sequence
+             * number telling whether it can be written or read. It has no ABA problem and never allocates after
+             * construction.
+             */
+            class SizeClassFreeList
+            {
+                public:
+
+                    /*!
+                     * @param capacity Minimum number of changes the list can hold. It is rounded up to a power of two.
+                     */
+                    explicit SizeClassFreeList(uint32_t capacity);
+
+                    /*!
+                     * @brief Adds a change to the list.
+                     * @return False if the list is full.
+                     */
+                    bool push(CacheChange_t* change);
+
+                    /*!
+                     * @brief Takes a change from the list.
+                     * @return False if the list is empty.
+                     */
+                    bool pop(CacheChange_t** change);
+
+                private:
+
+                    SizeClassFreeList(const SizeClassFreeList&) = delete;
+                    SizeClassFreeList& operator=(const SizeClassFreeList&) = delete;
+
+                    struct Cell
+                    {
+                        std::atomic<size_t> sequence;
+                        CacheChange_t* change;
+                    };
+
+                    std::unique_ptr<Cell[]> cells_;
+
+                    size_t mask_;
+
+                    std::atomic<size_t> push_pos_;
+
+                    std::atomic<size_t> pop_pos_;
+            };
+        }
+    }
+}
+
+#endif // _RTPS_HISTORY_SIZECLASSFREELIST_H_
@@ -52,6 +52,18 @@ bool WriterHistory::add_change(CacheChange_t* a_change)
 }
 
 bool WriterHistory::add_change(CacheChange_t* a_change, WriteParams& wparams)
+{
+    if(!add_change_(a_change, wparams))
+    {
+        return false;
+    }
+
+    mp_writer->deliver_to_local_readers();
+
+    return true;
+}
+
+bool WriterHistory::add_change_(CacheChange_t* a_change, WriteParams& wparams)
 {
     if(mp_writer == nullptr || mp_mutex == nullptr)
     {
@@ -143,7 +155,7 @@ bool WriterHistory::remove_change(CacheChange_t* a_change)
             return true;
         }
     }
-    logWarning(RTPS_HISTORY,"SequenceNumber "<<a_change->sequenceNumber << " not found");
+    logWarningFmt(RTPS_HISTORY, "SequenceNumber {} not found", a_change->sequenceNumber);
     return false;
 }
 
@@ -176,7 +188,7 @@ bool WriterHistory::remove_change(const SequenceNumber_t& sequence_number)
         }
     }
 
-    logWarning(RTPS_HISTORY,"SequenceNumber " <<  sequence_number << " not found");
+    logWarningFmt(RTPS_HISTORY, "SequenceNumber {} not found", sequence_number);
     return false;
 }
 
@@ -204,7 +216,7 @@ CacheChange_t* WriterHistory::remove_change_and_reuse(const SequenceNumber_t& se
         }
     }
 
-    logWarning(RTPS_HISTORY,"SequenceNumber " <<  sequence_number << " not found");
+    logWarningFmt(RTPS_HISTORY, "SequenceNumber {} not found", sequence_number);
     return nullptr;
 }
 
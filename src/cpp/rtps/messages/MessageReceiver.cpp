@@ -33,6 +33,7 @@
 
 #include "../participant/RTPSParticipantImpl.h"
 
+#include <algorithm>
 #include <mutex>
 
 #include <limits>
@@ -49,7 +50,6 @@ namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
-
 MessageReceiver::MessageReceiver(RTPSParticipantImpl* participant, uint32_t rec_buffer_size) :
 #if HAVE_SECURITY
     m_crypto_msg(rec_buffer_size),
@@ -92,7 +92,11 @@ void MessageReceiver::associateEndpoint(Endpoint *to_add){
                 break;
             }
         }
-        if(!found) AssociatedWriters.push_back((RTPSWriter*)to_add);
+        if(!found)
+        {
+            AssociatedWriters.push_back((RTPSWriter*)to_add);
+            WritersByGuid[to_add->getGuid()] = (RTPSWriter*)to_add;
+        }
     }
     else
     {
@@ -104,7 +108,12 @@ void MessageReceiver::associateEndpoint(Endpoint *to_add){
                 break;
             }
         }
-        if(!found) AssociatedReaders.push_back((RTPSReader*)to_add);
+        if(!found)
+        {
+            RTPSReader* reader = (RTPSReader*)to_add;
+            AssociatedReaders.push_back(reader);
+            AssociatedReaderRoutes.addReader(reader);
+        }
     }
     return;
 }
@@ -116,6 +125,7 @@ void MessageReceiver::removeEndpoint(Endpoint *to_remove){
         for(auto it=AssociatedWriters.begin(); it !=AssociatedWriters.end(); ++it){
             if ((*it) == var){
                 AssociatedWriters.erase(it);
+                WritersByGuid.erase(var->getGuid());
                 break;
             }
         }
@@ -124,6 +134,7 @@ void MessageReceiver::removeEndpoint(Endpoint *to_remove){
         for(auto it=AssociatedReaders.begin(); it !=AssociatedReaders.end(); ++it){
             if ((*it) == var){
                 AssociatedReaders.erase(it);
+                AssociatedReaderRoutes.removeReader(var);
                 break;
             }
         }
@@ -131,6 +142,14 @@ void MessageReceiver::removeEndpoint(Endpoint *to_remove){
     return;
 }
 
+const std::vector<RTPSReader*>& MessageReceiver::destinationReaders(const EntityId_t& readerID,
+        const GUID_t& writerGUID)
+{
+    // The generation is read before asking the readers, so a match done meanwhile invalidates the new route.
+    return AssociatedReaderRoutes.destinationReaders(readerID, writerGUID,
+            participant_->reader_matching_generation());
+}
+
 
 void MessageReceiver::reset(){
     destVersion = c_ProtocolVersion;
@@ -452,23 +471,14 @@ bool MessageReceiver::proc_Submsg_Data(CDRMessage_t* msg,SubmessageHeader_t* smh
 
     //WE KNOW THE READER THAT THE MESSAGE IS DIRECTED TO SO WE LOOK FOR IT:
 
-    RTPSReader* firstReader = nullptr;
     if(AssociatedReaders.empty())
     {
         logWarning(RTPS_MSG_IN,IDSTRING"Data received when NO readers are listening");
         return false;
     }
 
-    for(std::vector<RTPSReader*>::iterator it=AssociatedReaders.begin();
-            it != AssociatedReaders.end(); ++it)
-    {
-        if((*it)->acceptMsgDirectedTo(readerID)) //add
-        {
-            firstReader = *it;
-            break;
-        }
-    }
-    if(firstReader == nullptr) //Reader not found
+    bool readerFound = AssociatedReaderRoutes.hasReaders(readerID);
+    if(!readerFound) //Reader not found
     {
         logWarning(RTPS_MSG_IN, IDSTRING"No Reader accepts this message (directed to: " <<readerID << ")");
         return false;
@@ -505,14 +515,11 @@ bool MessageReceiver::proc_Submsg_Data(CDRMessage_t* msg,SubmessageHeader_t* smh
         }
     }
 
-    int32_t inlineQosSize = 0;
+    uint32_t inlineQosSize = 0;
 
     if(inlineQosFlag)
     {
-        ParameterList_t parameter_list;
-        inlineQosSize = ParameterList::readParameterListfromCDRMsg(msg, &parameter_list, &ch, false);
-
-        if(inlineQosSize <= 0)
+        if(!ParameterList::updateCacheChangeFromInlineQos(msg, ch, inlineQosSize))
         {
             logInfo(RTPS_MSG_IN,IDSTRING"SubMessage Data ERROR, Inline Qos ParameterList error");
             return false;
@@ -571,13 +578,9 @@ bool MessageReceiver::proc_Submsg_Data(CDRMessage_t* msg,SubmessageHeader_t* smh
     //FIXME: DO SOMETHING WITH PARAMETERLIST CREATED.
     logInfo(RTPS_MSG_IN,IDSTRING"from Writer " << ch.writerGUID << "; possible RTPSReaders: "<<AssociatedReaders.size());
     //Look for the correct reader to add the change
-    for(std::vector<RTPSReader*>::iterator it = AssociatedReaders.begin();
-            it != AssociatedReaders.end(); ++it)
+    for(RTPSReader* reader : destinationReaders(readerID, ch.writerGUID))
     {
-        if((*it)->acceptMsgDirectedTo(readerID))
-        {
-            (*it)->processDataMsg(&ch);
-        }
+        reader->processDataMsg(&ch);
     }
 
     //TODO(Ricardo) If a exception is thrown (ex, by fastcdr), this line is not executed -> segmentation fault
@@ -627,18 +630,8 @@ bool MessageReceiver::proc_Submsg_DataFrag(CDRMessage_t* msg, SubmessageHeader_t
         return false;
     }
 
-    RTPSReader* firstReader = nullptr;
-    for (std::vector<RTPSReader*>::iterator it = AssociatedReaders.begin();
-            it != AssociatedReaders.end(); ++it)
-    {
-        if ((*it)->acceptMsgDirectedTo(readerID)) //add
-        {
-            firstReader = *it;
-            break;
-        }
-    }
-
-    if (firstReader == nullptr) //Reader not found
+    bool readerFound = AssociatedReaderRoutes.hasReaders(readerID);
+    if (!readerFound) //Reader not found
     {
         logWarning(RTPS_MSG_IN, IDSTRING"No Reader accepts this message (directed to: " << readerID << ")");
         return false;
@@ -691,14 +684,11 @@ bool MessageReceiver::proc_Submsg_DataFrag(CDRMessage_t* msg, SubmessageHeader_t
         }
     }
 
-    int32_t inlineQosSize = 0;
+    uint32_t inlineQosSize = 0;
 
     if (inlineQosFlag)
     {
-        ParameterList_t parameter_list;
-        inlineQosSize = ParameterList::readParameterListfromCDRMsg(msg, &parameter_list, &ch, false);
-
-        if (inlineQosSize <= 0)
+        if (!ParameterList::updateCacheChangeFromInlineQos(msg, ch, inlineQosSize))
         {
             logInfo(RTPS_MSG_IN, IDSTRING"SubMessage Data ERROR, Inline Qos ParameterList error");
             return false;
@@ -716,10 +706,8 @@ bool MessageReceiver::proc_Submsg_DataFrag(CDRMessage_t* msg, SubmessageHeader_t
         {
             ch.serializedPayload.length = payload_size;
 
-            // TODO Mejorar el reubicar el vector de fragmentos.
             ch.setFragmentSize(fragmentSize);
-            ch.getDataFragments()->clear();
-            ch.getDataFragments()->resize(fragmentsInSubmessage, ChangeFragmentStatus_t::PRESENT);
+            ch.getDataFragments().assign(fragmentsInSubmessage, true);
 
             ch.serializedPayload.data = &msg->buffer[msg->pos];
             ch.serializedPayload.length = payload_size;
@@ -764,13 +752,9 @@ bool MessageReceiver::proc_Submsg_DataFrag(CDRMessage_t* msg, SubmessageHeader_t
     //FIXME: DO SOMETHING WITH PARAMETERLIST CREATED.
     logInfo(RTPS_MSG_IN, IDSTRING"from Writer " << ch.writerGUID << "; possible RTPSReaders: " << AssociatedReaders.size());
     //Look for the correct reader to add the change
-    for (std::vector<RTPSReader*>::iterator it = AssociatedReaders.begin();
-            it != AssociatedReaders.end(); ++it)
+    for (RTPSReader* reader : destinationReaders(readerID, ch.writerGUID))
     {
-        if ((*it)->acceptMsgDirectedTo(readerID))
-        {
-            (*it)->processDataFragMsg(&ch, sampleSize, fragmentStartingNum);
-        }
+        reader->processDataFragMsg(&ch, sampleSize, fragmentStartingNum);
     }
 
     ch.serializedPayload.data = nullptr;
@@ -811,13 +795,9 @@ bool MessageReceiver::proc_Submsg_Heartbeat(CDRMessage_t* msg,SubmessageHeader_t
 
     std::lock_guard<std::mutex> guard(mtx);
     //Look for the correct reader and writers:
-    for (std::vector<RTPSReader*>::iterator it = AssociatedReaders.begin();
-            it != AssociatedReaders.end(); ++it)
+    for (RTPSReader* reader : destinationReaders(readerGUID.entityId, writerGUID))
     {
-        if((*it)->acceptMsgDirectedTo(readerGUID.entityId))
-        {
-            (*it)->processHeartbeatMsg(writerGUID, HBCount, firstSN, lastSN, finalFlag, livelinessFlag);
-        }
+        reader->processHeartbeatMsg(writerGUID, HBCount, firstSN, lastSN, finalFlag, livelinessFlag);
     }
     return true;
 }
@@ -846,22 +826,19 @@ bool MessageReceiver::proc_Submsg_Acknack(CDRMessage_t* msg,SubmessageHeader_t*
 
     std::lock_guard<std::mutex> guard(mtx);
     //Look for the correct writer to use the acknack
-    for (std::vector<RTPSWriter*>::iterator it = AssociatedWriters.begin();
-            it != AssociatedWriters.end(); ++it)
+    auto it = WritersByGuid.find(writerGUID);
+    if(it != WritersByGuid.end())
     {
-        if((*it)->getGuid() == writerGUID)
+        if(it->second->getAttributes().reliabilityKind == RELIABLE)
         {
-            if((*it)->getAttributes().reliabilityKind == RELIABLE)
-            {
-                StatefulWriter* SF = (StatefulWriter*)(*it);
-                SF->process_acknack(readerGUID, Ackcount, SNSet, finalFlag);
-                return true;
-            }
-            else
-            {
-                logInfo(RTPS_MSG_IN,IDSTRING"Acknack msg to NOT stateful writer ");
-                return false;
-            }
+            StatefulWriter* SF = (StatefulWriter*)it->second;
+            SF->process_acknack(readerGUID, Ackcount, SNSet, finalFlag);
+            return true;
+        }
+        else
+        {
+            logInfo(RTPS_MSG_IN,IDSTRING"Acknack msg to NOT stateful writer ");
+            return false;
         }
     }
     logInfo(RTPS_MSG_IN,IDSTRING"Acknack msg to UNKNOWN writer (I loooked through "
@@ -893,13 +870,9 @@ bool MessageReceiver::proc_Submsg_Gap(CDRMessage_t* msg,SubmessageHeader_t* smh)
         return false;
 
     std::lock_guard<std::mutex> guard(mtx);
-    for (std::vector<RTPSReader*>::iterator it = AssociatedReaders.begin();
-            it != AssociatedReaders.end(); ++it)
+    for (RTPSReader* reader : destinationReaders(readerGUID.entityId, writerGUID))
     {
-        if((*it)->acceptMsgDirectedTo(readerGUID.entityId))
-        {
-            (*it)->processGapMsg(writerGUID, gapStart, gapList);
-        }
+        reader->processGapMsg(writerGUID, gapStart, gapList);
     }
 
     return true;
@@ -994,42 +967,39 @@ bool MessageReceiver::proc_Submsg_NackFrag(CDRMessage_t*msg, SubmessageHeader_t*
 
     std::lock_guard<std::mutex> guard(mtx);
     //Look for the correct writer to use the acknack
-    for (std::vector<RTPSWriter*>::iterator it = AssociatedWriters.begin();
-            it != AssociatedWriters.end(); ++it)
+    auto it = WritersByGuid.find(writerGUID);
+    if (it != WritersByGuid.end())
     {
         //Look for the readerProxy the acknack is from
-        std::lock_guard<std::recursive_mutex> guardW(*(*it)->getMutex());
-        if ((*it)->getGuid() == writerGUID)
+        std::lock_guard<std::recursive_mutex> guardW(*it->second->getMutex());
+        if (it->second->getAttributes().reliabilityKind == RELIABLE)
         {
-            if ((*it)->getAttributes().reliabilityKind == RELIABLE)
+            StatefulWriter* SF = (StatefulWriter*)it->second;
+
+            for (auto rit = SF->matchedReadersBegin(); rit != SF->matchedReadersEnd(); ++rit)
             {
-                StatefulWriter* SF = (StatefulWriter*)(*it);
+                std::lock_guard<std::recursive_mutex> guardReaderProxy(*(*rit)->mp_mutex);
 
-                for (auto rit = SF->matchedReadersBegin(); rit != SF->matchedReadersEnd(); ++rit)
+                if ((*rit)->m_att.guid == readerGUID)
                 {
-                    std::lock_guard<std::recursive_mutex> guardReaderProxy(*(*rit)->mp_mutex);
-
-                    if ((*rit)->m_att.guid == readerGUID)
+                    if ((*rit)->getLastNackfragCount() < Ackcount)
                     {
-                        if ((*rit)->getLastNackfragCount() < Ackcount)
+                        (*rit)->setLastNackfragCount(Ackcount);
+                        // TODO Not doing Acknowledged.
+                        if((*rit)->requested_fragment_set(writerSN, fnState))
                         {
-                            (*rit)->setLastNackfragCount(Ackcount);
-                            // TODO Not doing Acknowledged.
-                            if((*rit)->requested_fragment_set(writerSN, fnState))
-                            {
-                                SF->nack_response_event_->restart_timer();
-                            }
+                            SF->nack_response_event_->restart_timer();
                         }
-                        break;
                     }
+                    break;
                 }
-                return true;
-            }
-            else
-            {
-                logInfo(RTPS_MSG_IN, IDSTRING"Acknack msg to NOT stateful writer ");
-                return false;
             }
+            return true;
+        }
+        else
+        {
+            logInfo(RTPS_MSG_IN, IDSTRING"Acknack msg to NOT stateful writer ");
+            return false;
         }
     }
     logInfo(RTPS_MSG_IN, IDSTRING"Acknack msg to UNKNOWN writer (I looked through "
@@ -271,10 +271,7 @@ void RTPSMessageGroup::send()
 #endif
         const LocatorList_t & destinations =
             fixed_destination_ ? *fixed_destination_locators_ : current_locators_;
-        for(const auto& lit : destinations)
-        {
-            participant_->sendSync(msgToSend, endpoint_, lit);
-        }
+        participant_->sendSync(msgToSend, endpoint_, destinations);
 
         currentBytesSent_ += msgToSend->length;
     }
@@ -0,0 +1,106 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderRoutes.cpp
+ *
+ */
+
+#include <fastrtps/rtps/messages/ReaderRoutes.h>
+#include <fastrtps/rtps/reader/RTPSReader.h>
+
+#include <algorithm>
+
+namespace eprosima {
+namespace fastrtps{
+namespace rtps {
+
+//!Maximum number of writers whose destination readers are kept. Reaching it drops all of them.
+static const size_t s_maxCachedWriterRoutes = 4096;
+
+ReaderRoutes::ReaderRoutes() : m_readersByWriterGeneration(0)
+{
+}
+
+void ReaderRoutes::addReader(RTPSReader* reader)
+{
+    m_readersByEntityId[reader->getGuid().entityId].push_back(reader);
+    EntityId_t unknown = c_EntityId_Unknown;
+    if(reader->acceptMsgDirectedTo(unknown))
+    {
+        m_readersAcceptingUnknown.push_back(reader);
+        m_readersByWriter.clear();
+    }
+}
+
+void ReaderRoutes::removeReader(RTPSReader* reader)
+{
+    auto entity_it = m_readersByEntityId.find(reader->getGuid().entityId);
+    if(entity_it != m_readersByEntityId.end())
+    {
+        std::vector<RTPSReader*>& readers = entity_it->second;
+        readers.erase(std::remove(readers.begin(), readers.end(), reader), readers.end());
+        if(readers.empty())
+        {
+            m_readersByEntityId.erase(entity_it);
+        }
+    }
+
+    m_readersAcceptingUnknown.erase(std::remove(m_readersAcceptingUnknown.begin(),
+                m_readersAcceptingUnknown.end(), reader), m_readersAcceptingUnknown.end());
+    m_readersByWriter.clear();
+}
+
+bool ReaderRoutes::hasReaders(const EntityId_t& readerID) const
+{
+    return readerID == c_EntityId_Unknown ? !m_readersAcceptingUnknown.empty() :
+        m_readersByEntityId.find(readerID) != m_readersByEntityId.end();
+}
+
+const std::vector<RTPSReader*>& ReaderRoutes::destinationReaders(const EntityId_t& readerID,
+        const GUID_t& writerGUID, uint32_t generation)
+{
+    static const std::vector<RTPSReader*> no_readers;
+
+    if(readerID != c_EntityId_Unknown)
+    {
+        auto it = m_readersByEntityId.find(readerID);
+        return it != m_readersByEntityId.end() ? it->second : no_readers;
+    }
+
+    if(generation != m_readersByWriterGeneration || m_readersByWriter.size() >= s_maxCachedWriterRoutes)
+    {
+        m_readersByWriter.clear();
+        m_readersByWriterGeneration = generation;
+    }
+
+    auto it = m_readersByWriter.find(writerGUID);
+    if(it == m_readersByWriter.end())
+    {
+        it = m_readersByWriter.emplace(writerGUID, std::vector<RTPSReader*>()).first;
+        for(RTPSReader* reader : m_readersAcceptingUnknown)
+        {
+            if(reader->acceptMsgFromWriter(writerGUID))
+            {
+                it->second.push_back(reader);
+            }
+        }
+    }
+
+    return it->second;
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
@@ -127,11 +127,27 @@ LocatorList_t NetworkFactory::ShrinkLocatorLists(const std::vector<LocatorList_t
 {
     LocatorList_t returnedList;
 
+    // Remote endpoints reachable through shared memory are not sent anything through the network.
+    std::vector<LocatorList_t> reachableLocatorLists;
+    for(auto& locatorList : locatorLists)
+    {
+        LocatorList_t sharedMemList;
+        for(auto it = locatorList.begin(); it != locatorList.end(); ++it)
+        {
+            if(it->kind == LOCATOR_KIND_SHM && is_local_locator(*it))
+            {
+                sharedMemList.push_back(*it);
+            }
+        }
+
+        reachableLocatorLists.push_back(sharedMemList.empty() ? locatorList : sharedMemList);
+    }
+
     for(auto& transport : mRegisteredTransports)
     {
         std::vector<LocatorList_t> transportLocatorLists;
 
-        for(auto& locatorList : locatorLists)
+        for(auto& locatorList : reachableLocatorLists)
         {
             LocatorList_t resultList;
 
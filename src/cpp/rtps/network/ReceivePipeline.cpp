@@ -0,0 +1,227 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReceivePipeline.cpp
+ */
+
+#include "ReceivePipeline.h"
+
+#include <fastrtps/rtps/messages/MessageReceiver.h>
+#include <fastrtps/rtps/messages/RTPS_messages.h>
+
+#include <cstring>
+
+using namespace eprosima::fastrtps::rtps;
+
+//! Number of datagrams each worker can have queued before the receiving threads block.
+static const size_t s_worker_queue_capacity = 128;
+
+//! Size of the header of a submessage.
+static const uint32_t s_submessage_header_size = 4;
+
+static inline uint32_t fnv1a(uint32_t hash, const octet* data, size_t size)
+{
+    for(size_t i = 0; i < size; ++i)
+    {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+ReceivePipeline::Worker::Worker(size_t capacity)
+    : slots(capacity)
+    , head(0)
+    , count(0)
+    , running(true)
+{
+}
+
+ReceivePipeline::ReceivePipeline(uint32_t num_workers)
+{
+    if(num_workers == 0)
+    {
+        num_workers = 1;
+    }
+
+    for(uint32_t i = 0; i < num_workers; ++i)
+    {
+        workers_.emplace_back(new Worker(s_worker_queue_capacity));
+    }
+
+    for(auto& worker : workers_)
+    {
+        worker->thread = std::thread(&ReceivePipeline::run, this, std::ref(*worker));
+    }
+}
+
+ReceivePipeline::~ReceivePipeline()
+{
+    stop();
+}
+
+void ReceivePipeline::stop()
+{
+    for(auto& worker : workers_)
+    {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->running = false;
+        worker->not_empty.notify_all();
+        worker->not_full.notify_all();
+    }
+
+    for(auto& worker : workers_)
+    {
+        if(worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+}
+
+uint32_t ReceivePipeline::sender_key(const octet* data, uint32_t size)
+{
+    uint32_t hash = 2166136261u;
+    if(size < RTPSMESSAGE_HEADER_SIZE)
+    {
+        return hash;
+    }
+
+    // GUID prefix of the header.
+    const octet* prefix = data + 8;
+    uint32_t pos = RTPSMESSAGE_HEADER_SIZE;
+
+    while(pos + s_submessage_header_size <= size)
+    {
+        octet id = data[pos];
+        bool little_endian = (data[pos + 1] & 0x01) != 0;
+        uint32_t length = little_endian ?
+            static_cast<uint32_t>(data[pos + 2] | (data[pos + 3] << 8)) :
+            static_cast<uint32_t>((data[pos + 2] << 8) | data[pos + 3]);
+        uint32_t body = pos + s_submessage_header_size;
+        if(length == 0)
+        {
+            length = size - body;
+        }
+        if(body + length > size)
+        {
+            break;
+        }
+
+        // Offset inside the body of the entity id of the sending endpoint.
+        uint32_t entity_offset = 0;
+        switch(id)
+        {
+            case DATA:
+            case DATA_FRAG:
+                entity_offset = 8;
+                break;
+            case HEARTBEAT:
+            case GAP:
+            case HEARTBEAT_FRAG:
+                entity_offset = 4;
+                break;
+            case ACKNACK:
+            case NACK_FRAG:
+                entity_offset = 0;
+                break;
+            case INFO_SRC:
+                if(length >= 20)
+                {
+                    prefix = data + body + 8;
+                }
+                pos = body + length;
+                continue;
+            default:
+                pos = body + length;
+                continue;
+        }
+
+        if(entity_offset + 4 <= length)
+        {
+            hash = fnv1a(hash, prefix, 12);
+            return fnv1a(hash, data + body + entity_offset, 4);
+        }
+        break;
+    }
+
+    return fnv1a(hash, prefix, 12);
+}
+
+void ReceivePipeline::push(MessageReceiver* const* receivers, const octet* data, uint32_t size,
+        const Locator_t& remote_locator)
+{
+    uint32_t index = sender_key(data, size) % num_workers();
+    Worker& worker = *workers_[index];
+
+    std::unique_lock<std::mutex> lock(worker.mutex);
+    worker.not_full.wait(lock, [&worker]()
+    {
+        return !worker.running || worker.count < worker.slots.size();
+    });
+
+    if(!worker.running)
+    {
+        return;
+    }
+
+    Datagram& datagram = worker.slots[(worker.head + worker.count) % worker.slots.size()];
+    datagram.receiver = receivers[index];
+    datagram.remote_locator = remote_locator;
+    if(datagram.data.size() < size)
+    {
+        datagram.data.resize(size);
+    }
+    memcpy(datagram.data.data(), data, size);
+    datagram.length = size;
+
+    ++worker.count;
+    worker.not_empty.notify_one();
+}
+
+void ReceivePipeline::run(Worker& worker)
+{
+    CDRMessage_t msg(0);
+    msg.wraps = true;
+
+    std::unique_lock<std::mutex> lock(worker.mutex);
+    for(;;)
+    {
+        worker.not_empty.wait(lock, [&worker]()
+        {
+            return !worker.running || worker.count > 0;
+        });
+
+        if(!worker.running)
+        {
+            break;
+        }
+
+        // The slot is not reused by push until count is decremented, so it can be processed unlocked.
+        Datagram& datagram = worker.slots[worker.head];
+        lock.unlock();
+
+        msg.buffer = datagram.data.data();
+        msg.length = datagram.length;
+        msg.max_size = datagram.length;
+        msg.pos = 0;
+        datagram.receiver->processCDRMsg(datagram.remote_locator, &msg);
+
+        lock.lock();
+        worker.head = (worker.head + 1) % worker.slots.size();
+        --worker.count;
+        worker.not_full.notify_one();
+    }
+}
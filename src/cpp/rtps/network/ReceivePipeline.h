@@ -0,0 +1,122 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReceivePipeline.h
+ */
+#ifndef _RTPS_NETWORK_RECEIVEPIPELINE_H_
+#define _RTPS_NETWORK_RECEIVEPIPELINE_H_
+
+#include <fastrtps/rtps/common/Locator.h>
+#include <fastrtps/rtps/common/Types.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eprosima
+{
+    namespace fastrtps
+    {
+        namespace rtps
+        {
+            class MessageReceiver;
+
+            /*!
+             * @brief Pool of threads that parse and dispatch the datagrams taken from the sockets.
+             * Each datagram is copied to the queue of one worker, chosen from the GUID of the endpoint that sent it.
+             * All the datagrams of a writer are therefore processed by the same worker, in reception order.
+             * Each worker uses its own MessageReceiver of the receiving resource, so workers never share parsing
+             * state.
+             */
+            class ReceivePipeline
+            {
+                public:
+
+                    /*!
+                     * @param num_workers Number of worker threads. At least one is created.
+                     */
+                    explicit ReceivePipeline(uint32_t num_workers);
+
+                    //! Stops the workers. Datagrams still queued are discarded.
+                    ~ReceivePipeline();
+
+                    /*!
+                     * @brief Stops the workers and waits for them to finish. Datagrams still queued are discarded.
+                     * The threads blocked in push are released, and the following calls to push do nothing.
+                     */
+                    void stop();
+
+                    uint32_t num_workers() const
+                    {
+                        return static_cast<uint32_t>(workers_.size());
+                    }
+
+                    /*!
+                     * @brief Queues a copy of a datagram in the worker of the endpoint that sent it.
+                     * Blocks while the queue of that worker is full, until the pipeline is stopped.
+                     * @param receivers Message receivers of the receiving resource, one per worker.
+                     * @param data Pointer to the received datagram.
+                     * @param size Size of the received datagram.
+                     * @param remote_locator Locator of the sender.
+                     */
+                    void push(MessageReceiver* const* receivers, const octet* data, uint32_t size,
+                            const Locator_t& remote_locator);
+
+                    /*!
+                     * @brief Key identifying the endpoint that sent a datagram.
+                     * It hashes the GUID prefix of the sender with the entity id of the first submessage that
+                     * belongs to an endpoint. Datagrams without such submessage only use the GUID prefix.
+                     */
+                    static uint32_t sender_key(const octet* data, uint32_t size);
+
+                private:
+
+                    ReceivePipeline(const ReceivePipeline&) = delete;
+                    ReceivePipeline& operator=(const ReceivePipeline&) = delete;
+
+                    struct Datagram
+                    {
+                        MessageReceiver* receiver;
+                        Locator_t remote_locator;
+                        std::vector<octet> data;
+                        uint32_t length;
+                    };
+
+                    struct Worker
+                    {
+                        explicit Worker(size_t capacity);
+
+                        std::mutex mutex;
+                        std::condition_variable not_empty;
+                        std::condition_variable not_full;
+                        //! Circular queue. Buffers are kept between uses.
+                        std::vector<Datagram> slots;
+                        size_t head;
+                        size_t count;
+                        bool running;
+                        std::thread thread;
+                    };
+
+                    void run(Worker& worker);
+
+                    std::vector<std::unique_ptr<Worker>> workers_;
+            };
+        }
+    }
+}
+
+#endif // _RTPS_NETWORK_RECEIVEPIPELINE_H_
@@ -14,6 +14,7 @@
 
 #include <fastrtps/rtps/network/ReceiverResource.h>
 #include <fastrtps/rtps/messages/MessageReceiver.h>
+#include "ReceivePipeline.h"
 #include <cassert>
 #include <fastrtps/log/Log.h>
 
@@ -28,6 +29,9 @@ namespace rtps{
 ReceiverResource::ReceiverResource(TransportInterface& transport, const Locator_t& locator, uint32_t max_size)
         : mValid(false)
         , receiver(nullptr)
+        , pipeline(nullptr)
+        , pipeline_receivers(nullptr)
+        , pipeline_pushes(0)
         , msg(0)
 {
     // Internal channel is opened and assigned to this resource.
@@ -44,11 +48,16 @@ ReceiverResource::ReceiverResource(TransportInterface& transport, const Locator_
 }
 
 ReceiverResource::ReceiverResource(ReceiverResource&& rValueResource)
+    : pipeline_pushes(0)
 {
     Cleanup.swap(rValueResource.Cleanup);
     LocatorMapsToManagedChannel.swap(rValueResource.LocatorMapsToManagedChannel);
     receiver = rValueResource.receiver;
     rValueResource.receiver = nullptr;
+    pipeline = rValueResource.pipeline;
+    rValueResource.pipeline = nullptr;
+    pipeline_receivers = rValueResource.pipeline_receivers;
+    rValueResource.pipeline_receivers = nullptr;
     mValid = rValueResource.mValid;
     rValueResource.mValid = false;
     msg = std::move(rValueResource.msg);
@@ -74,7 +83,19 @@ void ReceiverResource::UnregisterReceiver(MessageReceiver* rcv)
 {
     std::unique_lock<std::mutex> lock(mtx);
     if (receiver == rcv)
+    {
         receiver = nullptr;
+        pipeline = nullptr;
+        pipeline_receivers = nullptr;
+        pipeline_pushes_done.wait(lock, [this]() { return pipeline_pushes == 0; });
+    }
+}
+
+void ReceiverResource::RegisterPipeline(ReceivePipeline* pipe, MessageReceiver* const* receivers)
+{
+    std::unique_lock<std::mutex> lock(mtx);
+    pipeline = pipe;
+    pipeline_receivers = receivers;
 }
 
 void ReceiverResource::OnDataReceived(const octet * data, const uint32_t size,
@@ -85,7 +106,24 @@ void ReceiverResource::OnDataReceived(const octet * data, const uint32_t size,
     std::unique_lock<std::mutex> lock(mtx);
     MessageReceiver* rcv = receiver;
 
-    if (rcv != nullptr)
+    if (rcv != nullptr && pipeline != nullptr)
+    {
+        // A full queue blocks the push, which must not keep the mutex. The pipeline is kept alive by
+        // UnregisterReceiver, that waits for the pushes in progress.
+        ReceivePipeline* pipe = pipeline;
+        MessageReceiver* const* receivers = pipeline_receivers;
+        ++pipeline_pushes;
+        lock.unlock();
+
+        pipe->push(receivers, data, size, remoteLocator);
+
+        lock.lock();
+        if (--pipeline_pushes == 0)
+        {
+            pipeline_pushes_done.notify_all();
+        }
+    }
+    else if (rcv != nullptr)
     {
         msg.wraps = true;
         msg.buffer = const_cast<octet*>(data);
@@ -57,6 +57,14 @@ SenderResource::SenderResource(TransportInterface& transport, Locator_t& locator
                 return transport.Send(data, dataSize, locator, destination, pChannelResource);
             }
         };
+
+    SendBatchThroughAssociatedChannel =
+        [&transport, locator]
+        (const octet* data, uint32_t dataSize, const LocatorList_t& destinations)-> bool
+        {
+            return transport.SendBatch(data, dataSize, locator, destinations);
+        };
+
     LocatorMapsToManagedChannel = [&transport, locator](const Locator_t& locatorToCheck) -> bool
         {
             return transport.DoOutputLocatorsMatch(locator, locatorToCheck);
@@ -86,12 +94,22 @@ bool SenderResource::Send(const octet* data, uint32_t dataLength, const Locator_
     return false;
 }
 
+bool SenderResource::Send(const octet* data, uint32_t dataLength, const LocatorList_t& destinationLocators)
+{
+    if (SendBatchThroughAssociatedChannel)
+    {
+        return SendBatchThroughAssociatedChannel(data, dataLength, destinationLocators);
+    }
+    return false;
+}
+
 SenderResource::SenderResource(SenderResource&& rValueResource)
 {
     mValid = rValueResource.mValid;
     Cleanup.swap(rValueResource.Cleanup);
     AddSenderLocatorToManagedChannel.swap(rValueResource.AddSenderLocatorToManagedChannel);
     SendThroughAssociatedChannel.swap(rValueResource.SendThroughAssociatedChannel);
+    SendBatchThroughAssociatedChannel.swap(rValueResource.SendBatchThroughAssociatedChannel);
     LocatorMapsToManagedChannel.swap(rValueResource.LocatorMapsToManagedChannel);
     ManagedChannelMapsToRemote.swap(rValueResource.ManagedChannelMapsToRemote);
     //m_pChannelResource = rValueResource.m_pChannelResource;
@@ -20,6 +20,7 @@
 #include "RTPSParticipantImpl.h"
 
 #include "../flowcontrol/ThroughputController.h"
+#include "../flowcontrol/TokenBucketController.h"
 #include "../persistence/PersistenceService.h"
 
 #include <fastrtps/rtps/resources/ResourceEvent.h>
@@ -39,6 +40,7 @@
 
 #include <fastrtps/rtps/participant/RTPSParticipant.h>
 #include <fastrtps/transport/UDPv4TransportDescriptor.h>
+#include <fastrtps/transport/SharedMemTransport.h>
 
 #include <fastrtps/rtps/RTPSDomain.h>
 
@@ -90,6 +92,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(const RTPSParticipantAttributes& PParam
 #if HAVE_SECURITY
     , m_security_manager(this)
 #endif
+    , m_readerMatchingGeneration(0)
     , mp_participantListener(plisten)
     , mp_userParticipant(par)
     , mp_mutex(new std::recursive_mutex())
@@ -109,6 +112,18 @@ RTPSParticipantImpl::RTPSParticipantImpl(const RTPSParticipantAttributes& PParam
         m_network_Factory.RegisterTransport(transportDescriptor.get());
     }
 
+    // Receive pipeline, created before any receiver resource
+    if (m_att.receiveWorkerThreads > 0)
+    {
+        m_receive_pipeline.reset(new ReceivePipeline(m_att.receiveWorkerThreads));
+    }
+
+    // Asynchronous writer threads, created before any writer
+    if (m_att.asyncWriterThreads > 0)
+    {
+        m_async_writer_scheduler.reset(new AsyncWriterScheduler(m_att.asyncWriterThreads));
+    }
+
     mp_userParticipant->mp_impl = this;
     mp_event_thr = new ResourceEvent();
     mp_event_thr->init_thread(this);
@@ -116,7 +131,11 @@ RTPSParticipantImpl::RTPSParticipantImpl(const RTPSParticipantAttributes& PParam
     // Throughput controller, if the descriptor has valid values
     if (PParam.throughputController.bytesPerPeriod != UINT32_MAX && PParam.throughputController.periodMillisecs != 0)
     {
-        std::unique_ptr<FlowController> controller(new ThroughputController(PParam.throughputController, this));
+        std::unique_ptr<FlowController> controller;
+        if (PParam.throughputController.kind == TOKEN_BUCKET_THROUGHPUT_CONTROLLER)
+            controller.reset(new TokenBucketController(PParam.throughputController, this));
+        else
+            controller.reset(new ThroughputController(PParam.throughputController, this));
         m_controllers.push_back(std::move(controller));
     }
 
@@ -245,12 +264,22 @@ RTPSParticipantImpl::~RTPSParticipantImpl()
     // Disable Retries on Transports
     m_network_Factory.Shutdown();
 
+    // Stop the workers before touching the receiver resources. Receiving threads blocked on a full queue
+    // are released, so unregistering the receivers below never waits for them.
+    if (m_receive_pipeline)
+    {
+        m_receive_pipeline->stop();
+    }
+
     // Safely abort threads.
     for(auto& block : m_receiverResourcelist)
     {
-        block.Receiver->UnregisterReceiver(block.mp_receiver);
+        block.Receiver->UnregisterReceiver(block.mp_receivers.front());
     }
 
+    // No more messages reach the workers.
+    m_receive_pipeline.reset();
+
     while(m_userReaderList.size() > 0)
     {
         deleteUserEndpoint((Endpoint*)*m_userReaderList.begin());
@@ -270,7 +299,10 @@ RTPSParticipantImpl::~RTPSParticipantImpl()
     // Destruct message receivers
     for (auto& block : m_receiverResourcelist)
     {
-        delete block.mp_receiver;
+        for (MessageReceiver* receiver : block.mp_receivers)
+        {
+            delete receiver;
+        }
     }
     m_receiverResourcelist.clear();
 
@@ -429,13 +461,22 @@ bool RTPSParticipantImpl::createWriter(RTPSWriter** WriterOut, WriterAttributes&
     if (!isBuiltin)
     {
         m_userWriterList.push_back(SWriter);
+
+        if (allowsIntraprocessDelivery((Endpoint *)SWriter))
+        {
+            RTPSDomain::register_local_writer(SWriter->getGuid());
+        }
     }
     *WriterOut = SWriter;
 
     // If the terminal throughput controller has proper user defined values, instantiate it
     if (param.throughputController.bytesPerPeriod != UINT32_MAX && param.throughputController.periodMillisecs != 0)
     {
-        std::unique_ptr<FlowController> controller(new ThroughputController(param.throughputController, SWriter));
+        std::unique_ptr<FlowController> controller;
+        if (param.throughputController.kind == TOKEN_BUCKET_THROUGHPUT_CONTROLLER)
+            controller.reset(new TokenBucketController(param.throughputController, SWriter));
+        else
+            controller.reset(new ThroughputController(param.throughputController, SWriter));
         SWriter->add_flow_controller(std::move(controller));
     }
 
@@ -584,6 +625,11 @@ bool RTPSParticipantImpl::createReader(RTPSReader** ReaderOut, ReaderAttributes&
     if (!isBuiltin)
     {
         m_userReaderList.push_back(SReader);
+
+        if (allowsIntraprocessDelivery((Endpoint *)SReader))
+        {
+            RTPSDomain::register_local_reader(SReader);
+        }
     }
     *ReaderOut = SReader;
     return true;
@@ -604,7 +650,7 @@ void RTPSParticipantImpl::disableReader(RTPSReader *reader)
     m_receiverResourcelistMutex.lock();
     for (auto it = m_receiverResourcelist.begin(); it != m_receiverResourcelist.end(); ++it)
     {
-        it->mp_receiver->removeEndpoint(reader);
+        it->removeEndpoint(reader);
     }
     m_receiverResourcelistMutex.unlock();
 }
@@ -734,7 +780,7 @@ bool RTPSParticipantImpl::assignEndpoint2LocatorList(Endpoint* endp, LocatorList
             if (it->Receiver->SupportsLocator(*lit))
             {
                 //Supported! Take mutex and update lists - We maintain reader/writer discrimination just in case
-                it->mp_receiver->associateEndpoint(endp);
+                it->associateEndpoint(endp);
                 // end association between reader/writer and the receive resources
             }
 
@@ -783,6 +829,13 @@ void RTPSParticipantImpl::createReceiverResources(LocatorList_t& Locator_list, b
     uint32_t size = m_network_Factory.get_max_message_size_between_transports();
     for (auto it_loc = Locator_list.begin(); it_loc != Locator_list.end(); ++it_loc)
     {
+        if (it_loc->kind == LOCATOR_KIND_SHM)
+        {
+            // Shared memory segments belong to this participant, whatever their port number.
+            SharedMemTransport::SetParticipantScope(*it_loc, m_att.builtin.domainId,
+                static_cast<uint32_t>(m_att.participantID));
+        }
+
         bool ret = m_network_Factory.BuildReceiverResources(*it_loc, size, newItemsBuffer);
         if (!ret && ApplyMutation)
         {
@@ -800,11 +853,19 @@ void RTPSParticipantImpl::createReceiverResources(LocatorList_t& Locator_list, b
             std::lock_guard<std::mutex> lock(m_receiverResourcelistMutex);
             //Push the new items into the ReceiverResource buffer
             m_receiverResourcelist.push_back(ReceiverControlBlock(std::move(*it_buffer)));
-            //Create and init the MessageReceiver
-            auto mr = new MessageReceiver(this, size);
-            m_receiverResourcelist.back().mp_receiver = mr;
+            //Create and init the MessageReceivers, one per receive worker
+            ReceiverControlBlock& block = m_receiverResourcelist.back();
+            uint32_t num_receivers = m_receive_pipeline ? m_receive_pipeline->num_workers() : 1;
+            for (uint32_t i = 0; i < num_receivers; ++i)
+            {
+                block.mp_receivers.push_back(new MessageReceiver(this, size));
+            }
             //Start reception
-            m_receiverResourcelist.back().Receiver->RegisterReceiver(mr);
+            if (m_receive_pipeline)
+            {
+                block.Receiver->RegisterPipeline(m_receive_pipeline.get(), block.mp_receivers.data());
+            }
+            block.Receiver->RegisterReceiver(block.mp_receivers.front());
         }
         newItemsBuffer.clear();
     }
@@ -853,15 +914,46 @@ void RTPSParticipantImpl::createSenderResources(LocatorList_t& Locator_list, boo
     }
 }
 
+bool RTPSParticipantImpl::allowsIntraprocessDelivery(Endpoint *pend) const
+{
+    if (!m_att.useIntraprocessDelivery)
+    {
+        return false;
+    }
+
+#if HAVE_SECURITY
+    // Protected data has to go through the crypto plugin.
+    if (pend->getAttributes().security_attributes().is_submessage_protected ||
+            pend->getAttributes().security_attributes().is_payload_protected)
+    {
+        return false;
+    }
+#else
+    (void)pend;
+#endif
+
+    return true;
+}
+
 bool RTPSParticipantImpl::deleteUserEndpoint(Endpoint* p_endpoint)
 {
     m_receiverResourcelistMutex.lock();
     for (auto it = m_receiverResourcelist.begin(); it != m_receiverResourcelist.end(); ++it)
     {
-        it->mp_receiver->removeEndpoint(p_endpoint);
+        it->removeEndpoint(p_endpoint);
     }
     m_receiverResourcelistMutex.unlock();
 
+    // Local writers stop delivering data to the endpoint before it is unmatched.
+    if(p_endpoint->getAttributes().endpointKind == WRITER)
+    {
+        RTPSDomain::unregister_local_writer(p_endpoint->getGuid());
+    }
+    else
+    {
+        RTPSDomain::unregister_local_reader(p_endpoint->getGuid());
+    }
+
     bool found = false, found_in_users = false;
     {
         if(p_endpoint->getAttributes().endpointKind == WRITER)
@@ -985,6 +1077,27 @@ void RTPSParticipantImpl::sendSync(CDRMessage_t* msg, Endpoint* /*pend*/, const
     }
 }
 
+void RTPSParticipantImpl::sendSync(CDRMessage_t* msg, Endpoint* /*pend*/, const LocatorList_t& destination_locators)
+{
+    std::lock_guard<std::mutex> guard(m_send_resources_mutex);
+    for (auto& it : m_senderResourceList)
+    {
+        m_batchSendLocators.clear();
+        for (const Locator_t& destination_loc : destination_locators)
+        {
+            if (it.SupportsLocator(destination_loc))
+            {
+                m_batchSendLocators.push_back(destination_loc);
+            }
+        }
+
+        if (!m_batchSendLocators.empty())
+        {
+            it.Send(msg->buffer, msg->length, m_batchSendLocators);
+        }
+    }
+}
+
 void RTPSParticipantImpl::setGuid(GUID_t& guid)
 {
     m_guid = guid;
@@ -42,6 +42,8 @@
 #include <fastrtps/rtps/network/NetworkFactory.h>
 #include <fastrtps/rtps/network/ReceiverResource.h>
 #include <fastrtps/rtps/network/SenderResource.h>
+#include "../network/ReceivePipeline.h"
+#include "../resources/AsyncWriterScheduler.h"
 #include <fastrtps/rtps/messages/MessageReceiver.h>
 
 #if HAVE_SECURITY
@@ -90,18 +92,32 @@ class RTPSParticipantImpl
     Receiver Control block is a struct we use to encapsulate the resources that take part in message reception.
     It contains:
     -A ReceiverResource (as produced by the NetworkFactory Element)
-    -Its associated MessageReceiver
+    -Its associated MessageReceivers. There is one per worker of the receive pipeline, or only one without it.
+    The first one is the one registered in the ReceiverResource.
     */
     typedef struct ReceiverControlBlock
     {
         std::shared_ptr<ReceiverResource> Receiver;
-        MessageReceiver* mp_receiver; //Associated Readers/Writers inside of MessageReceiver
-        ReceiverControlBlock(std::shared_ptr<ReceiverResource>&& rec) :Receiver(std::move(rec)), mp_receiver(nullptr)
+        std::vector<MessageReceiver*> mp_receivers; //Associated Readers/Writers inside of MessageReceiver
+        ReceiverControlBlock(std::shared_ptr<ReceiverResource>&& rec) :Receiver(std::move(rec))
         {
         }
-        ReceiverControlBlock(ReceiverControlBlock&& origen) :Receiver(std::move(origen.Receiver)), mp_receiver(origen.mp_receiver)
+        ReceiverControlBlock(ReceiverControlBlock&& origen) :Receiver(std::move(origen.Receiver)), mp_receivers(std::move(origen.mp_receivers))
         {
-            origen.mp_receiver = nullptr;
+        }
+        void associateEndpoint(Endpoint* endp)
+        {
+            for (MessageReceiver* receiver : mp_receivers)
+            {
+                receiver->associateEndpoint(endp);
+            }
+        }
+        void removeEndpoint(Endpoint* endp)
+        {
+            for (MessageReceiver* receiver : mp_receivers)
+            {
+                receiver->removeEndpoint(endp);
+            }
         }
 
     private:
@@ -173,6 +189,12 @@ public:
     //!Send Method - Deprecated - Stays here for reference purposes
     void sendSync(CDRMessage_t* msg, Endpoint *pend, const Locator_t& destination_loc);
 
+    /**
+     * Sends a message to several locators. Each sender resource receives all its destinations at once, so the
+     * transport can batch the datagrams.
+     */
+    void sendSync(CDRMessage_t* msg, Endpoint *pend, const LocatorList_t& destination_locators);
+
     //!Get the participant Mutex
     std::recursive_mutex* getParticipantMutex() const { return mp_mutex; };
 
@@ -235,6 +257,18 @@ public:
 
     uint32_t get_min_network_send_buffer_size() { return m_network_Factory.get_min_send_buffer_size(); }
 
+    /**
+     * Notifies that the writers accepted by a local reader changed.
+     * It invalidates the routes the message receivers keep for messages not directed to a specific reader.
+     */
+    void reader_matching_changed() { m_readerMatchingGeneration.fetch_add(1, std::memory_order_acq_rel); }
+
+    //! Counter increased on each call to reader_matching_changed().
+    uint32_t reader_matching_generation() const { return m_readerMatchingGeneration.load(std::memory_order_acquire); }
+
+    //! Threads sending the asynchronous writers of this participant. nullptr if they use the shared thread.
+    AsyncWriterScheduler* async_writer_scheduler() const { return m_async_writer_scheduler.get(); }
+
 private:
     //!Attributes of the RTPSParticipant
     RTPSParticipantAttributes m_att;
@@ -275,10 +309,18 @@ private:
     std::list<ReceiverControlBlock> m_receiverResourcelist;
     //! Receiver resource list needs its own mutext to avoid a race condition.
     std::mutex m_receiverResourcelistMutex;
+    //!Workers processing the received messages, if enabled in the attributes.
+    std::unique_ptr<ReceivePipeline> m_receive_pipeline;
+    //!Threads sending the asynchronous writers, if enabled in the attributes.
+    std::unique_ptr<AsyncWriterScheduler> m_async_writer_scheduler;
+    //!Changes each time the writers accepted by a local reader change.
+    std::atomic<uint32_t> m_readerMatchingGeneration;
 
     //!SenderResource List
     std::mutex m_send_resources_mutex;
     std::vector<SenderResource> m_senderResourceList;
+    //!Destinations of a batched send supported by one sender resource. Protected by m_send_resources_mutex.
+    LocatorList_t m_batchSendLocators;
 
     //!Participant Listener
     RTPSParticipantListener* mp_participantListener;
@@ -322,6 +364,12 @@ private:
         */
     bool createSendResources(Endpoint *pend);
 
+    /** Check whether the data of an endpoint can be exchanged with the endpoints of this process without
+        using the transports.
+        @param pend - Pointer to the user endpoint
+        */
+    bool allowsIntraprocessDelivery(Endpoint *pend) const;
+
     /** When we want to create a new Resource but the physical channel specified by the Locator
         can not be opened, we want to mutate the Locator to open a more or less equivalent channel.
         @param loc -  Locator we want to change
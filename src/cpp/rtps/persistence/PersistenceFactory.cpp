@@ -22,10 +22,21 @@
 
 #include <fastrtps/rtps/attributes/PropertyPolicy.h>
 
+#include <cstdlib>
+
 namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
+static void read_uint32_property(const PropertyPolicy& property_policy, const char* name, uint32_t& value)
+{
+    const std::string* property = PropertyPolicyHelper::find_property(property_policy, name);
+    if (property != nullptr)
+    {
+        value = static_cast<uint32_t>(std::strtoul(property->c_str(), nullptr, 0));
+    }
+}
+
 IPersistenceService* PersistenceFactory::create_persistence_service(const PropertyPolicy& property_policy)
 {
     IPersistenceService* ret_val = nullptr;
@@ -38,7 +49,19 @@ IPersistenceService* PersistenceFactory::create_persistence_service(const Proper
             const std::string* filename_property = PropertyPolicyHelper::find_property(property_policy, "dds.persistence.sqlite3.filename");
             const char* filename = (filename_property == nullptr) ?
                 "persistence.db" : filename_property->c_str();
-            ret_val = create_SQLite3_persistence_service(filename);
+
+            SQLite3PersistenceOptions options;
+            const std::string* journal_mode_property = PropertyPolicyHelper::find_property(property_policy, "dds.persistence.sqlite3.journal_mode");
+            if (journal_mode_property != nullptr)
+            {
+                options.journal_mode = *journal_mode_property;
+            }
+            const std::string* write_behind_property = PropertyPolicyHelper::find_property(property_policy, "dds.persistence.sqlite3.write_behind");
+            options.write_behind = (write_behind_property != nullptr) && (write_behind_property->compare("true") == 0);
+            read_uint32_property(property_policy, "dds.persistence.sqlite3.max_latency_ms", options.max_latency_ms);
+            read_uint32_property(property_policy, "dds.persistence.sqlite3.batch_size", options.batch_size);
+
+            ret_val = create_SQLite3_persistence_service(filename, options);
         }
     }
 
@@ -23,13 +23,34 @@
 
 #include "sqlite3.h"
 
+#include <algorithm>
+#include <cctype>
 #include <string.h>
 
 namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
-static sqlite3* open_or_create_database(const char* filename)
+static bool set_journal_mode(sqlite3* db, const std::string& journal_mode)
+{
+    static const char* const valid_modes[] = { "DELETE", "TRUNCATE", "PERSIST", "MEMORY", "WAL", "OFF" };
+
+    std::string mode(journal_mode);
+    std::transform(mode.begin(), mode.end(), mode.begin(), [](char c) { return static_cast<char>(::toupper(c)); });
+
+    for (const char* valid_mode : valid_modes)
+    {
+        if (mode.compare(valid_mode) == 0)
+        {
+            std::string statement = "PRAGMA journal_mode=" + mode + ";";
+            return sqlite3_exec(db, statement.c_str(), 0, 0, 0) == SQLITE_OK;
+        }
+    }
+
+    return false;
+}
+
+static sqlite3* open_or_create_database(const char* filename, const std::string& journal_mode)
 {
     sqlite3* db = NULL;
     int rc;
@@ -44,6 +65,12 @@ static sqlite3* open_or_create_database(const char* filename)
         return NULL;
     }
 
+    // Journal mode should be set before creating the tables
+    if (!journal_mode.empty() && !set_journal_mode(db, journal_mode))
+    {
+        logWarning(RTPS_PERSISTENCE, "Could not set journal mode " << journal_mode << " on " << filename);
+    }
+
     // Create tables if they don't exist
     const char* create_statement = R"(
 CREATE TABLE IF NOT EXISTS writers(
@@ -84,17 +111,33 @@ static void finalize_statement(sqlite3_stmt*& stmt)
 
 IPersistenceService* create_SQLite3_persistence_service(const char* filename)
 {
-    sqlite3* db = open_or_create_database(filename);
-    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db);
+    return create_SQLite3_persistence_service(filename, SQLite3PersistenceOptions());
+}
+
+IPersistenceService* create_SQLite3_persistence_service(const char* filename,
+        const SQLite3PersistenceOptions& options)
+{
+    sqlite3* db = open_or_create_database(filename, options.journal_mode);
+    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db, options);
+}
+
+SQLite3PersistenceService::SQLite3PersistenceService(sqlite3* db)
+    : SQLite3PersistenceService(db, SQLite3PersistenceOptions())
+{
 }
 
-SQLite3PersistenceService::SQLite3PersistenceService(sqlite3* db):
+SQLite3PersistenceService::SQLite3PersistenceService(sqlite3* db, const SQLite3PersistenceOptions& options):
     db_(db),
     load_writer_stmt_(NULL),
     add_writer_change_stmt_(NULL),
     remove_writer_change_stmt_(NULL),
     load_reader_stmt_(NULL),
-    update_reader_stmt_(NULL)
+    update_reader_stmt_(NULL),
+    options_(options),
+    pending_count_(0),
+    storing_active_(false),
+    flush_requests_(0),
+    stop_(false)
 {
     // Prepare writer statements
     sqlite3_prepare_v3(db_,"SELECT seq_num,instance,payload FROM writers WHERE guid=?;",-1,SQLITE_PREPARE_PERSISTENT,&load_writer_stmt_,NULL);
@@ -104,10 +147,31 @@ SQLite3PersistenceService::SQLite3PersistenceService(sqlite3* db):
     // Prepare reader statements
     sqlite3_prepare_v3(db_, "SELECT writer_guid_prefix,writer_guid_entity,seq_num FROM readers WHERE guid=?;", -1, SQLITE_PREPARE_PERSISTENT, &load_reader_stmt_, NULL);
     sqlite3_prepare_v3(db_, "INSERT OR REPLACE INTO readers VALUES(?,?,?,?);", -1, SQLITE_PREPARE_PERSISTENT, &update_reader_stmt_, NULL);
+
+    if (options_.write_behind)
+    {
+        if (options_.batch_size == 0)
+        {
+            options_.batch_size = 1;
+        }
+        pending_.resize(options_.batch_size);
+        storing_.resize(options_.batch_size);
+        write_behind_thread_ = std::thread(&SQLite3PersistenceService::write_behind_run, this);
+    }
 }
 
 SQLite3PersistenceService::~SQLite3PersistenceService()
 {
+    if (write_behind_thread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            stop_ = true;
+        }
+        pending_cv_.notify_one();
+        write_behind_thread_.join();
+    }
+
     // Finalize writer statements
     finalize_statement(load_writer_stmt_);
     finalize_statement(add_writer_change_stmt_);
@@ -130,6 +194,8 @@ bool SQLite3PersistenceService::load_writer_from_storage(const std::string& pers
 {
     logInfo(RTPS_PERSISTENCE, "Loading writer " << writer_guid);
 
+    flush();
+
     if (load_writer_stmt_ != NULL)
     {
         sqlite3_reset(load_writer_stmt_);
@@ -169,20 +235,41 @@ bool SQLite3PersistenceService::add_writer_change_to_storage(const std::string&
 {
     logInfo(RTPS_PERSISTENCE, "Writer " << change.writerGUID << " storing change for seq " << change.sequenceNumber);
 
+    if (options_.write_behind)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        PendingOperation& operation = enqueue(lock, PendingOperation::ADD_WRITER_CHANGE);
+        operation.guid.assign(persistence_guid);
+        operation.seq_num = change.sequenceNumber.to64long();
+        operation.has_instance = change.instanceHandle.isDefined();
+        operation.instance = change.instanceHandle;
+        operation.payload.assign(change.serializedPayload.data,
+                change.serializedPayload.data + change.serializedPayload.length);
+        return true;
+    }
+
+    return add_writer_change(persistence_guid, change.sequenceNumber.to64long(),
+            change.instanceHandle.isDefined() ? &change.instanceHandle : nullptr,
+            change.serializedPayload.data, change.serializedPayload.length);
+}
+
+bool SQLite3PersistenceService::add_writer_change(const std::string& persistence_guid, int64_t seq_num,
+        const InstanceHandle_t* instance, const octet* data, uint32_t length)
+{
     if (add_writer_change_stmt_ != NULL)
     {
         sqlite3_reset(add_writer_change_stmt_);
         sqlite3_bind_text(add_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(add_writer_change_stmt_, 2, change.sequenceNumber.to64long());
-        if (change.instanceHandle.isDefined())
+        sqlite3_bind_int64(add_writer_change_stmt_, 2, seq_num);
+        if (instance != nullptr)
         {
-            sqlite3_bind_blob(add_writer_change_stmt_, 3, change.instanceHandle.value, 16, SQLITE_STATIC);
+            sqlite3_bind_blob(add_writer_change_stmt_, 3, instance->value, 16, SQLITE_STATIC);
         }
         else
         {
             sqlite3_bind_zeroblob(add_writer_change_stmt_, 3, 16);
         }
-        sqlite3_bind_blob(add_writer_change_stmt_, 4, change.serializedPayload.data, change.serializedPayload.length, SQLITE_STATIC);
+        sqlite3_bind_blob(add_writer_change_stmt_, 4, data, length, SQLITE_STATIC);
         return sqlite3_step(add_writer_change_stmt_) == SQLITE_DONE;
     }
 
@@ -198,11 +285,25 @@ bool SQLite3PersistenceService::remove_writer_change_from_storage(const std::str
 {
     logInfo(RTPS_PERSISTENCE, "Writer " << change.writerGUID << " removing change for seq " << change.sequenceNumber);
 
+    if (options_.write_behind)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        PendingOperation& operation = enqueue(lock, PendingOperation::REMOVE_WRITER_CHANGE);
+        operation.guid.assign(persistence_guid);
+        operation.seq_num = change.sequenceNumber.to64long();
+        return true;
+    }
+
+    return remove_writer_change(persistence_guid, change.sequenceNumber.to64long());
+}
+
+bool SQLite3PersistenceService::remove_writer_change(const std::string& persistence_guid, int64_t seq_num)
+{
     if (remove_writer_change_stmt_ != NULL)
     {
         sqlite3_reset(remove_writer_change_stmt_);
         sqlite3_bind_text(remove_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(remove_writer_change_stmt_, 2, change.sequenceNumber.to64long());
+        sqlite3_bind_int64(remove_writer_change_stmt_, 2, seq_num);
         return sqlite3_step(remove_writer_change_stmt_) == SQLITE_DONE;
     }
 
@@ -218,6 +319,8 @@ bool SQLite3PersistenceService::load_reader_from_storage(const std::string& read
 {
     logInfo(RTPS_PERSISTENCE, "Loading reader " << reader_guid);
 
+    flush();
+
     if (load_reader_stmt_ != NULL)
     {
         sqlite3_reset(load_reader_stmt_);
@@ -248,19 +351,147 @@ bool SQLite3PersistenceService::update_writer_seq_on_storage(const std::string&
 {
     logInfo(RTPS_PERSISTENCE, "Reader " << reader_guid << " setting seq for writer " << writer_guid << " to " << seq_number);
 
+    if (options_.write_behind)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        PendingOperation& operation = enqueue(lock, PendingOperation::UPDATE_WRITER_SEQ);
+        operation.guid.assign(reader_guid);
+        operation.writer_guid = writer_guid;
+        operation.seq_num = seq_number.to64long();
+        return true;
+    }
+
+    return update_writer_seq(reader_guid, writer_guid, seq_number.to64long());
+}
+
+bool SQLite3PersistenceService::update_writer_seq(const std::string& reader_guid, const GUID_t& writer_guid,
+        int64_t seq_num)
+{
     if (update_reader_stmt_ != NULL)
     {
         sqlite3_reset(update_reader_stmt_);
         sqlite3_bind_text(update_reader_stmt_, 1, reader_guid.c_str(), -1, SQLITE_STATIC);
         sqlite3_bind_blob(update_reader_stmt_, 2, writer_guid.guidPrefix.value, GuidPrefix_t::size, SQLITE_STATIC);
         sqlite3_bind_blob(update_reader_stmt_, 3, writer_guid.entityId.value, EntityId_t::size, SQLITE_STATIC);
-        sqlite3_bind_int64(update_reader_stmt_, 4, seq_number.to64long());
+        sqlite3_bind_int64(update_reader_stmt_, 4, seq_num);
         return sqlite3_step(update_reader_stmt_) == SQLITE_DONE;
     }
 
     return false;
 }
 
+void SQLite3PersistenceService::flush()
+{
+    if (!options_.write_behind)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    ++flush_requests_;
+    pending_cv_.notify_one();
+    stored_cv_.wait(lock, [this]() { return pending_count_ == 0 && !storing_active_; });
+    --flush_requests_;
+}
+
+SQLite3PersistenceService::PendingOperation& SQLite3PersistenceService::enqueue(std::unique_lock<std::mutex>& lock,
+        PendingOperation::Kind kind)
+{
+    // The queue holds one batch. When it is full, wait for the write-behind thread to take it.
+    stored_cv_.wait(lock, [this]() { return pending_count_ < pending_.size(); });
+
+    if (pending_count_ == 0)
+    {
+        first_pending_time_ = std::chrono::steady_clock::now();
+        pending_cv_.notify_one();
+    }
+    else if (pending_count_ + 1 == pending_.size())
+    {
+        pending_cv_.notify_one();
+    }
+
+    PendingOperation& operation = pending_[pending_count_++];
+    operation.kind = kind;
+    return operation;
+}
+
+void SQLite3PersistenceService::write_behind_run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true)
+    {
+        pending_cv_.wait(lock, [this]() { return stop_ || pending_count_ > 0; });
+
+        if (pending_count_ == 0)
+        {
+            // Stopping, and everything has been stored
+            break;
+        }
+
+        // Wait for the batch to be completed, but no longer than the maximum latency of its first modification
+        std::chrono::steady_clock::time_point deadline = first_pending_time_ +
+            std::chrono::milliseconds(options_.max_latency_ms);
+        pending_cv_.wait_until(lock, deadline, [this]()
+        {
+            return stop_ || flush_requests_ > 0 || pending_count_ >= pending_.size();
+        });
+
+        size_t count = pending_count_;
+        pending_.swap(storing_);
+        pending_count_ = 0;
+        storing_active_ = true;
+        stored_cv_.notify_all();
+
+        lock.unlock();
+        store(storing_, count);
+        lock.lock();
+
+        storing_active_ = false;
+        stored_cv_.notify_all();
+    }
+}
+
+void SQLite3PersistenceService::store(std::vector<PendingOperation>& operations, size_t count)
+{
+    if (sqlite3_exec(db_, "BEGIN;", 0, 0, 0) != SQLITE_OK)
+    {
+        logError(RTPS_PERSISTENCE, "Could not begin a transaction: " << sqlite3_errmsg(db_));
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        PendingOperation& operation = operations[i];
+        bool ret = false;
+
+        switch (operation.kind)
+        {
+            case PendingOperation::ADD_WRITER_CHANGE:
+                ret = add_writer_change(operation.guid, operation.seq_num,
+                        operation.has_instance ? &operation.instance : nullptr,
+                        operation.payload.data(), static_cast<uint32_t>(operation.payload.size()));
+                break;
+            case PendingOperation::REMOVE_WRITER_CHANGE:
+                ret = remove_writer_change(operation.guid, operation.seq_num);
+                break;
+            case PendingOperation::UPDATE_WRITER_SEQ:
+                ret = update_writer_seq(operation.guid, operation.writer_guid, operation.seq_num);
+                break;
+        }
+
+        if (!ret)
+        {
+            logError(RTPS_PERSISTENCE, "Could not store modification on " << operation.guid << " for seq " <<
+                    operation.seq_num << ": " << sqlite3_errmsg(db_));
+        }
+    }
+
+    if (sqlite3_exec(db_, "COMMIT;", 0, 0, 0) != SQLITE_OK)
+    {
+        logError(RTPS_PERSISTENCE, "Could not commit a transaction: " << sqlite3_errmsg(db_));
+    }
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
@@ -22,16 +22,48 @@
 #include "PersistenceService.h"
 #include "sqlite3.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+/**
+* Options of the SQLite3 persistence service
+* @ingroup RTPS_PERSISTENCE_MODULE
+*/
+struct SQLite3PersistenceOptions
+{
+    //! Journal mode of the database (i.e. "WAL"). When empty, the default of SQLite is kept.
+    std::string journal_mode;
+    //! When true, modifications are queued and stored in grouped transactions by a background thread.
+    bool write_behind = false;
+    //! Maximum time, in milliseconds, a queued modification waits before its transaction is committed.
+    uint32_t max_latency_ms = 10;
+    //! Maximum number of queued modifications stored in one transaction.
+    uint32_t batch_size = 256;
+};
+
 /**
 * Create a new SQLite3 implementation of persistence service
 * @ingroup RTPS_PERSISTENCE_MODULE
 */
 IPersistenceService* create_SQLite3_persistence_service(const char* filename);
 
+/**
+* Create a new SQLite3 implementation of persistence service
+* @param filename Name of the database file.
+* @param options Journal mode and write-behind configuration.
+* @ingroup RTPS_PERSISTENCE_MODULE
+*/
+IPersistenceService* create_SQLite3_persistence_service(const char* filename,
+        const SQLite3PersistenceOptions& options);
+
 
 /**
 * Persistence service implementation over SQLite3
@@ -41,6 +73,7 @@ class SQLite3PersistenceService : public IPersistenceService
 {
 public:
     SQLite3PersistenceService(sqlite3* db);
+    SQLite3PersistenceService(sqlite3* db, const SQLite3PersistenceOptions& options);
     virtual ~SQLite3PersistenceService() override;
 
     /**
@@ -52,6 +85,7 @@ public:
 
     /**
      * Add a change to storage.
+     * On write-behind mode the change is queued, and errors storing it are only logged.
      * @param change The cache change to add.
      * @return True if operation was successful.
      */
@@ -80,7 +114,47 @@ public:
      */
     virtual bool update_writer_seq_on_storage(const std::string& reader_guid, const GUID_t& writer_guid, const SequenceNumber_t& seq_number) final;
 
+    /**
+     * Wait until all the queued modifications have been stored. Does nothing if write-behind is disabled.
+     */
+    void flush();
+
 private:
+
+    //! Modification queued on write-behind mode.
+    struct PendingOperation
+    {
+        enum Kind
+        {
+            ADD_WRITER_CHANGE,
+            REMOVE_WRITER_CHANGE,
+            UPDATE_WRITER_SEQ
+        };
+
+        Kind kind;
+        //! Persistence guid of the writer, or guid of the reader.
+        std::string guid;
+        int64_t seq_num;
+        bool has_instance;
+        InstanceHandle_t instance;
+        std::vector<octet> payload;
+        GUID_t writer_guid;
+    };
+
+    bool add_writer_change(const std::string& persistence_guid, int64_t seq_num, const InstanceHandle_t* instance,
+            const octet* data, uint32_t length);
+
+    bool remove_writer_change(const std::string& persistence_guid, int64_t seq_num);
+
+    bool update_writer_seq(const std::string& reader_guid, const GUID_t& writer_guid, int64_t seq_num);
+
+    //! Reserves a slot for a new modification. Called with mutex_ locked, it may wait for free space.
+    PendingOperation& enqueue(std::unique_lock<std::mutex>& lock, PendingOperation::Kind kind);
+
+    void write_behind_run();
+
+    void store(std::vector<PendingOperation>& operations, size_t count);
+
     sqlite3* db_;
 
     sqlite3_stmt* load_writer_stmt_;
@@ -89,6 +163,24 @@ private:
 
     sqlite3_stmt* load_reader_stmt_;
     sqlite3_stmt* update_reader_stmt_;
+
+    SQLite3PersistenceOptions options_;
+
+    std::mutex mutex_;
+    //! Wakes up the write-behind thread.
+    std::condition_variable pending_cv_;
+    //! Notified when a batch has been stored.
+    std::condition_variable stored_cv_;
+    //! Queued modifications. Slots are reused, only the first pending_count_ are valid.
+    std::vector<PendingOperation> pending_;
+    size_t pending_count_;
+    //! Modifications being stored by the write-behind thread.
+    std::vector<PendingOperation> storing_;
+    bool storing_active_;
+    std::chrono::steady_clock::time_point first_pending_time_;
+    uint32_t flush_requests_;
+    bool stop_;
+    std::thread write_behind_thread_;
 };
 
 } /* namespace rtps */
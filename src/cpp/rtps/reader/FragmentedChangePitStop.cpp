@@ -63,46 +63,44 @@ CacheChange_t* FragmentedChangePitStop::process(CacheChange_t* incoming_change,
         original_change_cit = changes_.insert(ChangeInPit(original_change));
     }
 
+    CacheChange_t* original_change = original_change_cit->getChange();
+    eprosima::fastrtps::DynamicBitmap& fragments = original_change->getDataFragments();
+    uint32_t fragment_size = original_change->getFragmentSize();
+    uint32_t first = fragmentStartingNum - 1;
+    uint32_t last = first + incoming_change->getFragmentCount();
+    if(last > fragments.size())
+        last = fragments.size();
+
+    // Each run of fragments not present yet is copied at once.
     bool was_updated = false;
-    for (uint32_t count = (fragmentStartingNum - 1); count < (fragmentStartingNum - 1) + incoming_change->getFragmentCount(); ++count)
+    uint32_t begin = fragments.find_first_unset(first);
+    while(begin < last)
     {
-        if(original_change_cit->getChange()->getDataFragments()->at(count) == ChangeFragmentStatus_t::NOT_PRESENT)
-        {
-            // All cases minus last fragment.
-            if (count + 1 != original_change_cit->getChange()->getFragmentCount())
-            {
-                memcpy(original_change_cit->getChange()->serializedPayload.data + count * original_change_cit->getChange()->getFragmentSize(),
-                        incoming_change->serializedPayload.data + (count - (fragmentStartingNum - 1)) * incoming_change->getFragmentSize(), incoming_change->getFragmentSize());
-            }
-            // Last fragment is a special case when copying.
-            else
-            {
-                memcpy(original_change_cit->getChange()->serializedPayload.data + count * original_change_cit->getChange()->getFragmentSize(),
-                        incoming_change->serializedPayload.data + (count - (fragmentStartingNum - 1)) * incoming_change->getFragmentSize(), original_change_cit->getChange()->serializedPayload.length - (count * original_change_cit->getChange()->getFragmentSize()));
-            }
+        uint32_t end = fragments.find_first_set(begin);
+        if(end > last)
+            end = last;
 
-            original_change_cit->getChange()->getDataFragments()->at(count) = ChangeFragmentStatus_t::PRESENT;
+        uint32_t offset = begin * fragment_size;
+        uint32_t length = end * fragment_size;
+        // Last fragment is a special case when copying.
+        if(length > original_change->serializedPayload.length)
+            length = original_change->serializedPayload.length;
+        length -= offset;
 
-            was_updated = true;
-        }
+        memcpy(original_change->serializedPayload.data + offset,
+                incoming_change->serializedPayload.data + (begin - first) * incoming_change->getFragmentSize(), length);
+
+        fragments.set_range(begin, end);
+        was_updated = true;
+
+        begin = fragments.find_first_unset(end);
     }
 
-    // If was updated, check if it is completed.
-    if(was_updated)
+    // If it is completed, return CacheChange_t and remove information.
+    if(was_updated && fragments.all())
     {
-        auto fit = original_change_cit->getChange()->getDataFragments()->begin();
-        for(; fit != original_change_cit->getChange()->getDataFragments()->end(); ++fit)
-        {
-            if(*fit == ChangeFragmentStatus_t::NOT_PRESENT)
-                break;
-        }
-
-        // If it is completed, return CacheChange_t and remove information.
-        if(fit == original_change_cit->getChange()->getDataFragments()->end())
-        {
-            returnedValue = original_change_cit->getChange();
-            changes_.erase(original_change_cit);
-        }
+        returnedValue = original_change;
+        changes_.erase(original_change_cit);
     }
 
     return returnedValue;
@@ -0,0 +1,58 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LocalReaderPointer.cpp
+ */
+
+#include "LocalReaderPointer.h"
+
+using namespace eprosima::fastrtps::rtps;
+
+LocalReaderPointer::LocalReaderPointer(RTPSReader* reader)
+    : reader_(reader)
+    , users_(0)
+{
+}
+
+void LocalReaderPointer::deactivate()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    reader_ = nullptr;
+    cv_.wait(lock, [this]() { return users_ == 0; });
+}
+
+LocalReaderPointer::Instance::Instance(LocalReaderPointer& pointer)
+    : pointer_(pointer)
+    , reader_(nullptr)
+{
+    std::lock_guard<std::mutex> lock(pointer_.mutex_);
+    reader_ = pointer_.reader_;
+    if(reader_ != nullptr)
+    {
+        ++pointer_.users_;
+    }
+}
+
+LocalReaderPointer::Instance::~Instance()
+{
+    if(reader_ != nullptr)
+    {
+        std::lock_guard<std::mutex> lock(pointer_.mutex_);
+        if(--pointer_.users_ == 0)
+        {
+            pointer_.cv_.notify_all();
+        }
+    }
+}
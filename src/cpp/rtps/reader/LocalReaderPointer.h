@@ -0,0 +1,91 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LocalReaderPointer.h
+ */
+#ifndef _RTPS_READER_LOCALREADERPOINTER_H_
+#define _RTPS_READER_LOCALREADERPOINTER_H_
+
+#include <condition_variable>
+#include <mutex>
+
+namespace eprosima
+{
+    namespace fastrtps
+    {
+        namespace rtps
+        {
+            class RTPSReader;
+
+            /*!
+             * @brief Reference to a reader of this process used by writers to deliver data directly.
+             * The reader can be deleted at any time by its participant. Before that happens, deactivate() is called,
+             * which waits for the deliveries in progress and makes the following ones fail.
+             */
+            class LocalReaderPointer
+            {
+                public:
+
+                    /*!
+                     * @brief Gives access to the reader while it is alive. Holding an instance prevents the reader
+                     * from being deleted, so it should only live during a single delivery.
+                     */
+                    class Instance
+                    {
+                        public:
+
+                            explicit Instance(LocalReaderPointer& pointer);
+
+                            ~Instance();
+
+                            explicit operator bool() const { return reader_ != nullptr; }
+
+                            RTPSReader* operator->() const { return reader_; }
+
+                        private:
+
+                            Instance(const Instance&) = delete;
+                            Instance& operator=(const Instance&) = delete;
+
+                            LocalReaderPointer& pointer_;
+
+                            RTPSReader* reader_;
+                    };
+
+                    explicit LocalReaderPointer(RTPSReader* reader);
+
+                    /*!
+                     * @brief Stops giving access to the reader and waits until all instances are released.
+                     */
+                    void deactivate();
+
+                private:
+
+                    LocalReaderPointer(const LocalReaderPointer&) = delete;
+                    LocalReaderPointer& operator=(const LocalReaderPointer&) = delete;
+
+                    std::mutex mutex_;
+
+                    std::condition_variable cv_;
+
+                    RTPSReader* reader_;
+
+                    uint32_t users_;
+            };
+        }
+    }
+}
+
+#endif // _RTPS_READER_LOCALREADERPOINTER_H_
@@ -21,6 +21,7 @@
 #include <fastrtps/rtps/history/ReaderHistory.h>
 #include <fastrtps/log/Log.h>
 #include "FragmentedChangePitStop.h"
+#include "../participant/RTPSParticipantImpl.h"
 
 #include <fastrtps/rtps/reader/ReaderListener.h>
 
@@ -64,6 +65,13 @@ bool RTPSReader::acceptMsgDirectedTo(EntityId_t& entityId)
         return false;
 }
 
+void RTPSReader::setTrustedWriter(EntityId_t writer)
+{
+    m_acceptMessagesFromUnkownWriters = false;
+    m_trustedWriterEntityId = writer;
+    mp_RTPSParticipant->reader_matching_changed();
+}
+
 bool RTPSReader::reserveCache(CacheChange_t** change, uint32_t dataCdrSerializedSize)
 {
     return mp_history->reserve_Cache(change, dataCdrSerializedSize);
@@ -162,6 +170,19 @@ void RTPSReader::set_last_notified(const GUID_t& peristence_guid, const Sequence
     history_record_[peristence_guid] = seq;
 }
 
+bool RTPSReader::acceptMsgFromWriter(const GUID_t& writerGUID)
+{
+    (void)writerGUID;
+    return true;
+}
+
+bool RTPSReader::intraprocess_acknack(const GUID_t& writerGUID, SequenceNumberSet_t& sns)
+{
+    (void)writerGUID;
+    (void)sns;
+    return false;
+}
+
 }
 } /* namespace rtps */
 } /* namespace eprosima */
@@ -29,6 +29,7 @@
 #include "FragmentedChangePitStop.h"
 #include <fastrtps/utils/TimeConversion.h>
 
+#include <algorithm>
 #include <mutex>
 #include <thread>
 
@@ -65,14 +66,10 @@ StatefulReader::StatefulReader(RTPSParticipantImpl* pimpl,GUID_t& guid,
 bool StatefulReader::matched_writer_add(RemoteWriterAttributes& wdata)
 {
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
-    for(std::vector<WriterProxy*>::iterator it=matched_writers.begin();
-            it!=matched_writers.end();++it)
+    if(matched_writers_index.find(wdata.guid) != matched_writers_index.end())
     {
-        if((*it)->m_att.guid == wdata.guid)
-        {
-            logInfo(RTPS_READER,"Attempting to add existing writer");
-            return false;
-        }
+        logInfo(RTPS_READER,"Attempting to add existing writer");
+        return false;
     }
 
     getRTPSParticipant()->createSenderResources(wdata.endpoint.remoteLocatorList, false);
@@ -87,6 +84,8 @@ bool StatefulReader::matched_writer_add(RemoteWriterAttributes& wdata)
     add_persistence_guid(wdata);
     wp->loaded_from_storage_nts(get_last_notified(wdata.guid));
     matched_writers.push_back(wp);
+    matched_writers_index[wp->m_att.guid] = wp;
+    mp_RTPSParticipant->reader_matching_changed();
     logInfo(RTPS_READER,"Writer Proxy " <<wp->m_att.guid <<" added to " <<m_guid.entityId);
     return true;
 }
@@ -99,16 +98,15 @@ bool StatefulReader::matched_writer_remove(const RemoteWriterAttributes& wdata)
     //Remove cachechanges belonging to the unmatched writer
     mp_history->remove_changes_with_guid(wdata.guid);
 
-    for(std::vector<WriterProxy*>::iterator it=matched_writers.begin();it!=matched_writers.end();++it)
+    auto index_it = matched_writers_index.find(wdata.guid);
+    if(index_it != matched_writers_index.end())
     {
-        if((*it)->m_att.guid == wdata.guid)
-        {
-            logInfo(RTPS_READER,"Writer Proxy removed: " <<(*it)->m_att.guid);
-            wproxy = *it;
-            matched_writers.erase(it);
-            remove_persistence_guid(wdata);
-            break;
-        }
+        wproxy = index_it->second;
+        logInfo(RTPS_READER,"Writer Proxy removed: " <<wproxy->m_att.guid);
+        matched_writers_index.erase(index_it);
+        matched_writers.erase(std::find(matched_writers.begin(), matched_writers.end(), wproxy));
+        remove_persistence_guid(wdata);
+        mp_RTPSParticipant->reader_matching_changed();
     }
 
     lock.unlock();
@@ -131,16 +129,15 @@ bool StatefulReader::matched_writer_remove(const RemoteWriterAttributes& wdata,
     //Remove cachechanges belonging to the unmatched writer
     mp_history->remove_changes_with_guid(wdata.guid);
 
-    for(std::vector<WriterProxy*>::iterator it=matched_writers.begin();it!=matched_writers.end();++it)
+    auto index_it = matched_writers_index.find(wdata.guid);
+    if(index_it != matched_writers_index.end())
     {
-        if((*it)->m_att.guid == wdata.guid)
-        {
-            logInfo(RTPS_READER,"Writer Proxy removed: " <<(*it)->m_att.guid);
-            wproxy = *it;
-            matched_writers.erase(it);
-            remove_persistence_guid(wdata);
-            break;
-        }
+        wproxy = index_it->second;
+        logInfo(RTPS_READER,"Writer Proxy removed: " <<wproxy->m_att.guid);
+        matched_writers_index.erase(index_it);
+        matched_writers.erase(std::find(matched_writers.begin(), matched_writers.end(), wproxy));
+        remove_persistence_guid(wdata);
+        mp_RTPSParticipant->reader_matching_changed();
     }
 
     lock.unlock();
@@ -158,14 +155,13 @@ bool StatefulReader::matched_writer_remove(const RemoteWriterAttributes& wdata,
 bool StatefulReader::matched_writer_is_matched(const RemoteWriterAttributes& wdata)
 {
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
-    for(std::vector<WriterProxy*>::iterator it=matched_writers.begin();it!=matched_writers.end();++it)
-    {
-        if((*it)->m_att.guid == wdata.guid)
-        {
-            return true;
-        }
-    }
-    return false;
+    return matched_writers_index.find(wdata.guid) != matched_writers_index.end();
+}
+
+bool StatefulReader::acceptMsgFromWriter(const GUID_t& writerGUID)
+{
+    std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+    return matched_writers_index.find(writerGUID) != matched_writers_index.end();
 }
 
 
@@ -193,13 +189,11 @@ bool StatefulReader::findWriterProxy(const GUID_t& writerGUID, WriterProxy** WP)
 {
     assert(WP);
 
-    for(std::vector<WriterProxy*>::iterator it = matched_writers.begin(); it != matched_writers.end(); ++it)
+    auto it = matched_writers_index.find(writerGUID);
+    if(it != matched_writers_index.end())
     {
-        if((*it)->m_att.guid == writerGUID)
-        {
-            *WP = *it;
-            return true;
-        }
+        *WP = it->second;
+        return true;
     }
     return false;
 }
@@ -398,6 +392,24 @@ bool StatefulReader::processHeartbeatMsg(GUID_t &writerGUID, uint32_t hbCount, S
     return true;
 }
 
+bool StatefulReader::intraprocess_acknack(const GUID_t& writerGUID, SequenceNumberSet_t& sns)
+{
+    WriterProxy *pWP = nullptr;
+
+    std::lock_guard<std::recursive_mutex> lock(*mp_mutex);
+
+    if(!findWriterProxy(writerGUID, &pWP))
+    {
+        return false;
+    }
+
+    std::lock_guard<std::recursive_mutex> wpLock(*pWP->getMutex());
+
+    pWP->missing_changes(sns);
+
+    return true;
+}
+
 bool StatefulReader::processGapMsg(GUID_t &writerGUID, SequenceNumber_t &gapStart, SequenceNumberSet_t &gapList)
 {
     WriterProxy *pWP = nullptr;
@@ -415,11 +427,11 @@ bool StatefulReader::processGapMsg(GUID_t &writerGUID, SequenceNumber_t &gapStar
                 fragmentedChangePitStop_->try_to_remove(auxSN, pWP->m_att.guid);
         }
 
-        for(auto it = gapList.get_begin(); it != gapList.get_end();++it)
+        gapList.for_each([this, pWP](const SequenceNumber_t& it)
         {
-            if(pWP->irrelevant_change_set((*it)))
-                fragmentedChangePitStop_->try_to_remove((*it), pWP->m_att.guid);
-        }
+            if(pWP->irrelevant_change_set(it))
+                fragmentedChangePitStop_->try_to_remove(it, pWP->m_att.guid);
+        });
     }
 
     return true;
@@ -429,17 +441,7 @@ bool StatefulReader::acceptMsgFrom(GUID_t &writerId, WriterProxy **wp)
 {
     assert(wp != nullptr);
 
-    for(std::vector<WriterProxy*>::iterator it = this->matched_writers.begin();
-            it!=matched_writers.end();++it)
-    {
-        if((*it)->m_att.guid == writerId)
-        {
-            *wp = *it;
-            return true;
-        }
-    }
-
-    return false;
+    return findWriterProxy(writerId, wp);
 }
 
 bool StatefulReader::change_removed_by_history(CacheChange_t* a_change, WriterProxy* wp)
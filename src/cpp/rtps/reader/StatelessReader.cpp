@@ -51,11 +51,8 @@ StatelessReader::StatelessReader(RTPSParticipantImpl* pimpl,GUID_t& guid,
 bool StatelessReader::matched_writer_add(RemoteWriterAttributes& wdata)
 {
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
-    for(auto it = m_matched_writers.begin();it!=m_matched_writers.end();++it)
-    {
-        if((*it).guid == wdata.guid)
-            return false;
-    }
+    if(!m_matched_writers_index.insert(wdata.guid).second)
+        return false;
 
     getRTPSParticipant()->createSenderResources(wdata.endpoint.remoteLocatorList, false);
 
@@ -63,6 +60,7 @@ bool StatelessReader::matched_writer_add(RemoteWriterAttributes& wdata)
     m_matched_writers.push_back(wdata);
     add_persistence_guid(wdata);
     m_acceptMessagesFromUnkownWriters = false;
+    mp_RTPSParticipant->reader_matching_changed();
     return true;
 }
 bool StatelessReader::matched_writer_remove(const RemoteWriterAttributes& wdata)
@@ -74,7 +72,9 @@ bool StatelessReader::matched_writer_remove(const RemoteWriterAttributes& wdata)
         {
             logInfo(RTPS_READER,"Writer " <<wdata.guid<< " removed from "<<m_guid.entityId);
             m_matched_writers.erase(it);
+            m_matched_writers_index.erase(wdata.guid);
             remove_persistence_guid(wdata);
+            mp_RTPSParticipant->reader_matching_changed();
             return true;
         }
     }
@@ -84,14 +84,14 @@ bool StatelessReader::matched_writer_remove(const RemoteWriterAttributes& wdata)
 bool StatelessReader::matched_writer_is_matched(const RemoteWriterAttributes& wdata)
 {
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
-    for(auto it = m_matched_writers.begin();it!=m_matched_writers.end();++it)
-    {
-        if((*it).guid == wdata.guid)
-        {
-            return true;
-        }
-    }
-    return false;
+    return m_matched_writers_index.find(wdata.guid) != m_matched_writers_index.end();
+}
+
+bool StatelessReader::acceptMsgFromWriter(const GUID_t& writerGUID)
+{
+    std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+    GUID_t writerId = writerGUID;
+    return acceptMsgFrom(writerId);
 }
 
 bool StatelessReader::change_received(CacheChange_t* change)
@@ -305,13 +305,8 @@ bool StatelessReader::acceptMsgFrom(GUID_t& writerId)
         if(writerId.entityId == this->m_trustedWriterEntityId)
             return true;
 
-        for(auto it = m_matched_writers.begin();it!=m_matched_writers.end();++it)
-        {
-            if((*it).guid == writerId)
-            {
-                return true;
-            }
-        }
+        if(m_matched_writers_index.find(writerId) != m_matched_writers_index.end())
+            return true;
     }
 
     return false;
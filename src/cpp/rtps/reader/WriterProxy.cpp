@@ -23,41 +23,36 @@
 #include <fastrtps/log/Log.h>
 #include <fastrtps/utils/TimeConversion.h>
 
+#include <cassert>
+#include <limits>
 #include <mutex>
 
 #include <fastrtps/rtps/reader/timedevent/HeartbeatResponseDelay.h>
 #include <fastrtps/rtps/reader/timedevent/WriterProxyLiveliness.h>
 #include <fastrtps/rtps/reader/timedevent/InitialAckNack.h>
 
+using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 
 /*!
  * @brief Auxiliary function to change status in a range.
  */
-void WriterProxy::for_each_set_status_from(decltype(WriterProxy::m_changesFromW)::iterator first,
-        decltype(WriterProxy::m_changesFromW)::iterator last,
+void WriterProxy::for_each_set_status_from(RingBuffer<ChangeFromWriter_t>::iterator first,
+        RingBuffer<ChangeFromWriter_t>::iterator last,
         ChangeFromWriterStatus_t status,
         ChangeFromWriterStatus_t new_status)
 {
-    auto it = first;
-    while(it != last)
+    for(auto it = first; it != last; ++it)
     {
         if(it->getStatus() == status)
         {
-            ChangeFromWriter_t newch(*it);
-            newch.setStatus(new_status);
-
-            auto hint = m_changesFromW.erase(it);
-
-            it = m_changesFromW.insert(hint, newch);
+            it->setStatus(new_status);
         }
-
-        ++it;
     }
 }
 
-void WriterProxy::for_each_set_status_from_and_maybe_remove(decltype(WriterProxy::m_changesFromW)::iterator first,
-        decltype(WriterProxy::m_changesFromW)::iterator last,
+void WriterProxy::for_each_set_status_from_and_maybe_remove(RingBuffer<ChangeFromWriter_t>::iterator first,
+        RingBuffer<ChangeFromWriter_t>::iterator last,
         ChangeFromWriterStatus_t status,
         ChangeFromWriterStatus_t orstatus,
         ChangeFromWriterStatus_t new_status)
@@ -65,29 +60,42 @@ void WriterProxy::for_each_set_status_from_and_maybe_remove(decltype(WriterProxy
     auto it = first;
     while(it != last)
     {
-        if(it->getStatus() == status || it->getStatus() == orstatus)
-        {
-            if(it != m_changesFromW.begin())
-            {
-                ChangeFromWriter_t newch(*it);
-                newch.setStatus(new_status);
-
-                auto hint = m_changesFromW.erase(it);
-
-                it = m_changesFromW.insert(hint, newch);
-                ++it;
-                continue;
-            }
-        }
-
         // UNKNOWN or MISSING at the beginning or
         // LOST or RECEIVED at the beginning.
         if(it == m_changesFromW.begin())
         {
             changesFromWLowMark_ = it->getSequenceNumber();
-            it = m_changesFromW.erase(it);
+            m_changesFromW.pop_front();
+            // Iterators are positions in the window, so the following elements are now one position before.
+            --last;
+            continue;
         }
+
+        if(it->getStatus() == status || it->getStatus() == orstatus)
+        {
+            it->setStatus(new_status);
+        }
+
+        ++it;
+    }
+}
+
+RingBuffer<ChangeFromWriter_t>::iterator WriterProxy::find_change(const SequenceNumber_t& seq_num)
+{
+    if(m_changesFromW.empty() || seq_num < m_changesFromW.front().getSequenceNumber())
+    {
+        return m_changesFromW.end();
+    }
+
+    uint64_t offset = seq_num.to64long() - m_changesFromW.front().getSequenceNumber().to64long();
+    if(offset >= m_changesFromW.size())
+    {
+        return m_changesFromW.end();
     }
+
+    auto it = m_changesFromW.begin() + static_cast<std::ptrdiff_t>(offset);
+    assert(it->getSequenceNumber() == seq_num);
+    return it;
 }
 
 static const int WRITERPROXY_LIVELINESS_PERIOD_MULTIPLIER = 1;
@@ -114,10 +122,9 @@ WriterProxy::WriterProxy(const RemoteWriterAttributes& watt,
     mp_initialAcknack(nullptr),
     m_heartbeatFinalFlag(false),
     m_isAlive(true),
-    mp_mutex(new std::recursive_mutex())
-
+    mp_mutex(new std::recursive_mutex()),
+    m_changesFromW(std::numeric_limits<size_t>::max())
 {
-    m_changesFromW.clear();
     //Create Events
     mp_writerProxyLiveliness = new WriterProxyLiveliness(this,TimeConv::Time_t2MilliSecondsDouble(m_att.livelinessLeaseDuration)*WRITERPROXY_LIVELINESS_PERIOD_MULTIPLIER);
     mp_heartbeatResponse = new HeartbeatResponseDelay(this,TimeConv::Time_t2MilliSecondsDouble(mp_SFR->getTimes().heartbeatResponseDelay));
@@ -141,7 +148,7 @@ void WriterProxy::missing_changes_update(const SequenceNumber_t& seqNum)
     // Check was not removed from container.
     if(seqNum > changesFromWLowMark_)
     {
-        if(m_changesFromW.size() == 0 || m_changesFromW.rbegin()->getSequenceNumber() < seqNum)
+        if(m_changesFromW.empty() || m_changesFromW.back().getSequenceNumber() < seqNum)
         {
             // Set already values in container.
             for_each_set_status_from(m_changesFromW.begin(), m_changesFromW.end(),
@@ -155,12 +162,12 @@ void WriterProxy::missing_changes_update(const SequenceNumber_t& seqNum)
             // Add requetes sequence number.
             ChangeFromWriter_t newch(seqNum);
             newch.setStatus(ChangeFromWriterStatus_t::MISSING);
-            m_changesFromW.insert(m_changesFromW.end(), newch);
+            m_changesFromW.push_back(newch);
         }
         else
         {
             // Find it. Must be there.
-            auto last_it = m_changesFromW.find(ChangeFromWriter_t(seqNum));
+            auto last_it = find_change(seqNum);
             assert(last_it != m_changesFromW.end());
             for_each_set_status_from(m_changesFromW.begin(), ++last_it,
                     ChangeFromWriterStatus_t::UNKNOWN, ChangeFromWriterStatus_t::MISSING);
@@ -177,8 +184,8 @@ bool WriterProxy::maybe_add_changes_from_writer_up_to(const SequenceNumber_t& se
     // Check if CacheChange_t is in the container or not.
     SequenceNumber_t lastSeqNum = changesFromWLowMark_;
 
-    if(m_changesFromW.size() > 0)
-        lastSeqNum = m_changesFromW.rbegin()->getSequenceNumber();
+    if(!m_changesFromW.empty())
+        lastSeqNum = m_changesFromW.back().getSequenceNumber();
 
     if(sequence_number > lastSeqNum)
     {
@@ -190,7 +197,7 @@ bool WriterProxy::maybe_add_changes_from_writer_up_to(const SequenceNumber_t& se
         {
             ChangeFromWriter_t newch(lastSeqNum);
             newch.setStatus(default_status);
-            m_changesFromW.insert(m_changesFromW.end(), newch);
+            m_changesFromW.push_back(newch);
         }
     }
 
@@ -205,7 +212,7 @@ void WriterProxy::lost_changes_update(const SequenceNumber_t& seqNum)
     // Check was not removed from container.
     if(seqNum > changesFromWLowMark_)
     {
-        if(m_changesFromW.size() == 0 || m_changesFromW.rbegin()->getSequenceNumber() < seqNum)
+        if(m_changesFromW.empty() || m_changesFromW.back().getSequenceNumber() < seqNum)
         {
             // Remove all because lost or received.
             m_changesFromW.clear();
@@ -215,7 +222,7 @@ void WriterProxy::lost_changes_update(const SequenceNumber_t& seqNum)
         else
         {
             // Find it. Must be there.
-            auto last_it = m_changesFromW.find(ChangeFromWriter_t(seqNum));
+            auto last_it = find_change(seqNum);
             assert(last_it != m_changesFromW.end());
             for_each_set_status_from_and_maybe_remove(m_changesFromW.begin(), last_it,
                     ChangeFromWriterStatus_t::UNKNOWN, ChangeFromWriterStatus_t::MISSING,
@@ -257,12 +264,12 @@ bool WriterProxy::received_change_set(const SequenceNumber_t& seqNum, bool is_re
     if(will_be_the_last)
     {
         // There are others.
-        if(m_changesFromW.size() > 0)
+        if(!m_changesFromW.empty())
         {
             ChangeFromWriter_t chfw(seqNum);
             chfw.setStatus(RECEIVED);
             chfw.setRelevance(is_relevance);
-            m_changesFromW.insert(m_changesFromW.end(), chfw);
+            m_changesFromW.push_back(chfw);
         }
         // Else not insert
         else
@@ -271,7 +278,7 @@ bool WriterProxy::received_change_set(const SequenceNumber_t& seqNum, bool is_re
     // Else it has to be found and change state.
     else
     {
-        auto chit = m_changesFromW.find(ChangeFromWriter_t(seqNum));
+        auto chit = find_change(seqNum);
 
         // Has to be in the container.
         assert(chit != m_changesFromW.end());
@@ -280,13 +287,8 @@ bool WriterProxy::received_change_set(const SequenceNumber_t& seqNum, bool is_re
         {
             if(chit->getStatus() != RECEIVED)
             {
-                ChangeFromWriter_t newch(*chit);
-                newch.setStatus(RECEIVED);
-                newch.setRelevance(is_relevance);
-
-                auto hint = m_changesFromW.erase(chit);
-
-                m_changesFromW.insert(hint, newch);
+                chit->setStatus(RECEIVED);
+                chit->setRelevance(is_relevance);
             }
             else
                 return false;
@@ -295,7 +297,7 @@ bool WriterProxy::received_change_set(const SequenceNumber_t& seqNum, bool is_re
         {
             assert(chit->getStatus() != RECEIVED);
             changesFromWLowMark_ = seqNum;
-            m_changesFromW.erase(chit);
+            m_changesFromW.pop_front();
             cleanup();
         }
 
@@ -307,25 +309,28 @@ bool WriterProxy::received_change_set(const SequenceNumber_t& seqNum, bool is_re
 }
 
 
-const std::vector<ChangeFromWriter_t> WriterProxy::missing_changes()
+void WriterProxy::missing_changes(SequenceNumberSet_t& sns)
 {
-    std::vector<ChangeFromWriter_t> returnedValue;
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
-    for(auto ch : m_changesFromW)
+    sns = SequenceNumberSet_t(changesFromWLowMark_ + 1);
+
+    for(const ChangeFromWriter_t& ch : m_changesFromW)
     {
         if(ch.getStatus() == MISSING)
         {
             // If MISSING, then is relevant.
             assert(ch.isRelevant());
-            returnedValue.push_back(ch);
+
+            // Changes are ordered, so the following ones do not fit either.
+            if(!sns.add(ch.getSequenceNumber()))
+            {
+                logInfo(RTPS_READER, "Sequence number " << ch.getSequenceNumber()
+                        << " exceeded bitmap limit of AckNack. SeqNumSet Base: " << sns.base);
+                break;
+            }
         }
     }
-
-
-    //print_changes_fromWriter_test2();
-
-    return returnedValue;
 }
 
 bool WriterProxy::change_was_received(const SequenceNumber_t& seq_num)
@@ -335,7 +340,7 @@ bool WriterProxy::change_was_received(const SequenceNumber_t& seq_num)
     if(seq_num <= changesFromWLowMark_)
         return true;
 
-    auto chit = m_changesFromW.find(ChangeFromWriter_t(seq_num));
+    auto chit = find_change(seq_num);
 
     if(chit != m_changesFromW.end() && chit->getStatus() == RECEIVED)
         return true;
@@ -356,7 +361,7 @@ void WriterProxy::print_changes_fromWriter_test2()
 
     for(auto it = m_changesFromW.begin(); it != m_changesFromW.end(); ++it)
     {
-        sstream << it->getSequenceNumber() <<"("<<it->isRelevant()<<","<<it->getStatus()<<")-";
+        sstream << it->getSequenceNumber() <<"("<<it->isRelevant()<<","<<static_cast<int>(it->getStatus())<<")-";
     }
 
     std::string auxstr = sstream.str();
@@ -384,7 +389,7 @@ void WriterProxy::setNotValid(const SequenceNumber_t& seqNum)
     if(seqNum <= changesFromWLowMark_)
         return;
 
-    auto chit = m_changesFromW.find(ChangeFromWriter_t(seqNum));
+    auto chit = find_change(seqNum);
 
     // Element must be in the container. In other case, bug.
     assert(chit != m_changesFromW.end());
@@ -395,23 +400,16 @@ void WriterProxy::setNotValid(const SequenceNumber_t& seqNum)
     // Cannot be in the beginning because process of cleanup
     assert(chit != m_changesFromW.begin());
 
-    ChangeFromWriter_t newch(*chit);
-    newch.notValid();
-
-    auto hint = m_changesFromW.erase(chit);
-
-    m_changesFromW.insert(hint, newch);
+    chit->notValid();
 }
 
 void WriterProxy::cleanup()
 {
-    auto chit = m_changesFromW.begin();
-
-    while(chit != m_changesFromW.end() &&
-            (chit->getStatus() == RECEIVED || chit->getStatus() == LOST))
+    while(!m_changesFromW.empty() &&
+            (m_changesFromW.front().getStatus() == RECEIVED || m_changesFromW.front().getStatus() == LOST))
     {
-        changesFromWLowMark_ = chit->getSequenceNumber();
-        chit = m_changesFromW.erase(chit);
+        changesFromWLowMark_ = m_changesFromW.front().getSequenceNumber();
+        m_changesFromW.pop_front();
     }
 }
 
@@ -420,7 +418,7 @@ bool WriterProxy::areThereMissing()
     bool returnedValue = false;
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
-    for(auto ch : m_changesFromW)
+    for(const ChangeFromWriter_t& ch : m_changesFromW)
     {
         if(ch.getStatus() == ChangeFromWriterStatus_t::MISSING)
         {
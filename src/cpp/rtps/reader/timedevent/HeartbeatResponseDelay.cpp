@@ -73,37 +73,30 @@ void HeartbeatResponseDelay::event(
         // Protect reader
         std::lock_guard<std::recursive_mutex> guard(*mp_WP->mp_SFR->getMutex());
 
-        const std::vector<ChangeFromWriter_t> missing_changes = mp_WP->missing_changes();
+        SequenceNumberSet_t sns;
+        mp_WP->missing_changes(sns);
         // Stores missing changes but there is some fragments received.
         std::vector<CacheChange_t*> uncompleted_changes;
 
         RTPSMessageGroup group(mp_WP->mp_SFR->getRTPSParticipant(), mp_WP->mp_SFR, RTPSMessageGroup::READER,
                 m_cdrmessages, m_destination_locators, m_remote_endpoints);
 
-        if(!missing_changes.empty() || !mp_WP->m_heartbeatFinalFlag)
+        if(!sns.isSetEmpty() || !mp_WP->m_heartbeatFinalFlag)
         {
-            SequenceNumberSet_t sns;
-            sns.base = mp_WP->available_changes_max();
-            sns.base++;
-
-            for(auto ch : missing_changes)
+            // Uncompleted changes are requested with NACK_FRAG instead.
+            const SequenceNumberSet_t missing_changes = sns;
+            missing_changes.for_each([this, &sns, &uncompleted_changes](const SequenceNumber_t& seq_num)
             {
                 // Check if the CacheChange_t is uncompleted.
-                CacheChange_t* uncomplete_change = mp_WP->mp_SFR->findCacheInFragmentedCachePitStop(ch.getSequenceNumber(), mp_WP->m_att.guid);
+                CacheChange_t* uncomplete_change =
+                    mp_WP->mp_SFR->findCacheInFragmentedCachePitStop(seq_num, mp_WP->m_att.guid);
 
-                if(uncomplete_change == nullptr)
-                {
-                    if(!sns.add(ch.getSequenceNumber()))
-                    {
-                        logInfo(RTPS_READER,"Sequence number " << ch.getSequenceNumber()
-                                << " exceeded bitmap limit of AckNack. SeqNumSet Base: " << sns.base);
-                    }
-                }
-                else
+                if(uncomplete_change != nullptr)
                 {
+                    sns.remove(seq_num);
                     uncompleted_changes.push_back(uncomplete_change);
                 }
-            }
+            });
 
             // TODO Protect
             mp_WP->mp_SFR->m_acknackCount++;
@@ -123,32 +116,25 @@ void HeartbeatResponseDelay::event(
         {
             for(auto cit : uncompleted_changes)
             {
-                FragmentNumberSet_t frag_sns;
+                const DynamicBitmap& fragments = cit->getDataFragments();
 
                 //  Search first fragment not present.
-                uint32_t frag_num = 0;
-                auto fit = cit->getDataFragments()->begin();
-                for(; fit != cit->getDataFragments()->end(); ++fit)
-                {
-                    ++frag_num;
-                    if(*fit == ChangeFragmentStatus_t::NOT_PRESENT)
-                        break;
-                }
+                uint32_t missing = fragments.find_first_unset();
 
                 // Never should happend.
-                assert(frag_num != 0);
-                assert(fit != cit->getDataFragments()->end());
+                assert(missing < fragments.size());
 
                 // Store FragmentNumberSet_t base.
-                frag_sns.base = frag_num;
+                FragmentNumberSet_t frag_sns(missing + 1);
 
-                // Fill the FragmentNumberSet_t bitmap.
-                for(; fit != cit->getDataFragments()->end(); ++fit)
+                // Fill the FragmentNumberSet_t bitmap with each run of fragments not present.
+                while(missing < fragments.size())
                 {
-                    if(*fit == ChangeFragmentStatus_t::NOT_PRESENT)
-                        frag_sns.add(frag_num);
+                    uint32_t present = fragments.find_first_set(missing);
+                    if(!frag_sns.add_range(missing + 1, present + 1))
+                        break;
 
-                    ++frag_num;
+                    missing = fragments.find_first_unset(present);
                 }
 
                 ++mp_WP->mp_SFR->m_nackfragCount;
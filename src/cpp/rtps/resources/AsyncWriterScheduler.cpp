@@ -0,0 +1,260 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AsyncWriterScheduler.cpp
+ */
+
+#include "AsyncWriterScheduler.h"
+#include <fastrtps/rtps/writer/RTPSWriter.h>
+
+#include <algorithm>
+
+using namespace eprosima::fastrtps::rtps;
+
+//! Scheduling states of a writer.
+static const uint32_t s_idle = 0;
+static const uint32_t s_queued = 1;
+static const uint32_t s_running = 2;
+//! Woken up while being sent. It is queued again when the thread finishes.
+static const uint32_t s_running_woken = 3;
+
+AsyncWriterScheduler::AsyncWriterScheduler(uint32_t num_threads)
+    : num_threads_(num_threads == 0 ? 1 : num_threads)
+    , running_(false)
+    , num_ready_(0)
+{
+    in_progress_.reserve(num_threads_);
+}
+
+AsyncWriterScheduler::~AsyncWriterScheduler()
+{
+    std::lock_guard<std::mutex> lifecycle(lifecycle_mutex_);
+    std::vector<std::thread> threads;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+        threads.swap(threads_);
+        work_cv_.notify_all();
+    }
+
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void AsyncWriterScheduler::add_writer(RTPSWriter& writer, int32_t priority)
+{
+    std::lock_guard<std::mutex> lifecycle(lifecycle_mutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    Registered& registered = writers_[&writer];
+    registered.writer = &writer;
+    registered.priority = priority;
+    ready_[priority];
+
+    if(threads_.empty())
+    {
+        running_ = true;
+        for(uint32_t i = 0; i < num_threads_; ++i)
+        {
+            threads_.emplace_back(&AsyncWriterScheduler::run, this);
+        }
+    }
+
+    writer.async_state_.store(s_idle);
+    writer.async_scheduler_.store(this);
+}
+
+bool AsyncWriterScheduler::remove_writer(RTPSWriter& writer)
+{
+    std::lock_guard<std::mutex> lifecycle(lifecycle_mutex_);
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    auto it = writers_.find(&writer);
+    if(it == writers_.end())
+    {
+        return false;
+    }
+
+    writer.async_scheduler_.store(nullptr);
+    std::deque<RTPSWriter*>& queue = ready_[it->second.priority];
+    writers_.erase(it);
+
+    auto queued = std::find(queue.begin(), queue.end(), &writer);
+    if(queued != queue.end())
+    {
+        queue.erase(queued);
+        --num_ready_;
+    }
+
+    // A writer removed from its own sending thread cannot wait for itself.
+    done_cv_.wait(lock, [this, &writer]()
+    {
+        return !is_in_progress_nts(&writer, true);
+    });
+    writer.async_state_.store(s_idle);
+
+    // A sending thread cannot join itself, so when the last writer is removed from one of them the threads are
+    // kept waiting for writers, and the destructor stops them.
+    bool from_sending_thread = std::any_of(threads_.begin(), threads_.end(), [](const std::thread& thread)
+    {
+        return thread.get_id() == std::this_thread::get_id();
+    });
+
+    if(writers_.empty() && !from_sending_thread)
+    {
+        std::vector<std::thread> threads;
+        running_ = false;
+        threads.swap(threads_);
+        work_cv_.notify_all();
+        lock.unlock();
+
+        for(std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    return true;
+}
+
+void AsyncWriterScheduler::wake_up(const RTPSWriter& writer)
+{
+    AsyncWriterScheduler* scheduler = writer.async_scheduler_.load(std::memory_order_acquire);
+    if(scheduler == nullptr)
+    {
+        return;
+    }
+
+    uint32_t state = writer.async_state_.load(std::memory_order_acquire);
+    for(;;)
+    {
+        uint32_t next = state;
+        if(state == s_idle)
+        {
+            next = s_queued;
+        }
+        else if(state == s_running)
+        {
+            next = s_running_woken;
+        }
+        else
+        {
+            // Already queued, or already going to be queued again.
+            return;
+        }
+
+        if(writer.async_state_.compare_exchange_weak(state, next, std::memory_order_acq_rel))
+        {
+            if(next == s_queued)
+            {
+                scheduler->enqueue(writer);
+            }
+            return;
+        }
+    }
+}
+
+size_t AsyncWriterScheduler::num_writers()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return writers_.size();
+}
+
+void AsyncWriterScheduler::enqueue(const RTPSWriter& writer)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // The writer may have been removed after being woken up.
+    auto it = writers_.find(&writer);
+    if(it == writers_.end())
+    {
+        return;
+    }
+
+    ready_[it->second.priority].push_back(it->second.writer);
+    ++num_ready_;
+    work_cv_.notify_one();
+}
+
+RTPSWriter* AsyncWriterScheduler::pop_nts()
+{
+    for(auto& level : ready_)
+    {
+        if(!level.second.empty())
+        {
+            RTPSWriter* writer = level.second.front();
+            level.second.pop_front();
+            --num_ready_;
+            return writer;
+        }
+    }
+
+    return nullptr;
+}
+
+bool AsyncWriterScheduler::is_in_progress_nts(const RTPSWriter* writer, bool ignore_this_thread) const
+{
+    for(const auto& entry : in_progress_)
+    {
+        if(entry.first == writer)
+        {
+            return !(ignore_this_thread && entry.second == std::this_thread::get_id());
+        }
+    }
+
+    return false;
+}
+
+void AsyncWriterScheduler::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while(running_)
+    {
+        RTPSWriter* writer = pop_nts();
+        if(writer == nullptr)
+        {
+            work_cv_.wait(lock);
+            continue;
+        }
+
+        writer->async_state_.store(s_running, std::memory_order_release);
+        in_progress_.emplace_back(writer, std::this_thread::get_id());
+        lock.unlock();
+
+        writer->send_any_unsent_changes();
+
+        lock.lock();
+        in_progress_.erase(std::find(in_progress_.begin(), in_progress_.end(),
+                    std::make_pair(static_cast<const RTPSWriter*>(writer), std::this_thread::get_id())));
+
+        // The writer may have been removed, and even deleted, while it was being sent. Then remove_writer resets
+        // its state and it cannot be touched here.
+        auto it = writers_.find(writer);
+        uint32_t expected = s_running;
+        if(it != writers_.end() &&
+                !writer->async_state_.compare_exchange_strong(expected, s_idle, std::memory_order_acq_rel))
+        {
+            // Woken up while being sent. It goes behind the writers already waiting.
+            writer->async_state_.store(s_queued, std::memory_order_release);
+            ready_[it->second.priority].push_back(writer);
+            ++num_ready_;
+        }
+
+        done_cv_.notify_all();
+    }
+}
@@ -0,0 +1,138 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AsyncWriterScheduler.h
+ */
+
+#ifndef _RTPS_RESOURCES_ASYNCWRITERSCHEDULER_H_
+#define _RTPS_RESOURCES_ASYNCWRITERSCHEDULER_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace eprosima
+{
+    namespace fastrtps
+    {
+        namespace rtps
+        {
+            class RTPSWriter;
+
+            /*!
+             * @brief Pool of threads sending the pending changes of a set of writers.
+             * A writer that is woken up is queued once, whatever the number of wake ups it gets before a thread
+             * takes it. Waking up a writer that is already queued or being sent is a single atomic operation.
+             * Writers are taken by priority, and in wake up order for the same priority. A writer woken up while
+             * it is being sent is queued again behind the writers already waiting, and it is never sent by two
+             * threads at the same time, so a slow writer only holds one of the threads.
+             * Threads are started with the first writer and stopped when the last one is removed, unless it is
+             * removed from one of them. In that case they are stopped by the destructor.
+             */
+            class AsyncWriterScheduler
+            {
+                public:
+
+                    /*!
+                     * @param num_threads Number of sending threads. At least one is used.
+                     */
+                    explicit AsyncWriterScheduler(uint32_t num_threads);
+
+                    ~AsyncWriterScheduler();
+
+                    /*!
+                     * @brief Adds a writer to the scheduler.
+                     * @param writer Writer to add. It cannot be managed by another scheduler.
+                     * @param priority Writers with a higher priority are sent first.
+                     */
+                    void add_writer(RTPSWriter& writer, int32_t priority);
+
+                    /*!
+                     * @brief Removes a writer, waiting until it is not being sent.
+                     * @return True if the writer was managed by this scheduler.
+                     */
+                    bool remove_writer(RTPSWriter& writer);
+
+                    //! Wakes up the scheduler of a writer, if it has one, so its pending changes are sent.
+                    static void wake_up(const RTPSWriter& writer);
+
+                    uint32_t num_threads() const
+                    {
+                        return num_threads_;
+                    }
+
+                    size_t num_writers();
+
+                private:
+
+                    AsyncWriterScheduler(const AsyncWriterScheduler&) = delete;
+                    AsyncWriterScheduler& operator=(const AsyncWriterScheduler&) = delete;
+
+                    struct Registered
+                    {
+                        RTPSWriter* writer;
+                        int32_t priority;
+                    };
+
+                    //! Queues a writer that was idle.
+                    void enqueue(const RTPSWriter& writer);
+
+                    RTPSWriter* pop_nts();
+
+                    bool is_in_progress_nts(const RTPSWriter* writer, bool ignore_this_thread) const;
+
+                    void run();
+
+                    const uint32_t num_threads_;
+
+                    //! Serializes adding and removing writers, so threads are not started while being stopped.
+                    std::mutex lifecycle_mutex_;
+
+                    std::mutex mutex_;
+
+                    //! Notified when a writer is queued.
+                    std::condition_variable work_cv_;
+
+                    //! Notified when a thread finishes sending a writer.
+                    std::condition_variable done_cv_;
+
+                    bool running_;
+
+                    std::vector<std::thread> threads_;
+
+                    std::unordered_map<const RTPSWriter*, Registered> writers_;
+
+                    //! Queued writers by priority, highest first.
+                    std::map<int32_t, std::deque<RTPSWriter*>, std::greater<int32_t>> ready_;
+
+                    size_t num_ready_;
+
+                    //! Writers being sent, with the thread sending them.
+                    std::vector<std::pair<const RTPSWriter*, std::thread::id>> in_progress_;
+            };
+        }
+    }
+}
+
+#endif
+#endif // _RTPS_RESOURCES_ASYNCWRITERSCHEDULER_H_
@@ -14,119 +14,85 @@
 
 #include <fastrtps/rtps/resources/AsyncWriterThread.h>
 #include <fastrtps/rtps/writer/RTPSWriter.h>
+#include <fastrtps/rtps/attributes/PropertyPolicy.h>
+#include <fastrtps/log/Log.h>
+#include "AsyncWriterScheduler.h"
+#include "../participant/RTPSParticipantImpl.h"
 
 #include <mutex>
 
-#include <algorithm>
-#include <cassert>
-#include <stdexcept>
+#include <cstdlib>
 
+using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 
-std::thread* AsyncWriterThread::thread_;
-std::mutex AsyncWriterThread::data_structure_mutex_;
-std::mutex AsyncWriterThread::condition_variable_mutex_;
-std::list<RTPSWriter*> AsyncWriterThread::async_writers;
-bool AsyncWriterThread::running_;
-bool AsyncWriterThread::run_scheduled_;
-std::condition_variable AsyncWriterThread::cv_;
-AsyncInterestTree AsyncWriterThread::interestTree;
+//! Scheduler of the writers whose participant does not have its own threads.
+static AsyncWriterScheduler& shared_scheduler()
+{
+    static AsyncWriterScheduler scheduler(1);
+    return scheduler;
+}
 
-bool AsyncWriterThread::addWriter(RTPSWriter& writer)
+static int32_t writer_priority(RTPSWriter& writer)
 {
-    bool returnedValue = false;
+    const std::string* property = PropertyPolicyHelper::find_property(writer.getAttributes().properties,
+            "fastrtps.async_writer.priority");
+    if(property == nullptr)
+    {
+        return 0;
+    }
 
-    data_structure_mutex_.lock();
-    async_writers.push_back(&writer);
-    returnedValue = true;
+    char* end = nullptr;
+    long priority = strtol(property->c_str(), &end, 10);
+    if(end == property->c_str() || *end != '\0')
+    {
+        logWarning(RTPS_WRITER, "Invalid async writer priority '" << *property << "'. Using 0");
+        return 0;
+    }
+    return static_cast<int32_t>(priority);
+}
 
-    std::unique_lock<std::mutex> cond_guard(condition_variable_mutex_);
-    data_structure_mutex_.unlock();
-    // If thread not running, start it.
-    if(thread_ == nullptr)
+bool AsyncWriterThread::addWriter(RTPSWriter& writer)
+{
+    AsyncWriterScheduler* scheduler = nullptr;
+    if(writer.getRTPSParticipant() != nullptr)
     {
-        running_ = true;
-        run_scheduled_ = true;
-        thread_ = new std::thread(AsyncWriterThread::run);
+        scheduler = writer.getRTPSParticipant()->async_writer_scheduler();
+    }
+    if(scheduler == nullptr)
+    {
+        scheduler = &shared_scheduler();
     }
 
-    return returnedValue;
+    scheduler->add_writer(writer, writer_priority(writer));
+    return true;
 }
 
-/*!
- * @brief This function removes a writer.
- * @param writer Asynchronous writer to be removed.
- * @return Result of the operation.
- */
 bool AsyncWriterThread::removeWriter(RTPSWriter& writer)
 {
-    bool returnedValue = false;
-
-    std::unique_lock<std::mutex> data_guard(data_structure_mutex_);
-    auto it = std::find(async_writers.begin(), async_writers.end(), &writer);
-
-    if(it != async_writers.end())
+    AsyncWriterScheduler* scheduler = nullptr;
+    if(writer.getRTPSParticipant() != nullptr)
     {
-        async_writers.erase(it);
-        returnedValue = true;
-
-        // If there is not more asynchronous writers, stop the thread.
-        if(async_writers.empty())
-        {
-            std::unique_lock<std::mutex> cond_guard(condition_variable_mutex_);
-            data_guard.unlock();
-            running_ = false;
-            run_scheduled_ = false;
-            cv_.notify_all();
-            cond_guard.unlock();
-            thread_->join();
-            cond_guard.lock();
-            delete thread_;
-            thread_ = nullptr;
-        }
+        scheduler = writer.getRTPSParticipant()->async_writer_scheduler();
+    }
+    if(scheduler != nullptr && scheduler->remove_writer(writer))
+    {
+        return true;
     }
 
-    return returnedValue;
+    return shared_scheduler().remove_writer(writer);
 }
 
 void AsyncWriterThread::wakeUp(const RTPSParticipantImpl* interestedParticipant)
 {
-   interestTree.RegisterInterest(interestedParticipant);
-   { // Lock scope
-      std::unique_lock<std::mutex> cond_guard(condition_variable_mutex_);
-      run_scheduled_ = true;
-   }
-   cv_.notify_all();
+    std::lock_guard<std::recursive_mutex> guard(*interestedParticipant->getParticipantMutex());
+    for(RTPSWriter* writer : interestedParticipant->getAllWriters())
+    {
+        AsyncWriterScheduler::wake_up(*writer);
+    }
 }
 
 void AsyncWriterThread::wakeUp(const RTPSWriter* interestedWriter)
 {
-   interestTree.RegisterInterest(interestedWriter);
-   std::unique_lock<std::mutex> cond_guard(condition_variable_mutex_);
-   run_scheduled_ = true;
-   cv_.notify_all();
-}
-
-void AsyncWriterThread::run()
-{
-    std::unique_lock<std::mutex> cond_guard(condition_variable_mutex_);
-    while(running_)
-    {
-       if(run_scheduled_)
-       {
-          run_scheduled_ = false;
-          cond_guard.unlock();
-          interestTree.Swap();
-          auto interestedWriters = interestTree.GetInterestedWriters();
-
-          std::unique_lock<std::mutex> data_guard(data_structure_mutex_);
-          for(auto writer : async_writers)
-             if (interestedWriters.count(writer))
-               writer->send_any_unsent_changes();
-
-          cond_guard.lock();
-       }
-       else
-           cv_.wait(cond_guard);
-    }
+    AsyncWriterScheduler::wake_up(*interestedWriter);
 }
@@ -62,7 +62,8 @@ namespace eprosima
 using namespace eprosima::fastrtps::rtps;
 
 TimedEventImpl::TimedEventImpl(TimedEvent* event, asio::io_service &service, const std::thread& event_thread, std::chrono::microseconds interval, TimedEvent::AUTODESTRUCTION_MODE autodestruction) :
-timer_(service, interval), m_interval_microsec(interval), mp_event(event),
+service_(service), wheel_(TimerWheel::get(service)), deadline_(std::chrono::steady_clock::now() + interval),
+m_interval_microsec(interval), mp_event(event),
 autodestruction_(autodestruction), state_(std::make_shared<TimerState>(autodestruction)), event_thread_id_(event_thread.get_id())
 {
 	//TIME_INFINITE(m_timeInfinite);
@@ -70,6 +71,7 @@ autodestruction_(autodestruction), state_(std::make_shared<TimerState>(autodestr
 
 TimedEventImpl::~TimedEventImpl()
 {
+    wheel_->cancel(wheel_entry_);
 }
 
 void TimedEventImpl::destroy()
@@ -83,7 +85,7 @@ void TimedEventImpl::destroy()
 
     // If the event is waiting, cancel it.
     if(code == TimerState::WAITING)
-        timer_.cancel();
+        wheel_->cancel(wheel_entry_);
 
     // If the event is waiting or running, wait it finishes.
     // Don't wait if it is the event thread.
@@ -108,12 +110,19 @@ void TimedEventImpl::cancel_timer()
 
     if(ret)
     {
+        std::shared_ptr<TimerState> cancelled_state = state_;
         // Unattach the event state from future event execution.
         state_.reset(new TimerState(autodestruction_));
-        // Cancel the event.
-        timer_.cancel();
+        // Cancel the event. If the wheel is already expiring it, the expiration will release it.
+        bool was_armed = wheel_->cancel(wheel_entry_);
         // Alert to user.
         mp_event->event(TimedEvent::EVENT_ABORT, nullptr);
+
+        // Only self-destructing events have to be released by the cancelled expiration.
+        if(was_armed && autodestruction_ == TimedEvent::ALLWAYS)
+        {
+            service_.post(std::bind(&TimedEventImpl::event, this, TimedEvent::EVENT_ABORT, cancelled_state));
+        }
     }
 }
 
@@ -144,8 +153,8 @@ void TimedEventImpl::restart_timer()
 
         if(restartTimer)
         {
-            timer_.expires_from_now(m_interval_microsec);
-            timer_.async_wait(std::bind(&TimedEventImpl::event,this,std::placeholders::_1, state_));
+            deadline_ = std::chrono::steady_clock::now() + m_interval_microsec;
+            wheel_->schedule(wheel_entry_, this, state_, deadline_);
         }
     }
 }
@@ -164,7 +173,7 @@ bool TimedEventImpl::update_interval_millisec(double time_millisec)
 	return true;
 }
 
-void TimedEventImpl::event(const std::error_code& ec, const std::shared_ptr<TimerState>& state)
+void TimedEventImpl::event(TimedEvent::EventCode code, const std::shared_ptr<TimerState>& state)
 {
     TimerState::StateCode scode = TimerState::WAITING;
 
@@ -174,7 +183,7 @@ void TimedEventImpl::event(const std::error_code& ec, const std::shared_ptr<Time
     // Check bad preconditions
     assert(!(ret && scode == TimerState::DESTROYED));
 
-    if(scode != TimerState::WAITING || !ret || ec == asio::error::operation_aborted)
+    if(scode != TimerState::WAITING || !ret || code == TimedEvent::EVENT_ABORT)
     {
         // If autodestruction is TimedEvent::ALLWAYS, delete the event.
         if(scode != TimerState::DESTROYED && state.get()->autodestruction_ == TimedEvent::ALLWAYS)
@@ -185,15 +194,7 @@ void TimedEventImpl::event(const std::error_code& ec, const std::shared_ptr<Time
         return;
     }
 
-    TimedEvent::EventCode code = TimedEvent::EVENT_MSG;
-    std::string message;
-
-    if(!ec)
-        code = TimedEvent::EVENT_SUCCESS;
-    else
-        message = ec.message();
-
-    this->mp_event->event(code, message.c_str());
+    this->mp_event->event(code, "");
 
     // If the destructor is waiting, signal it.
     std::unique_lock<std::mutex> lock(mutex_);
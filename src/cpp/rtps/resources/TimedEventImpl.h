@@ -26,12 +26,10 @@
 #include <fastrtps/rtps/common/Time_t.h>
 #include <fastrtps/rtps/resources/TimedEvent.h>
 
+#include "TimerWheel.h"
+
 #include <memory>
 
-#include <asio/io_service.hpp>
-#include <asio/steady_timer.hpp>
-#include <asio/deadline_timer.hpp>
-#include <asio/placeholders.hpp>
 #include <asio/io_service.hpp>
 
 #include <fastrtps/utils/Semaphore.h>
@@ -70,17 +68,23 @@ namespace eprosima
                     TimedEventImpl(TimedEvent* ev, asio::io_service &service, const std::thread& event_thread, std::chrono::microseconds interval, TimedEvent::AUTODESTRUCTION_MODE autodestruction);
 
                     /**
-                     * Method invoked when the event occurs. Abstract method.
+                     * Method invoked when the event occurs, or when it was cancelled and has to be released.
                      *
-                     * @param code Code representing the status of the event
-                     * @param msg Message associated to the event
+                     * @param code EVENT_SUCCESS when the timer expired, EVENT_ABORT when it was cancelled.
+                     * @param state State of the event when the timer was armed.
                      */
-                    void event(const std::error_code& ec, const std::shared_ptr<TimerState>& state);
+                    void event(TimedEvent::EventCode code, const std::shared_ptr<TimerState>& state);
 
 
                 protected:
-                    //!Pointer to the timer.
-                    asio::steady_timer timer_;
+                    //!IO service running the event.
+                    asio::io_service& service_;
+                    //!Wheel of the IO service, where the timer is armed.
+                    std::shared_ptr<TimerWheel> wheel_;
+                    //!Node of the timer in the wheel.
+                    TimerWheel::Entry wheel_entry_;
+                    //!Expiration time of the last time the timer was armed.
+                    std::chrono::steady_clock::time_point deadline_;
                     //!Interval to be used in the timed Event.
                     std::chrono::microseconds m_interval_microsec;
                     //!TimedEvent pointer
@@ -129,7 +133,8 @@ namespace eprosima
                     double getRemainingTimeMilliSec()
                     {
                         std::unique_lock<std::mutex> lock(mutex_);
-                        return static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(timer_.expires_from_now()).count());
+                        return static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                    deadline_ - std::chrono::steady_clock::now()).count());
                     }
 
                 private:
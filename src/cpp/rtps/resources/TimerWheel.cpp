@@ -0,0 +1,322 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimerWheel.cpp
+ */
+
+#include "TimerWheel.h"
+#include "TimedEventImpl.h"
+
+#include <map>
+
+using namespace eprosima::fastrtps::rtps;
+
+//! Number of bits of the tick used to index each level. Level 0 has 256 slots and the rest 64.
+static const unsigned int s_level_bits[] = {8, 6, 6, 6};
+static const unsigned int s_level_shift[] = {0, 8, 14, 20};
+//! Ticks covered by the whole wheel. Later entries are parked in the last level until they get closer.
+static const uint64_t s_wheel_range = uint64_t(1) << 26;
+
+static std::mutex& registry_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::map<asio::io_service*, std::weak_ptr<TimerWheel>>& registry()
+{
+    static std::map<asio::io_service*, std::weak_ptr<TimerWheel>> wheels;
+    return wheels;
+}
+
+std::shared_ptr<TimerWheel> TimerWheel::get(asio::io_service& service)
+{
+    std::lock_guard<std::mutex> guard(registry_mutex());
+    std::weak_ptr<TimerWheel>& registered = registry()[&service];
+    std::shared_ptr<TimerWheel> wheel = registered.lock();
+    if(!wheel)
+    {
+        wheel.reset(new TimerWheel(service));
+        registered = wheel;
+    }
+    return wheel;
+}
+
+TimerWheel::TimerWheel(asio::io_service& service)
+    : service_(service)
+    , timer_(service)
+    , epoch_(std::chrono::steady_clock::now())
+    , current_tick_(0)
+    , num_entries_(0)
+    , timer_armed_(false)
+    , timer_tick_(0)
+{
+    for(unsigned int level = 0; level < s_num_levels; ++level)
+    {
+        for(unsigned int slot = 0; slot < s_slots_per_level; ++slot)
+        {
+            slots_[level][slot] = nullptr;
+        }
+    }
+}
+
+TimerWheel::~TimerWheel()
+{
+    std::lock_guard<std::mutex> guard(registry_mutex());
+    auto it = registry().find(&service_);
+    // Another wheel may have been registered for the service after this one expired.
+    if(it != registry().end() && it->second.expired())
+    {
+        registry().erase(it);
+    }
+}
+
+uint64_t TimerWheel::to_tick(std::chrono::steady_clock::time_point time, bool round_up) const
+{
+    if(time <= epoch_)
+    {
+        return 0;
+    }
+
+    std::chrono::steady_clock::duration elapsed = time - epoch_;
+    tick_duration ticks = std::chrono::duration_cast<tick_duration>(elapsed);
+    uint64_t tick = static_cast<uint64_t>(ticks.count());
+    if(round_up && ticks < elapsed)
+    {
+        ++tick;
+    }
+    return tick;
+}
+
+void TimerWheel::link_nts(Entry& entry)
+{
+    uint64_t expiry = entry.expiry_tick < current_tick_ ? current_tick_ : entry.expiry_tick;
+    uint64_t delta = expiry - current_tick_;
+
+    unsigned int level = 0;
+    while(level < s_num_levels - 1 && delta >= (uint64_t(1) << (s_level_shift[level + 1])))
+    {
+        ++level;
+    }
+
+    if(delta >= s_wheel_range)
+    {
+        expiry = current_tick_ + s_wheel_range - 1;
+    }
+
+    uint64_t slot = (expiry >> s_level_shift[level]) & ((uint64_t(1) << s_level_bits[level]) - 1);
+    Entry** head = &slots_[level][slot];
+
+    entry.slot = head;
+    entry.prev = nullptr;
+    entry.next = *head;
+    if(*head != nullptr)
+    {
+        (*head)->prev = &entry;
+    }
+    *head = &entry;
+}
+
+void TimerWheel::unlink_nts(Entry& entry)
+{
+    if(entry.prev != nullptr)
+    {
+        entry.prev->next = entry.next;
+    }
+    else
+    {
+        *entry.slot = entry.next;
+    }
+
+    if(entry.next != nullptr)
+    {
+        entry.next->prev = entry.prev;
+    }
+
+    entry.slot = nullptr;
+    entry.prev = nullptr;
+    entry.next = nullptr;
+}
+
+void TimerWheel::cascade_nts(unsigned int level)
+{
+    uint64_t slot = (current_tick_ >> s_level_shift[level]) & ((uint64_t(1) << s_level_bits[level]) - 1);
+    Entry* entry = slots_[level][slot];
+    slots_[level][slot] = nullptr;
+
+    while(entry != nullptr)
+    {
+        Entry* next = entry->next;
+        link_nts(*entry);
+        entry = next;
+    }
+}
+
+void TimerWheel::advance_nts(uint64_t now_tick, std::vector<Expired>& batch)
+{
+    while(current_tick_ <= now_tick)
+    {
+        if(num_entries_ == 0)
+        {
+            current_tick_ = now_tick + 1;
+            break;
+        }
+
+        // When a lower level wraps, the next slot of the upper one is distributed between the lower levels.
+        for(unsigned int level = s_num_levels - 1; level > 0; --level)
+        {
+            if((current_tick_ & ((uint64_t(1) << s_level_shift[level]) - 1)) == 0)
+            {
+                cascade_nts(level);
+            }
+        }
+
+        Entry* entry = slots_[0][current_tick_ & (s_slots_per_level - 1)];
+        slots_[0][current_tick_ & (s_slots_per_level - 1)] = nullptr;
+        while(entry != nullptr)
+        {
+            Entry* next = entry->next;
+            entry->slot = nullptr;
+            entry->prev = nullptr;
+            entry->next = nullptr;
+            --num_entries_;
+            batch.push_back(Expired{entry->owner, std::move(entry->state)});
+            entry = next;
+        }
+
+        ++current_tick_;
+    }
+}
+
+void TimerWheel::arm_timer_nts()
+{
+    if(num_entries_ == 0)
+    {
+        return;
+    }
+
+    // Wake on the first slot with entries, or when level 0 wraps to cascade the upper levels.
+    uint64_t target = current_tick_;
+    for(unsigned int i = 0; i < s_slots_per_level; ++i, ++target)
+    {
+        if(i > 0 && (target & (s_slots_per_level - 1)) == 0)
+        {
+            break;
+        }
+        if(slots_[0][target & (s_slots_per_level - 1)] != nullptr)
+        {
+            break;
+        }
+    }
+
+    if(timer_armed_ && timer_tick_ <= target)
+    {
+        return;
+    }
+
+    timer_armed_ = true;
+    timer_tick_ = target;
+    timer_.expires_at(epoch_ + tick_duration(static_cast<tick_duration::rep>(target)));
+
+    std::weak_ptr<TimerWheel> weak_this = shared_from_this();
+    timer_.async_wait([weak_this](const asio::error_code& ec)
+    {
+        if(ec == asio::error::operation_aborted)
+        {
+            return;
+        }
+
+        std::shared_ptr<TimerWheel> wheel = weak_this.lock();
+        if(wheel)
+        {
+            wheel->on_timer();
+        }
+    });
+}
+
+void TimerWheel::schedule(Entry& entry, TimedEventImpl* owner, const std::shared_ptr<TimerState>& state,
+        std::chrono::steady_clock::time_point deadline)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    if(entry.slot != nullptr)
+    {
+        unlink_nts(entry);
+        --num_entries_;
+    }
+    else if(num_entries_ == 0)
+    {
+        // Nothing to process until now.
+        current_tick_ = to_tick(std::chrono::steady_clock::now(), false);
+    }
+
+    entry.owner = owner;
+    entry.state = state;
+    entry.expiry_tick = to_tick(deadline, true);
+    link_nts(entry);
+    ++num_entries_;
+
+    if(!timer_armed_ || entry.expiry_tick < timer_tick_)
+    {
+        arm_timer_nts();
+    }
+}
+
+bool TimerWheel::cancel(Entry& entry)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    if(entry.slot == nullptr)
+    {
+        return false;
+    }
+
+    unlink_nts(entry);
+    entry.state.reset();
+    --num_entries_;
+    return true;
+}
+
+size_t TimerWheel::size()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return num_entries_;
+}
+
+void TimerWheel::on_timer()
+{
+    std::vector<Expired> batch;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        timer_armed_ = false;
+        batch.swap(spare_batch_);
+        advance_nts(to_tick(std::chrono::steady_clock::now(), false), batch);
+        arm_timer_nts();
+    }
+
+    // Events are notified without the lock, so they can arm and cancel events.
+    for(Expired& expired : batch)
+    {
+        expired.owner->event(TimedEvent::EVENT_SUCCESS, expired.state);
+    }
+    batch.clear();
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    if(spare_batch_.capacity() < batch.capacity())
+    {
+        spare_batch_.swap(batch);
+    }
+}
@@ -0,0 +1,159 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimerWheel.h
+ */
+
+#ifndef _RTPS_RESOURCES_TIMERWHEEL_H_
+#define _RTPS_RESOURCES_TIMERWHEEL_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <asio.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace eprosima
+{
+    namespace fastrtps
+    {
+        namespace rtps
+        {
+            class TimedEventImpl;
+            class TimerState;
+
+            /*!
+             * @brief Hierarchical timing wheel shared by all the timed events of an io_service.
+             * Arming and cancelling an event only links or unlinks a node owned by the event, so they are O(1) and
+             * never allocate. A single asio timer wakes the wheel when the earliest slot is due, and all the events
+             * of the due slots are expired in a batch on the thread running the io_service.
+             * Expiration times are rounded up to the wheel tick, so events never expire early.
+             */
+            class TimerWheel : public std::enable_shared_from_this<TimerWheel>
+            {
+                public:
+
+                    //! Node of the wheel. Each timed event owns one and it is only accessed by the wheel.
+                    struct Entry
+                    {
+                        Entry() : slot(nullptr), prev(nullptr), next(nullptr), expiry_tick(0), owner(nullptr) {}
+
+                        //! Head of the slot list the entry is linked to. nullptr when not armed.
+                        Entry** slot;
+                        Entry* prev;
+                        Entry* next;
+                        uint64_t expiry_tick;
+                        TimedEventImpl* owner;
+                        //! State of the event when it was armed.
+                        std::shared_ptr<TimerState> state;
+                    };
+
+                    //! Duration of a tick of the wheel.
+                    typedef std::chrono::milliseconds tick_duration;
+
+                    /*!
+                     * @brief Get the wheel of an io_service, creating it if it does not exist.
+                     * The wheel lives while there is some event using it.
+                     */
+                    static std::shared_ptr<TimerWheel> get(asio::io_service& service);
+
+                    ~TimerWheel();
+
+                    /*!
+                     * @brief Arms an entry. If it was already armed, it is moved to the new expiration time.
+                     * @param entry Entry to arm.
+                     * @param owner Event notified when the entry expires.
+                     * @param state State of the event passed back on expiration.
+                     * @param deadline Expiration time.
+                     */
+                    void schedule(Entry& entry, TimedEventImpl* owner, const std::shared_ptr<TimerState>& state,
+                            std::chrono::steady_clock::time_point deadline);
+
+                    /*!
+                     * @brief Disarms an entry.
+                     * @return True if the entry was armed. False if it was not armed or it is being expired.
+                     */
+                    bool cancel(Entry& entry);
+
+                    //! Number of armed entries.
+                    size_t size();
+
+                private:
+
+                    explicit TimerWheel(asio::io_service& service);
+
+                    TimerWheel(const TimerWheel&) = delete;
+                    TimerWheel& operator=(const TimerWheel&) = delete;
+
+                    struct Expired
+                    {
+                        TimedEventImpl* owner;
+                        std::shared_ptr<TimerState> state;
+                    };
+
+                    uint64_t to_tick(std::chrono::steady_clock::time_point time, bool round_up) const;
+
+                    void link_nts(Entry& entry);
+
+                    void unlink_nts(Entry& entry);
+
+                    //! Moves the entries of a slot to the lower levels.
+                    void cascade_nts(unsigned int level);
+
+                    //! Processes all the ticks up to now, moving the due entries to the batch.
+                    void advance_nts(uint64_t now_tick, std::vector<Expired>& batch);
+
+                    //! Arms the asio timer for the earliest tick with due entries, if needed.
+                    void arm_timer_nts();
+
+                    void on_timer();
+
+                    static const unsigned int s_num_levels = 4;
+
+                    static const unsigned int s_slots_per_level = 256;
+
+                    asio::io_service& service_;
+
+                    asio::steady_timer timer_;
+
+                    std::mutex mutex_;
+
+                    //! Origin of the ticks.
+                    std::chrono::steady_clock::time_point epoch_;
+
+                    //! First tick not processed yet.
+                    uint64_t current_tick_;
+
+                    //! Slot lists of each level. Level 0 uses all the slots, upper levels only 64 of them.
+                    Entry* slots_[s_num_levels][s_slots_per_level];
+
+                    size_t num_entries_;
+
+                    bool timer_armed_;
+
+                    uint64_t timer_tick_;
+
+                    //! Batch kept between expirations so expiring does not allocate.
+                    std::vector<Expired> spare_batch_;
+            };
+        }
+    }
+}
+
+#endif
+#endif // _RTPS_RESOURCES_TIMERWHEEL_H_
@@ -19,10 +19,13 @@
 
 #include <fastrtps/rtps/writer/RTPSWriter.h>
 #include <fastrtps/rtps/history/WriterHistory.h>
+#include <fastrtps/rtps/common/CacheChange.h>
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
+#include <fastrtps/rtps/reader/RTPSReader.h>
 #include <fastrtps/log/Log.h>
 #include "../participant/RTPSParticipantImpl.h"
 #include "../flowcontrol/FlowController.h"
+#include "../reader/LocalReaderPointer.h"
 
 #include <mutex>
 
@@ -47,6 +50,9 @@ RTPSWriter::RTPSWriter(RTPSParticipantImpl* impl, GUID_t& guid, WriterAttributes
 #if HAVE_SECURITY
     , encrypt_payload_(mp_history->getTypeMaxSerialized())
 #endif
+    , async_scheduler_(nullptr)
+    , async_state_(0)
+    , delivering_local_reader_messages_(false)
 {
     mp_history->mp_writer = this;
     mp_history->mp_mutex = mp_mutex;
@@ -162,6 +168,117 @@ uint32_t RTPSWriter::calculateMaxDataSize(uint32_t length)
     return maxDataSize;
 }
 
+void RTPSWriter::deliver_to_local_readers()
+{
+    std::vector<LocalReaderMessage> messages;
+    std::unique_lock<std::recursive_mutex> lock(*mp_mutex);
+
+    // Only one thread delivers at a time, so the readers receive the messages in order.
+    if(delivering_local_reader_messages_)
+    {
+        return;
+    }
+
+    delivering_local_reader_messages_ = true;
+
+    while(!local_reader_messages_.empty())
+    {
+        messages.swap(local_reader_messages_);
+        lock.unlock();
+
+        for(auto& message : messages)
+        {
+            process_local_reader_message(message);
+        }
+
+        messages.clear();
+        lock.lock();
+    }
+
+    delivering_local_reader_messages_ = false;
+}
+
+void RTPSWriter::add_local_reader_message_nts(LocalReaderMessage&& message)
+{
+    local_reader_messages_.push_back(std::move(message));
+}
+
+void RTPSWriter::add_local_reader_data_nts(const GUID_t& reader_guid,
+        const std::shared_ptr<LocalReaderPointer>& reader, const CacheChange_t* change)
+{
+    LocalReaderMessage message(LocalReaderMessage::DATA, reader_guid, reader);
+
+    // Local readers of the same change are queued one after the other.
+    for(auto it = local_reader_messages_.rbegin(); it != local_reader_messages_.rend(); ++it)
+    {
+        if(it->kind == LocalReaderMessage::DATA)
+        {
+            if(it->change->sequenceNumber == change->sequenceNumber)
+            {
+                message.change = it->change;
+            }
+            break;
+        }
+    }
+
+    if(!message.change)
+    {
+        message.change = std::make_shared<CacheChange_t>(change->serializedPayload.length);
+        message.change->copy(change);
+    }
+
+    local_reader_messages_.push_back(std::move(message));
+}
+
+void RTPSWriter::process_local_reader_message(LocalReaderMessage& message)
+{
+    LocalReaderPointer::Instance reader(*message.reader);
+
+    if(!reader)
+    {
+        return;
+    }
+
+    GUID_t writer_guid = m_guid;
+
+    switch(message.kind)
+    {
+        case LocalReaderMessage::DATA:
+            reader->processDataMsg(message.change.get());
+            break;
+
+        case LocalReaderMessage::GAP:
+        {
+            auto it = message.seq_nums.begin();
+
+            // Each run of consecutive sequence numbers is notified as a single gap.
+            while(it != message.seq_nums.end())
+            {
+                SequenceNumber_t gap_start = *it;
+                SequenceNumber_t gap_end = gap_start;
+
+                while(++it != message.seq_nums.end() && *it == gap_end + 1)
+                {
+                    ++gap_end;
+                }
+
+                SequenceNumberSet_t gap_list;
+                gap_list.base = gap_end + 1;
+                reader->processGapMsg(writer_guid, gap_start, gap_list);
+            }
+            break;
+        }
+
+        case LocalReaderMessage::HEARTBEAT:
+            reader->processHeartbeatMsg(writer_guid, message.count, message.first_seq, message.last_seq, true, false);
+            break;
+
+        case LocalReaderMessage::ACKNACK:
+            // Only writers keeping the state of their readers need acknowledgements.
+            break;
+    }
+}
+
 void RTPSWriter::update_cached_info_nts(std::vector<GUID_t>&& allRemoteReaders,
             std::vector<LocatorList_t>& allLocatorLists)
 {
@@ -180,7 +297,8 @@ bool RTPSWriter::encrypt_cachechange(CacheChange_t* change)
             + 20 /*SecureDataHeader*/ + 4 + ((2* 16) /*EVP_MAX_IV_LENGTH max block size*/ - 1 ) /* SecureDataBodey*/
             + 16 + 4 /*SecureDataTag*/ &&
             (mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE ||
-            mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE))
+            mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE ||
+            mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::POOLED_SIZE_CLASS_MEMORY_MODE))
         {
             encrypt_payload_.data = (octet*)realloc(encrypt_payload_.data, change->serializedPayload.length +
                     // In future v2 changepool is in writer, and writer set this value to cachechagepool.
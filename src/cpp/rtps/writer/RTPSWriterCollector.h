@@ -23,6 +23,7 @@
 #include <fastrtps/rtps/common/FragmentNumber.h>
 #include <fastrtps/rtps/common/CacheChange.h>
 
+#include <set>
 #include <vector>
 #include <cassert>
 
@@ -74,16 +75,24 @@ class RTPSWriterCollector
 
         typedef std::set<Item, ItemCmp> ItemSet;
 
-        void add_change(CacheChange_t* change, const T& remoteReader, const FragmentNumberSet_t optionalFragmentsNotSent)
+        /**
+         * Adds a change for a remote reader.
+         * @param change Change to add.
+         * @param remoteReader Remote reader of the change.
+         * @param optionalFragmentsNotSent When the change is fragmented, bitmap of the fragments to add.
+         * Bit i is set for fragment i + 1.
+         */
+        void add_change(CacheChange_t* change, const T& remoteReader,
+                const DynamicBitmap& optionalFragmentsNotSent)
         {
             if(change->getFragmentSize() > 0)
             {
-                for(auto sn = optionalFragmentsNotSent.get_begin(); sn != optionalFragmentsNotSent.get_end(); ++sn)
+                optionalFragmentsNotSent.for_each_set([this, change, &remoteReader](uint32_t bit)
                 {
-                    assert(*sn <= change->getDataFragments()->size());
-                    auto it = mItems_.emplace(change->sequenceNumber, *sn, change);
+                    assert(bit < change->getFragmentCount());
+                    auto it = mItems_.emplace(change->sequenceNumber, bit + 1, change);
                     it.first->remoteReaders.push_back(remoteReader);
-                }
+                });
             }
             else
             {
@@ -25,11 +25,15 @@
 #include <fastrtps/log/Log.h>
 #include <fastrtps/rtps/resources/AsyncWriterThread.h>
 #include <fastrtps/rtps/history/WriterHistory.h>
+#include <fastrtps/rtps/RTPSDomain.h>
 
 #include <mutex>
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
+using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 
 
@@ -42,7 +46,9 @@ ReaderProxy::ReaderProxy(
     , mp_nackSupression(nullptr)
     , m_lastAcknackCount(0)
     , mp_mutex(new std::recursive_mutex())
+    , m_changesForReader(std::numeric_limits<size_t>::max())
     , lastNackfragCount_(0)
+    , local_reader_(RTPSDomain::find_local_reader(SW->getGuid(), rdata.guid))
 {
     if(rdata.endpoint.reliabilityKind == RELIABLE)
     {
@@ -77,18 +83,17 @@ void ReaderProxy::addChange(const ChangeForReader_t& change)
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
     assert(change.getSequenceNumber() > changesFromRLowMark_);
-    assert(m_changesForReader.rbegin() != m_changesForReader.rend() ?
-            change.getSequenceNumber() > m_changesForReader.rbegin()->getSequenceNumber() :
-            true);
+    assert(m_changesForReader.empty() ||
+            change.getSequenceNumber() > m_changesForReader.back().getSequenceNumber());
 
     // For best effort readers, changes are acked when being sent
-    if(m_changesForReader.size() == 0 && change.getStatus() == ACKNOWLEDGED)
+    if(m_changesForReader.empty() && change.getStatus() == ACKNOWLEDGED)
     {
         changesFromRLowMark_ = change.getSequenceNumber();
         return;
     }
 
-    m_changesForReader.insert(change);
+    m_changesForReader.push_back(change);
     //TODO (Ricardo) Remove this functionality from here. It is not his place.
     if (change.getStatus() == UNSENT)
     {
@@ -109,7 +114,7 @@ bool ReaderProxy::change_is_acked(const SequenceNumber_t& sequence_number)
     if(sequence_number <= changesFromRLowMark_)
         return true;
 
-    auto chit = m_changesForReader.find(ChangeForReader_t(sequence_number));
+    auto chit = find_change(sequence_number);
     assert(chit != m_changesForReader.end());
 
     return !chit->isRelevant() || chit->getStatus() == ACKNOWLEDGED;
@@ -122,8 +127,10 @@ void ReaderProxy::acked_changes_set(const SequenceNumber_t& seqNum)
 
     if(seqNum > changesFromRLowMark_)
     {
-        auto chit = m_changesForReader.find(seqNum);
-        m_changesForReader.erase(m_changesForReader.begin(), chit);
+        while(!m_changesForReader.empty() && m_changesForReader.front().getSequenceNumber() < seqNum)
+        {
+            m_changesForReader.pop_front();
+        }
     }
     else
     {
@@ -137,6 +144,8 @@ void ReaderProxy::acked_changes_set(const SequenceNumber_t& seqNum)
         }
         future_low_mark = current_sequence;
 
+        // All of them go before the changes already in the window.
+        auto position = m_changesForReader.begin();
         for(; current_sequence <= changesFromRLowMark_; ++current_sequence)
         {
             CacheChange_t* change = nullptr;
@@ -145,14 +154,14 @@ void ReaderProxy::acked_changes_set(const SequenceNumber_t& seqNum)
             {
                 ChangeForReader_t cr(change);
                 cr.setStatus(UNACKNOWLEDGED);
-                m_changesForReader.insert(cr);
+                position = m_changesForReader.insert(position, cr) + 1;
             }
             else
             {
-                ChangeForReader_t cr;
+                ChangeForReader_t cr(current_sequence);
                 cr.setStatus(UNACKNOWLEDGED);
                 cr.notValid();
-                m_changesForReader.insert(cr);
+                position = m_changesForReader.insert(position, cr) + 1;
             }
         }
     }
@@ -160,34 +169,28 @@ void ReaderProxy::acked_changes_set(const SequenceNumber_t& seqNum)
     changesFromRLowMark_ = future_low_mark - 1;
 }
 
-bool ReaderProxy::requested_changes_set(std::vector<SequenceNumber_t>& seqNumSet)
+bool ReaderProxy::requested_changes_set(const SequenceNumberSet_t& seqNumSet)
 {
     bool isSomeoneWasSetRequested = false;
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
-    for(std::vector<SequenceNumber_t>::iterator sit=seqNumSet.begin();sit!=seqNumSet.end();++sit)
+    seqNumSet.for_each([this, &isSomeoneWasSetRequested](const SequenceNumber_t& sit)
     {
-        auto chit = m_changesForReader.find(ChangeForReader_t(*sit));
+        auto chit = find_change(sit);
 
         if(chit != m_changesForReader.end() && UNACKNOWLEDGED == chit->getStatus())
         {
-            ChangeForReader_t newch(*chit);
-            newch.setStatus(REQUESTED);
-            newch.markAllFragmentsAsUnsent();
-
-            auto hint = m_changesForReader.erase(chit);
-
-            m_changesForReader.insert(hint, newch);
-
+            chit->setStatus(REQUESTED);
+            chit->markAllFragmentsAsUnsent();
             isSomeoneWasSetRequested = true;
         }
-    }
+    });
 
     if(isSomeoneWasSetRequested)
     {
         logInfo(RTPS_WRITER,"Requested Changes: " << seqNumSet);
     }
-    else if(!seqNumSet.empty())
+    else if(!seqNumSet.isSetEmpty())
     {
         logWarning(RTPS_WRITER,"Requested Changes: " << seqNumSet
                    << " not found (low mark: " << changesFromRLowMark_ << ")");
@@ -197,33 +200,6 @@ bool ReaderProxy::requested_changes_set(std::vector<SequenceNumber_t>& seqNumSet
 }
 
 
-//TODO(Ricardo) Temporal
-//std::vector<const ChangeForReader_t*> ReaderProxy::get_unsent_changes() const
-std::vector<ChangeForReader_t*> ReaderProxy::get_unsent_changes()
-{
-    std::vector<ChangeForReader_t*> unsent_changes;
-    std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
-
-    for(auto &change_for_reader : m_changesForReader)
-        if(change_for_reader.getStatus() == UNSENT)
-            unsent_changes.push_back(const_cast<ChangeForReader_t*>(&change_for_reader));
-
-    return unsent_changes;
-}
-
-std::vector<const ChangeForReader_t*> ReaderProxy::get_requested_changes() const
-{
-    std::vector<const ChangeForReader_t*> unsent_changes;
-    std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
-
-    auto it = m_changesForReader.begin();
-    for (; it!= m_changesForReader.end(); ++it)
-        if(it->getStatus() == REQUESTED)
-            unsent_changes.push_back(&(*it));
-
-    return unsent_changes;
-}
-
 void ReaderProxy::set_change_to_status(const SequenceNumber_t& seq_num, ChangeForReaderStatus_t status)
 {
     if(seq_num <= changesFromRLowMark_)
@@ -231,23 +207,20 @@ void ReaderProxy::set_change_to_status(const SequenceNumber_t& seq_num, ChangeFo
         return;
     }
 
-    auto it = m_changesForReader.find(ChangeForReader_t(seq_num));
+    auto it = find_change(seq_num);
     bool mustWakeUpAsyncThread = false;
 
     if(it != m_changesForReader.end())
     {
         if(status == ACKNOWLEDGED && it == m_changesForReader.begin())
         {
-            m_changesForReader.erase(it);
+            m_changesForReader.pop_front();
             changesFromRLowMark_ = seq_num;
         }
         else
         {
-            ChangeForReader_t newch(*it);
-            newch.setStatus(status);
+            it->setStatus(status);
             if (status == UNSENT) mustWakeUpAsyncThread = true;
-            auto hint = m_changesForReader.erase(it);
-            m_changesForReader.insert(hint, newch);
         }
     }
 
@@ -261,22 +234,19 @@ bool ReaderProxy::mark_fragment_as_sent_for_change(const CacheChange_t* change,
         return false;
 
     bool allFragmentsSent = false;
-    auto it = m_changesForReader.find(ChangeForReader_t(change->sequenceNumber));
+    auto it = find_change(change->sequenceNumber);
 
     bool mustWakeUpAsyncThread = false; 
 
     if(it != m_changesForReader.end())
     {
-        ChangeForReader_t newch(*it);
-        newch.markFragmentsAsSent(fragment);
-        if (newch.getUnsentFragments().isSetEmpty())
+        it->markFragmentsAsSent(fragment);
+        if (it->getUnsentFragments().none())
         {
             allFragmentsSent = true;
         }
         else
             mustWakeUpAsyncThread = true;
-        auto hint = m_changesForReader.erase(it);
-        m_changesForReader.insert(hint, newch);
     }
 
     if (mustWakeUpAsyncThread)
@@ -301,14 +271,14 @@ void ReaderProxy::convert_status_on_all_changes(ChangeForReaderStatus_t previous
         {
             if(next == ACKNOWLEDGED && it == m_changesForReader.begin())
             {
+                // The iterator keeps pointing to the beginning of the window.
                 changesFromRLowMark_ = it->getSequenceNumber();
-                it = m_changesForReader.erase(it);
+                m_changesForReader.pop_front();
                 continue;
             }
             else
             {
-                // Note: we can perform this cast as we are not touching the sorting field (seq_num)
-                const_cast<ChangeForReader_t&>(*it).setStatus(next);
+                it->setStatus(next);
                 if (next == UNSENT)
                 {
                     mustWakeUpAsyncThread = true;
@@ -332,16 +302,15 @@ void ReaderProxy::setNotValid(CacheChange_t* change)
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
     // Check sequence number is in the container, because it was not clean up.
-    if(m_changesForReader.size() == 0 || change->sequenceNumber < m_changesForReader.begin()->getSequenceNumber())
+    if(m_changesForReader.empty() || change->sequenceNumber < m_changesForReader.front().getSequenceNumber())
         return;
 
-    auto chit = m_changesForReader.find(ChangeForReader_t(change));
+    auto chit = find_change(change->sequenceNumber);
 
     // Element must be in the container. In other case, bug.
     assert(chit != m_changesForReader.end());
 
-    // Note: we can perform this cast as we are not touching the sorting field (seq_num)
-    auto & newch = const_cast<ChangeForReader_t&>(*chit);
+    ChangeForReader_t& newch = *chit;
 
     if(chit == m_changesForReader.begin())
     {
@@ -349,7 +318,6 @@ void ReaderProxy::setNotValid(CacheChange_t* change)
 
         // if it is the first element, set state to unacknowledge because from now reader has to confirm
         // it will not be expecting it.
-        // Note: we can perform this cast as we are not touching the sorting field (seq_num)
         newch.setStatus(UNACKNOWLEDGED);
     }
     else
@@ -397,20 +365,56 @@ bool ReaderProxy::requested_fragment_set(SequenceNumber_t sequence_number, const
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
     // Locate the outbound change referenced by the NACK_FRAG
-    auto changeIter = std::find_if(m_changesForReader.begin(), m_changesForReader.end(), 
-            [sequence_number](const ChangeForReader_t& change)
-            {return change.getSequenceNumber() == sequence_number;});
+    auto changeIter = find_change(sequence_number);
     if (changeIter == m_changesForReader.end())
         return false;
 
-    ChangeForReader_t newch(*changeIter);
-    auto hint = m_changesForReader.erase(changeIter);
-    newch.markFragmentsAsUnsent(frag_set);
+    changeIter->markFragmentsAsUnsent(frag_set);
 
     // If it was UNSENT, we shouldn't switch back to REQUESTED to prevent stalling.
-    if (newch.getStatus() != UNSENT)
-        newch.setStatus(REQUESTED);
-    m_changesForReader.insert(hint, newch);
+    if (changeIter->getStatus() != UNSENT)
+        changeIter->setStatus(REQUESTED);
 
     return true;
 }
+
+RingBuffer<ChangeForReader_t>::iterator ReaderProxy::find_change(const SequenceNumber_t& seq_num)
+{
+    if(m_changesForReader.empty() || seq_num < m_changesForReader.front().getSequenceNumber())
+    {
+        return m_changesForReader.end();
+    }
+
+    // Without gaps, the change is at its distance to the first one.
+    uint64_t offset = seq_num.to64long() - m_changesForReader.front().getSequenceNumber().to64long();
+    if(offset < m_changesForReader.size())
+    {
+        auto it = m_changesForReader.begin() + static_cast<std::ptrdiff_t>(offset);
+        if(it->getSequenceNumber() == seq_num)
+        {
+            return it;
+        }
+    }
+
+    auto it = std::lower_bound(m_changesForReader.begin(), m_changesForReader.end(), seq_num,
+            [](const ChangeForReader_t& change, const SequenceNumber_t& sequence_number)
+            {
+                return change.getSequenceNumber() < sequence_number;
+            });
+
+    if(it != m_changesForReader.end() && it->getSequenceNumber() == seq_num)
+    {
+        return it;
+    }
+
+    return m_changesForReader.end();
+}
+
+void ReaderProxy::remove_acknowledged_front()
+{
+    while(!m_changesForReader.empty() && m_changesForReader.front().getStatus() == ACKNOWLEDGED)
+    {
+        changesFromRLowMark_ = m_changesForReader.front().getSequenceNumber();
+        m_changesForReader.pop_front();
+    }
+}
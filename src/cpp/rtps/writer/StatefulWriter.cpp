@@ -21,9 +21,11 @@
 #include <fastrtps/rtps/writer/WriterListener.h>
 #include <fastrtps/rtps/writer/ReaderProxy.h>
 #include <fastrtps/rtps/resources/AsyncWriterThread.h>
+#include <fastrtps/rtps/reader/RTPSReader.h>
 
 #include "../participant/RTPSParticipantImpl.h"
 #include "../flowcontrol/FlowController.h"
+#include "../reader/LocalReaderPointer.h"
 
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
 #include <fastrtps/rtps/messages/RTPSMessageGroup.h>
@@ -42,6 +44,7 @@
 
 #include <mutex>
 #include <vector>
+#include <algorithm>
 
 using namespace eprosima::fastrtps::rtps;
 
@@ -131,6 +134,37 @@ void StatefulWriter::unsent_change_added_to_history(CacheChange_t* change)
             {
                 ChangeForReader_t changeForReader(change);
 
+                // Local readers always receive the data directly, whatever the push mode.
+                if((*it)->is_local_reader())
+                {
+                    bool is_reliable = (*it)->m_att.endpoint.reliabilityKind == RELIABLE;
+                    changeForReader.setStatus(is_reliable ? UNACKNOWLEDGED : ACKNOWLEDGED);
+
+                    std::lock_guard<std::recursive_mutex> rguard(*(*it)->mp_mutex);
+                    changeForReader.setRelevance((*it)->rtps_is_relevant(change));
+                    (*it)->addChange(changeForReader);
+
+                    // Delivered when the writer is unlocked.
+                    if(changeForReader.isRelevant())
+                    {
+                        add_local_reader_data_nts((*it)->m_att.guid, (*it)->local_reader(), change);
+                    }
+                    else
+                    {
+                        LocalReaderMessage gap(LocalReaderMessage::GAP, (*it)->m_att.guid, (*it)->local_reader());
+                        gap.seq_nums.insert(change->sequenceNumber);
+                        add_local_reader_message_nts(std::move(gap));
+                    }
+
+                    if(is_reliable)
+                    {
+                        add_local_reader_message_nts(LocalReaderMessage(LocalReaderMessage::ACKNACK,
+                                    (*it)->m_att.guid, (*it)->local_reader()));
+                    }
+
+                    continue;
+                }
+
                 // TODO(Ricardo) Study next case: Not push mode, writer reliable and reader besteffort.
                 if(m_pushMode)
                 {
@@ -173,7 +207,7 @@ void StatefulWriter::unsent_change_added_to_history(CacheChange_t* change)
                 }
             }
 
-            if (!m_separateSendingEnabled)
+            if (!m_separateSendingEnabled && !mAllRemoteReaders.empty())
             {
                 RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages);
                 if (!group.add_data(*change, mAllRemoteReaders, mAllShrinkedLocatorList, expectsInlineQos))
@@ -197,7 +231,7 @@ void StatefulWriter::unsent_change_added_to_history(CacheChange_t* change)
             {
                 ChangeForReader_t changeForReader(change);
 
-                if(m_pushMode)
+                if(m_pushMode || (*it)->is_local_reader())
                 {
                     changeForReader.setStatus(UNSENT);
                 }
@@ -244,8 +278,7 @@ bool StatefulWriter::change_removed_by_history(CacheChange_t* a_change)
 
 void StatefulWriter::send_any_unsent_changes()
 {
-
-    std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+    std::unique_lock<std::recursive_mutex> lock(*mp_mutex);
 
     bool activateHeartbeatPeriod = false;
 
@@ -256,6 +289,12 @@ void StatefulWriter::send_any_unsent_changes()
 
         for (auto remoteReader : matched_readers)
         {
+            if (remoteReader->is_local_reader())
+            {
+                send_unsent_changes_to_local_reader_nts(*remoteReader);
+                continue;
+            }
+
             std::lock_guard<std::recursive_mutex> rguard(*remoteReader->mp_mutex);
 
             // For possible GAP
@@ -270,27 +309,26 @@ void StatefulWriter::send_any_unsent_changes()
 
             // Loop all changes
             bool is_reliable = (remoteReader->m_att.endpoint.reliabilityKind == RELIABLE);
-            std::vector<ChangeForReader_t*> unsentChanges = remoteReader->get_unsent_changes();
-            for (auto unsentChange : unsentChanges)
+            remoteReader->for_each_unsent_change([&](ChangeForReader_t& unsentChange)
             {
-                SequenceNumber_t seqNum = unsentChange->getSequenceNumber();
+                SequenceNumber_t seqNum = unsentChange.getSequenceNumber();
 
-                if (unsentChange->isRelevant() && unsentChange->isValid())
+                if (unsentChange.isRelevant() && unsentChange.isValid())
                 {
                     // As we checked we are not async, we know we cannot have fragments
-                    if (group.add_data(*(unsentChange->getChange()), guids, remote_locators_shrinked,
+                    if (group.add_data(*(unsentChange.getChange()), guids, remote_locators_shrinked,
                                 remoteReader->m_att.expectsInlineQos))
                     {
                         if (is_reliable)
                         {
-                            remoteReader->set_change_to_status(seqNum, UNDERWAY);
+                            unsentChange.setStatus(UNDERWAY);
                             activateHeartbeatPeriod = true;
                             assert(remoteReader->mp_nackSupression != nullptr);
                             remoteReader->mp_nackSupression->restart_timer();
                         }
                         else
                         {
-                            remoteReader->set_change_to_status(seqNum, ACKNOWLEDGED);
+                            unsentChange.setStatus(ACKNOWLEDGED);
                         }
                     }
                     else
@@ -304,9 +342,9 @@ void StatefulWriter::send_any_unsent_changes()
                     {
                         irrelevant.emplace(seqNum);
                     }
-                    remoteReader->set_change_to_status(seqNum, UNDERWAY); //TODO(Ricardo) Review
+                    unsentChange.setStatus(UNDERWAY); //TODO(Ricardo) Review
                 } // Relevance
-            } // Changes loop
+            }); // Changes loop
 
             if (!irrelevant.empty())
             {
@@ -322,28 +360,33 @@ void StatefulWriter::send_any_unsent_changes()
 
         for (auto remoteReader : matched_readers)
         {
+            if (remoteReader->is_local_reader())
+            {
+                send_unsent_changes_to_local_reader_nts(*remoteReader);
+                continue;
+            }
+
             std::lock_guard<std::recursive_mutex> rguard(*remoteReader->mp_mutex);
-            std::vector<ChangeForReader_t*> unsentChanges = remoteReader->get_unsent_changes();
 
-            for (auto unsentChange : unsentChanges)
+            remoteReader->for_each_unsent_change([&](ChangeForReader_t& unsentChange)
             {
-                if (unsentChange->isRelevant() && unsentChange->isValid())
+                if (unsentChange.isRelevant() && unsentChange.isValid())
                 {
                     if (m_pushMode)
                     {
-                        relevantChanges.add_change(unsentChange->getChange(), remoteReader, unsentChange->getUnsentFragments());
+                        relevantChanges.add_change(unsentChange.getChange(), remoteReader, unsentChange.getUnsentFragments());
                     }
                     else // Change status to UNACKNOWLEDGED
                     {
-                        remoteReader->set_change_to_status(unsentChange->getSequenceNumber(), UNACKNOWLEDGED);
+                        unsentChange.setStatus(UNACKNOWLEDGED);
                     }
                 }
                 else
                 {
-                    notRelevantChanges.add_sequence_number(unsentChange->getSequenceNumber(), remoteReader);
-                    remoteReader->set_change_to_status(unsentChange->getSequenceNumber(), UNDERWAY); //TODO(Ricardo) Review
+                    notRelevantChanges.add_sequence_number(unsentChange.getSequenceNumber(), remoteReader);
+                    unsentChange.setStatus(UNDERWAY); //TODO(Ricardo) Review
                 }
-            }
+            });
         }
 
         if (m_pushMode)
@@ -488,6 +531,9 @@ void StatefulWriter::send_any_unsent_changes()
     // On VOLATILE writers, remove auto-acked (best effort readers) changes
     check_acked_status();
 
+    lock.unlock();
+    deliver_to_local_readers();
+
     logInfo(RTPS_WRITER, "Finish sending unsent changes");
 }
 
@@ -497,7 +543,7 @@ void StatefulWriter::send_any_unsent_changes()
  */
 bool StatefulWriter::matched_reader_add(RemoteReaderAttributes& rdata)
 {
-    std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+    std::unique_lock<std::recursive_mutex> lock(*mp_mutex);
 
     if(rdata.guid == c_Guid_Unknown)
     {
@@ -518,24 +564,31 @@ bool StatefulWriter::matched_reader_add(RemoteReaderAttributes& rdata)
             return false;
         }
 
-        allRemoteReaders.push_back((*it)->m_att.guid);
-        allLocatorLists.push_back((*it)->m_att.endpoint.remoteLocatorList);
+        if(!(*it)->is_local_reader())
+        {
+            allRemoteReaders.push_back((*it)->m_att.guid);
+            allLocatorLists.push_back((*it)->m_att.endpoint.remoteLocatorList);
+        }
     }
 
-    // Add info of new datareader.
-    allRemoteReaders.push_back(rdata.guid);
     LocatorList_t locators(rdata.endpoint.unicastLocatorList);
     locators.push_back(rdata.endpoint.multicastLocatorList);
-    allLocatorLists.push_back(locators);
-
-    update_cached_info_nts(std::move(allRemoteReaders), allLocatorLists);
-
-    getRTPSParticipant()->createSenderResources(mAllShrinkedLocatorList, false);
 
     rdata.endpoint.unicastLocatorList =
         mp_RTPSParticipant->network_factory().ShrinkLocatorLists({rdata.endpoint.unicastLocatorList});
 
     ReaderProxy* rp = new ReaderProxy(rdata, m_times, this);
+
+    // Add info of new datareader. Local readers don't need the transports.
+    if(!rp->is_local_reader())
+    {
+        allRemoteReaders.push_back(rdata.guid);
+        allLocatorLists.push_back(locators);
+    }
+
+    update_cached_info_nts(std::move(allRemoteReaders), allLocatorLists);
+
+    getRTPSParticipant()->createSenderResources(mAllShrinkedLocatorList, false);
     std::set<SequenceNumber_t> not_relevant_changes;
 
     SequenceNumber_t current_seq = get_seq_num_min();
@@ -581,19 +634,34 @@ bool StatefulWriter::matched_reader_add(RemoteReaderAttributes& rdata)
 
         assert(last_seq + 1 == current_seq);
 
-        std::vector<GUID_t> guids(1, rp->m_att.guid);
-        const LocatorList_t remote_locators_shrinked{mp_RTPSParticipant->network_factory().ShrinkLocatorLists(
-                {rp->m_att.endpoint.remoteLocatorList})};
-        RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages,
-                remote_locators_shrinked, guids);
-
-        // Send initial heartbeat
-        send_heartbeat_nts_(guids, remote_locators_shrinked, group, false);
+        if(rp->is_local_reader())
+        {
+            if(!not_relevant_changes.empty())
+            {
+                LocalReaderMessage gap(LocalReaderMessage::GAP, rp->m_att.guid, rp->local_reader());
+                gap.seq_nums.swap(not_relevant_changes);
+                add_local_reader_message_nts(std::move(gap));
+            }
 
-        // Send Gap
-        if(!not_relevant_changes.empty())
+            // The reader requests the relevant changes it is missing.
+            add_local_reader_heartbeat_nts(*rp);
+        }
+        else
         {
-            group.add_gap(not_relevant_changes, guids, remote_locators_shrinked);
+            std::vector<GUID_t> guids(1, rp->m_att.guid);
+            const LocatorList_t remote_locators_shrinked{mp_RTPSParticipant->network_factory().ShrinkLocatorLists(
+                    {rp->m_att.endpoint.remoteLocatorList})};
+            RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages,
+                    remote_locators_shrinked, guids);
+
+            // Send initial heartbeat
+            send_heartbeat_nts_(guids, remote_locators_shrinked, group, false);
+
+            // Send Gap
+            if(!not_relevant_changes.empty())
+            {
+                group.add_gap(not_relevant_changes, guids, remote_locators_shrinked);
+            }
         }
 
         // Always activate heartbeat period. We need a confirmation of the reader.
@@ -611,6 +679,9 @@ bool StatefulWriter::matched_reader_add(RemoteReaderAttributes& rdata)
             <<rp->m_att.endpoint.unicastLocatorList.size()<<"(u)-"
             <<rp->m_att.endpoint.multicastLocatorList.size()<<"(m) locators");
 
+    lock.unlock();
+    deliver_to_local_readers();
+
     return true;
 }
 
@@ -636,8 +707,11 @@ bool StatefulWriter::matched_reader_remove(const RemoteReaderAttributes& rdata)
             continue;
         }
 
-        allRemoteReaders.push_back((*it)->m_att.guid);
-        allLocatorLists.push_back((*it)->m_att.endpoint.remoteLocatorList);
+        if(!(*it)->is_local_reader())
+        {
+            allRemoteReaders.push_back((*it)->m_att.guid);
+            allLocatorLists.push_back((*it)->m_att.endpoint.remoteLocatorList);
+        }
         ++it;
     }
 
@@ -898,6 +972,12 @@ SequenceNumber_t StatefulWriter::next_sequence_number() const
 
 void StatefulWriter::send_heartbeat_to_nts(ReaderProxy& remoteReaderProxy, bool final)
 {
+    if(remoteReaderProxy.is_local_reader())
+    {
+        add_local_reader_heartbeat_nts(remoteReaderProxy);
+        return;
+    }
+
     std::vector<GUID_t> tmp_guids(1, remoteReaderProxy.m_att.guid);
     const LocatorList_t remote_locators_shrinked{mp_RTPSParticipant->network_factory().ShrinkLocatorLists(
             {remoteReaderProxy.m_att.endpoint.remoteLocatorList})};
@@ -988,8 +1068,7 @@ void StatefulWriter::process_acknack(const GUID_t reader_guid, uint32_t ack_coun
                 {
                     // Sequence numbers before Base are set as Acknowledged.
                     remote_reader->acked_changes_set(sn_set.base);
-                    std::vector<SequenceNumber_t> set_vec = sn_set.get_set();
-                    if (remote_reader->requested_changes_set(set_vec) && nack_response_event_ != nullptr)
+                    if (remote_reader->requested_changes_set(sn_set) && nack_response_event_ != nullptr)
                     {
                         nack_response_event_->restart_timer();
                     }
@@ -1011,3 +1090,117 @@ void StatefulWriter::process_acknack(const GUID_t reader_guid, uint32_t ack_coun
         }
     }
 }
+
+void StatefulWriter::add_local_reader_heartbeat_nts(ReaderProxy& reader_proxy)
+{
+    LocalReaderMessage heartbeat(LocalReaderMessage::HEARTBEAT, reader_proxy.m_att.guid, reader_proxy.local_reader());
+    heartbeat.first_seq = get_seq_num_min();
+    heartbeat.last_seq = get_seq_num_max();
+
+    if(heartbeat.first_seq == c_SequenceNumber_Unknown || heartbeat.last_seq == c_SequenceNumber_Unknown)
+    {
+        heartbeat.first_seq = next_sequence_number();
+        heartbeat.last_seq = heartbeat.first_seq - 1;
+    }
+
+    incrementHBCount();
+    heartbeat.count = m_heartbeatCount;
+    add_local_reader_message_nts(std::move(heartbeat));
+
+    LocalReaderMessage acknack(LocalReaderMessage::ACKNACK, reader_proxy.m_att.guid, reader_proxy.local_reader());
+    acknack.process_nacks = true;
+    add_local_reader_message_nts(std::move(acknack));
+}
+
+void StatefulWriter::process_local_reader_message(LocalReaderMessage& message)
+{
+    if(message.kind != LocalReaderMessage::ACKNACK)
+    {
+        RTPSWriter::process_local_reader_message(message);
+        return;
+    }
+
+    SequenceNumberSet_t sns;
+
+    {
+        LocalReaderPointer::Instance reader(*message.reader);
+
+        if(!reader || !reader->intraprocess_acknack(m_guid, sns))
+        {
+            return;
+        }
+    }
+
+    {
+        std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+
+        auto it = std::find_if(matched_readers.begin(), matched_readers.end(),
+                [&message](const ReaderProxy* reader_proxy)
+                {
+                    return reader_proxy->m_att.guid == message.reader_guid;
+                });
+
+        // The reader may have been unmatched meanwhile.
+        if(it == matched_readers.end())
+        {
+            return;
+        }
+
+        std::lock_guard<std::recursive_mutex> rguard(*(*it)->mp_mutex);
+        (*it)->acked_changes_set(sns.base);
+
+        if(message.process_nacks)
+        {
+            if((*it)->requested_changes_set(sns) && nack_response_event_ != nullptr)
+            {
+                nack_response_event_->restart_timer();
+            }
+        }
+    }
+
+    check_acked_status();
+}
+
+void StatefulWriter::send_unsent_changes_to_local_reader_nts(ReaderProxy& reader_proxy)
+{
+    std::lock_guard<std::recursive_mutex> rguard(*reader_proxy.mp_mutex);
+
+    bool is_reliable = (reader_proxy.m_att.endpoint.reliabilityKind == RELIABLE);
+    std::set<SequenceNumber_t> irrelevant;
+
+    size_t sent = reader_proxy.for_each_unsent_change([&](ChangeForReader_t& unsentChange)
+    {
+        SequenceNumber_t seqNum = unsentChange.getSequenceNumber();
+        CacheChange_t* change = unsentChange.isRelevant() ? unsentChange.getChange() : nullptr;
+
+        unsentChange.setStatus(is_reliable ? UNACKNOWLEDGED : ACKNOWLEDGED);
+
+        if (change != nullptr)
+        {
+            // Flow controllers only limit the use of the transports.
+            add_local_reader_data_nts(reader_proxy.m_att.guid, reader_proxy.local_reader(), change);
+        }
+        else if (is_reliable)
+        {
+            irrelevant.insert(seqNum);
+        }
+    });
+
+    if (!irrelevant.empty())
+    {
+        LocalReaderMessage gap(LocalReaderMessage::GAP, reader_proxy.m_att.guid, reader_proxy.local_reader());
+        gap.seq_nums.swap(irrelevant);
+        add_local_reader_message_nts(std::move(gap));
+    }
+
+    if (is_reliable && sent != 0)
+    {
+        add_local_reader_message_nts(LocalReaderMessage(LocalReaderMessage::ACKNACK, reader_proxy.m_att.guid,
+                    reader_proxy.local_reader()));
+
+        if (reader_proxy.thereIsUnacknowledged())
+        {
+            mp_periodicHB->restart_timer();
+        }
+    }
+}
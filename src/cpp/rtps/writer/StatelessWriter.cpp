@@ -21,8 +21,10 @@
 #include <fastrtps/rtps/writer/WriterListener.h>
 #include <fastrtps/rtps/history/WriterHistory.h>
 #include <fastrtps/rtps/resources/AsyncWriterThread.h>
+#include <fastrtps/rtps/RTPSDomain.h>
 #include "../participant/RTPSParticipantImpl.h"
 #include "../flowcontrol/FlowController.h"
+#include "../reader/LocalReaderPointer.h"
 #include "RTPSWriterCollector.h"
 
 #include <mutex>
@@ -71,7 +73,7 @@ void StatelessWriter::unsent_change_added_to_history(CacheChange_t* cptr)
 {
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
-    if (!reader_locators.empty())
+    if (!reader_locators.empty() || !local_readers_.empty())
     {
 #if HAVE_SECURITY
         encrypt_cachechange(cptr);
@@ -81,6 +83,12 @@ void StatelessWriter::unsent_change_added_to_history(CacheChange_t* cptr)
         {
             this->setLivelinessAsserted(true);
 
+            // Delivered when the writer is unlocked.
+            for (auto& local_reader : local_readers_)
+            {
+                add_local_reader_data_nts(local_reader.guid, local_reader.pointer, cptr);
+            }
+
             if(m_separateSendingEnabled)
             {
                 std::vector<GUID_t> guids(1);
@@ -96,7 +104,7 @@ void StatelessWriter::unsent_change_added_to_history(CacheChange_t* cptr)
                     }
                 }
             }
-            else
+            else if (!reader_locators.empty())
             {
                 RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages,
                     mAllShrinkedLocatorList, mAllRemoteReaders);
@@ -116,6 +124,8 @@ void StatelessWriter::unsent_change_added_to_history(CacheChange_t* cptr)
         {
             for (auto& reader_locator : reader_locators)
                 reader_locator.unsent_changes.push_back(ChangeForReader_t(cptr));
+            for (auto& local_reader : local_readers_)
+                local_reader.unsent_changes.push_back(ChangeForReader_t(cptr));
             AsyncWriterThread::wakeUp(this);
         }
     }
@@ -144,6 +154,17 @@ bool StatelessWriter::change_removed_by_history(CacheChange_t* change)
                     }),
                     reader_locator.unsent_changes.end());
 
+    for(auto& local_reader : local_readers_)
+        local_reader.unsent_changes.erase(std::remove_if(
+                    local_reader.unsent_changes.begin(),
+                    local_reader.unsent_changes.end(),
+                    [change](ChangeForReader_t& cptr)
+                    {
+                        return cptr.getChange() == change ||
+                            cptr.getChange()->sequenceNumber == change->sequenceNumber;
+                    }),
+                    local_reader.unsent_changes.end());
+
     return true;
 }
 
@@ -169,6 +190,21 @@ bool StatelessWriter::is_acked_by_all(const CacheChange_t* change) const
                 return false;
             }
         }
+
+        for (auto& local_reader : local_readers_)
+        {
+            auto it = std::find_if(local_reader.unsent_changes.begin(),
+                local_reader.unsent_changes.end(),
+                [change](const ChangeForReader_t& unsent_change)
+            {
+                return change == unsent_change.getChange();
+            });
+
+            if (it != local_reader.unsent_changes.end())
+            {
+                return false;
+            }
+        }
     }
 
     return true;
@@ -189,8 +225,7 @@ void StatelessWriter::update_unsent_changes(ReaderLocator& reader_locator,
         if (fragNum != 0)
         {
             it->markFragmentsAsSent(fragNum);
-            FragmentNumberSet_t fragment_sns = it->getUnsentFragments();
-            if(fragment_sns.isSetEmpty())
+            if(it->getUnsentFragments().none())
                 reader_locator.unsent_changes.erase(it);
         }
         else
@@ -201,7 +236,10 @@ void StatelessWriter::update_unsent_changes(ReaderLocator& reader_locator,
 void StatelessWriter::send_any_unsent_changes()
 {
     //TODO(Mcc) Separate sending for asynchronous writers
-    std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+    std::unique_lock<std::recursive_mutex> lock(*mp_mutex);
+
+    // Local readers are not limited by the flow controllers.
+    send_unsent_changes_to_local_readers_nts();
 
     RTPSWriterCollector<ReaderLocator*> changesToSend;
 
@@ -265,6 +303,9 @@ void StatelessWriter::send_any_unsent_changes()
         }
     }
 
+    lock.unlock();
+    deliver_to_local_readers();
+
     logInfo(RTPS_WRITER, "Finish sending unsent changes";);
 }
 
@@ -277,6 +318,34 @@ bool StatelessWriter::matched_reader_add(RemoteReaderAttributes& rdata)
 {
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
+    for(auto it = local_readers_.begin(); it != local_readers_.end(); ++it)
+    {
+        if((*it).guid == rdata.guid)
+        {
+            logWarning(RTPS_WRITER, "Attempting to add existing reader");
+            return false;
+        }
+    }
+
+    std::shared_ptr<LocalReaderPointer> local_reader_pointer = RTPSDomain::find_local_reader(m_guid, rdata.guid);
+    if(local_reader_pointer)
+    {
+        LocalReader local_reader;
+        local_reader.guid = rdata.guid;
+        local_reader.pointer = std::move(local_reader_pointer);
+
+        if(rdata.endpoint.durabilityKind >= TRANSIENT_LOCAL)
+        {
+            local_reader.unsent_changes.assign(mp_history->changesBegin(), mp_history->changesEnd());
+            AsyncWriterThread::wakeUp(this);
+        }
+
+        local_readers_.push_back(std::move(local_reader));
+
+        logInfo(RTPS_READER,"Local reader " << rdata.guid << " added to "<<m_guid.entityId);
+        return true;
+    }
+
     std::vector<GUID_t> allRemoteReaders = get_builtin_guid();
     std::vector<LocatorList_t> allLocatorLists;
     bool addGuid = allRemoteReaders.empty();
@@ -429,6 +498,15 @@ bool StatelessWriter::matched_reader_remove(const RemoteReaderAttributes& rdata)
 {
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
+    for(auto lit = local_readers_.begin(); lit != local_readers_.end(); ++lit)
+    {
+        if((*lit).guid == rdata.guid)
+        {
+            local_readers_.erase(lit);
+            return true;
+        }
+    }
+
     std::vector<GUID_t> allRemoteReaders = get_builtin_guid();
     std::vector<LocatorList_t> allLocatorLists;
     bool found = false, addGuid = allRemoteReaders.empty();
@@ -469,6 +547,13 @@ bool StatelessWriter::matched_reader_is_matched(const RemoteReaderAttributes& rd
             return true;
         }
     }
+    for(auto lit = local_readers_.begin(); lit != local_readers_.end(); ++lit)
+    {
+        if((*lit).guid == rdata.guid)
+        {
+            return true;
+        }
+    }
     return false;
 }
 
@@ -480,9 +565,35 @@ void StatelessWriter::unsent_changes_reset()
         reader_locator.unsent_changes.assign(mp_history->changesBegin(),
                 mp_history->changesEnd());
 
+    for(auto& local_reader : local_readers_)
+        local_reader.unsent_changes.assign(mp_history->changesBegin(),
+                mp_history->changesEnd());
+
     AsyncWriterThread::wakeUp(this);
 }
 
+void StatelessWriter::send_unsent_changes_to_local_readers_nts()
+{
+    bool bHasListener = mp_listener != nullptr;
+
+    for(auto& local_reader : local_readers_)
+    {
+        std::vector<ChangeForReader_t> unsent_changes;
+        unsent_changes.swap(local_reader.unsent_changes);
+
+        for(auto& unsent_change : unsent_changes)
+        {
+            CacheChange_t* change = unsent_change.getChange();
+            add_local_reader_data_nts(local_reader.guid, local_reader.pointer, change);
+
+            if (bHasListener && this->is_acked_by_all(change))
+            {
+                mp_listener->onWriterChangeReceivedByAll(this, change);
+            }
+        }
+    }
+}
+
 void StatelessWriter::add_flow_controller(std::unique_ptr<FlowController> controller)
 {
     m_controllers.push_back(std::move(controller));
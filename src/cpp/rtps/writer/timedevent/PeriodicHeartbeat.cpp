@@ -69,21 +69,26 @@ void PeriodicHeartbeat::event(
 
         if (mp_SFW->get_separate_sending())
         {
-            std::lock_guard<std::recursive_mutex> guardW(*mp_SFW->getMutex());
-            for (std::vector<ReaderProxy*>::iterator it = mp_SFW->matchedReadersBegin();
-                it != mp_SFW->matchedReadersEnd(); ++it)
-            {
-                if ((*it)->thereIsUnacknowledged())
+            {//BEGIN PROTECTION
+                std::lock_guard<std::recursive_mutex> guardW(*mp_SFW->getMutex());
+                for (std::vector<ReaderProxy*>::iterator it = mp_SFW->matchedReadersBegin();
+                    it != mp_SFW->matchedReadersEnd(); ++it)
                 {
-                    // FinalFlag is always false because this class is used only by StatefulWriter in Reliable.
-                    mp_SFW->send_heartbeat_to_nts(**it, false);
-                    unacked_changes = true;
+                    if ((*it)->thereIsUnacknowledged())
+                    {
+                        // FinalFlag is always false because this class is used only by StatefulWriter in Reliable.
+                        mp_SFW->send_heartbeat_to_nts(**it, false);
+                        unacked_changes = true;
+                    }
                 }
             }
+
+            mp_SFW->deliver_to_local_readers();
         }
         else
         {
             Count_t heartbeatCount = 0;
+            bool local_unacked_changes = false;
             std::vector<LocatorList_t> locList;
             std::vector<GUID_t> remote_readers;
 
@@ -92,6 +97,17 @@ void PeriodicHeartbeat::event(
                 for (std::vector<ReaderProxy*>::iterator it = mp_SFW->matchedReadersBegin();
                     it != mp_SFW->matchedReadersEnd(); ++it)
                 {
+                    // Local readers are handled out of the message group, once the writer is unlocked.
+                    if ((*it)->is_local_reader())
+                    {
+                        if ((*it)->thereIsUnacknowledged())
+                        {
+                            mp_SFW->send_heartbeat_to_nts(**it, false);
+                            local_unacked_changes = true;
+                        }
+                        continue;
+                    }
+
                     if (!unacked_changes)
                     {
                         if ((*it)->thereIsUnacknowledged())
@@ -110,21 +126,23 @@ void PeriodicHeartbeat::event(
 
                     if (firstSeq == c_SequenceNumber_Unknown || lastSeq == c_SequenceNumber_Unknown)
                     {
-                        return;
+                        unacked_changes = false;
                     }
                     else
                     {
                         (void)firstSeq;
                         assert(firstSeq <= lastSeq);
-                    }
 
-                    mp_SFW->incrementHBCount();
-                    heartbeatCount = mp_SFW->getHeartbeatCount();
+                        mp_SFW->incrementHBCount();
+                        heartbeatCount = mp_SFW->getHeartbeatCount();
+                    }
 
                     // TODO(Ricardo) Use StatefulWriter::send_heartbeat_to_nts.
                 }
             }
 
+            mp_SFW->deliver_to_local_readers();
+
             if (unacked_changes)
             {
                 RTPSMessageGroup group(mp_SFW->getRTPSParticipant(), mp_SFW, RTPSMessageGroup::WRITER, m_cdrmessages);
@@ -135,6 +153,8 @@ void PeriodicHeartbeat::event(
                 logInfo(RTPS_WRITER, mp_SFW->getGuid().entityId << " Sending Heartbeat (" << firstSeq
                         << " - " << lastSeq << ")");
             }
+
+            unacked_changes |= local_unacked_changes;
         }
 
         if (unacked_changes)
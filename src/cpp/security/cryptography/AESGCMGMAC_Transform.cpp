@@ -23,15 +23,10 @@
 
 #include <openssl/aes.h>
 #include <openssl/evp.h>
+#include <openssl/hmac.h>
 #include <openssl/rand.h>
 #include <cstring>
 
-#if OPENSSL_VERSION_NUMBER >= 0x10100000L
-#define IS_OPENSSL_1_1 1
-#else
-#define IS_OPENSSL_1_1 0
-#endif
-
  // Solve error with Win32 macro
 #ifdef WIN32
 #undef max
@@ -59,6 +54,30 @@ static KeyMaterial_AES_GCM_GMAC* find_key(KeyMaterial_AES_GCM_GMAC_Seq& keys, co
     return nullptr;
 }
 
+static void received_sessionkeys(AESGCMGMAC_Transform& transform, AESGCMGMAC_EntityCryptoHandle& remote_entity,
+        const KeyMaterial_AES_GCM_GMAC* key_mat, uint32_t session_id, std::array<uint8_t, 32>& session_key,
+        std::array<uint8_t, 32>& specific_session_key)
+{
+    size_t index = static_cast<size_t>(key_mat - remote_entity->Entity2RemoteKeyMaterial.data());
+    size_t num_sessions = sizeof(remote_entity->ReceivedSessions) / sizeof(remote_entity->ReceivedSessions[0]);
+
+    if(index < num_sessions)
+    {
+        std::unique_lock<std::mutex> lock(remote_entity->received_mutex_);
+        RemoteKeySessionData& session = remote_entity->ReceivedSessions[index];
+        transform.compute_received_sessionkeys(session, *key_mat, session_id);
+        session_key = session.SessionKey;
+        specific_session_key = session.ReceiverSpecificSessionKey;
+    }
+    else
+    {
+        RemoteKeySessionData session;
+        transform.compute_received_sessionkeys(session, *key_mat, session_id);
+        session_key = session.SessionKey;
+        specific_session_key = session.ReceiverSpecificSessionKey;
+    }
+}
+
 AESGCMGMAC_Transform::AESGCMGMAC_Transform()
 {
 }
@@ -106,16 +125,16 @@ bool AESGCMGMAC_Transform::encode_serialized_payload(
 
         //ReceiverSpecific keys shall be computed specifically when needed
         session->session_block_counter = 0;
+        RAND_bytes((unsigned char*)&session->session_iv_salt, sizeof(uint64_t));
     }
     //In any case, increment session block counter
     session->session_block_counter += 1;
 
     //Build NONCE elements (Build once, use once)
     std::array<uint8_t, initialization_vector_suffix_length> initialization_vector_suffix;  //iv suffix changes with every operation
-    RAND_bytes(initialization_vector_suffix.data(), initialization_vector_suffix_length);
     std::array<uint8_t, 12> initialization_vector; //96 bytes, session_id + suffix
-    memcpy(initialization_vector.data(),&(session->session_id),4);
-    memcpy(initialization_vector.data() + 4, initialization_vector_suffix.data(), 8);
+    compute_initialization_vector(initialization_vector, initialization_vector_suffix, session->session_id,
+            session->session_iv_salt, session->session_block_counter);
     std::array<uint8_t, 4> session_id;
     memcpy(session_id.data(), &(session->session_id), 4);
 
@@ -137,7 +156,7 @@ bool AESGCMGMAC_Transform::encode_serialized_payload(
     try
     {
         if(!serialize_SecureDataBody(serializer, keyMat.transformation_kind, session->SessionKey,
-                    initialization_vector, output_buffer, payload.data, payload.length, tag, false))
+                    session->cipher_context, initialization_vector, output_buffer, payload.data, payload.length, tag, false))
         {
             return false;
         }
@@ -209,16 +228,16 @@ bool AESGCMGMAC_Transform::encode_datawriter_submessage(
 
         //ReceiverSpecific keys shall be computed specifically when needed
         session->session_block_counter = 0;
+        RAND_bytes((unsigned char*)&session->session_iv_salt, sizeof(uint64_t));
     }
 
     session->session_block_counter += 1;
 
     //Build remaining NONCE elements
     std::array<uint8_t, initialization_vector_suffix_length> initialization_vector_suffix;  //iv suffix changes with every operation
-    RAND_bytes(initialization_vector_suffix.data(), initialization_vector_suffix_length);
-    std::array<uint8_t,12> initialization_vector; //96 bytes, session_id + suffix
-    memcpy(initialization_vector.data(),&(session->session_id),4);
-    memcpy(initialization_vector.data() + 4, initialization_vector_suffix.data(), 8);
+    std::array<uint8_t, 12> initialization_vector; //96 bytes, session_id + suffix
+    compute_initialization_vector(initialization_vector, initialization_vector_suffix, session->session_id,
+            session->session_iv_salt, session->session_block_counter);
     std::array<uint8_t, 4> session_id;
     memcpy(session_id.data(), &(session->session_id), 4);
 
@@ -262,7 +281,8 @@ bool AESGCMGMAC_Transform::encode_datawriter_submessage(
     try
     {
         if(!serialize_SecureDataBody(serializer, keyMat.transformation_kind, session->SessionKey,
-                    initialization_vector, output_buffer, &plain_rtps_submessage.buffer[plain_rtps_submessage.pos],
+                    session->cipher_context, initialization_vector, output_buffer,
+                    &plain_rtps_submessage.buffer[plain_rtps_submessage.pos],
                     plain_rtps_submessage.length - plain_rtps_submessage.pos, tag, true))
         {
             return false;
@@ -346,16 +366,16 @@ bool AESGCMGMAC_Transform::encode_datareader_submessage(
 
         //ReceiverSpecific keys shall be computed specifically when needed
         session->session_block_counter = 0;
+        RAND_bytes((unsigned char*)&session->session_iv_salt, sizeof(uint64_t));
     }
 
     session->session_block_counter += 1;
 
     //Build remaining NONCE elements
     std::array<uint8_t, initialization_vector_suffix_length> initialization_vector_suffix;  //iv suffix changes with every operation
-    RAND_bytes(initialization_vector_suffix.data(), initialization_vector_suffix_length);
-    std::array<uint8_t,12> initialization_vector; //96 bytes, session_id + suffix
-    memcpy(initialization_vector.data(),&(session->session_id),4);
-    memcpy(initialization_vector.data() + 4, initialization_vector_suffix.data(), 8);
+    std::array<uint8_t, 12> initialization_vector; //96 bytes, session_id + suffix
+    compute_initialization_vector(initialization_vector, initialization_vector_suffix, session->session_id,
+            session->session_iv_salt, session->session_block_counter);
     std::array<uint8_t, 4> session_id;
     memcpy(session_id.data(), &(session->session_id), 4);
 
@@ -399,7 +419,8 @@ bool AESGCMGMAC_Transform::encode_datareader_submessage(
     try
     {
         if(!serialize_SecureDataBody(serializer, local_reader->EntityKeyMaterial.at(0).transformation_kind, session->SessionKey,
-                    initialization_vector, output_buffer, &plain_rtps_submessage.buffer[plain_rtps_submessage.pos],
+                    session->cipher_context, initialization_vector, output_buffer,
+                    &plain_rtps_submessage.buffer[plain_rtps_submessage.pos],
                     plain_rtps_submessage.length - plain_rtps_submessage.pos, tag, true))
         {
             return false;
@@ -484,6 +505,7 @@ bool AESGCMGMAC_Transform::encode_rtps_message(
 
         //ReceiverSpecific keys shall be computed specifically when needed
         local_participant->session_block_counter = 0;
+        RAND_bytes((unsigned char*)&local_participant->session_iv_salt, sizeof(uint64_t));
         //Insert outdate session_id values in all RemoteParticipant trackers to trigger a SessionkeyUpdate
     }
 
@@ -491,10 +513,9 @@ bool AESGCMGMAC_Transform::encode_rtps_message(
 
     //Build remaining NONCE elements
     std::array<uint8_t, initialization_vector_suffix_length> initialization_vector_suffix;  //iv suffix changes with every operation
-    RAND_bytes(initialization_vector_suffix.data(), initialization_vector_suffix_length);
-    std::array<uint8_t,12> initialization_vector; //96 bytes, session_id + suffix
-    memcpy(initialization_vector.data(),&(local_participant->session_id),4);
-    memcpy(initialization_vector.data() + 4, initialization_vector_suffix.data(), 8);
+    std::array<uint8_t, 12> initialization_vector; //96 bytes, session_id + suffix
+    compute_initialization_vector(initialization_vector, initialization_vector_suffix, local_participant->session_id,
+            local_participant->session_iv_salt, local_participant->session_block_counter);
     std::array<uint8_t, 4> session_id;
     memcpy(session_id.data(), &(local_participant->session_id), 4);
 
@@ -538,7 +559,8 @@ bool AESGCMGMAC_Transform::encode_rtps_message(
     try
     {
         if(!serialize_SecureDataBody(serializer, local_participant->ParticipantKeyMaterial.transformation_kind, local_participant->SessionKey,
-                    initialization_vector, output_buffer, &plain_rtps_message.buffer[plain_rtps_message.pos],
+                    local_participant->cipher_context, initialization_vector, output_buffer,
+                    &plain_rtps_message.buffer[plain_rtps_message.pos],
                     plain_rtps_message.length - plain_rtps_message.pos, tag, true))
         {
             return false;
@@ -667,11 +689,17 @@ bool AESGCMGMAC_Transform::decode_rtps_message(
     uint32_t session_id;
     memcpy(&session_id, header.session_id.data(), 4);
 
-    //Sessionkey
+    //Sessionkeys
     std::array<uint8_t, 32> session_key;
-    compute_sessionkey(session_key,
-            sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0),
-            session_id);
+    std::array<uint8_t, 32> specific_session_key;
+    {
+        std::unique_lock<std::mutex> lock(sending_participant->received_mutex_);
+        RemoteKeySessionData& session = sending_participant->ReceivedSession;
+        compute_received_sessionkeys(session, sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0),
+                session_id);
+        session_key = session.SessionKey;
+        specific_session_key = session.ReceiverSpecificSessionKey;
+    }
     //IV
     std::array<uint8_t,12> initialization_vector;
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -755,9 +783,7 @@ bool AESGCMGMAC_Transform::decode_rtps_message(
 
         if(!deserialize_SecureDataTag(decoder, tag, sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).transformation_kind,
                 sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).receiver_specific_key_id,
-                sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).master_receiver_specific_key,
-                sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).master_salt,
-                initialization_vector, session_id, exception))
+                specific_session_key, initialization_vector, exception))
         {
             return false;
         }
@@ -1039,9 +1065,10 @@ bool AESGCMGMAC_Transform::decode_datawriter_submessage(
 
     uint32_t session_id;
     memcpy(&session_id,header.session_id.data(),4);
-    //Sessionkey
+    //Sessionkeys
     std::array<uint8_t, 32> session_key;
-    compute_sessionkey(session_key, *keyMat, session_id);
+    std::array<uint8_t, 32> specific_session_key;
+    received_sessionkeys(*this, sending_writer, keyMat, session_id, session_key, specific_session_key);
     //IV
     std::array<uint8_t,12> initialization_vector;
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -1096,10 +1123,8 @@ bool AESGCMGMAC_Transform::decode_datawriter_submessage(
         SecurityException exception;
 
         if(!deserialize_SecureDataTag(decoder, tag, keyMat->transformation_kind,
-                keyMat->receiver_specific_key_id,
-                keyMat->master_receiver_specific_key,
-                keyMat->master_salt,
-                initialization_vector, session_id, exception))
+                keyMat->receiver_specific_key_id, specific_session_key,
+                initialization_vector, exception))
         {
             return false;
         }
@@ -1217,9 +1242,10 @@ bool AESGCMGMAC_Transform::decode_datareader_submessage(
 
     uint32_t session_id;
     memcpy(&session_id,header.session_id.data(),4);
-    //Sessionkey
+    //Sessionkeys
     std::array<uint8_t, 32> session_key;
-    compute_sessionkey(session_key, *keyMat, session_id);
+    std::array<uint8_t, 32> specific_session_key;
+    received_sessionkeys(*this, sending_reader, keyMat, session_id, session_key, specific_session_key);
     //IV
     std::array<uint8_t,12> initialization_vector;
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -1274,10 +1300,8 @@ bool AESGCMGMAC_Transform::decode_datareader_submessage(
         SecurityException exception;
 
         if(!deserialize_SecureDataTag(decoder, tag, keyMat->transformation_kind,
-                keyMat->receiver_specific_key_id,
-                keyMat->master_receiver_specific_key,
-                keyMat->master_salt,
-                initialization_vector, session_id, exception))
+                keyMat->receiver_specific_key_id, specific_session_key,
+                initialization_vector, exception))
         {
             return false;
         }
@@ -1373,7 +1397,8 @@ bool AESGCMGMAC_Transform::decode_serialized_payload(
 
     //Sessionkey
     std::array<uint8_t, 32> session_key;
-    compute_sessionkey(session_key, *keyMat, session_id);
+    std::array<uint8_t, 32> specific_session_key;
+    received_sessionkeys(*this, sending_writer, keyMat, session_id, session_key, specific_session_key);
     //IV
     std::array<uint8_t,12> initialization_vector;
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -1412,7 +1437,7 @@ bool AESGCMGMAC_Transform::decode_serialized_payload(
     // Tag
     try
     {
-        deserialize_SecureDataTag(decoder, tag, {}, {}, {}, {}, {}, 0, exception);
+        deserialize_SecureDataTag(decoder, tag, {}, {}, {}, {}, exception);
     }
     catch(eprosima::fastcdr::exception::NotEnoughMemoryException&)
     {
@@ -1468,28 +1493,39 @@ void AESGCMGMAC_Transform::compute_sessionkey(std::array<uint8_t, 32>& session_k
     memcpy(source + sourceLen, &session_id, 4);
     sourceLen += 4;
 
-    EVP_PKEY *key = EVP_PKEY_new_mac_key(EVP_PKEY_HMAC, NULL, master_key.data(), key_len);
-    EVP_MD_CTX* ctx =
-#if IS_OPENSSL_1_1
-        EVP_MD_CTX_new();
-#else
-        (EVP_MD_CTX*)malloc(sizeof(EVP_MD_CTX));
-#endif
-    EVP_MD_CTX_init(ctx);
-    EVP_DigestSignInit(ctx, NULL, EVP_sha256(), NULL, key);
-    EVP_DigestSignUpdate(ctx, source, sourceLen);
+    // One-shot HMAC, without creating an EVP_PKEY and a digest context for each key.
+    unsigned int finalLen = static_cast<unsigned int>(session_key.size());
+    HMAC(EVP_sha256(), master_key.data(), key_len, source, static_cast<size_t>(sourceLen), session_key.data(),
+            &finalLen);
+}
 
-    size_t finalLen;
-    EVP_DigestSignFinal(ctx, NULL, &finalLen);
-    EVP_DigestSignFinal(ctx, session_key.data(), &finalLen);
+void AESGCMGMAC_Transform::compute_received_sessionkeys(RemoteKeySessionData& session,
+    const KeyMaterial_AES_GCM_GMAC& key_mat, const uint32_t session_id)
+{
+    if(session.valid && session.session_id == session_id && session.sender_key_id == key_mat.sender_key_id)
+    {
+        return;
+    }
 
-    EVP_PKEY_free(key);
-#if IS_OPENSSL_1_1
-    EVP_MD_CTX_free(ctx);
-#else
-    EVP_MD_CTX_cleanup(ctx);
-    free(ctx);
-#endif
+    compute_sessionkey(session.SessionKey, key_mat, session_id);
+    compute_sessionkey(session.ReceiverSpecificSessionKey, true, key_mat.master_receiver_specific_key,
+            key_mat.master_salt, session_id);
+    session.sender_key_id = key_mat.sender_key_id;
+    session.session_id = session_id;
+    session.valid = true;
+}
+
+void AESGCMGMAC_Transform::compute_initialization_vector(std::array<uint8_t, 12>& initialization_vector,
+    std::array<uint8_t, 8>& initialization_vector_suffix, const uint32_t session_id,
+    const uint64_t session_iv_salt, const uint64_t session_block_counter)
+{
+    // The block counter gives a different IV for every operation of the session. Handles that share the key
+    // material (like the key exchange writer and reader of both participants) also share the session ids, so
+    // each session starts its suffixes at a random salt drawn when the session key was computed.
+    uint64_t suffix = session_iv_salt + session_block_counter;
+    memcpy(initialization_vector_suffix.data(), &suffix, initialization_vector_suffix_length);
+    memcpy(initialization_vector.data(), &session_id, 4);
+    memcpy(initialization_vector.data() + 4, initialization_vector_suffix.data(), initialization_vector_suffix_length);
 }
 
 void AESGCMGMAC_Transform::serialize_SecureDataHeader(eprosima::fastcdr::Cdr& serializer,
@@ -1501,7 +1537,7 @@ void AESGCMGMAC_Transform::serialize_SecureDataHeader(eprosima::fastcdr::Cdr& se
 
 bool AESGCMGMAC_Transform::serialize_SecureDataBody(eprosima::fastcdr::Cdr& serializer,
         const std::array<uint8_t, 4>& transformation_kind, const std::array<uint8_t,32>& session_key,
-        const std::array<uint8_t, 12>& initialization_vector,
+        AESGCMContext& cipher_context, const std::array<uint8_t, 12>& initialization_vector,
         eprosima::fastcdr::FastBuffer& output_buffer, octet* plain_buffer, uint32_t plain_buffer_len,
         SecureDataTag& tag, bool submessage)
 {
@@ -1512,31 +1548,14 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(eprosima::fastcdr::Cdr& seri
 
     // AES_BLOCK_SIZE = 16
     int cipher_block_size = 0, actual_size = 0, final_size = 0;
-    EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-    if (!use_256_bits)
+    EVP_CIPHER_CTX* e_ctx = cipher_context.init(true, use_256_bits, session_key, initialization_vector);
+    if (e_ctx == nullptr)
     {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(), (const unsigned char*)(session_key.data()),
-            initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
+        logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
+        return false;
     }
-    else
-    {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(), (const unsigned char*)(session_key.data()),
-            initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
 
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
-    }
+    cipher_block_size = EVP_CIPHER_CTX_block_size(e_ctx);
 
     if (!do_encryption)
     {
@@ -1545,7 +1564,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(eprosima::fastcdr::Cdr& seri
             plain_buffer_len)
         {
             logError(SECURITY_CRYPTO, "Not enough memory to copy payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
         memcpy(serializer.getCurrentPosition(), plain_buffer, plain_buffer_len);
@@ -1554,14 +1572,12 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(eprosima::fastcdr::Cdr& seri
         if (!EVP_EncryptUpdate(e_ctx, nullptr, &actual_size, plain_buffer, static_cast<int>(plain_buffer_len)))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
-        if (!EVP_EncryptFinal(e_ctx, nullptr, &final_size))
+        if (!EVP_EncryptFinal_ex(e_ctx, nullptr, &final_size))
         {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal_ex function returns an error");
             return false;
         }
     }
@@ -1602,7 +1618,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(eprosima::fastcdr::Cdr& seri
             (plain_buffer_len + (2 * cipher_block_size) - 1))
         {
             logError(SECURITY_CRYPTO, "Not enough memory to cipher payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1610,14 +1625,12 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(eprosima::fastcdr::Cdr& seri
             static_cast<int>(plain_buffer_len)))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
-        if (!EVP_EncryptFinal(e_ctx, output_buffer_raw, &final_size))
+        if (!EVP_EncryptFinal_ex(e_ctx, output_buffer_raw, &final_size))
         {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal_ex function returns an error");
             return false;
         }
 
@@ -1642,7 +1655,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(eprosima::fastcdr::Cdr& seri
 
     // Get commmon_mac
     EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, tag.common_mac.data());
-    EVP_CIPHER_CTX_free(e_ctx);
 
     if (submessage)
     {
@@ -1719,45 +1731,26 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(eprosima::fastcdr::Cdr& seria
 
         //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
         int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        if(transformation_kind == c_transfrom_kind_aes128_gcm ||
-                transformation_kind == c_transfrom_kind_aes128_gmac)
-        {
-            if(!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(), (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                        initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if(transformation_kind == c_transfrom_kind_aes256_gcm ||
-                transformation_kind == c_transfrom_kind_aes256_gmac)
+        EVP_CIPHER_CTX* e_ctx = remote_entity->Sessions[sessionIndex].cipher_context.init(true, use_256_bits,
+                remote_entity->Sessions[sessionIndex].SessionKey, initialization_vector);
+        if(e_ctx == nullptr)
         {
-            if(!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(), (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                        initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
+            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
+            continue;
         }
         if(!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
         {
             logError(SECURITY_CRYPTO, "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
-        if(!EVP_EncryptFinal(e_ctx, NULL, &final_size))
+        if(!EVP_EncryptFinal_ex(e_ctx, NULL, &final_size))
         {
-            logError(SECURITY_CRYPTO, "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+            logError(SECURITY_CRYPTO, "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal_ex function returns an error");
             continue;
         }
         serializer << remote_entity->Remote2EntityKeyMaterial.at(0).receiver_specific_key_id;
         EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, 16, serializer.getCurrentPosition());
         serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
 
         ++length;
     }
@@ -1823,46 +1816,26 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(eprosima::fastcdr::Cdr& seria
 
         //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
         int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        auto& trans_kind = remote_participant->Participant2ParticipantKeyMaterial.at(0).transformation_kind;
-        if(trans_kind == c_transfrom_kind_aes128_gcm ||
-            trans_kind == c_transfrom_kind_aes128_gmac)
+        EVP_CIPHER_CTX* e_ctx = remote_participant->cipher_context.init(true, use_256_bits,
+                remote_participant->SessionKey, initialization_vector);
+        if(e_ctx == nullptr)
         {
-            if(!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(), (const unsigned char*)(remote_participant->SessionKey.data()),
-                        initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if(trans_kind == c_transfrom_kind_aes256_gcm ||
-            trans_kind == c_transfrom_kind_aes256_gmac)
-        {
-            if(!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(), (const unsigned char*)(remote_participant->SessionKey.data()),
-                        initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
+            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
+            continue;
         }
         if(!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
         {
             logError(SECURITY_CRYPTO, "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
-        if(!EVP_EncryptFinal(e_ctx, NULL, &final_size))
+        if(!EVP_EncryptFinal_ex(e_ctx, NULL, &final_size))
         {
-            logError(SECURITY_CRYPTO, "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+            logError(SECURITY_CRYPTO, "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal_ex function returns an error");
             continue;
         }
         serializer << remote_participant->Participant2ParticipantKeyMaterial.at(0).receiver_specific_key_id;
         EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, 16, serializer.getCurrentPosition());
         serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
 
         ++length;
     }
@@ -1898,31 +1871,18 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(eprosima::fastcdr::Cdr& de
     bool use_256_bits = (transformation_kind == c_transfrom_kind_aes256_gcm ||
         transformation_kind == c_transfrom_kind_aes256_gmac);
 
-    EVP_CIPHER_CTX *d_ctx = EVP_CIPHER_CTX_new();
+    // Contexts are kept for each thread, so consecutive messages of the same session reuse the key schedule.
+    static thread_local AESGCMContext decrypt_context;
     int cipher_block_size = 0, actual_size = 0, final_size = 0;
 
-    if(!use_256_bits)
+    EVP_CIPHER_CTX* d_ctx = decrypt_context.init(false, use_256_bits, session_key, initialization_vector);
+    if(d_ctx == nullptr)
     {
-        if(!EVP_DecryptInit(d_ctx, EVP_aes_128_gcm(), (const unsigned char *)session_key.data(), initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
+        logError(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptInit function returns an error");
+        return false;
     }
-    else
-    {
-        if(!EVP_DecryptInit(d_ctx, EVP_aes_256_gcm(), (const unsigned char *)session_key.data(), initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
 
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
-    }
+    cipher_block_size = EVP_CIPHER_CTX_block_size(d_ctx);
 
     uint32_t protected_len = body_length;
     if (do_encryption)
@@ -1934,7 +1894,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(eprosima::fastcdr::Cdr& de
         if (plain_buffer_len < (protected_len + cipher_block_size))
         {
             logWarning(SECURITY_CRYPTO, "Not enough memory to decode payload");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
     }
@@ -1944,19 +1903,16 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(eprosima::fastcdr::Cdr& de
     if(!EVP_DecryptUpdate(d_ctx, output_buffer, &actual_size, input_buffer, protected_len))
     {
         logWarning(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptUpdate function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
         return false;
     }
 
     EVP_CIPHER_CTX_ctrl(d_ctx, EVP_CTRL_GCM_SET_TAG, AES_BLOCK_SIZE, tag.common_mac.data());
 
-    if(!EVP_DecryptFinal(d_ctx, output_buffer, &final_size))
+    if(!EVP_DecryptFinal_ex(d_ctx, output_buffer, &final_size))
     {
-        logWarning(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptFinal function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
+        logWarning(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptFinal_ex function returns an error");
         return false;
     }
-    EVP_CIPHER_CTX_free(d_ctx);
 
     uint32_t cnt_len = do_encryption ? static_cast<uint32_t>(actual_size + final_size) : body_length;
     if (plain_buffer_len < cnt_len)
@@ -2015,9 +1971,9 @@ bool AESGCMGMAC_Transform::predeserialize_SecureDataBody(eprosima::fastcdr::Cdr&
 
 bool AESGCMGMAC_Transform::deserialize_SecureDataTag(eprosima::fastcdr::Cdr& decoder, SecureDataTag& tag,
         const CryptoTransformKind& transformation_kind,
-        const CryptoTransformKeyId& receiver_specific_key_id, const std::array<uint8_t, 32>& receiver_specific_key,
-        const std::array<uint8_t,32>& master_salt, const std::array<uint8_t,12>& initialization_vector,
-        const uint32_t session_id, SecurityException& exception)
+        const CryptoTransformKeyId& receiver_specific_key_id,
+        const std::array<uint8_t, 32>& receiver_specific_session_key,
+        const std::array<uint8_t,12>& initialization_vector, SecurityException& exception)
 {
     decoder >> tag.common_mac;
 
@@ -2050,63 +2006,53 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(eprosima::fastcdr::Cdr& dec
         }
 
         //Auth message - The point is that we cannot verify the authorship of the message with our receiver_specific_key the message could be crafted
-        EVP_CIPHER_CTX* d_ctx = EVP_CIPHER_CTX_new();
-        const EVP_CIPHER* d_cipher = nullptr;
+        static thread_local AESGCMContext verify_context;
+        bool use_256_bits = false;
 
         int actual_size = 0, final_size = 0;
 
-        //Get ReceiverSpecificSessionKey
-        std::array<uint8_t, 32> specific_session_key;
-        compute_sessionkey(specific_session_key, true, receiver_specific_key, master_salt, session_id);
-
         //Verify specific MAC
         if(transformation_kind == c_transfrom_kind_aes128_gcm ||
                 transformation_kind == c_transfrom_kind_aes128_gmac)
         {
-            d_cipher = EVP_aes_128_gcm();
+            use_256_bits = false;
         }
         else if(transformation_kind == c_transfrom_kind_aes256_gcm ||
                 transformation_kind == c_transfrom_kind_aes256_gmac)
         {
-            d_cipher = EVP_aes_256_gcm();
+            use_256_bits = true;
         }
         else
         {
             logError(SECURITY_CRYPTO, "Invalid transformation kind)");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
-        if(!EVP_DecryptInit(d_ctx, d_cipher, (const unsigned char *)specific_session_key.data(),
-                    initialization_vector.data()))
+        EVP_CIPHER_CTX* d_ctx = verify_context.init(false, use_256_bits, receiver_specific_session_key,
+                initialization_vector);
+        if(d_ctx == nullptr)
         {
             logError(SECURITY_CRYPTO, "Unable to authenticate the message. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
         if(!EVP_DecryptUpdate(d_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
         {
             logError(SECURITY_CRYPTO, "Unable to authenticate the message. EVP_DecryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
         if (!EVP_CIPHER_CTX_ctrl(d_ctx, EVP_CTRL_GCM_SET_TAG, 16, tag.receiver_mac.data()))
         {
             logError(SECURITY_CRYPTO, "Unable to authenticate the message. EVP_CIPHER_CTX_ctrl function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
         if(!EVP_DecryptFinal_ex(d_ctx, NULL, &final_size))
         {
             logError(SECURITY_CRYPTO, "Unable to authenticate the message. EVP_DecryptFinal_ex function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
-
-        EVP_CIPHER_CTX_free(d_ctx);
     }
 
     return true;
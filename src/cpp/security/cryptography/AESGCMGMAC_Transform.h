@@ -118,6 +118,20 @@ class AESGCMGMAC_Transform : public CryptoTransform
         const KeyMaterial_AES_GCM_GMAC& key, 
         const uint32_t session_id);
 
+    //Aux function to update the session keys used to decode messages, only when the session changes
+    void compute_received_sessionkeys(
+        RemoteKeySessionData& session,
+        const KeyMaterial_AES_GCM_GMAC& key,
+        const uint32_t session_id);
+
+    //Aux function to build the initialization vector of the next operation of a session
+    void compute_initialization_vector(
+        std::array<uint8_t, 12>& initialization_vector,
+        std::array<uint8_t, 8>& initialization_vector_suffix,
+        const uint32_t session_id,
+        const uint64_t session_iv_salt,
+        const uint64_t session_block_counter);
+
     //Serialization and deserialization of message components
     void serialize_SecureDataHeader(eprosima::fastcdr::Cdr& serializer,
             const CryptoTransformKind& transformation_kind, const CryptoTransformKeyId& transformation_key_id,
@@ -125,7 +139,7 @@ class AESGCMGMAC_Transform : public CryptoTransform
 
     bool serialize_SecureDataBody(eprosima::fastcdr::Cdr& serializer,
             const std::array<uint8_t, 4>& transformation_kind, const std::array<uint8_t,32>& session_key,
-            const std::array<uint8_t, 12>& initialization_vector,
+            AESGCMContext& cipher_context, const std::array<uint8_t, 12>& initialization_vector,
             eprosima::fastcdr::FastBuffer& output_buffer, octet* plain_buffer, uint32_t plain_buffer_len,
             SecureDataTag& tag, bool submessage);
 
@@ -160,9 +174,9 @@ class AESGCMGMAC_Transform : public CryptoTransform
 
     bool deserialize_SecureDataTag(eprosima::fastcdr::Cdr& decoder, SecureDataTag& tag,
             const CryptoTransformKind& transformation_kind,
-            const CryptoTransformKeyId& receiver_specific_key_id, const std::array<uint8_t, 32>& receiver_specific_key,
-            const std::array<uint8_t,32>& master_salt, const std::array<uint8_t,12>& initialization_vector,
-            uint32_t session_id, SecurityException& exception);
+            const CryptoTransformKeyId& receiver_specific_key_id,
+            const std::array<uint8_t, 32>& receiver_specific_session_key,
+            const std::array<uint8_t,12>& initialization_vector, SecurityException& exception);
 
     uint32_t calculate_extra_size_for_rtps_message(uint32_t number_discovered_participants) const override;
 
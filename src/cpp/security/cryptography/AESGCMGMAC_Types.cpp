@@ -19,8 +19,60 @@
 
 #include "AESGCMGMAC_Types.h"
 
+#include <openssl/crypto.h>
+#include <cstring>
+
 using namespace eprosima::fastrtps::rtps::security;
 
 
 const char* const ParticipantKeyHandle::class_id_ = "ParticipantCryptohandle";
 const char * const EntityKeyHandle::class_id_ = "EntityCryptohandle";
+
+AESGCMContext::AESGCMContext() : ctx_(nullptr), cipher_(nullptr), encrypt_(0)
+{
+}
+
+AESGCMContext::~AESGCMContext()
+{
+    if(ctx_ != nullptr)
+    {
+        EVP_CIPHER_CTX_free(ctx_);
+    }
+    OPENSSL_cleanse(key_.data(), key_.size());
+}
+
+EVP_CIPHER_CTX* AESGCMContext::init(bool encrypt, bool use_256_bits, const std::array<uint8_t, 32>& key,
+        const std::array<uint8_t, 12>& initialization_vector)
+{
+    if(ctx_ == nullptr)
+    {
+        ctx_ = EVP_CIPHER_CTX_new();
+        if(ctx_ == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    const EVP_CIPHER* cipher = use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm();
+    int enc = encrypt ? 1 : 0;
+    size_t key_len = use_256_bits ? 32 : 16;
+
+    if(cipher == cipher_ && enc == encrypt_ && memcmp(key.data(), key_.data(), key_len) == 0)
+    {
+        // Same key schedule, only the IV changes.
+        if(EVP_CipherInit_ex(ctx_, nullptr, nullptr, nullptr, initialization_vector.data(), enc))
+        {
+            return ctx_;
+        }
+    }
+    else if(EVP_CipherInit_ex(ctx_, cipher, nullptr, key.data(), initialization_vector.data(), enc))
+    {
+        cipher_ = cipher;
+        encrypt_ = enc;
+        memcpy(key_.data(), key.data(), key_len);
+        return ctx_;
+    }
+
+    cipher_ = nullptr;
+    return nullptr;
+}
@@ -26,6 +26,8 @@
 #include <fastrtps/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
 #include <fastrtps/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
 
+#include <openssl/evp.h>
+
 #include <mutex>
 #include <limits>
 
@@ -126,13 +128,66 @@ struct SecureDataTag{
  * Note: the common key of the remote cryptohandle is stored along with the specific keys. KeyMaterial->master_sender_key
  */
 
+/* Reusable AES-GCM context
+ * ------------------------
+ * Keeps the OpenSSL cipher context and its key schedule between operations. When the key does not change, only the
+ * initialization vector is set for the next operation.
+ */
+class AESGCMContext
+{
+    public:
+
+        AESGCMContext();
+
+        ~AESGCMContext();
+
+        /**
+         * Prepares the context for a new encryption or decryption.
+         * @param encrypt True to encrypt, false to decrypt.
+         * @param use_256_bits True for AES-256, false for AES-128.
+         * @param key Session key. Only the first 16 bytes are used with AES-128.
+         * @param initialization_vector Initialization vector of the operation.
+         * @return The OpenSSL context ready to be used, or nullptr on error.
+         */
+        EVP_CIPHER_CTX* init(bool encrypt, bool use_256_bits, const std::array<uint8_t, 32>& key,
+                const std::array<uint8_t, 12>& initialization_vector);
+
+    private:
+
+        AESGCMContext(const AESGCMContext&) = delete;
+
+        AESGCMContext& operator=(const AESGCMContext&) = delete;
+
+        EVP_CIPHER_CTX* ctx_;
+        const EVP_CIPHER* cipher_;
+        int encrypt_;
+        std::array<uint8_t, 32> key_;
+};
+
 struct KeySessionData
 {
     uint32_t session_id;
     std::array<uint8_t, 32> SessionKey;
     uint64_t session_block_counter;
+    //Random start of the IV suffixes of the session, so handles sharing a key never repeat an IV
+    uint64_t session_iv_salt;
+    //Context keyed with SessionKey
+    AESGCMContext cipher_context;
+
+    KeySessionData() : session_id(std::numeric_limits<uint32_t>::max()), session_block_counter(0),
+        session_iv_salt(0) {}
+};
+
+//Session keys derived from the key material of a remote element, kept while its messages use the same session
+struct RemoteKeySessionData
+{
+    bool valid;
+    CryptoTransformKeyId sender_key_id;
+    uint32_t session_id;
+    std::array<uint8_t, 32> SessionKey;
+    std::array<uint8_t, 32> ReceiverSpecificSessionKey;
 
-    KeySessionData() : session_id(std::numeric_limits<uint32_t>::max()), session_block_counter(0) {}
+    RemoteKeySessionData() : valid(false), session_id(0) {}
 };
 
 class  EntityKeyHandle
@@ -164,8 +219,12 @@ class  EntityKeyHandle
 
         //Data used to store the current session keys and to determine when it has to be updated
         KeySessionData Sessions[2];
+        //Session keys used to decode the messages of a remote entity, one for each Entity2RemoteKeyMaterial
+        RemoteKeySessionData ReceivedSessions[2];
         uint64_t max_blocks_per_session;
         std::mutex mutex_;
+        //Protects ReceivedSessions, used when decoding
+        std::mutex received_mutex_;
 };
 typedef HandleImpl<EntityKeyHandle> AESGCMGMAC_WriterCryptoHandle;
 typedef HandleImpl<EntityKeyHandle> AESGCMGMAC_ReaderCryptoHandle;
@@ -177,7 +236,7 @@ class  ParticipantKeyHandle
     public:
 
         ParticipantKeyHandle() : session_id(std::numeric_limits<uint32_t>::max()),
-                session_block_counter(0), max_blocks_per_session(0){}
+                session_block_counter(0), session_iv_salt(0), max_blocks_per_session(0){}
 
         ~ParticipantKeyHandle(){}
 
@@ -202,8 +261,15 @@ class  ParticipantKeyHandle
         uint32_t session_id;
         std::array<uint8_t,32> SessionKey;
         uint64_t session_block_counter;
+        //Random start of the IV suffixes of the session, so handles sharing a key never repeat an IV
+        uint64_t session_iv_salt;
         uint64_t max_blocks_per_session;
+        //Context keyed with SessionKey
+        AESGCMContext cipher_context;
         std::mutex mutex_;
+        //Session keys used to decode the messages of a remote participant, protected by received_mutex_
+        mutable RemoteKeySessionData ReceivedSession;
+        mutable std::mutex received_mutex_;
 };
 
 typedef HandleImpl<ParticipantKeyHandle> AESGCMGMAC_ParticipantCryptoHandle;
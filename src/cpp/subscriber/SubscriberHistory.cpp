@@ -26,6 +26,7 @@
 #include <fastrtps/TopicDataType.h>
 #include <fastrtps/log/Log.h>
 
+#include <algorithm>
 #include <mutex>
 
 using namespace eprosima::fastrtps;
@@ -46,6 +47,8 @@ SubscriberHistory::SubscriberHistory(
     , m_unreadCacheCount(0)
     , m_historyQos(history)
     , m_resourceLimitsQos(resource)
+    , m_instanceCapacity(static_cast<size_t>(std::max(1, history.kind == KEEP_LAST_HISTORY_QOS ?
+                    history.depth : resource.max_samples_per_instance)))
     , mp_subImpl(simpl)
     , mp_getKeyObject(nullptr)
 {
@@ -61,6 +64,11 @@ SubscriberHistory::~SubscriberHistory()
     {
         mp_subImpl->getType()->deleteData(mp_getKeyObject);
     }
+
+    for (void* sample : m_loanedCopies)
+    {
+        mp_subImpl->getType()->deleteData(sample);
+    }
 }
 
 bool SubscriberHistory::received_change(
@@ -170,7 +178,7 @@ bool SubscriberHistory::received_change(
                 << " and no method to obtain it";);
             return false;
         }
-        t_v_Inst_Caches::iterator vit;
+        t_m_Inst_Caches::iterator vit;
         if (find_Key(a_change, &vit))
         {
             //logInfo(RTPS_EDP,"Trying to add change with KEY: "<< vit->first << endl;);
@@ -195,22 +203,24 @@ bool SubscriberHistory::received_change(
                 }
                 else
                 {
-                    // Try to substitude a older samples.
-                    auto older_sample = m_changes.rend();
-                    for (auto it = m_changes.rbegin(); it != m_changes.rend(); ++it)
+                    // Try to substitude the oldest sample of the same writer in this instance.
+                    auto older_sample = vit->second.end();
+                    for (auto it = vit->second.begin(); it != vit->second.end(); ++it)
                     {
-
                         if ((*it)->writerGUID == a_change->writerGUID)
                         {
                             if ((*it)->sequenceNumber < a_change->sequenceNumber)
-                                older_sample = it;
+                            {
+                                if (older_sample == vit->second.end())
+                                    older_sample = it;
+                            }
                             // Already received
                             else if ((*it)->sequenceNumber == a_change->sequenceNumber)
                                 return false;
                         }
                     }
 
-                    if (older_sample != m_changes.rend())
+                    if (older_sample != vit->second.end())
                     {
                         bool read = (*older_sample)->isRead;
 
@@ -251,8 +261,8 @@ bool SubscriberHistory::received_change(
                     }
                     else
                     {
-                        vit->second.push_back(a_change);
-                        std::sort(vit->second.begin(), vit->second.end(), sort_ReaderHistoryCache);
+                        vit->second.insert(std::upper_bound(vit->second.begin(), vit->second.end(), a_change,
+                                    sort_ReaderHistoryCache), a_change);
                     }
                     logInfo(SUBSCRIBER, this->mp_reader->getGuid().entityId
                         << ": Change " << a_change->sequenceNumber << " added from: "
@@ -462,51 +472,177 @@ bool SubscriberHistory::takeNextData(void* data, SampleInfo_t* info)
     return false;
 }
 
-bool SubscriberHistory::find_Key(CacheChange_t* a_change, t_v_Inst_Caches::iterator* vit_out)
+bool SubscriberHistory::take_loan(void** sample, SampleInfo_t* info)
 {
-    t_v_Inst_Caches::iterator vit;
-    bool found = false;
-    for (vit = m_keyedChanges.begin(); vit != m_keyedChanges.end(); ++vit)
+    if (mp_reader == nullptr || mp_mutex == nullptr)
     {
-        if (a_change->instanceHandle == vit->first)
-        {
-            *vit_out = vit;
-            return true;
-        }
+        logError(RTPS_HISTORY, "You need to create a Reader with this History before using it");
+        return false;
+    }
+
+    TopicDataType* type = this->mp_subImpl->getType();
+    if (!type->is_plain())
+    {
+        logError(SUBSCRIBER, "Type " << type->getName() << " is not plain. Samples cannot be loaned");
+        return false;
     }
-    if (!found)
+
+    std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+    CacheChange_t* change;
+    WriterProxy * wp;
+    if (this->mp_reader->nextUntakenCache(&change, &wp))
     {
-        if ((int)m_keyedChanges.size() < m_resourceLimitsQos.max_instances)
+        if (!change->isRead)
         {
-            t_p_I_Change newpair;
-            newpair.first = a_change->instanceHandle;
-            m_keyedChanges.push_back(newpair);
-            *vit_out = m_keyedChanges.end() - 1;
-            return true;
+            this->decreaseUnreadCount();
         }
-        else
+        change->isRead = true;
+        logInfo(SUBSCRIBER, this->mp_reader->getGuid().entityId << ": loaning seqNum" << change->sequenceNumber <<
+            " from writer: " << change->writerGUID);
+
+        *sample = nullptr;
+        bool copied = false;
+        if (change->kind == ALIVE)
         {
-            for (vit = m_keyedChanges.begin(); vit != m_keyedChanges.end(); ++vit)
+            if (change->serializedPayload.length != type->m_typeSize ||
+                change->serializedPayload.encapsulation != (DEFAULT_ENDIAN == BIGEND ? CDR_BE : CDR_LE))
             {
-                if (vit->second.size() == 0)
+                // Another endianness or an older version of the type. The sample is deserialized into a new
+                // object, which is given back to the type on return_loan().
+                logInfo(SUBSCRIBER, "Sample " << change->sequenceNumber << " from " << change->writerGUID <<
+                    " does not have the layout of plain type " << type->getName() << ". Loaning a copy");
+                *sample = type->createData();
+                if (!type->deserialize(&change->serializedPayload, *sample))
                 {
-                    m_keyedChanges.erase(vit);
-                    t_p_I_Change newpair;
-                    newpair.first = a_change->instanceHandle;
-                    m_keyedChanges.push_back(newpair);
-                    *vit_out = m_keyedChanges.end() - 1;
-                    return true;
+                    // The sample cannot be decoded. It is discarded and the change goes back to the pool.
+                    logWarning(SUBSCRIBER, "Sample " << change->sequenceNumber << " from " << change->writerGUID <<
+                        " cannot be deserialized as type " << type->getName());
+                    type->deleteData(*sample);
+                    *sample = nullptr;
+                    this->remove_change_sub(change);
+                    return false;
                 }
+                m_loanedCopies.push_back(*sample);
+                copied = true;
+            }
+            else
+            {
+                *sample = change->serializedPayload.data + SerializedPayload_t::representation_header_size;
+            }
+        }
+
+        if (info != nullptr)
+        {
+            info->sampleKind = change->kind;
+            info->sample_identity.writer_guid(change->writerGUID);
+            info->sample_identity.sequence_number(change->sequenceNumber);
+            info->sourceTimestamp = change->sourceTimestamp;
+            if (this->mp_subImpl->getAttributes().qos.m_ownership.kind == EXCLUSIVE_OWNERSHIP_QOS)
+            {
+                info->ownershipStrength = wp->m_att.ownershipStrength;
             }
-            logWarning(SUBSCRIBER, "History has reached the maximum number of instances");
+            if (this->mp_subImpl->getAttributes().topic.topicKind == WITH_KEY &&
+                change->instanceHandle == c_InstanceHandle_Unknown && change->kind == ALIVE)
+            {
+                bool is_key_protected = false;
+#if HAVE_SECURITY
+                is_key_protected = mp_reader->getAttributes().security_attributes().is_key_protected;
+#endif
+                type->getKey(*sample, &change->instanceHandle, is_key_protected);
+            }
+            info->iHandle = change->instanceHandle;
+            info->related_sample_identity = change->write_params.sample_identity();
         }
 
+        // Samples without data and copied samples do not keep the change.
+        if (*sample == nullptr || copied)
+        {
+            this->remove_change_sub(change);
+        }
+        else if (this->remove_change_sub(change, nullptr, false))
+        {
+            m_loanedChanges.push_back(change);
+        }
+        else
+        {
+            *sample = nullptr;
+            return false;
+        }
+
+        return true;
     }
+
     return false;
 }
 
+bool SubscriberHistory::return_loan(void* sample)
+{
+    if (mp_reader == nullptr || mp_mutex == nullptr)
+    {
+        logError(RTPS_HISTORY, "You need to create a Reader with this History before using it");
+        return false;
+    }
+
+    std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+    for (auto it = m_loanedChanges.begin(); it != m_loanedChanges.end(); ++it)
+    {
+        if ((*it)->serializedPayload.data + SerializedPayload_t::representation_header_size == sample)
+        {
+            this->release_Cache(*it);
+            m_loanedChanges.erase(it);
+            return true;
+        }
+    }
 
-bool SubscriberHistory::remove_change_sub(CacheChange_t* change, t_v_Inst_Caches::iterator* vit_in)
+    for (auto it = m_loanedCopies.begin(); it != m_loanedCopies.end(); ++it)
+    {
+        if (*it == sample)
+        {
+            this->mp_subImpl->getType()->deleteData(sample);
+            m_loanedCopies.erase(it);
+            return true;
+        }
+    }
+
+    logError(SUBSCRIBER, "The sample was not loaned by this subscriber");
+    return false;
+}
+
+bool SubscriberHistory::find_Key(CacheChange_t* a_change, t_m_Inst_Caches::iterator* vit_out)
+{
+    t_m_Inst_Caches::iterator vit = m_keyedChanges.find(a_change->instanceHandle);
+    if (vit != m_keyedChanges.end())
+    {
+        *vit_out = vit;
+        return true;
+    }
+
+    if ((int)m_keyedChanges.size() < m_resourceLimitsQos.max_instances)
+    {
+        *vit_out = m_keyedChanges.emplace(a_change->instanceHandle, t_Inst_Changes(m_instanceCapacity)).first;
+        return true;
+    }
+
+    // Reuse the entry of an instance without changes.
+    for (vit = m_keyedChanges.begin(); vit != m_keyedChanges.end(); ++vit)
+    {
+        if (vit->second.empty())
+        {
+            m_keyedChanges.erase(vit);
+            *vit_out = m_keyedChanges.emplace(a_change->instanceHandle, t_Inst_Changes(m_instanceCapacity)).first;
+            return true;
+        }
+    }
+    logWarning(SUBSCRIBER, "History has reached the maximum number of instances");
+    return false;
+}
+
+bool SubscriberHistory::remove_change_sub(CacheChange_t* change, t_m_Inst_Caches::iterator* vit_in)
+{
+    return remove_change_sub(change, vit_in, true);
+}
+
+bool SubscriberHistory::remove_change_sub(CacheChange_t* change, t_m_Inst_Caches::iterator* vit_in, bool release)
 {
     if (mp_reader == nullptr || mp_mutex == nullptr)
     {
@@ -517,7 +653,7 @@ bool SubscriberHistory::remove_change_sub(CacheChange_t* change, t_v_Inst_Caches
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
     if (mp_subImpl->getAttributes().topic.getTopicKind() == NO_KEY)
     {
-        if (this->remove_change(change))
+        if (release ? this->remove_change(change) : this->detach_change(change))
         {
             m_isHistoryFull = false;
             return true;
@@ -526,24 +662,26 @@ bool SubscriberHistory::remove_change_sub(CacheChange_t* change, t_v_Inst_Caches
     }
     else
     {
-        t_v_Inst_Caches::iterator vit;
+        t_m_Inst_Caches::iterator vit;
         if (vit_in != nullptr)
         {
             vit = *vit_in;
-        }
-        else if (this->find_Key(change, &vit))
-        {
-
         }
         else
         {
-            return false;
+            vit = m_keyedChanges.find(change->instanceHandle);
+            if (vit == m_keyedChanges.end())
+            {
+                logError(SUBSCRIBER, "Instance of change not found, something is wrong");
+                return false;
+            }
         }
-        for (auto chit = vit->second.begin(); chit != vit->second.end(); ++chit)
+        for (auto chit = std::lower_bound(vit->second.begin(), vit->second.end(), change, sort_ReaderHistoryCache);
+                chit != vit->second.end() && (*chit)->sequenceNumber == change->sequenceNumber; ++chit)
         {
-            if ((*chit)->sequenceNumber == change->sequenceNumber && (*chit)->writerGUID == change->writerGUID)
+            if ((*chit)->writerGUID == change->writerGUID)
             {
-                if (remove_change(change))
+                if (release ? remove_change(change) : detach_change(change))
                 {
                     vit->second.erase(chit);
                     m_isHistoryFull = false;
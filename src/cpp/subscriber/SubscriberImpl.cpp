@@ -91,6 +91,16 @@ bool SubscriberImpl::takeNextData(void* data,SampleInfo_t* info) {
     return this->m_history.takeNextData(data,info);
 }
 
+bool SubscriberImpl::take_loan(void** sample, SampleInfo_t* info)
+{
+    return this->m_history.take_loan(sample, info);
+}
+
+bool SubscriberImpl::return_loan(void* sample)
+{
+    return this->m_history.return_loan(sample);
+}
+
 
 
 const GUID_t& SubscriberImpl::getGuid(){
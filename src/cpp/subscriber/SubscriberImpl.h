@@ -78,6 +78,8 @@ public:
 
 	bool readNextData(void* data,SampleInfo_t* info);
 	bool takeNextData(void* data,SampleInfo_t* info);
+	bool take_loan(void** sample, SampleInfo_t* info);
+	bool return_loan(void* sample);
 
 	///@}
 	
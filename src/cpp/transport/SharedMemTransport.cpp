@@ -0,0 +1,472 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/transport/SharedMemTransport.h>
+#include <fastrtps/log/Log.h>
+#include "shared_mem/SharedMemPort.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+//! Time the listening threads sleep before checking whether their channel was closed.
+static const uint32_t s_sharedMemListenTimeoutMs = 100;
+//! Octets of the locator address holding the host identifier. The rest holds the participant scope.
+static const size_t s_sharedMemHostIdSize = 12;
+
+static uint64_t segment_key(const Locator_t& locator)
+{
+    return (static_cast<uint64_t>(SharedMemTransport::GetDomainId(locator)) << 32) |
+        (static_cast<uint64_t>(SharedMemTransport::GetParticipantId(locator)) << 16) |
+        static_cast<uint16_t>(locator.port);
+}
+
+static bool is_host_defined(const Locator_t& locator)
+{
+    for (size_t i = 0; i < s_sharedMemHostIdSize; ++i)
+    {
+        if (locator.address[i] != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+SharedMemTransportDescriptor::SharedMemTransportDescriptor()
+    : TransportDescriptorInterface(s_maximumMessageSize, s_maximumInitialPeersRange)
+    , port_queue_capacity(s_defaultSharedMemPortQueueCapacity)
+{
+}
+
+SharedMemTransportDescriptor::SharedMemTransportDescriptor(const SharedMemTransportDescriptor& t)
+    : TransportDescriptorInterface(t)
+    , port_queue_capacity(t.port_queue_capacity)
+{
+}
+
+TransportInterface* SharedMemTransportDescriptor::create_transport() const
+{
+    return new SharedMemTransport(*this);
+}
+
+SharedMemChannelResource::SharedMemChannelResource(std::unique_ptr<SharedMemPort>&& port, const Locator_t& locator,
+        TransportReceiverInterface* receiver)
+    : ChannelResource(0)
+    , mPort(std::move(port))
+    , mLocator(locator)
+    , mMsgReceiver(receiver)
+{
+}
+
+SharedMemChannelResource::~SharedMemChannelResource()
+{
+    // The listening thread must be finished before the segment is unmapped.
+    Clear();
+}
+
+void SharedMemChannelResource::Disable()
+{
+    ChannelResource::Disable();
+    mPort->close();
+}
+
+SharedMemTransport::SharedMemTransport(const SharedMemTransportDescriptor& descriptor)
+    : mConfiguration_(descriptor)
+    , mOutputChannelOpen(false)
+{
+    memset(mHostId, 0, sizeof(mHostId));
+}
+
+SharedMemTransport::~SharedMemTransport()
+{
+    std::vector<Locator_t> open_locators;
+    {
+        std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
+        for (auto& input : mInputPorts)
+        {
+            open_locators.push_back(input.second->GetLocator());
+        }
+    }
+
+    for (const Locator_t& locator : open_locators)
+    {
+        CloseInputChannel(locator);
+    }
+}
+
+bool SharedMemTransport::init()
+{
+    if (mConfiguration_.maxMessageSize == 0 || mConfiguration_.port_queue_capacity == 0)
+    {
+        logError(RTPS_MSG_OUT, "SharedMemTransport: maxMessageSize and port_queue_capacity must be greater than 0");
+        return false;
+    }
+
+    if (!SharedMemPort::get_host_id(mHostId))
+    {
+        logError(RTPS_MSG_OUT, "SharedMemTransport: shared memory is not available");
+        return false;
+    }
+
+    return true;
+}
+
+void SharedMemTransport::FillLocalAddress(Locator_t& locator) const
+{
+    locator.kind = LOCATOR_KIND_SHM;
+    memcpy(locator.address, mHostId, sizeof(mHostId));
+}
+
+void SharedMemTransport::SetParticipantScope(Locator_t& locator, uint32_t domainId, uint32_t participantId)
+{
+    locator.address[12] = static_cast<octet>((domainId >> 8) & 0xFF);
+    locator.address[13] = static_cast<octet>(domainId & 0xFF);
+    locator.address[14] = static_cast<octet>((participantId >> 8) & 0xFF);
+    locator.address[15] = static_cast<octet>(participantId & 0xFF);
+}
+
+uint16_t SharedMemTransport::GetDomainId(const Locator_t& locator)
+{
+    return static_cast<uint16_t>((locator.address[12] << 8) | locator.address[13]);
+}
+
+uint16_t SharedMemTransport::GetParticipantId(const Locator_t& locator)
+{
+    return static_cast<uint16_t>((locator.address[14] << 8) | locator.address[15]);
+}
+
+bool SharedMemTransport::IsInputChannelOpen(const Locator_t& locator) const
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
+    return IsLocatorSupported(locator) && mInputPorts.find(segment_key(locator)) != mInputPorts.end();
+}
+
+bool SharedMemTransport::IsOutputChannelOpen(const Locator_t& locator) const
+{
+    std::unique_lock<std::mutex> scopedLock(mOutputMapMutex);
+    return IsLocatorSupported(locator) && mOutputChannelOpen;
+}
+
+bool SharedMemTransport::IsLocatorSupported(const Locator_t& locator) const
+{
+    return locator.kind == LOCATOR_KIND_SHM;
+}
+
+bool SharedMemTransport::IsLocatorAllowed(const Locator_t& locator) const
+{
+    return is_local_locator(locator);
+}
+
+Locator_t SharedMemTransport::RemoteToMainLocal(const Locator_t& remote) const
+{
+    Locator_t mainLocal(remote);
+    mainLocal.port = 0;
+    FillLocalAddress(mainLocal);
+    return mainLocal;
+}
+
+bool SharedMemTransport::OpenOutputChannel(const Locator_t& locator)
+{
+    std::unique_lock<std::mutex> scopedLock(mOutputMapMutex);
+    if (!IsLocatorSupported(locator) || mOutputChannelOpen)
+    {
+        return false;
+    }
+
+    // Remote segments are mapped on first use.
+    mOutputChannelOpen = true;
+    return true;
+}
+
+bool SharedMemTransport::OpenExtraOutputChannel(const Locator_t&)
+{
+    return false;
+}
+
+bool SharedMemTransport::OpenInputChannel(const Locator_t& locator, TransportReceiverInterface* receiver,
+        uint32_t maxMsgSize)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
+    if (!IsLocatorSupported(locator) || IsInputChannelOpen(locator))
+    {
+        return false;
+    }
+
+    uint16_t port = static_cast<uint16_t>(locator.port);
+    uint32_t slot_size = std::max(maxMsgSize, mConfiguration_.maxMessageSize);
+    std::unique_ptr<SharedMemPort> shared_port = SharedMemPort::create(GetDomainId(locator),
+        GetParticipantId(locator), port, mConfiguration_.port_queue_capacity, slot_size);
+    if (!shared_port)
+    {
+        return false;
+    }
+
+    SharedMemChannelResource* pChannelResource = new SharedMemChannelResource(std::move(shared_port), locator,
+        receiver);
+    std::thread* newThread = new std::thread(&SharedMemTransport::performListenOperation, this, pChannelResource);
+    pChannelResource->SetThread(newThread);
+    mInputPorts[segment_key(locator)] = pChannelResource;
+
+    logInfo(RTPS_MSG_IN, "SharedMemTransport: listening on port " << port << " of participant " <<
+        GetParticipantId(locator) << " in domain " << GetDomainId(locator));
+    return true;
+}
+
+bool SharedMemTransport::CloseOutputChannel(const Locator_t& locator)
+{
+    std::unique_lock<std::mutex> scopedLock(mOutputMapMutex);
+    if (!IsLocatorSupported(locator) || !mOutputChannelOpen)
+    {
+        return false;
+    }
+
+    mOutputPorts.clear();
+    mOutputChannelOpen = false;
+    return true;
+}
+
+bool SharedMemTransport::CloseInputChannel(const Locator_t& locator)
+{
+    SharedMemChannelResource* pChannelResource = nullptr;
+    {
+        std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
+        if (!IsInputChannelOpen(locator))
+        {
+            return false;
+        }
+
+        auto it = mInputPorts.find(segment_key(locator));
+        pChannelResource = it->second;
+        mInputPorts.erase(it);
+    }
+
+    // Wakes up the listening thread, which is joined on destruction.
+    pChannelResource->Disable();
+    delete pChannelResource;
+    return true;
+}
+
+bool SharedMemTransport::DoInputLocatorsMatch(const Locator_t& left, const Locator_t& right) const
+{
+    return left.kind == right.kind && segment_key(left) == segment_key(right);
+}
+
+bool SharedMemTransport::DoOutputLocatorsMatch(const Locator_t& left, const Locator_t& right) const
+{
+    return IsLocatorSupported(left) && IsLocatorSupported(right);
+}
+
+bool SharedMemTransport::Send(const octet* sendBuffer, uint32_t sendBufferSize, const Locator_t& localLocator,
+        const Locator_t& remoteLocator)
+{
+    if (!IsOutputChannelOpen(localLocator) || !IsLocatorAllowed(remoteLocator) ||
+            sendBufferSize > mConfiguration_.maxMessageSize)
+    {
+        return false;
+    }
+
+    uint16_t port = static_cast<uint16_t>(remoteLocator.port);
+    uint64_t key = segment_key(remoteLocator);
+
+    std::unique_lock<std::mutex> scopedLock(mOutputMapMutex);
+    auto it = mOutputPorts.find(key);
+    if (it == mOutputPorts.end() || !it->second->is_alive())
+    {
+        // First message to this port, or its listener has been replaced or is gone.
+        std::unique_ptr<SharedMemPort> shared_port = SharedMemPort::open(GetDomainId(remoteLocator),
+            GetParticipantId(remoteLocator), port);
+        if (!shared_port)
+        {
+            if (it != mOutputPorts.end())
+            {
+                mOutputPorts.erase(it);
+            }
+            return false;
+        }
+
+        it = mOutputPorts.emplace(key, nullptr).first;
+        it->second = std::move(shared_port);
+    }
+
+    bool sent = it->second->push(sendBuffer, sendBufferSize);
+    if (!sent)
+    {
+        logInfo(RTPS_MSG_OUT, "SharedMemTransport: message dropped, port " << port << " is full or closed");
+    }
+    return sent;
+}
+
+bool SharedMemTransport::Send(const octet* sendBuffer, uint32_t sendBufferSize, const Locator_t& localLocator,
+        const Locator_t& remoteLocator, ChannelResource*)
+{
+    return Send(sendBuffer, sendBufferSize, localLocator, remoteLocator);
+}
+
+void SharedMemTransport::performListenOperation(SharedMemChannelResource* pChannelResource)
+{
+    SharedMemPort* port = pChannelResource->GetPort();
+    Locator_t remoteLocator;
+    FillLocalAddress(remoteLocator);
+    remoteLocator.port = 0;
+
+    while (pChannelResource->IsAlive())
+    {
+        uint32_t received = port->pop_all([&](const octet* data, uint32_t size)
+        {
+            // Messages are processed in place, the slot is not reused until this returns.
+            TransportReceiverInterface* receiver = pChannelResource->GetMessageReceiver();
+            if (receiver != nullptr)
+            {
+                receiver->OnDataReceived(data, size, pChannelResource->GetLocator(), remoteLocator);
+            }
+            else
+            {
+                logWarning(RTPS_MSG_IN, "Received Message, but no receiver attached");
+            }
+        });
+
+        if (received == 0)
+        {
+            port->wait(s_sharedMemListenTimeoutMs);
+        }
+    }
+}
+
+LocatorList_t SharedMemTransport::NormalizeLocator(const Locator_t& locator)
+{
+    LocatorList_t list;
+    Locator_t newloc(locator);
+    if (!is_host_defined(newloc))
+    {
+        FillLocalAddress(newloc);
+    }
+    list.push_back(newloc);
+    return list;
+}
+
+LocatorList_t SharedMemTransport::ShrinkLocatorLists(const std::vector<LocatorList_t>& locatorLists)
+{
+    // Every remote port is a different destination: only remove duplicates and unreachable locators.
+    LocatorList_t result;
+    for (const LocatorList_t& locatorList : locatorLists)
+    {
+        for (auto it = locatorList.begin(); it != locatorList.end(); ++it)
+        {
+            if (IsLocatorAllowed(*it) && !result.contains(*it))
+            {
+                result.push_back(*it);
+            }
+        }
+    }
+    return result;
+}
+
+bool SharedMemTransport::is_local_locator(const Locator_t& locator) const
+{
+    return IsLocatorSupported(locator) && memcmp(locator.address, mHostId, s_sharedMemHostIdSize) == 0;
+}
+
+void SharedMemTransport::AddDefaultOutputLocator(LocatorList_t&)
+{
+    // Output channels are created by the network transports default locators.
+}
+
+bool SharedMemTransport::getDefaultMetatrafficMulticastLocators(LocatorList_t&, uint32_t) const
+{
+    // No multicast over shared memory.
+    return false;
+}
+
+bool SharedMemTransport::getDefaultMetatrafficUnicastLocators(LocatorList_t &locators,
+        uint32_t metatraffic_unicast_port) const
+{
+    Locator_t locator;
+    FillLocalAddress(locator);
+    locator.port = metatraffic_unicast_port;
+    locators.push_back(locator);
+    return true;
+}
+
+bool SharedMemTransport::getDefaultUnicastLocators(LocatorList_t &locators, uint32_t unicast_port) const
+{
+    Locator_t locator;
+    FillLocalAddress(locator);
+    fillUnicastLocator(locator, unicast_port);
+    locators.push_back(locator);
+    return true;
+}
+
+bool SharedMemTransport::fillMetatrafficMulticastLocator(Locator_t&, uint32_t) const
+{
+    return false;
+}
+
+bool SharedMemTransport::fillMetatrafficUnicastLocator(Locator_t &locator,
+        uint32_t metatraffic_unicast_port) const
+{
+    if (locator.port == 0)
+    {
+        locator.port = metatraffic_unicast_port;
+    }
+    return true;
+}
+
+bool SharedMemTransport::configureInitialPeerLocator(Locator_t &locator, const PortParameters &port_params,
+        uint32_t domainId, LocatorList_t& list) const
+{
+    if (!is_host_defined(locator))
+    {
+        FillLocalAddress(locator);
+    }
+
+    if (locator.port == 0)
+    {
+        for (uint32_t i = 0; i < mConfiguration_.maxInitialPeersRange; ++i)
+        {
+            Locator_t auxloc(locator);
+            auxloc.port = port_params.getUnicastPort(domainId, i);
+            SetParticipantScope(auxloc, domainId, i);
+            list.push_back(auxloc);
+        }
+    }
+    else
+    {
+        list.push_back(locator);
+    }
+
+    return true;
+}
+
+bool SharedMemTransport::fillUnicastLocator(Locator_t &locator, uint32_t well_known_port) const
+{
+    if (locator.port == 0)
+    {
+        locator.port = well_known_port;
+    }
+    return true;
+}
+
+void SharedMemTransport::Shutdown()
+{
+    std::unique_lock<std::mutex> scopedLock(mOutputMapMutex);
+    mOutputPorts.clear();
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -48,10 +48,19 @@ TCPChannelResource::TCPChannelResource(TCPTransportInterface* parent, RTCPMessag
     , mLocator(locator)
     , m_inputSocket(false)
     , mWaitingForKeepAlive(false)
+    , mSkipCRC(false)
     , mRTCPThread(nullptr)
     , mService(service)
     , mSocket(createTCPSocket(service))
     , mConnectionStatus(eConnectionStatus::eDisconnected)
+    , mAsyncBufferBegin(0)
+    , mAsyncBufferEnd(0)
+    , mAsyncDiscardBytes(0)
+    , mKeepAliveStrand(service)
+    , mKeepAliveTimer(service)
+    , mPendingAsyncOperations(0)
+    , mSendQueueTimer(service)
+    , mSendQueueTimerArmed(false)
 {
 }
 
@@ -63,10 +72,19 @@ TCPChannelResource::TCPChannelResource(TCPTransportInterface* parent, RTCPMessag
     , mLocator()
     , m_inputSocket(true)
     , mWaitingForKeepAlive(false)
+    , mSkipCRC(false)
     , mRTCPThread(nullptr)
     , mService(service)
     , mSocket(moveSocket(socket))
     , mConnectionStatus(eConnectionStatus::eWaitingForBind)
+    , mAsyncBufferBegin(0)
+    , mAsyncBufferEnd(0)
+    , mAsyncDiscardBytes(0)
+    , mKeepAliveStrand(service)
+    , mKeepAliveTimer(service)
+    , mPendingAsyncOperations(0)
+    , mSendQueueTimer(service)
+    , mSendQueueTimerArmed(false)
 {
 }
 
@@ -180,9 +198,25 @@ void TCPChannelResource::Disconnect()
             // Cancel & shutdown throws exceptions if the socket has been closed ( Test_TCPv4Transport )
         }
         mSocket.close();
+
+        if (!mAsyncBuffer.empty())
+        {
+            CancelKeepAliveTimer();
+        }
     }
 }
 
+void TCPChannelResource::CancelKeepAliveTimer()
+{
+    // The timer is only touched from its strand, so the cancellation is posted there.
+    ++mPendingAsyncOperations;
+    mKeepAliveStrand.post([this]()
+    {
+        mKeepAliveTimer.cancel();
+        --mPendingAsyncOperations;
+    });
+}
+
 bool TCPChannelResource::IsLogicalPortOpened(uint16_t port)
 {
     std::unique_lock<std::recursive_mutex> scopedLock(mPendingLogicalMutex);
@@ -16,6 +16,7 @@
 #include <fastrtps/transport/tcp/RTCPMessageManager.h>
 #include <fastrtps/transport/timedevent/CleanTCPSocketsEvent.h>
 #include <utility>
+#include <array>
 #include <asio.hpp>
 #include <cstring>
 #include <algorithm>
@@ -37,6 +38,7 @@ static const int s_default_keep_alive_frequency = 50000; // 50 SECONDS
 static const int s_default_keep_alive_timeout = 10000; // 10 SECONDS
 static const int s_clean_deleted_sockets_pool_timeout = 100; // 100 MILLISECONDS
 static const int s_default_tcp_negotitation_timeout = 5000; // 5 Seconds
+static const uint32_t s_minimum_io_threads = 2;
 
 TCPAcceptor::TCPAcceptor(asio::io_service& io_service, TCPTransportInterface* parent, const Locator_t& locator)
     : mAcceptor(io_service, parent->GenerateEndpoint(IPLocator::getPhysicalPort(locator)))
@@ -80,6 +82,10 @@ TCPTransportDescriptor::TCPTransportDescriptor()
     , wait_for_tcp_negotiation(false)
     , calculate_crc(true)
     , check_crc(true)
+    , async_io(false)
+    , io_threads(2)
+    , send_coalescing_window_us(0)
+    , send_coalescing_bytes(8192)
 {
 }
 
@@ -96,6 +102,10 @@ TCPTransportDescriptor::TCPTransportDescriptor(const TCPTransportDescriptor& t)
     , wait_for_tcp_negotiation(t.wait_for_tcp_negotiation)
     , calculate_crc(t.calculate_crc)
     , check_crc(t.check_crc)
+    , async_io(t.async_io)
+    , io_threads(t.io_threads)
+    , send_coalescing_window_us(t.send_coalescing_window_us)
+    , send_coalescing_bytes(t.send_coalescing_bytes)
 {
 }
 
@@ -164,8 +174,16 @@ void TCPTransportInterface::Clean()
     {
         mService.stop();
         ioServiceThread->join();
+        for (std::thread& thread : mIOPoolThreads)
+        {
+            thread.join();
+        }
+        mIOPoolThreads.clear();
     }
 
+    // The handlers that were still queued will never be called.
+    CleanDeletedSockets(true);
+
     delete mRTCPMessageManager;
 }
 
@@ -202,12 +220,24 @@ TCPChannelResource* TCPTransportInterface::BindSocket(const Locator_t& locator,
     return nullptr;
 }
 
-void TCPTransportInterface::CleanDeletedSockets()
+void TCPTransportInterface::CleanDeletedSockets(bool force)
 {
     std::vector<TCPChannelResource*> deleteList;
     {
         std::unique_lock<std::recursive_mutex> scopedLock(mDeletedSocketsPoolMutex);
         deleteList = std::move(mDeletedSocketsPool);
+        mDeletedSocketsPool.clear();
+
+        if (!force)
+        {
+            // Keep the sockets still referenced by an asynchronous handler until it finishes.
+            auto pendingIt = std::partition(deleteList.begin(), deleteList.end(), [](TCPChannelResource* channel)
+            {
+                return !channel->HasPendingAsyncOperations();
+            });
+            mDeletedSocketsPool.assign(pendingIt, deleteList.end());
+            deleteList.erase(pendingIt, deleteList.end());
+        }
     }
 
     for (auto it = deleteList.begin(); it != deleteList.end(); ++it)
@@ -234,22 +264,12 @@ void TCPTransportInterface::DeleteSocket(TCPChannelResource *channelResource)
 
 bool TCPTransportInterface::CheckCRC(const TCPHeader &header, const octet *data, uint32_t size) const
 {
-    uint32_t crc(0);
-    for (uint32_t i = 0; i < size; ++i)
-    {
-        crc = RTCPMessageManager::addToCRC(crc, data[i]);
-    }
-    return crc == header.crc;
+    return RTCPMessageManager::addToCRC(0, data, size) == header.crc;
 }
 
 void TCPTransportInterface::CalculateCRC(TCPHeader &header, const octet *data, uint32_t size) const
 {
-    uint32_t crc(0);
-    for (uint32_t i = 0; i < size; ++i)
-    {
-        crc = RTCPMessageManager::addToCRC(crc, data[i]);
-    }
-    header.crc = crc;
+    header.crc = RTCPMessageManager::addToCRC(0, data, size);
 }
 
 
@@ -328,11 +348,11 @@ bool TCPTransportInterface::EnqueueLogicalOutputPort(const Locator_t& locator)
 }
 
 void TCPTransportInterface::FillTCPHeader(TCPHeader& header, const octet* sendBuffer, uint32_t sendBufferSize,
-        uint16_t logicalPort) const
+        uint16_t logicalPort, const TCPChannelResource* pChannelResource) const
 {
     header.length = sendBufferSize + static_cast<uint32_t>(TCPHeader::getSize());
     header.logicalPort = logicalPort;
-    if (GetConfiguration()->calculate_crc)
+    if (GetConfiguration()->calculate_crc && !pChannelResource->mSkipCRC)
     {
         CalculateCRC(header, sendBuffer, sendBufferSize);
     }
@@ -446,6 +466,13 @@ bool TCPTransportInterface::init()
         return false;
     }
 
+    if (GetConfiguration()->async_io && GetConfiguration()->io_threads < s_minimum_io_threads)
+    {
+        logWarning(RTCP_MSG_OUT, "io_threads cannot be lower than " << s_minimum_io_threads << ", using "
+            << s_minimum_io_threads);
+        GetConfiguration()->io_threads = s_minimum_io_threads;
+    }
+
     if (mRTCPMessageManager == nullptr)
     {
         mRTCPMessageManager = new RTCPMessageManager(this);
@@ -461,6 +488,14 @@ bool TCPTransportInterface::init()
     };
     ioServiceThread.reset(new std::thread(ioServiceFunction));
 
+    if (GetConfiguration()->async_io)
+    {
+        for (uint32_t i = 1; i < GetConfiguration()->io_threads; ++i)
+        {
+            mIOPoolThreads.emplace_back(ioServiceFunction);
+        }
+    }
+
     mCleanSocketsPoolTimer = new CleanTCPSocketsEvent(this, mService, *ioServiceThread.get(),
         s_clean_deleted_sockets_pool_timeout);
 
@@ -655,14 +690,56 @@ bool TCPTransportInterface::OpenInputChannel(const Locator_t& locator, Transport
     return success;
 }
 
-void TCPTransportInterface::performRTPCManagementThread(TCPChannelResource *pChannelResource)
+void TCPTransportInterface::StartReceiving(TCPChannelResource *pChannelResource)
 {
-    std::chrono::time_point<std::chrono::system_clock> time_now = std::chrono::system_clock::now();
-    std::chrono::time_point<std::chrono::system_clock> next_time = time_now +
+    std::chrono::steady_clock::time_point time_now = std::chrono::steady_clock::now();
+    pChannelResource->mNextKeepAlive = time_now +
         std::chrono::milliseconds(GetConfiguration()->keep_alive_frequency_ms);
-    std::chrono::time_point<std::chrono::system_clock> timeout_time =
-        time_now + std::chrono::milliseconds(GetConfiguration()->keep_alive_timeout_ms);
+    pChannelResource->mKeepAliveTimeout = time_now +
+        std::chrono::milliseconds(GetConfiguration()->keep_alive_timeout_ms);
+
+    if (GetConfiguration()->async_io)
+    {
+        pChannelResource->mAsyncBuffer.resize(TCPHeader::getSize() + GetConfiguration()->maxMessageSize);
+        if (GetConfiguration()->keep_alive_frequency_ms > 0 && GetConfiguration()->keep_alive_timeout_ms > 0)
+        {
+            ScheduleKeepAlive(pChannelResource, std::chrono::milliseconds(100));
+        }
+        AsyncReceive(pChannelResource);
+    }
+    else
+    {
+        pChannelResource->SetThread(new std::thread(&TCPTransportInterface::performListenOperation, this,
+            pChannelResource));
+        pChannelResource->SetRTCPThread(new std::thread(&TCPTransportInterface::performRTPCManagementThread,
+            this, pChannelResource));
+    }
+}
+
+bool TCPTransportInterface::ManageKeepAlive(TCPChannelResource *pChannelResource)
+{
+    std::chrono::steady_clock::time_point time_now = std::chrono::steady_clock::now();
+
+    if (!pChannelResource->mWaitingForKeepAlive && time_now > pChannelResource->mNextKeepAlive)
+    {
+        mRTCPMessageManager->sendKeepAliveRequest(pChannelResource);
+        pChannelResource->mWaitingForKeepAlive = true;
+        pChannelResource->mNextKeepAlive = time_now +
+            std::chrono::milliseconds(GetConfiguration()->keep_alive_frequency_ms);
+        pChannelResource->mKeepAliveTimeout = time_now +
+            std::chrono::milliseconds(GetConfiguration()->keep_alive_timeout_ms);
+    }
+    else if (pChannelResource->mWaitingForKeepAlive && time_now >= pChannelResource->mKeepAliveTimeout)
+    {
+        // Disable the socket to erase it after the reception.
+        CloseTCPSocket(pChannelResource);
+        return false;
+    }
+    return true;
+}
 
+void TCPTransportInterface::performRTPCManagementThread(TCPChannelResource *pChannelResource)
+{
     logInfo(RTCP, "START performRTPCManagementThread " << IPLocator::toIPv4string(pChannelResource->GetLocator()) \
             << ":" << IPLocator::getPhysicalPort(pChannelResource->GetLocator()) << " (" \
             << pChannelResource->getSocket()->local_endpoint().address() << ":" \
@@ -675,24 +752,10 @@ void TCPTransportInterface::performRTPCManagementThread(TCPChannelResource *pCha
         if (pChannelResource->IsConnectionEstablished())
         {
             // KeepAlive
-            if (GetConfiguration()->keep_alive_frequency_ms > 0 && GetConfiguration()->keep_alive_timeout_ms > 0)
+            if (GetConfiguration()->keep_alive_frequency_ms > 0 && GetConfiguration()->keep_alive_timeout_ms > 0 &&
+                !ManageKeepAlive(pChannelResource))
             {
-                time_now = std::chrono::system_clock::now();
-
-                // Keep Alive Management
-                if (!pChannelResource->mWaitingForKeepAlive && time_now > next_time)
-                {
-                    mRTCPMessageManager->sendKeepAliveRequest(pChannelResource);
-                    pChannelResource->mWaitingForKeepAlive = true;
-                    next_time = time_now + std::chrono::milliseconds(GetConfiguration()->keep_alive_frequency_ms);
-                    timeout_time = time_now + std::chrono::milliseconds(GetConfiguration()->keep_alive_timeout_ms);
-                }
-                else if (pChannelResource->mWaitingForKeepAlive && time_now >= timeout_time)
-                {
-                    // Disable the socket to erase it after the reception.
-                    CloseTCPSocket(pChannelResource);
-                    break;
-                }
+                break;
             }
         }
         eClock::my_sleep(100);
@@ -703,7 +766,6 @@ void TCPTransportInterface::performRTPCManagementThread(TCPChannelResource *pCha
 void TCPTransportInterface::performListenOperation(TCPChannelResource *pChannelResource)
 {
     Locator_t remoteLocator;
-    uint16_t logicalPort(0);
 
     while (pChannelResource->IsAlive())
     {
@@ -716,28 +778,175 @@ void TCPTransportInterface::performListenOperation(TCPChannelResource *pChannelR
         }
 
         // Processes the data through the CDR Message interface.
-        logicalPort = IPLocator::getLogicalPort(remoteLocator);
-        std::unique_lock<std::mutex> scopedLock(mSocketsMapMutex);
-        auto it = mReceiverResources.find(logicalPort);
-        //TransportReceiverInterface* receiver = pChannelResource->GetMessageReceiver(logicalPort);
-        if (it != mReceiverResources.end())
+        DeliverReceivedMessage(pChannelResource, msg.buffer, msg.length, remoteLocator);
+    }
+
+    logInfo(RTCP, "End PerformListenOperation " << pChannelResource->GetLocator());
+}
+
+void TCPTransportInterface::DeliverReceivedMessage(TCPChannelResource *pChannelResource, const octet* data,
+    uint32_t size, const Locator_t& remoteLocator)
+{
+    uint16_t logicalPort = IPLocator::getLogicalPort(remoteLocator);
+    std::unique_lock<std::mutex> scopedLock(mSocketsMapMutex);
+    auto it = mReceiverResources.find(logicalPort);
+    if (it != mReceiverResources.end())
+    {
+        TransportReceiverInterface* receiver = it->second.first;
+        ReceiverInUseCV* receiver_in_use = it->second.second;
+        receiver_in_use->in_use = true;
+        scopedLock.unlock();
+        receiver->OnDataReceived(data, size, pChannelResource->GetLocator(), remoteLocator);
+        scopedLock.lock();
+        receiver_in_use->in_use = false;
+        receiver_in_use->cv.notify_one();
+    }
+    else
+    {
+        logWarning(RTCP, "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
+    }
+}
+
+void TCPTransportInterface::AsyncReceive(TCPChannelResource *pChannelResource)
+{
+    std::vector<octet>& buffer = pChannelResource->mAsyncBuffer;
+    ++pChannelResource->mPendingAsyncOperations;
+    pChannelResource->getSocket()->async_read_some(
+        asio::buffer(buffer.data() + pChannelResource->mAsyncBufferEnd,
+            buffer.size() - pChannelResource->mAsyncBufferEnd),
+        std::bind(&TCPTransportInterface::OnAsyncReceive, this, pChannelResource, std::placeholders::_1,
+            std::placeholders::_2));
+}
+
+void TCPTransportInterface::OnAsyncReceive(TCPChannelResource *pChannelResource, const asio::error_code& error,
+    std::size_t bytes)
+{
+    if (!error && pChannelResource->IsAlive())
+    {
+        pChannelResource->mAsyncBufferEnd += bytes;
+        if (ProcessAsyncBuffer(pChannelResource) && pChannelResource->IsAlive())
         {
-            TransportReceiverInterface* receiver = it->second.first;
-            ReceiverInUseCV* receiver_in_use = it->second.second;
-            receiver_in_use->in_use = true;
-            scopedLock.unlock();
-            receiver->OnDataReceived(msg.buffer, msg.length, pChannelResource->GetLocator(), remoteLocator);
-            scopedLock.lock();
-            receiver_in_use->in_use = false;
-            receiver_in_use->cv.notify_one();
+            AsyncReceive(pChannelResource);
         }
-        else
+    }
+    else if (error != asio::error::operation_aborted && pChannelResource->IsAlive())
+    {
+        // Close the channel
+        logInfo(RTCP_MSG_IN, "ASIO [RECEIVE]: " << error.message());
+        CloseTCPSocket(pChannelResource);
+    }
+
+    // Must be the last access to the channel, as it can be deleted afterwards.
+    --pChannelResource->mPendingAsyncOperations;
+}
+
+bool TCPTransportInterface::ProcessAsyncBuffer(TCPChannelResource *pChannelResource)
+{
+    const size_t header_size = TCPHeader::getSize();
+    const size_t capacity = GetConfiguration()->maxMessageSize;
+    octet* buffer = pChannelResource->mAsyncBuffer.data();
+    size_t& begin = pChannelResource->mAsyncBufferBegin;
+    size_t& end = pChannelResource->mAsyncBufferEnd;
+    size_t& discard = pChannelResource->mAsyncDiscardBytes;
+
+    while (pChannelResource->IsAlive())
+    {
+        if (discard > 0)
         {
-            logWarning(RTCP, "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
+            size_t dropped = std::min(discard, end - begin);
+            begin += dropped;
+            discard -= dropped;
+        }
+
+        if (discard > 0 || end - begin < header_size)
+        {
+            break;
+        }
+
+        TCPHeader tcp_header;
+        memcpy(&tcp_header, buffer + begin, header_size);
+        if (tcp_header.length < header_size)
+        {
+            logError(RTCP_MSG_IN, "Bad TCP header length: " << tcp_header.length);
+            CloseTCPSocket(pChannelResource);
+            return false;
+        }
+
+        uint32_t body_size = tcp_header.length - static_cast<uint32_t>(header_size);
+        if (body_size > capacity)
+        {
+            logError(RTCP_MSG_IN, "Size of incoming TCP message is bigger than buffer capacity: "
+                << body_size << " vs. " << capacity << ". " << "The full message will be dropped.");
+            begin += header_size;
+            discard = body_size;
+            continue;
+        }
+
+        if (end - begin < tcp_header.length)
+        {
+            break;
+        }
+
+        // The body is processed in place, without copying it.
+        octet* body = buffer + begin + header_size;
+        begin += tcp_header.length;
+
+        logInfo(RTCP_MSG_IN, "Received RTCP MSG. Logical Port " << tcp_header.logicalPort);
+        Locator_t remoteLocator;
+        if (ProcessReceivedMessage(pChannelResource, tcp_header, body, body_size, remoteLocator) && body_size > 0)
+        {
+            DeliverReceivedMessage(pChannelResource, body, body_size, remoteLocator);
         }
     }
 
-    logInfo(RTCP, "End PerformListenOperation " << pChannelResource->GetLocator());
+    // Move the incomplete message to the beginning, so the next read has room for the rest of it.
+    if (begin > 0)
+    {
+        if (end > begin)
+        {
+            memmove(buffer, buffer + begin, end - begin);
+        }
+        end -= begin;
+        begin = 0;
+    }
+
+    return true;
+}
+
+void TCPTransportInterface::ScheduleKeepAlive(TCPChannelResource *pChannelResource,
+    std::chrono::steady_clock::duration delay)
+{
+    ++pChannelResource->mPendingAsyncOperations;
+    pChannelResource->mKeepAliveStrand.dispatch([this, pChannelResource, delay]()
+    {
+        pChannelResource->mKeepAliveTimer.expires_from_now(delay);
+        pChannelResource->mKeepAliveTimer.async_wait(pChannelResource->mKeepAliveStrand.wrap(
+            std::bind(&TCPTransportInterface::OnKeepAliveTimer, this, pChannelResource, std::placeholders::_1)));
+    });
+}
+
+void TCPTransportInterface::OnKeepAliveTimer(TCPChannelResource *pChannelResource, const asio::error_code& error)
+{
+    if (!error && pChannelResource->IsAlive())
+    {
+        std::chrono::steady_clock::duration delay = std::chrono::milliseconds(100);
+        bool alive = true;
+        if (pChannelResource->IsConnectionEstablished())
+        {
+            alive = ManageKeepAlive(pChannelResource);
+            std::chrono::steady_clock::time_point next = pChannelResource->mWaitingForKeepAlive ?
+                pChannelResource->mKeepAliveTimeout : pChannelResource->mNextKeepAlive;
+            delay = next - std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+        }
+
+        if (alive && pChannelResource->IsAlive())
+        {
+            ScheduleKeepAlive(pChannelResource, delay);
+        }
+    }
+
+    // Must be the last access to the channel, as it can be deleted afterwards.
+    --pChannelResource->mPendingAsyncOperations;
 }
 
 bool TCPTransportInterface::ReadBody(octet* receiveBuffer, uint32_t receiveBufferCapacity,
@@ -824,41 +1033,8 @@ bool TCPTransportInterface::Receive(TCPChannelResource *pChannelResource, octet*
                             body_size);
                         //logInfo(RTCP_MSG_IN, " Received [ReadBody]");
 
-                        if (GetConfiguration()->check_crc && !CheckCRC(tcp_header, receiveBuffer, receiveBufferSize))
-                        {
-                            logWarning(RTCP_MSG_IN, "Bad TCP header CRC");
-                        }
-
-                        if (tcp_header.logicalPort == 0)
-                        {
-                            //logInfo(RTCP_MSG_IN, " Receive [RTCP Control]  (" << receiveBufferSize+bytes_received
-                            // << " bytes): " << receiveBufferSize << " bytes.");
-                            ResponseCode responseCode =
-                                mRTCPMessageManager->processRTCPMessage(pChannelResource, receiveBuffer, body_size);
-                            if (responseCode != RETCODE_OK)
-                            {
-                                switch (responseCode)
-                                {
-                                    case RETCODE_INCOMPATIBLE_VERSION:
-                                        {
-                                            CloseOutputChannel(pChannelResource->mLocator);
-                                            break;
-                                        }
-                                    default: // Ignore
-                                        {
-                                            CloseTCPSocket(pChannelResource);
-                                            break;
-                                        }
-                                }
-                            }
-                            success = false;
-                        }
-                        else
-                        {
-                            IPLocator::setLogicalPort(remoteLocator, tcp_header.logicalPort);
-                            logInfo(RTCP_MSG_IN, "[RECEIVE] From: " << remoteLocator \
-                                << " - " << receiveBufferSize << " bytes.");
-                        }
+                        success = success && ProcessReceivedMessage(pChannelResource, tcp_header, receiveBuffer,
+                            receiveBufferSize, remoteLocator);
                     }
                 }
             }
@@ -900,16 +1076,70 @@ bool TCPTransportInterface::Receive(TCPChannelResource *pChannelResource, octet*
     return success;
 }
 
-size_t TCPTransportInterface::Send(TCPChannelResource *pChannelResource, const octet *data,
-    size_t size, eSocketErrorCodes &errorCode) const
+bool TCPTransportInterface::ProcessReceivedMessage(TCPChannelResource *pChannelResource, const TCPHeader& header,
+    octet* body, uint32_t body_size, Locator_t& remoteLocator)
+{
+    if (GetConfiguration()->check_crc && !CheckCRC(header, body, body_size))
+    {
+        logWarning(RTCP_MSG_IN, "Bad TCP header CRC");
+    }
+
+    remoteLocator = pChannelResource->GetLocator();
+
+    if (header.logicalPort == 0)
+    {
+        ResponseCode responseCode = mRTCPMessageManager->processRTCPMessage(pChannelResource, body, body_size);
+        if (responseCode != RETCODE_OK)
+        {
+            switch (responseCode)
+            {
+                case RETCODE_INCOMPATIBLE_VERSION:
+                    {
+                        CloseOutputChannel(pChannelResource->mLocator);
+                        break;
+                    }
+                default: // Ignore
+                    {
+                        CloseTCPSocket(pChannelResource);
+                        break;
+                    }
+            }
+        }
+        return false;
+    }
+
+    IPLocator::setLogicalPort(remoteLocator, header.logicalPort);
+    logInfo(RTCP_MSG_IN, "[RECEIVE] From: " << remoteLocator << " - " << body_size << " bytes.");
+    return true;
+}
+
+template<typename ConstBufferSequence>
+size_t TCPTransportInterface::SendBuffers(TCPChannelResource *pChannelResource, const ConstBufferSequence& buffers,
+    eSocketErrorCodes &errorCode) const
 {
     size_t bytesSent = 0;
     try
     {
         asio::error_code ec;
         std::unique_lock<std::recursive_mutex> scopedLock(pChannelResource->GetWriteMutex());
-        bytesSent = pChannelResource->getSocket()->send(asio::buffer(data, size), 0, ec);
-        errorCode = eSocketErrorCodes::eNoError;
+        bytesSent = asio::write(*pChannelResource->getSocket(), buffers, ec);
+        if (!ec)
+        {
+            errorCode = eSocketErrorCodes::eNoError;
+        }
+        else
+        {
+            logInfo(RTCP, "ASIO [SEND]: " << ec.message());
+            if ((asio::error::eof == ec.value()) || (asio::error::connection_reset == ec.value()) ||
+                (asio::error::broken_pipe == ec.value()))
+            {
+                errorCode = eSocketErrorCodes::eBrokenPipe;
+            }
+            else
+            {
+                errorCode = eSocketErrorCodes::eAsioError;
+            }
+        }
     }
     catch (const asio::error_code& error)
     {
@@ -939,6 +1169,12 @@ size_t TCPTransportInterface::Send(TCPChannelResource *pChannelResource, const o
     return bytesSent;
 }
 
+size_t TCPTransportInterface::Send(TCPChannelResource *pChannelResource, const octet *data,
+    size_t size, eSocketErrorCodes &errorCode) const
+{
+    return SendBuffers(pChannelResource, asio::buffer(data, size), errorCode);
+}
+
 size_t TCPTransportInterface::Send(TCPChannelResource *pChannelResource, const octet *data, size_t size) const
 {
     eSocketErrorCodes error;
@@ -1007,17 +1243,8 @@ bool TCPTransportInterface::Send(const octet* sendBuffer, uint32_t sendBufferSiz
             if (bConnected && tcpChannelResource->IsLogicalPortOpened(logicalPort))
             {
                 TCPHeader tcp_header;
-                FillTCPHeader(tcp_header, sendBuffer, sendBufferSize, logicalPort);
-
-                {
-                    std::unique_lock<std::recursive_mutex> sendLock(tcpChannelResource->GetWriteMutex());
-                    success = SendThroughSocket((octet*)&tcp_header, static_cast<uint32_t>(TCPHeader::getSize()), remoteLocator, tcpChannelResource);
-
-                    if (success)
-                    {
-                        success = SendThroughSocket(sendBuffer, sendBufferSize, remoteLocator, tcpChannelResource);
-                    }
-                }
+                FillTCPHeader(tcp_header, sendBuffer, sendBufferSize, logicalPort, tcpChannelResource);
+                success = SendMessage(tcpChannelResource, tcp_header, sendBuffer, sendBufferSize, remoteLocator);
             }
         }
         else
@@ -1040,29 +1267,128 @@ bool TCPTransportInterface::Send(const octet* sendBuffer, uint32_t sendBufferSiz
     }
 }
 
-bool TCPTransportInterface::SendThroughSocket(const octet* sendBuffer, uint32_t sendBufferSize,
-    const Locator_t& remoteLocator, TCPChannelResource *socket)
+bool TCPTransportInterface::SendMessage(TCPChannelResource *pChannelResource, const TCPHeader& header,
+    const octet* sendBuffer, uint32_t sendBufferSize, const Locator_t& remoteLocator)
+{
+    eSocketErrorCodes errorCode = eSocketErrorCodes::eNoError;
+    bool success = false;
+    {
+        std::unique_lock<std::recursive_mutex> sendLock(pChannelResource->GetWriteMutex());
+        success = QueueOrSendMessage(pChannelResource, header, sendBuffer, sendBufferSize, remoteLocator,
+            errorCode);
+    }
+
+    // The channel is closed without holding its write mutex, as it locks the sockets map.
+    if (errorCode != eSocketErrorCodes::eNoError)
+    {
+        CloseTCPSocket(pChannelResource);
+    }
+
+    return success;
+}
+
+bool TCPTransportInterface::QueueOrSendMessage(TCPChannelResource *pChannelResource, const TCPHeader& header,
+    const octet* sendBuffer, uint32_t sendBufferSize, const Locator_t& remoteLocator, eSocketErrorCodes &errorCode)
+{
+    const uint32_t headerSize = static_cast<uint32_t>(TCPHeader::getSize());
+    const uint32_t messageSize = headerSize + sendBufferSize;
+    const uint32_t window = GetConfiguration()->send_coalescing_window_us;
+    const uint32_t threshold = GetConfiguration()->send_coalescing_bytes;
+    std::array<asio::const_buffer, 2> buffers = {{
+        asio::buffer(header.getAddress(), headerSize), asio::buffer(sendBuffer, sendBufferSize) }};
+
+    std::vector<octet>& queue = pChannelResource->mSendQueue;
+
+    if (window == 0 || messageSize >= threshold)
+    {
+        // Keep the order of the messages already queued.
+        if (!queue.empty() && !FlushSendQueue(pChannelResource, remoteLocator, errorCode))
+        {
+            return false;
+        }
+        return SendThroughSocket(buffers, messageSize, remoteLocator, pChannelResource, errorCode);
+    }
+
+    if (queue.size() + messageSize > threshold && !FlushSendQueue(pChannelResource, remoteLocator, errorCode))
+    {
+        return false;
+    }
+
+    queue.insert(queue.end(), header.getAddress(), header.getAddress() + headerSize);
+    queue.insert(queue.end(), sendBuffer, sendBuffer + sendBufferSize);
+
+    if (queue.size() >= threshold)
+    {
+        return FlushSendQueue(pChannelResource, remoteLocator, errorCode);
+    }
+
+    if (!pChannelResource->mSendQueueTimerArmed)
+    {
+        pChannelResource->mSendQueueTimerArmed = true;
+        ++pChannelResource->mPendingAsyncOperations;
+        pChannelResource->mSendQueueTimer.expires_from_now(std::chrono::microseconds(window));
+        pChannelResource->mSendQueueTimer.async_wait(std::bind(&TCPTransportInterface::OnSendQueueTimer, this,
+            pChannelResource, std::placeholders::_1));
+    }
+    return true;
+}
+
+bool TCPTransportInterface::FlushSendQueue(TCPChannelResource *pChannelResource, const Locator_t& remoteLocator,
+    eSocketErrorCodes &errorCode)
+{
+    std::vector<octet>& queue = pChannelResource->mSendQueue;
+    bool success = SendThroughSocket(asio::buffer(queue), static_cast<uint32_t>(queue.size()), remoteLocator,
+        pChannelResource, errorCode);
+    queue.clear();
+    return success;
+}
+
+void TCPTransportInterface::OnSendQueueTimer(TCPChannelResource *pChannelResource, const asio::error_code& error)
+{
+    eSocketErrorCodes errorCode = eSocketErrorCodes::eNoError;
+    {
+        std::unique_lock<std::recursive_mutex> sendLock(pChannelResource->GetWriteMutex());
+        pChannelResource->mSendQueueTimerArmed = false;
+        if (!error && pChannelResource->IsAlive() && !pChannelResource->mSendQueue.empty())
+        {
+            SendBuffers(pChannelResource, asio::buffer(pChannelResource->mSendQueue), errorCode);
+            pChannelResource->mSendQueue.clear();
+        }
+    }
+
+    // The channel is closed without holding its write mutex, as it locks the sockets map.
+    if (errorCode != eSocketErrorCodes::eNoError)
+    {
+        CloseTCPSocket(pChannelResource);
+    }
+
+    // Must be the last access to the channel, as it can be deleted afterwards.
+    --pChannelResource->mPendingAsyncOperations;
+}
+
+template<typename ConstBufferSequence>
+bool TCPTransportInterface::SendThroughSocket(const ConstBufferSequence& buffers, uint32_t sendBufferSize,
+    const Locator_t& remoteLocator, TCPChannelResource *socket, eSocketErrorCodes &errorCode)
 {
     auto destinationEndpoint = GenerateEndpoint(remoteLocator, IPLocator::getPhysicalPort(remoteLocator));
 
     size_t bytesSent = 0;
     (void)destinationEndpoint;
+    (void)sendBufferSize; // Only logged
 
     //logInfo(RTCP, "SOCKET SEND to physical port " << socket->getSocket()->remote_endpoint().port());
 
-    eSocketErrorCodes errorCode;
-    bytesSent = Send(socket, sendBuffer, sendBufferSize, errorCode);
+    bytesSent = SendBuffers(socket, buffers, errorCode);
     switch (errorCode)
     {
     case eNoError:
         //logInfo(RTCP, " Sent [OK]: " << sendBufferSize << " bytes to locator " << IPLocator::getLogicalPort(remoteLocator));
         break;
     default:
-        // Inform that connection has been lost
+        // Inform that connection has been lost. The caller closes the channel once its write mutex is released.
         logInfo(RTCP, " Sent [FAILED]: " << sendBufferSize << " bytes to locator " << IPLocator::getLogicalPort(remoteLocator) << " ERROR=" << errorCode);
         //socket->ConnectionLost();
-        CloseTCPSocket(socket);
-        break;
+        return false;
     }
 
     logInfo(RTCP_MSG_OUT, "[SENT] TO " << remoteLocator << " - " << sendBufferSize << " (" << bytesSent << ").");
@@ -1144,10 +1470,7 @@ void TCPTransportInterface::SocketAccepted(TCPAcceptor* acceptor, const asio::er
                 unicastSocket, GetConfiguration()->maxMessageSize);
 
             mUnboundChannelResources.push_back(pChannelResource);
-            pChannelResource->SetThread(new std::thread(&TCPTransportInterface::performListenOperation, this,
-                pChannelResource));
-            pChannelResource->SetRTCPThread(new std::thread(&TCPTransportInterface::performRTPCManagementThread,
-                this, pChannelResource));
+            StartReceiving(pChannelResource);
 
             logInfo(RTCP, " Accepted connection (physical local: " << IPLocator::getPhysicalPort(acceptor->mLocator)
                 << ", remote: " << pChannelResource->getSocket()->remote_endpoint().port()
@@ -1207,10 +1530,7 @@ void TCPTransportInterface::SocketConnected(Locator_t locator, const asio::error
                 outputSocket->getSocket()->set_option(socket_base::send_buffer_size(GetConfiguration()->sendBufferSize));
                 outputSocket->getSocket()->set_option(ip::tcp::no_delay(GetConfiguration()->enable_tcp_nodelay));
 
-                outputSocket->SetThread(
-                    new std::thread(&TCPTransportInterface::performListenOperation, this, outputSocket));
-                outputSocket->SetRTCPThread(
-                    new std::thread(&TCPTransportInterface::performRTPCManagementThread, this, outputSocket));
+                StartReceiving(outputSocket);
 
                 // RTCP Control Message
                 mRTCPMessageManager->sendConnectionRequest(outputSocket);
@@ -22,6 +22,12 @@
 #include <fastrtps/utils/Semaphore.h>
 #include <fastrtps/utils/IPLocator.h>
 
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <cerrno>
+#endif
+
 using namespace std;
 using namespace asio;
 
@@ -29,6 +35,11 @@ namespace eprosima{
 namespace fastrtps{
 namespace rtps {
 
+#if defined(__linux__)
+//! Maximum number of datagrams handed to sendmmsg or taken from recvmmsg in a single call.
+static const unsigned int s_batchSize = 16;
+#endif
+
 struct MultiUniLocatorsLinkage
 {
     MultiUniLocatorsLinkage(LocatorList_t&& m, LocatorList_t&& u)
@@ -44,12 +55,14 @@ struct MultiUniLocatorsLinkage
 UDPTransportDescriptor::UDPTransportDescriptor()
     : SocketTransportDescriptor(s_maximumMessageSize, s_maximumInitialPeersRange)
     , m_output_udp_socket(0)
+    , batched_io(false)
 {
 }
 
 UDPTransportDescriptor::UDPTransportDescriptor(const UDPTransportDescriptor& t)
     : SocketTransportDescriptor(t)
     , m_output_udp_socket(t.m_output_udp_socket)
+    , batched_io(t.batched_io)
 {
 }
 
@@ -253,8 +266,14 @@ UDPChannelResource* UDPTransportInterface::CreateInputChannelResource(const std:
     UDPChannelResource* pChannelResource = new UDPChannelResource(unicastSocket, maxMsgSize);
     pChannelResource->SetMessageReceiver(receiver);
     pChannelResource->SetInterface(sInterface);
+#if defined(__linux__)
+    std::thread* newThread = GetConfiguration()->batched_io ?
+        new std::thread(&UDPTransportInterface::performBatchedListenOperation, this, pChannelResource, locator) :
+        new std::thread(&UDPTransportInterface::performListenOperation, this, pChannelResource, locator);
+#else
     std::thread* newThread = new std::thread(&UDPTransportInterface::performListenOperation, this,
         pChannelResource, locator);
+#endif
     pChannelResource->SetThread(newThread);
     return pChannelResource;
 }
@@ -402,6 +421,76 @@ void UDPTransportInterface::performListenOperation(UDPChannelResource* pChannelR
     }
 }
 
+#if defined(__linux__)
+void UDPTransportInterface::performBatchedListenOperation(UDPChannelResource* pChannelResource,
+    Locator_t input_locator)
+{
+    Locator_t remoteLocator;
+    const uint32_t buffer_size = pChannelResource->GetMessageBuffer().max_size;
+    std::vector<octet> buffers(static_cast<size_t>(buffer_size) * s_batchSize);
+    struct iovec iovecs[s_batchSize];
+    struct sockaddr_storage addresses[s_batchSize];
+    struct mmsghdr messages[s_batchSize];
+
+    memset(messages, 0, sizeof(messages));
+    for (unsigned int i = 0; i < s_batchSize; ++i)
+    {
+        iovecs[i].iov_base = &buffers[static_cast<size_t>(i) * buffer_size];
+        iovecs[i].iov_len = buffer_size;
+        messages[i].msg_hdr.msg_iov = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+        messages[i].msg_hdr.msg_name = &addresses[i];
+    }
+
+    int fd = pChannelResource->getSocket()->native_handle();
+
+    while (pChannelResource->IsAlive())
+    {
+        for (unsigned int i = 0; i < s_batchSize; ++i)
+        {
+            messages[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+        }
+
+        // Blocks until one datagram arrives, then takes the ones already queued without waiting.
+        int received = ::recvmmsg(fd, messages, s_batchSize, MSG_WAITFORONE, nullptr);
+        if (received < 0)
+        {
+            if (errno != EINTR && pChannelResource->IsAlive())
+            {
+                logWarning(RTPS_MSG_IN, "Error receiving data: recvmmsg failed with errno " << errno);
+            }
+            continue;
+        }
+
+        auto receiver = pChannelResource->GetMessageReceiver();
+        for (int i = 0; i < received; ++i)
+        {
+            const octet* buffer = static_cast<const octet*>(iovecs[i].iov_base);
+            uint32_t length = static_cast<uint32_t>(messages[i].msg_len);
+            if (length == 0 || (length == 13 && memcmp(buffer, "EPRORTPSCLOSE", 13) == 0))
+            {
+                continue;
+            }
+
+            ip::udp::endpoint senderEndpoint;
+            memcpy(senderEndpoint.data(), &addresses[i], messages[i].msg_hdr.msg_namelen);
+            senderEndpoint.resize(messages[i].msg_hdr.msg_namelen);
+            EndpointToLocator(senderEndpoint, remoteLocator);
+
+            // Processes the data through the CDR Message interface.
+            if (receiver != nullptr)
+            {
+                receiver->OnDataReceived(buffer, length, input_locator, remoteLocator);
+            }
+            else
+            {
+                logWarning(RTPS_MSG_IN, "Received Message, but no receiver attached");
+            }
+        }
+    }
+}
+#endif
+
 bool UDPTransportInterface::Receive(UDPChannelResource* pChannelResource, octet* receiveBuffer,
     uint32_t receiveBufferCapacity, uint32_t& receiveBufferSize, Locator_t& remoteLocator)
 {
@@ -499,7 +588,8 @@ Locator_t UDPTransportInterface::RemoteToMainLocal(const Locator_t& remote) cons
 bool UDPTransportInterface::Send(const octet* sendBuffer, uint32_t sendBufferSize, const Locator_t& localLocator, const Locator_t& remoteLocator)
 {
     std::unique_lock<std::recursive_mutex> scopedLock(mOutputMapMutex);
-    if (!IsOutputChannelOpen(localLocator) || sendBufferSize > GetConfiguration()->sendBufferSize)
+    if (!IsOutputChannelOpen(localLocator) || !IsLocatorSupported(remoteLocator) ||
+            sendBufferSize > GetConfiguration()->sendBufferSize)
         return false;
 
     bool success = false;
@@ -520,6 +610,101 @@ bool UDPTransportInterface::Send(const octet* sendBuffer, uint32_t sendBufferSiz
     return SendThroughSocket(sendBuffer, sendBufferSize, remoteLocator, getRefFromPtr(udpSocket->getSocket()));
 }
 
+bool UDPTransportInterface::SendBatch(const octet* sendBuffer, uint32_t sendBufferSize,
+    const Locator_t& localLocator, const LocatorList_t& remoteLocators)
+{
+#if defined(__linux__)
+    if (GetConfiguration()->batched_io)
+    {
+        std::unique_lock<std::recursive_mutex> scopedLock(mOutputMapMutex);
+        if (!IsOutputChannelOpen(localLocator) || sendBufferSize > GetConfiguration()->sendBufferSize)
+            return false;
+
+        bool success = false;
+        for (auto& socket : mOutputSockets)
+        {
+            success |= SendBatchThroughSocket(sendBuffer, sendBufferSize, remoteLocators, socket);
+        }
+
+        return success;
+    }
+#endif
+
+    return TransportInterface::SendBatch(sendBuffer, sendBufferSize, localLocator, remoteLocators);
+}
+
+#if defined(__linux__)
+bool UDPTransportInterface::SendBatchThroughSocket(const octet* sendBuffer, uint32_t sendBufferSize,
+    const LocatorList_t& remoteLocators, UDPChannelResource* socket)
+{
+    // All the datagrams share the same scatter-gather entry, pointing to the message to send.
+    struct iovec iov;
+    iov.iov_base = const_cast<octet*>(sendBuffer);
+    iov.iov_len = sendBufferSize;
+
+    ip::udp::endpoint endpoints[s_batchSize];
+    struct mmsghdr messages[s_batchSize];
+    memset(messages, 0, sizeof(messages));
+
+    int fd = socket->getSocket()->native_handle();
+    bool success = false;
+    unsigned int count = 0;
+
+    auto flush = [&]()
+    {
+        unsigned int sent = 0;
+        while (sent < count)
+        {
+            int ret = ::sendmmsg(fd, messages + sent, count - sent, 0);
+            if (ret < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                // The first pending datagram failed. Skip it, as it would happen with a single send.
+                logWarning(RTPS_MSG_OUT, "Error: sendmmsg failed with errno " << errno << " sending to "
+                    << endpoints[sent]);
+                ++sent;
+            }
+            else
+            {
+                sent += static_cast<unsigned int>(ret);
+                success = true;
+            }
+        }
+        count = 0;
+    };
+
+    for (const Locator_t& remoteLocator : remoteLocators)
+    {
+        if (!IsLocatorSupported(remoteLocator) ||
+                (socket->only_multicast_purpose() && !IPLocator::isMulticast(remoteLocator)))
+        {
+            continue;
+        }
+
+        endpoints[count] = GenerateEndpoint(remoteLocator, IPLocator::getPhysicalPort(remoteLocator));
+        messages[count].msg_hdr.msg_name = endpoints[count].data();
+        messages[count].msg_hdr.msg_namelen = static_cast<socklen_t>(endpoints[count].size());
+        messages[count].msg_hdr.msg_iov = &iov;
+        messages[count].msg_hdr.msg_iovlen = 1;
+
+        if (++count == s_batchSize)
+        {
+            flush();
+        }
+    }
+
+    flush();
+
+    logInfo(RTPS_MSG_OUT, "UDPTransport: batch of " << sendBufferSize << " bytes FROM "
+        << socket->getSocket()->local_endpoint());
+    return success;
+}
+#endif
+
 bool UDPTransportInterface::SendThroughSocket(const octet* sendBuffer, uint32_t sendBufferSize,
     const Locator_t& remoteLocator, eProsimaUDPSocketRef socket)
 {
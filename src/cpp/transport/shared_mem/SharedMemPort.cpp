@@ -0,0 +1,684 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SharedMemPort.h"
+
+#include <fastrtps/log/Log.h>
+
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <random>
+#include <thread>
+
+#if !defined(_WIN32) && !defined(__APPLE__)
+#define FASTRTPS_SHM_SUPPORTED
+#include <cerrno>
+#include <ctime>
+#include <fcntl.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+#ifdef FASTRTPS_SHM_SUPPORTED
+
+static const uint32_t c_SharedMemMagic = 0x53484D31; // "SHM1"
+static const uint32_t c_SharedMemVersion = 2;
+static const size_t c_CacheLineSize = 64;
+static const char* c_HostIdSegmentName = "/fastrtps_shm_host_id";
+//! Marks the sequence of a slot the consumer skipped because its producer never published it.
+static const uint64_t c_AbandonedSlotFlag = 1ULL << 63;
+//! How long the consumer waits for a live producer to publish a reserved slot before skipping it.
+static const std::chrono::milliseconds c_StalledSlotTimeout(1000);
+
+struct SharedMemPortHeader
+{
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    uint32_t slot_count;
+    uint32_t slot_size;
+    uint32_t slot_stride;
+    int32_t owner_pid;
+    std::atomic<uint32_t> alive;
+    std::atomic<uint32_t> consumer_waiting;
+    sem_t data_available;
+    alignas(c_CacheLineSize) std::atomic<uint64_t> enqueue_pos;
+    alignas(c_CacheLineSize) std::atomic<uint64_t> dequeue_pos;
+};
+
+struct SharedMemSlot
+{
+    std::atomic<uint64_t> sequence;
+    uint32_t length;
+    //! Process that reserved the slot, 0 while the slot is free or before the producer recorded itself.
+    std::atomic<int32_t> writer_pid;
+};
+
+struct SharedMemHostId
+{
+    std::atomic<uint32_t> ready;
+    octet id[12];
+};
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared memory ring requires address-free 64 bit atomics");
+
+static size_t round_up(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static uint32_t next_power_of_two(uint32_t value)
+{
+    uint32_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+static size_t header_size()
+{
+    return round_up(sizeof(SharedMemPortHeader), c_CacheLineSize);
+}
+
+static bool process_is_alive(int32_t pid)
+{
+    return (kill(static_cast<pid_t>(pid), 0) == 0) || (errno == EPERM);
+}
+
+/**
+ * Checks whether an existing segment belongs to a listener that is no longer running and, in that case,
+ * removes it from the namespace so it can be created again.
+ */
+static bool reclaim_stale_segment(const std::string& name)
+{
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0)
+    {
+        // Already removed by someone else.
+        return errno == ENOENT;
+    }
+
+    struct stat segment_stat;
+    bool stale = false;
+    if (fstat(fd, &segment_stat) == 0 && static_cast<size_t>(segment_stat.st_size) >= sizeof(SharedMemPortHeader))
+    {
+        void* mapped = mmap(nullptr, sizeof(SharedMemPortHeader), PROT_READ, MAP_SHARED, fd, 0);
+        if (mapped != MAP_FAILED)
+        {
+            SharedMemPortHeader* header = static_cast<SharedMemPortHeader*>(mapped);
+
+            // Give a concurrent creator the chance to finish its initialization.
+            for (int i = 0; i < 10 && header->magic.load(std::memory_order_acquire) != c_SharedMemMagic; ++i)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+
+            stale = header->magic.load(std::memory_order_acquire) != c_SharedMemMagic ||
+                header->alive.load(std::memory_order_acquire) == 0 ||
+                !process_is_alive(header->owner_pid);
+            munmap(mapped, sizeof(SharedMemPortHeader));
+        }
+    }
+    else
+    {
+        // Creator died before sizing the segment.
+        stale = true;
+    }
+    ::close(fd);
+
+    if (stale)
+    {
+        logInfo(RTPS_MSG_OUT, "Reclaiming stale shared memory segment " << name);
+        shm_unlink(name.c_str());
+    }
+
+    return stale;
+}
+
+std::unique_ptr<SharedMemPort> SharedMemPort::create(uint16_t domain_id, uint16_t participant_id, uint16_t port,
+        uint32_t slot_count, uint32_t slot_size)
+{
+    std::string name = segment_name(domain_id, participant_id, port);
+    slot_count = next_power_of_two(slot_count == 0 ? 1 : slot_count);
+    size_t slot_stride = round_up(sizeof(SharedMemSlot) + slot_size, c_CacheLineSize);
+    size_t segment_size = header_size() + slot_stride * slot_count;
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666);
+    if (fd < 0 && errno == EEXIST && reclaim_stale_segment(name))
+    {
+        fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666);
+    }
+
+    if (fd < 0)
+    {
+        logInfo(RTPS_MSG_OUT, "SharedMemTransport: segment " << name << " already in use (" << strerror(errno) << ")");
+        return nullptr;
+    }
+
+    // Let every local user write into the segment, whatever the umask.
+    fchmod(fd, 0666);
+
+    if (ftruncate(fd, static_cast<off_t>(segment_size)) != 0)
+    {
+        logWarning(RTPS_MSG_OUT, "SharedMemTransport: cannot size segment " << name << ": " << strerror(errno));
+        ::close(fd);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+
+    void* segment = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (segment == MAP_FAILED)
+    {
+        logWarning(RTPS_MSG_OUT, "SharedMemTransport: cannot map segment " << name << ": " << strerror(errno));
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+
+    SharedMemPortHeader* header = new (segment) SharedMemPortHeader();
+    header->version = c_SharedMemVersion;
+    header->slot_count = slot_count;
+    header->slot_size = slot_size;
+    header->slot_stride = static_cast<uint32_t>(slot_stride);
+    header->owner_pid = static_cast<int32_t>(getpid());
+    header->alive.store(1, std::memory_order_relaxed);
+    header->consumer_waiting.store(0, std::memory_order_relaxed);
+    header->enqueue_pos.store(0, std::memory_order_relaxed);
+    header->dequeue_pos.store(0, std::memory_order_relaxed);
+
+    if (sem_init(&header->data_available, 1, 0) != 0)
+    {
+        logWarning(RTPS_MSG_OUT, "SharedMemTransport: cannot create semaphore: " << strerror(errno));
+        munmap(segment, segment_size);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+
+    octet* slots = static_cast<octet*>(segment) + header_size();
+    for (uint32_t i = 0; i < slot_count; ++i)
+    {
+        SharedMemSlot* s = new (slots + i * slot_stride) SharedMemSlot();
+        s->sequence.store(i, std::memory_order_relaxed);
+        s->length = 0;
+        s->writer_pid.store(0, std::memory_order_relaxed);
+    }
+
+    // Publish the initialized segment.
+    header->magic.store(c_SharedMemMagic, std::memory_order_release);
+
+    return std::unique_ptr<SharedMemPort>(new SharedMemPort(name, port, true, segment, segment_size));
+}
+
+std::unique_ptr<SharedMemPort> SharedMemPort::open(uint16_t domain_id, uint16_t participant_id, uint16_t port)
+{
+    std::string name = segment_name(domain_id, participant_id, port);
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat segment_stat;
+    if (fstat(fd, &segment_stat) != 0 || static_cast<size_t>(segment_stat.st_size) < header_size())
+    {
+        ::close(fd);
+        return nullptr;
+    }
+
+    size_t segment_size = static_cast<size_t>(segment_stat.st_size);
+    void* segment = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (segment == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    SharedMemPortHeader* header = static_cast<SharedMemPortHeader*>(segment);
+    if (header->magic.load(std::memory_order_acquire) != c_SharedMemMagic ||
+            header->version != c_SharedMemVersion ||
+            header->alive.load(std::memory_order_acquire) == 0 ||
+            header_size() + static_cast<size_t>(header->slot_stride) * header->slot_count > segment_size)
+    {
+        munmap(segment, segment_size);
+        return nullptr;
+    }
+
+    if (!process_is_alive(header->owner_pid))
+    {
+        // Left behind by a crashed listener. The next listener on the port reclaims it.
+        logInfo(RTPS_MSG_OUT, "SharedMemTransport: ignoring stale segment " << name);
+        munmap(segment, segment_size);
+        return nullptr;
+    }
+
+    return std::unique_ptr<SharedMemPort>(new SharedMemPort(name, port, false, segment, segment_size));
+}
+
+SharedMemPort::SharedMemPort(const std::string& name, uint16_t port, bool owner, void* segment, size_t segment_size)
+    : mName(name)
+    , mPort(port)
+    , mOwner(owner)
+    , mSegment(segment)
+    , mSegmentSize(segment_size)
+    , mHeader(static_cast<SharedMemPortHeader*>(segment))
+    , mSlots(static_cast<octet*>(segment) + header_size())
+    , mStalledPosition(~0ULL)
+{
+}
+
+SharedMemPort::~SharedMemPort()
+{
+    if (mOwner)
+    {
+        close();
+    }
+    munmap(mSegment, mSegmentSize);
+}
+
+SharedMemSlot* SharedMemPort::slot(uint64_t position) const
+{
+    uint64_t index = position & (mHeader->slot_count - 1);
+    return reinterpret_cast<SharedMemSlot*>(mSlots + index * mHeader->slot_stride);
+}
+
+bool SharedMemPort::push(const octet* data, uint32_t size)
+{
+    if (size > mHeader->slot_size || mHeader->alive.load(std::memory_order_acquire) == 0)
+    {
+        return false;
+    }
+
+    uint64_t position;
+    if (!reserve(position))
+    {
+        // Ring is full. Behave like a lossy datagram transport, unless nobody is ever going to empty it.
+        if (!process_is_alive(mHeader->owner_pid) && mHeader->alive.exchange(0) != 0)
+        {
+            logInfo(RTPS_MSG_OUT, "SharedMemTransport: listener of " << mName << " is gone");
+        }
+        return false;
+    }
+
+    if (!publish(position, data, size))
+    {
+        return false;
+    }
+
+    // Only pay for the wake up when the consumer is about to sleep.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (mHeader->consumer_waiting.load(std::memory_order_relaxed) != 0 &&
+            mHeader->consumer_waiting.exchange(0) != 0)
+    {
+        sem_post(&mHeader->data_available);
+    }
+
+    return true;
+}
+
+bool SharedMemPort::reserve(uint64_t& position)
+{
+    position = mHeader->enqueue_pos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        SharedMemSlot* s = slot(position);
+        uint64_t sequence = s->sequence.load(std::memory_order_acquire);
+        if ((sequence & c_AbandonedSlotFlag) != 0)
+        {
+            // Skipped by the consumer on the previous lap and not given back yet.
+            return false;
+        }
+
+        int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+        if (diff == 0)
+        {
+            if (mHeader->enqueue_pos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                // Lets the consumer find out whether the slot will ever be published.
+                s->writer_pid.store(static_cast<int32_t>(getpid()), std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = mHeader->enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool SharedMemPort::publish(uint64_t position, const octet* data, uint32_t size)
+{
+    SharedMemSlot* s = slot(position);
+    memcpy(reinterpret_cast<octet*>(s) + sizeof(SharedMemSlot), data, size);
+    s->length = size;
+
+    uint64_t expected = position;
+    if (!s->sequence.compare_exchange_strong(expected, position + 1, std::memory_order_release,
+                std::memory_order_relaxed))
+    {
+        // We took too long and the consumer moved past the slot. Give it back to the producers.
+        s->writer_pid.store(0, std::memory_order_relaxed);
+        expected = position | c_AbandonedSlotFlag;
+        s->sequence.compare_exchange_strong(expected, position + mHeader->slot_count, std::memory_order_release,
+                std::memory_order_relaxed);
+        return false;
+    }
+
+    return true;
+}
+
+bool SharedMemPort::front(const octet*& data, uint32_t& size)
+{
+    for (;;)
+    {
+        uint64_t position = mHeader->dequeue_pos.load(std::memory_order_relaxed);
+        SharedMemSlot* s = slot(position);
+        uint64_t sequence = s->sequence.load(std::memory_order_acquire);
+        if (sequence == position + 1)
+        {
+            data = reinterpret_cast<octet*>(s) + sizeof(SharedMemSlot);
+            size = s->length;
+            return true;
+        }
+
+        if (sequence == position)
+        {
+            if (mHeader->enqueue_pos.load(std::memory_order_relaxed) == position ||
+                    !recover_slot(position, s, sequence))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            if (sequence == ((position - mHeader->slot_count) | c_AbandonedSlotFlag))
+            {
+                // Skipped on the previous lap. Nobody else gives it back if its producer is gone.
+                int32_t writer_pid = s->writer_pid.load(std::memory_order_acquire);
+                if (writer_pid == 0 || !process_is_alive(writer_pid))
+                {
+                    s->writer_pid.store(0, std::memory_order_relaxed);
+                    s->sequence.compare_exchange_strong(sequence, position, std::memory_order_release,
+                            std::memory_order_relaxed);
+                }
+            }
+            return false;
+        }
+    }
+}
+
+bool SharedMemPort::recover_slot(uint64_t position, SharedMemSlot* s, uint64_t sequence)
+{
+    // The slot was reserved but is not published yet.
+    int32_t writer_pid = s->writer_pid.load(std::memory_order_acquire);
+    bool writer_dead = writer_pid != 0 && !process_is_alive(writer_pid);
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (mStalledPosition != position)
+    {
+        mStalledPosition = position;
+        mStalledSince = now;
+    }
+
+    if (!writer_dead && now - mStalledSince < c_StalledSlotTimeout)
+    {
+        return false;
+    }
+
+    if (!s->sequence.compare_exchange_strong(sequence, position | c_AbandonedSlotFlag, std::memory_order_acq_rel))
+    {
+        // Published in the meantime.
+        return true;
+    }
+
+    logWarning(RTPS_MSG_IN, "SharedMemTransport: skipping message never published on " << mName);
+    if (writer_dead)
+    {
+        s->writer_pid.store(0, std::memory_order_relaxed);
+        s->sequence.store(position + mHeader->slot_count, std::memory_order_release);
+    }
+    mHeader->dequeue_pos.store(position + 1, std::memory_order_relaxed);
+    return true;
+}
+
+void SharedMemPort::pop_front()
+{
+    uint64_t position = mHeader->dequeue_pos.load(std::memory_order_relaxed);
+    SharedMemSlot* s = slot(position);
+    s->writer_pid.store(0, std::memory_order_relaxed);
+    s->sequence.store(position + mHeader->slot_count, std::memory_order_release);
+    mHeader->dequeue_pos.store(position + 1, std::memory_order_relaxed);
+}
+
+bool SharedMemPort::is_empty() const
+{
+    uint64_t position = mHeader->dequeue_pos.load(std::memory_order_relaxed);
+    return slot(position)->sequence.load(std::memory_order_seq_cst) != position + 1;
+}
+
+void SharedMemPort::wait(uint32_t timeout_ms)
+{
+    mHeader->consumer_waiting.store(1, std::memory_order_seq_cst);
+
+    if (is_empty() && is_alive())
+    {
+        struct timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += timeout_ms / 1000;
+        deadline.tv_nsec += static_cast<long>(timeout_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L)
+        {
+            deadline.tv_sec += 1;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        while (sem_timedwait(&mHeader->data_available, &deadline) != 0 && errno == EINTR)
+        {
+        }
+    }
+
+    mHeader->consumer_waiting.store(0, std::memory_order_relaxed);
+}
+
+void SharedMemPort::close()
+{
+    if (mOwner && mHeader->alive.exchange(0) != 0)
+    {
+        // Remove the name first, so a new listener can take over the port right away.
+        shm_unlink(mName.c_str());
+        sem_post(&mHeader->data_available);
+    }
+}
+
+bool SharedMemPort::is_alive() const
+{
+    return mHeader->alive.load(std::memory_order_acquire) != 0;
+}
+
+uint32_t SharedMemPort::max_message_size() const
+{
+    return mHeader->slot_size;
+}
+
+std::string SharedMemPort::segment_name(uint16_t domain_id, uint16_t participant_id, uint16_t port)
+{
+    return "/fastrtps_shm_" + std::to_string(domain_id) + "_" + std::to_string(participant_id) + "_" +
+        std::to_string(port);
+}
+
+bool SharedMemPort::get_host_id(octet* id)
+{
+    bool creator = true;
+    int fd = shm_open(c_HostIdSegmentName, O_CREAT | O_EXCL | O_RDWR, 0666);
+    if (fd < 0 && errno == EEXIST)
+    {
+        creator = false;
+        fd = shm_open(c_HostIdSegmentName, O_RDWR, 0);
+    }
+
+    if (fd < 0)
+    {
+        logWarning(RTPS_MSG_OUT, "SharedMemTransport: shared memory not available: " << strerror(errno));
+        return false;
+    }
+
+    if (creator)
+    {
+        fchmod(fd, 0666);
+        if (ftruncate(fd, sizeof(SharedMemHostId)) != 0)
+        {
+            ::close(fd);
+            shm_unlink(c_HostIdSegmentName);
+            return false;
+        }
+    }
+    else
+    {
+        // Wait for the creator to size the segment.
+        struct stat segment_stat;
+        for (int i = 0; i < 100 && fstat(fd, &segment_stat) == 0 &&
+                static_cast<size_t>(segment_stat.st_size) < sizeof(SharedMemHostId); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    void* mapped = mmap(nullptr, sizeof(SharedMemHostId), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        return false;
+    }
+
+    SharedMemHostId* host_id = static_cast<SharedMemHostId*>(mapped);
+    bool ret = true;
+    if (creator)
+    {
+        std::random_device rd;
+        std::mt19937 generator(rd() ^ static_cast<uint32_t>(getpid()) ^
+            static_cast<uint32_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+        std::uniform_int_distribution<uint32_t> distribution(0, 255);
+        for (size_t i = 0; i < sizeof(host_id->id); ++i)
+        {
+            host_id->id[i] = static_cast<octet>(distribution(generator));
+        }
+        host_id->ready.store(1, std::memory_order_release);
+    }
+    else
+    {
+        for (int i = 0; i < 100 && host_id->ready.load(std::memory_order_acquire) == 0; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ret = host_id->ready.load(std::memory_order_acquire) != 0;
+    }
+
+    if (ret)
+    {
+        memcpy(id, host_id->id, sizeof(host_id->id));
+    }
+    munmap(mapped, sizeof(SharedMemHostId));
+    return ret;
+}
+
+#else // FASTRTPS_SHM_SUPPORTED
+
+struct SharedMemPortHeader {};
+struct SharedMemSlot {};
+
+std::unique_ptr<SharedMemPort> SharedMemPort::create(uint16_t, uint16_t, uint16_t, uint32_t, uint32_t)
+{
+    return nullptr;
+}
+
+std::unique_ptr<SharedMemPort> SharedMemPort::open(uint16_t, uint16_t, uint16_t)
+{
+    return nullptr;
+}
+
+SharedMemPort::~SharedMemPort()
+{
+}
+
+bool SharedMemPort::push(const octet*, uint32_t)
+{
+    return false;
+}
+
+bool SharedMemPort::reserve(uint64_t&)
+{
+    return false;
+}
+
+bool SharedMemPort::publish(uint64_t, const octet*, uint32_t)
+{
+    return false;
+}
+
+bool SharedMemPort::front(const octet*&, uint32_t&)
+{
+    return false;
+}
+
+void SharedMemPort::pop_front()
+{
+}
+
+void SharedMemPort::wait(uint32_t)
+{
+}
+
+void SharedMemPort::close()
+{
+}
+
+bool SharedMemPort::is_alive() const
+{
+    return false;
+}
+
+uint32_t SharedMemPort::max_message_size() const
+{
+    return 0;
+}
+
+std::string SharedMemPort::segment_name(uint16_t domain_id, uint16_t participant_id, uint16_t port)
+{
+    return "/fastrtps_shm_" + std::to_string(domain_id) + "_" + std::to_string(participant_id) + "_" +
+        std::to_string(port);
+}
+
+bool SharedMemPort::get_host_id(octet*)
+{
+    logWarning(RTPS_MSG_OUT, "SharedMemTransport is not supported on this platform");
+    return false;
+}
+
+#endif // FASTRTPS_SHM_SUPPORTED
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
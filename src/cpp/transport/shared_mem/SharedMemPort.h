@@ -0,0 +1,170 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SHARED_MEM_PORT_H
+#define SHARED_MEM_PORT_H
+
+#include <fastrtps/rtps/common/Types.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <cstdint>
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+struct SharedMemPortHeader;
+struct SharedMemSlot;
+
+/**
+ * Shared-memory segment backing a SharedMemTransport port.
+ * The segment holds a bounded multi-producer / single-consumer ring of fixed-size slots.
+ * Producers (any local process sending to the port) reserve slots with a CAS on the enqueue
+ * position and publish them through a per-slot sequence counter, so the data path never takes a lock.
+ * The single consumer (the process listening on the port) is only woken through the process-shared
+ * semaphore when it announced it was going to sleep.
+ *
+ * Segments are named after the domain, the participant and the port, so participants whose port numbers
+ * collide never share a ring.
+ *
+ * A producer that dies after reserving a slot and before publishing it would block the ring forever.
+ * The consumer abandons such a slot as soon as the process that reserved it is gone, or when it has not been
+ * published after a timeout, and keeps delivering the following messages. The slot is given back to the
+ * producers once its writer is known not to touch it anymore: either it is dead, or it finds out the slot
+ * was abandoned when trying to publish it, drops its message and releases the slot itself.
+ * @ingroup TRANSPORT_MODULE
+ */
+class SharedMemPort
+{
+public:
+
+    /**
+     * Creates the segment for a port on the listening side.
+     * Fails if there is a live listener already bound to the port. Segments left behind by a
+     * dead process are reclaimed.
+     * @param domain_id Domain of the listening participant.
+     * @param participant_id Identifier of the listening participant in its domain.
+     * @param port Port number.
+     * @param slot_count Number of messages the ring is able to hold. Rounded up to a power of two.
+     * @param slot_size Maximum size of a single message.
+     * @return nullptr on failure.
+     */
+    static std::unique_ptr<SharedMemPort> create(uint16_t domain_id, uint16_t participant_id, uint16_t port,
+            uint32_t slot_count, uint32_t slot_size);
+
+    /**
+     * Maps an already existing segment on the sending side.
+     * @param domain_id Domain of the listening participant.
+     * @param participant_id Identifier of the listening participant in its domain.
+     * @param port Port number.
+     * @return nullptr if there is no live listener on the port.
+     */
+    static std::unique_ptr<SharedMemPort> open(uint16_t domain_id, uint16_t participant_id, uint16_t port);
+
+    ~SharedMemPort();
+
+    /**
+     * Copies a message into the ring. Never blocks.
+     * @return false when the ring is full, the listener is gone or the consumer abandoned the slot.
+     */
+    bool push(const octet* data, uint32_t size);
+
+    /**
+     * Consumer side. Calls the functor with every queued message, in order, directly from the
+     * shared segment. The slot is given back to the producers once the functor returns.
+     * @return Number of messages processed.
+     */
+    template<class Functor>
+    uint32_t pop_all(Functor&& functor)
+    {
+        uint32_t count = 0;
+        const octet* data = nullptr;
+        uint32_t size = 0;
+        while (front(data, size))
+        {
+            functor(data, size);
+            pop_front();
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * Consumer side. Blocks until there is data to read, the port is closed, or the timeout expires.
+     */
+    void wait(uint32_t timeout_ms);
+
+    //! Consumer side. Marks the port as closed and wakes up the consumer.
+    void close();
+
+    /**
+     * Reports whether the listener of the segment is still running.
+     * A segment whose listener died without closing it is marked as closed when the ring is found full.
+     */
+    bool is_alive() const;
+
+    uint32_t max_message_size() const;
+
+    uint16_t port() const { return mPort; }
+
+    /**
+     * Returns an identifier of the shared-memory namespace this process lives in. Two processes
+     * can only talk through shared memory when this value is equal.
+     * @param[out] id Buffer of 12 octets.
+     * @return false when shared memory is not usable.
+     */
+    static bool get_host_id(octet* id);
+
+    //! Name of the segment of a port.
+    static std::string segment_name(uint16_t domain_id, uint16_t participant_id, uint16_t port);
+
+private:
+
+    friend class SharedMemPortTests;
+
+    SharedMemPort(const std::string& name, uint16_t port, bool owner, void* segment, size_t segment_size);
+
+    bool reserve(uint64_t& position);
+    bool publish(uint64_t position, const octet* data, uint32_t size);
+    bool front(const octet*& data, uint32_t& size);
+    void pop_front();
+    bool is_empty() const;
+    bool recover_slot(uint64_t position, SharedMemSlot* s, uint64_t sequence);
+    SharedMemSlot* slot(uint64_t position) const;
+
+    std::string mName;
+    uint16_t mPort;
+    bool mOwner;
+    void* mSegment;
+    size_t mSegmentSize;
+    SharedMemPortHeader* mHeader;
+    octet* mSlots;
+
+    //! Consumer side. Position of the slot the consumer is waiting for its producer to publish.
+    uint64_t mStalledPosition;
+    //! Consumer side. When the consumer started waiting for mStalledPosition.
+    std::chrono::steady_clock::time_point mStalledSince;
+
+    SharedMemPort(const SharedMemPort&) = delete;
+    SharedMemPort& operator=(const SharedMemPort&) = delete;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // SHARED_MEM_PORT_H
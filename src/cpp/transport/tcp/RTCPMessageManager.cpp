@@ -26,6 +26,13 @@
 #include <fastrtps/transport/TCPv4TransportDescriptor.h>
 #include <fastrtps/transport/TCPv6TransportDescriptor.h>
 
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RTCP_CRC_USE_SSE2
+#endif
 
 #define IDSTRING "(ID:" << std::this_thread::get_id() <<") "<<
 
@@ -117,6 +124,76 @@ uint32_t& RTCPMessageManager::addToCRC(uint32_t &crc, octet data)
     return crc;
 }
 
+/**
+ * addToCRC adds each byte with end-around carry, so the CRC of a buffer only depends on the sum of its bytes: it is
+ * that sum modulo 0xffffffff, in the range [1, 0xffffffff], unless everything added is zero.
+ */
+static uint32_t foldCRC(uint32_t crc, uint64_t sum)
+{
+    if (sum == 0)
+    {
+        return crc;
+    }
+    uint64_t total = static_cast<uint64_t>(crc) + sum;
+    return static_cast<uint32_t>((total - 1) % 0xffffffffull + 1);
+}
+
+uint32_t RTCPMessageManager::addToCRCWordwise(uint32_t crc, const octet* data, size_t size)
+{
+    const uint64_t even_bytes = 0x00FF00FF00FF00FFull;
+    const uint64_t even_words = 0x0000FFFF0000FFFFull;
+    uint64_t sum = 0;
+
+    while (size >= 8)
+    {
+        // Each of the four 16 bits lanes grows up to 510 per word, so 128 words can be added before folding them.
+        size_t words = std::min<size_t>(size / 8, 128);
+        uint64_t lanes = 0;
+        for (size_t i = 0; i < words; ++i, data += 8)
+        {
+            uint64_t word;
+            memcpy(&word, data, 8);
+            lanes += (word & even_bytes) + ((word >> 8) & even_bytes);
+        }
+        lanes = (lanes & even_words) + ((lanes >> 16) & even_words);
+        sum += (lanes & 0xFFFFFFFFull) + (lanes >> 32);
+        size -= words * 8;
+    }
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        sum += data[i];
+    }
+
+    return foldCRC(crc, sum);
+}
+
+uint32_t RTCPMessageManager::addToCRC(uint32_t crc, const octet* data, size_t size)
+{
+#if defined(RTCP_CRC_USE_SSE2)
+    // PSADBW adds each group of eight bytes into a 64 bits lane.
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lanes = zero;
+    for (; size >= 16; size -= 16, data += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        lanes = _mm_add_epi64(lanes, _mm_sad_epu8(block, zero));
+    }
+
+    uint64_t partial[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(partial), lanes);
+    uint64_t sum = partial[0] + partial[1];
+    for (size_t i = 0; i < size; ++i)
+    {
+        sum += data[i];
+    }
+
+    return foldCRC(crc, sum);
+#else
+    return addToCRCWordwise(crc, data, size);
+#endif
+}
+
 void RTCPMessageManager::fillHeaders(TCPCPMKind kind, const TCPTransactionId &transactionId,
     TCPControlMsgHeader &retCtrlHeader, TCPHeader &header, const SerializedPayload_t *payload,
     const ResponseCode *respCode)
@@ -149,6 +226,11 @@ void RTCPMessageManager::fillHeaders(TCPCPMKind kind, const TCPTransactionId &tr
     }
 
     retCtrlHeader.setEndianess(DEFAULT_ENDIAN); // Override "false" endianess set on the switch
+    if (kind == BIND_CONNECTION_REQUEST || kind == BIND_CONNECTION_RESPONSE)
+    {
+        // Let the other side know that it doesn't need to calculate the CRC of its messages.
+        retCtrlHeader.setSkipCRC(!mTransport->GetConfiguration()->check_crc);
+    }
     header.logicalPort = 0; // This is a control message
     header.length = static_cast<uint32_t>(retCtrlHeader.length + TCPHeader::getSize());
 
@@ -182,10 +264,7 @@ void RTCPMessageManager::fillHeaders(TCPCPMKind kind, const TCPTransactionId &tr
             {
                 crc = addToCRC(crc, pay[i]);
             }
-            for (uint32_t i = 0; i < payload->length; ++i)
-            {
-                crc = addToCRC(crc, payload->data[i]);
-            }
+            crc = addToCRC(crc, payload->data, payload->length);
         }
     }
     header.crc = crc;
@@ -597,6 +676,7 @@ ResponseCode RTCPMessageManager::processRTCPMessage(TCPChannelResource *pChannel
             "LogicalPort: " << IPLocator::getLogicalPort(request.transportLocator())
             << ", Physical remote: " << IPLocator::getPhysicalPort(request.transportLocator()));
 
+        pChannelResource->mSkipCRC = controlHeader.getSkipCRC();
         responseCode = processBindConnectionRequest(pChannelResource, request, controlHeader.transactionId, myLocator);
     }
     break;
@@ -616,6 +696,7 @@ ResponseCode RTCPMessageManager::processRTCPMessage(TCPChannelResource *pChannel
 
         if (respCode == RETCODE_OK || respCode == RETCODE_EXISTING_CONNECTION)
         {
+            pChannelResource->mSkipCRC = controlHeader.getSkipCRC();
             std::unique_lock<std::recursive_mutex> scopedLock(pChannelResource->mPendingLogicalMutex);
             if (!pChannelResource->mPendingLogicalOutputPorts.empty())
             {
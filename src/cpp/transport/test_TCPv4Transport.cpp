@@ -164,11 +164,7 @@ void test_TCPv4Transport::CalculateCRC(TCPHeader &header, const octet *data, uin
 {
     if (mInvalidCRCsPercentage <= (rand() % 100))
     {
-        uint32_t crc(0);
-        for (uint32_t i = 0; i < size; ++i)
-        {
-            crc = RTCPMessageManager::addToCRC(crc, data[i]);
-        }
+        header.crc = RTCPMessageManager::addToCRC(0, data, size);
     }
     else
     {
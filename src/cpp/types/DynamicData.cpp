@@ -17,12 +17,16 @@
 #include <fastrtps/types/DynamicPubSubType.h>
 #include <fastrtps/types/DynamicTypeBuilderFactory.h>
 #include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/DynamicTypeLayout.h>
 #include <fastrtps/types/TypeDescriptor.h>
 #include <fastrtps/types/DynamicDataFactory.h>
 #include <fastrtps/types/DynamicDataPtr.h>
 #include <fastrtps/log/Log.h>
+#include <fastcdr/FastBuffer.h>
 #include <fastcdr/Cdr.h>
 
+#include <cstring>
+
 namespace eprosima {
 namespace fastrtps {
 namespace types {
@@ -71,6 +75,7 @@ DynamicData::DynamicData()
     , mUnionLabel(UINT64_MAX)
     , mUnionId(MEMBER_ID_INVALID)
     , mUnionDiscriminator(nullptr)
+    , mLayout(nullptr)
 {
 }
 
@@ -96,6 +101,7 @@ DynamicData::DynamicData(DynamicType_ptr pType)
     , mUnionLabel(UINT64_MAX)
     , mUnionId(MEMBER_ID_INVALID)
     , mUnionDiscriminator(nullptr)
+    , mLayout(nullptr)
 {
     CreateMembers(mType);
 }
@@ -124,6 +130,7 @@ DynamicData::DynamicData(const DynamicData* pData)
     , mUnionLabel(pData->mUnionLabel)
     , mUnionId(pData->mUnionId)
     , mUnionDiscriminator(pData->mUnionDiscriminator)
+    , mLayout(nullptr)
 {
     CreateMembers(pData);
 }
@@ -136,6 +143,13 @@ DynamicData::~DynamicData()
 
 void DynamicData::CreateMembers(const DynamicData* pData)
 {
+    if (pData->mLayout != nullptr)
+    {
+        mLayout = pData->mLayout;
+        mFlatBuffer = pData->mFlatBuffer;
+        return;
+    }
+
     for (auto it = pData->mDescriptors.begin(); it != pData->mDescriptors.end(); ++it)
     {
         mDescriptors.insert(std::make_pair(it->first, new MemberDescriptor(it->second)));
@@ -170,6 +184,14 @@ void DynamicData::CreateMembers(const DynamicData* pData)
 
 void DynamicData::CreateMembers(DynamicType_ptr pType)
 {
+    // The values of the flat types start zeroed, like the members created by default.
+    if (pType->mLayout != nullptr)
+    {
+        mLayout = pType->mLayout;
+        mFlatBuffer.assign(mLayout->GetSize(), 0);
+        return;
+    }
+
     std::map<MemberId, DynamicTypeMember*> members;
     if (pType->GetAllMembers(members) == ResponseCode::RETCODE_OK)
     {
@@ -233,6 +255,16 @@ void DynamicData::CreateMembers(DynamicType_ptr pType)
 
 ResponseCode DynamicData::GetDescriptor(MemberDescriptor& value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        auto it = mType->mMemberById.find(id);
+        if (it != mType->mMemberById.end())
+        {
+            value.CopyFrom(it->second->GetDescriptor());
+            return ResponseCode::RETCODE_OK;
+        }
+    }
+
     auto it = mDescriptors.find(id);
     if (it != mDescriptors.end())
     {
@@ -268,6 +300,10 @@ bool DynamicData::Equals(const DynamicData* other) const
         {
             return true;
         }
+        else if (mLayout != nullptr || other->mLayout != nullptr)
+        {
+            return CompareFlatValues(other);
+        }
         else if (GetItemCount() == other->GetItemCount() && mType->Equals(other->mType.get()) &&
             mDescriptors.size() == other->mDescriptors.size())
         {
@@ -392,6 +428,18 @@ bool DynamicData::Equals(const DynamicData* other) const
 
 MemberId DynamicData::GetMemberIdByName(const std::string& name) const
 {
+    if (mLayout != nullptr)
+    {
+        for (const DynamicTypeLayout::Member& member : mLayout->mMembers)
+        {
+            if (member.mName == name)
+            {
+                return member.mId;
+            }
+        }
+        return MEMBER_ID_INVALID;
+    }
+
     for (auto it = mDescriptors.begin(); it != mDescriptors.end(); ++it)
     {
         if (it->second->GetName() == name)
@@ -404,6 +452,18 @@ MemberId DynamicData::GetMemberIdByName(const std::string& name) const
 
 MemberId DynamicData::GetMemberIdAtIndex(uint32_t index) const
 {
+    if (mLayout != nullptr)
+    {
+        for (const DynamicTypeLayout::Member& member : mLayout->mMembers)
+        {
+            if (member.mIndex == index)
+            {
+                return member.mId;
+            }
+        }
+        return MEMBER_ID_INVALID;
+    }
+
     for (auto it = mDescriptors.begin(); it != mDescriptors.end(); ++it)
     {
         if (it->second->GetIndex() == index)
@@ -421,7 +481,11 @@ TypeKind DynamicData::GetKind() const
 
 uint32_t DynamicData::GetItemCount() const
 {
-    if (GetKind() == TK_MAP)
+    if (mLayout != nullptr)
+    {
+        return static_cast<uint32_t>(mLayout->mMembers.size());
+    }
+    else if (GetKind() == TK_MAP)
     {
 #ifdef DYNAMIC_TYPES_CHECKING
         return static_cast<uint32_t>(mComplexValues.size() / 2);
@@ -591,6 +655,14 @@ void DynamicData::Clean()
         mUnionDiscriminator = nullptr;
     }
 
+    for (auto it = mFlatLoans.begin(); it != mFlatLoans.end(); ++it)
+    {
+        DynamicDataFactory::GetInstance()->DeleteData(it->second);
+    }
+    mFlatLoans.clear();
+    mFlatBuffer.clear();
+    mLayout = nullptr;
+
     CleanMembers();
 
     mType = nullptr;
@@ -604,6 +676,12 @@ void DynamicData::Clean()
 
 ResponseCode DynamicData::ClearAllValues()
 {
+    if (mLayout != nullptr)
+    {
+        std::fill(mFlatBuffer.begin(), mFlatBuffer.end(), static_cast<octet>(0));
+        return ResponseCode::RETCODE_OK;
+    }
+
     if (mType->IsComplexKind())
     {
         if (GetKind() == TK_SEQUENCE || GetKind() == TK_MAP || GetKind() == TK_ARRAY)
@@ -813,6 +891,12 @@ void DynamicData::CleanMembers()
 
 ResponseCode DynamicData::ClearNonkeyValues()
 {
+    // The members of a structure are never key elements, so all of them are cleared.
+    if (mLayout != nullptr)
+    {
+        return ClearAllValues();
+    }
+
     if (mType->IsComplexKind())
     {
         for (auto it = mDescriptors.begin(); it != mDescriptors.end(); ++it)
@@ -844,6 +928,17 @@ ResponseCode DynamicData::ClearNonkeyValues()
 
 ResponseCode DynamicData::ClearValue(MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        const DynamicTypeLayout::Member* member = mLayout->GetMember(id);
+        if (member != nullptr)
+        {
+            std::fill(mFlatBuffer.begin() + member->mOffset, mFlatBuffer.begin() + member->mOffset + member->mSize,
+                static_cast<octet>(0));
+        }
+        return ResponseCode::RETCODE_OK;
+    }
+
     auto it = mDescriptors.find(id);
     if (it != mDescriptors.end())
     {
@@ -1032,6 +1127,236 @@ bool DynamicData::CompareValues(TypeKind kind, void* left, void* right) const
     return false;
 }
 
+// Size and alignment of the values in the CDR representation.
+static void GetCdrValueSize(TypeKind kind, size_t& size, size_t& alignment)
+{
+    switch (kind)
+    {
+    default:
+    case TK_BOOLEAN:
+    case TK_BYTE:
+    case TK_CHAR8:      {   size = 1; alignment = 1; break;    }
+    case TK_INT16:
+    case TK_UINT16:     {   size = 2; alignment = 2; break;    }
+    case TK_INT32:
+    case TK_UINT32:
+    case TK_FLOAT32:
+    case TK_ENUM:
+    case TK_CHAR16:     {   size = 4; alignment = 4; break;    } // WCHARS NEED 32 Bits on Linux & MacOS
+    case TK_INT64:
+    case TK_UINT64:
+    case TK_FLOAT64:    {   size = 8; alignment = 8; break;    }
+    case TK_FLOAT128:   {   size = 16; alignment = 8; break;    }
+    }
+}
+
+template<typename T>
+static inline T ReadFlatValue(const octet* pValue)
+{
+    T value;
+    memcpy(&value, pValue, sizeof(T));
+    return value;
+}
+
+template<typename T>
+static inline void WriteFlatValue(octet* pValue, const T& value)
+{
+    memcpy(pValue, &value, sizeof(T));
+}
+
+template<typename T>
+ResponseCode DynamicData::GetFlatValue(T& value, MemberId id, TypeKind kind) const
+{
+    const DynamicTypeLayout::Member* member = mLayout->GetMember(id);
+    if (member != nullptr && member->mKind == kind)
+    {
+        value = ReadFlatValue<T>(mFlatBuffer.data() + member->mOffset);
+        return ResponseCode::RETCODE_OK;
+    }
+    return ResponseCode::RETCODE_BAD_PARAMETER;
+}
+
+template<typename T>
+ResponseCode DynamicData::SetFlatValue(const T& value, MemberId id, TypeKind kind)
+{
+    const DynamicTypeLayout::Member* member = mLayout->GetMember(id);
+    if (member != nullptr && member->mKind == kind)
+    {
+        WriteFlatValue(mFlatBuffer.data() + member->mOffset, value);
+        return ResponseCode::RETCODE_OK;
+    }
+    return ResponseCode::RETCODE_BAD_PARAMETER;
+}
+
+DynamicData* DynamicData::CreateFlatMemberData(MemberId id) const
+{
+    const DynamicTypeLayout::Member* member = mLayout->GetMember(id);
+    if (member == nullptr)
+    {
+        return nullptr;
+    }
+
+    DynamicData* pData = DynamicDataFactory::GetInstance()->CreateData(member->mType);
+    if (pData == nullptr)
+    {
+        return nullptr;
+    }
+
+    const octet* pValue = mFlatBuffer.data() + member->mOffset;
+    switch (member->mKind)
+    {
+    default:
+        break;
+    case TK_STRUCTURE:  {   memcpy(pData->mFlatBuffer.data(), pValue, member->mSize); break;    }
+    case TK_INT32:      {   pData->SetInt32Value(ReadFlatValue<int32_t>(pValue)); break;    }
+    case TK_UINT32:     {   pData->SetUint32Value(ReadFlatValue<uint32_t>(pValue)); break;    }
+    case TK_INT16:      {   pData->SetInt16Value(ReadFlatValue<int16_t>(pValue)); break;    }
+    case TK_UINT16:     {   pData->SetUint16Value(ReadFlatValue<uint16_t>(pValue)); break;    }
+    case TK_INT64:      {   pData->SetInt64Value(ReadFlatValue<int64_t>(pValue)); break;    }
+    case TK_UINT64:     {   pData->SetUint64Value(ReadFlatValue<uint64_t>(pValue)); break;    }
+    case TK_FLOAT32:    {   pData->SetFloat32Value(ReadFlatValue<float>(pValue)); break;    }
+    case TK_FLOAT64:    {   pData->SetFloat64Value(ReadFlatValue<double>(pValue)); break;    }
+    case TK_FLOAT128:   {   pData->SetFloat128Value(ReadFlatValue<long double>(pValue)); break;    }
+    case TK_CHAR8:      {   pData->SetChar8Value(ReadFlatValue<char>(pValue)); break;    }
+    case TK_CHAR16:     {   pData->SetChar16Value(ReadFlatValue<wchar_t>(pValue)); break;    }
+    case TK_BOOLEAN:    {   pData->SetBoolValue(ReadFlatValue<bool>(pValue)); break;    }
+    case TK_BYTE:       {   pData->SetByteValue(ReadFlatValue<octet>(pValue)); break;    }
+    case TK_ENUM:       {   pData->SetEnumValue(ReadFlatValue<uint32_t>(pValue)); break;    }
+    }
+    return pData;
+}
+
+void DynamicData::StoreFlatMemberData(const DynamicData* pData, MemberId id)
+{
+    const DynamicTypeLayout::Member* member = mLayout->GetMember(id);
+    if (member == nullptr)
+    {
+        return;
+    }
+
+    octet* pValue = mFlatBuffer.data() + member->mOffset;
+    switch (member->mKind)
+    {
+    default:
+        break;
+    case TK_STRUCTURE:  {   memcpy(pValue, pData->mFlatBuffer.data(), member->mSize); break;    }
+    case TK_INT32:      {   WriteFlatValue(pValue, pData->GetInt32Value(MEMBER_ID_INVALID)); break;    }
+    case TK_UINT32:     {   WriteFlatValue(pValue, pData->GetUint32Value(MEMBER_ID_INVALID)); break;    }
+    case TK_INT16:      {   WriteFlatValue(pValue, pData->GetInt16Value(MEMBER_ID_INVALID)); break;    }
+    case TK_UINT16:     {   WriteFlatValue(pValue, pData->GetUint16Value(MEMBER_ID_INVALID)); break;    }
+    case TK_INT64:      {   WriteFlatValue(pValue, pData->GetInt64Value(MEMBER_ID_INVALID)); break;    }
+    case TK_UINT64:     {   WriteFlatValue(pValue, pData->GetUint64Value(MEMBER_ID_INVALID)); break;    }
+    case TK_FLOAT32:    {   WriteFlatValue(pValue, pData->GetFloat32Value(MEMBER_ID_INVALID)); break;    }
+    case TK_FLOAT64:    {   WriteFlatValue(pValue, pData->GetFloat64Value(MEMBER_ID_INVALID)); break;    }
+    case TK_FLOAT128:   {   WriteFlatValue(pValue, pData->GetFloat128Value(MEMBER_ID_INVALID)); break;    }
+    case TK_CHAR8:      {   WriteFlatValue(pValue, pData->GetChar8Value(MEMBER_ID_INVALID)); break;    }
+    case TK_CHAR16:     {   WriteFlatValue(pValue, pData->GetChar16Value(MEMBER_ID_INVALID)); break;    }
+    case TK_BOOLEAN:    {   WriteFlatValue(pValue, pData->GetBoolValue(MEMBER_ID_INVALID)); break;    }
+    case TK_BYTE:       {   WriteFlatValue(pValue, pData->GetByteValue(MEMBER_ID_INVALID)); break;    }
+    case TK_ENUM:
+    {
+        uint32_t value(0);
+        pData->GetEnumValue(value, MEMBER_ID_INVALID);
+        WriteFlatValue(pValue, value);
+        break;
+    }
+    }
+}
+
+bool DynamicData::CompareFlatValues(const DynamicData* other) const
+{
+    if (!mType->Equals(other->mType.get()))
+    {
+        return false;
+    }
+
+    if (mLayout != nullptr && other->mLayout != nullptr)
+    {
+        if (mLayout->mValues.size() != other->mLayout->mValues.size())
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < mLayout->mValues.size(); ++i)
+        {
+            const DynamicTypeLayout::Value& value = mLayout->mValues[i];
+            const DynamicTypeLayout::Value& otherValue = other->mLayout->mValues[i];
+            if (value.mKind != otherValue.mKind || !CompareValues(value.mKind,
+                const_cast<octet*>(mFlatBuffer.data() + value.mOffset),
+                const_cast<octet*>(other->mFlatBuffer.data() + otherValue.mOffset)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // The same type built with and without the flat layout mode, compare their serialized values.
+    size_t size = getCdrSerializedSize(this);
+    if (size != getCdrSerializedSize(other))
+    {
+        return false;
+    }
+
+    std::vector<char> buffer(size);
+    std::vector<char> otherBuffer(size);
+    eprosima::fastcdr::FastBuffer fastBuffer(buffer.data(), size);
+    eprosima::fastcdr::FastBuffer otherFastBuffer(otherBuffer.data(), size);
+    eprosima::fastcdr::Cdr cdr(fastBuffer);
+    eprosima::fastcdr::Cdr otherCdr(otherFastBuffer);
+    serialize(cdr);
+    other->serialize(otherCdr);
+    return buffer == otherBuffer;
+}
+
+void DynamicData::SerializeFlatValues(eprosima::fastcdr::Cdr &cdr, TypeKind kind, size_t offset, uint32_t count) const
+{
+    const octet* pValues = mFlatBuffer.data() + offset;
+    switch (kind)
+    {
+    default:
+        break;
+    case TK_INT32:      {   cdr.serializeArray(reinterpret_cast<const int32_t*>(pValues), count); break;    }
+    case TK_UINT32:
+    case TK_ENUM:       {   cdr.serializeArray(reinterpret_cast<const uint32_t*>(pValues), count); break;    }
+    case TK_INT16:      {   cdr.serializeArray(reinterpret_cast<const int16_t*>(pValues), count); break;    }
+    case TK_UINT16:     {   cdr.serializeArray(reinterpret_cast<const uint16_t*>(pValues), count); break;    }
+    case TK_INT64:      {   cdr.serializeArray(reinterpret_cast<const int64_t*>(pValues), count); break;    }
+    case TK_UINT64:     {   cdr.serializeArray(reinterpret_cast<const uint64_t*>(pValues), count); break;    }
+    case TK_FLOAT32:    {   cdr.serializeArray(reinterpret_cast<const float*>(pValues), count); break;    }
+    case TK_FLOAT64:    {   cdr.serializeArray(reinterpret_cast<const double*>(pValues), count); break;    }
+    case TK_FLOAT128:   {   cdr.serializeArray(reinterpret_cast<const long double*>(pValues), count); break;    }
+    case TK_CHAR8:      {   cdr.serializeArray(reinterpret_cast<const char*>(pValues), count); break;    }
+    case TK_CHAR16:     {   cdr.serializeArray(reinterpret_cast<const wchar_t*>(pValues), count); break;    }
+    case TK_BOOLEAN:    {   cdr.serializeArray(reinterpret_cast<const bool*>(pValues), count); break;    }
+    case TK_BYTE:       {   cdr.serializeArray(pValues, count); break;    }
+    }
+}
+
+void DynamicData::DeserializeFlatValues(eprosima::fastcdr::Cdr &cdr, TypeKind kind, size_t offset, uint32_t count)
+{
+    octet* pValues = mFlatBuffer.data() + offset;
+    switch (kind)
+    {
+    default:
+        break;
+    case TK_INT32:      {   cdr.deserializeArray(reinterpret_cast<int32_t*>(pValues), count); break;    }
+    case TK_UINT32:
+    case TK_ENUM:       {   cdr.deserializeArray(reinterpret_cast<uint32_t*>(pValues), count); break;    }
+    case TK_INT16:      {   cdr.deserializeArray(reinterpret_cast<int16_t*>(pValues), count); break;    }
+    case TK_UINT16:     {   cdr.deserializeArray(reinterpret_cast<uint16_t*>(pValues), count); break;    }
+    case TK_INT64:      {   cdr.deserializeArray(reinterpret_cast<int64_t*>(pValues), count); break;    }
+    case TK_UINT64:     {   cdr.deserializeArray(reinterpret_cast<uint64_t*>(pValues), count); break;    }
+    case TK_FLOAT32:    {   cdr.deserializeArray(reinterpret_cast<float*>(pValues), count); break;    }
+    case TK_FLOAT64:    {   cdr.deserializeArray(reinterpret_cast<double*>(pValues), count); break;    }
+    case TK_FLOAT128:   {   cdr.deserializeArray(reinterpret_cast<long double*>(pValues), count); break;    }
+    case TK_CHAR8:      {   cdr.deserializeArray(reinterpret_cast<char*>(pValues), count); break;    }
+    case TK_CHAR16:     {   cdr.deserializeArray(reinterpret_cast<wchar_t*>(pValues), count); break;    }
+    case TK_BOOLEAN:    {   cdr.deserializeArray(reinterpret_cast<bool*>(pValues), count); break;    }
+    case TK_BYTE:       {   cdr.deserializeArray(pValues, count); break;    }
+    }
+}
+
 void DynamicData::GetValue(std::string& sOutValue, MemberId id /*= MEMBER_ID_INVALID*/) const
 {
     switch (mType->mKind)
@@ -1582,6 +1907,24 @@ void DynamicData::SetDefaultValue(MemberId id)
 
 DynamicData* DynamicData::LoanValue(MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        if (mFlatLoans.find(id) != mFlatLoans.end())
+        {
+            logError(DYN_TYPES, "Error loaning Value. The value has been loaned previously.");
+            return nullptr;
+        }
+
+        DynamicData* pData = CreateFlatMemberData(id);
+        if (pData == nullptr)
+        {
+            logError(DYN_TYPES, "Error loaning Value. MemberId not found.");
+            return nullptr;
+        }
+        mFlatLoans.insert(std::make_pair(id, pData));
+        return pData;
+    }
+
     if (id != MEMBER_ID_INVALID)
     {
         if (std::find(mLoanedValues.begin(), mLoanedValues.end(), id) == mLoanedValues.end())
@@ -1661,6 +2004,17 @@ DynamicData* DynamicData::LoanValue(MemberId id)
 
 ResponseCode DynamicData::ReturnLoanedValue(const DynamicData* value)
 {
+    for (auto it = mFlatLoans.begin(); it != mFlatLoans.end(); ++it)
+    {
+        if (it->second == value)
+        {
+            StoreFlatMemberData(it->second, it->first);
+            DynamicDataFactory::GetInstance()->DeleteData(it->second);
+            mFlatLoans.erase(it);
+            return ResponseCode::RETCODE_OK;
+        }
+    }
+
     for (auto loanIt = mLoanedValues.begin(); loanIt != mLoanedValues.end(); ++loanIt)
     {
 #ifdef DYNAMIC_TYPES_CHECKING
@@ -1686,6 +2040,11 @@ ResponseCode DynamicData::ReturnLoanedValue(const DynamicData* value)
 
 ResponseCode DynamicData::GetInt32Value(int32_t& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_INT32);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_INT32 && id == MEMBER_ID_INVALID)
     {
@@ -1735,6 +2094,11 @@ ResponseCode DynamicData::GetInt32Value(int32_t& value, MemberId id) const
 
 ResponseCode DynamicData::SetInt32Value(int32_t value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        return SetFlatValue(value, id, TK_INT32);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_INT32 && id == MEMBER_ID_INVALID)
     {
@@ -1799,6 +2163,11 @@ ResponseCode DynamicData::SetInt32Value(int32_t value, MemberId id)
 
 ResponseCode DynamicData::GetUint32Value(uint32_t& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_UINT32);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_UINT32 && id == MEMBER_ID_INVALID)
     {
@@ -1848,6 +2217,11 @@ ResponseCode DynamicData::GetUint32Value(uint32_t& value, MemberId id) const
 
 ResponseCode DynamicData::SetUint32Value(uint32_t value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        return SetFlatValue(value, id, TK_UINT32);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_UINT32 && id == MEMBER_ID_INVALID)
     {
@@ -1912,6 +2286,11 @@ ResponseCode DynamicData::SetUint32Value(uint32_t value, MemberId id)
 
 ResponseCode DynamicData::GetInt16Value(int16_t& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_INT16);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_INT16 && id == MEMBER_ID_INVALID)
     {
@@ -1961,6 +2340,11 @@ ResponseCode DynamicData::GetInt16Value(int16_t& value, MemberId id) const
 
 ResponseCode DynamicData::SetInt16Value(int16_t value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        return SetFlatValue(value, id, TK_INT16);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_INT16 && id == MEMBER_ID_INVALID)
     {
@@ -2025,6 +2409,11 @@ ResponseCode DynamicData::SetInt16Value(int16_t value, MemberId id)
 
 ResponseCode DynamicData::GetUint16Value(uint16_t& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_UINT16);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_UINT16 && id == MEMBER_ID_INVALID)
     {
@@ -2074,6 +2463,11 @@ ResponseCode DynamicData::GetUint16Value(uint16_t& value, MemberId id) const
 
 ResponseCode DynamicData::SetUint16Value(uint16_t value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        return SetFlatValue(value, id, TK_UINT16);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_UINT16 && id == MEMBER_ID_INVALID)
     {
@@ -2137,6 +2531,11 @@ ResponseCode DynamicData::SetUint16Value(uint16_t value, MemberId id)
 
 ResponseCode DynamicData::GetInt64Value(int64_t& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_INT64);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_INT64 && id == MEMBER_ID_INVALID)
     {
@@ -2186,6 +2585,11 @@ ResponseCode DynamicData::GetInt64Value(int64_t& value, MemberId id) const
 
 ResponseCode DynamicData::SetInt64Value(int64_t value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        return SetFlatValue(value, id, TK_INT64);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_INT64 && id == MEMBER_ID_INVALID)
     {
@@ -2250,6 +2654,11 @@ ResponseCode DynamicData::SetInt64Value(int64_t value, MemberId id)
 
 ResponseCode DynamicData::GetUint64Value(uint64_t& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_UINT64);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_UINT64 && id == MEMBER_ID_INVALID)
     {
@@ -2299,6 +2708,11 @@ ResponseCode DynamicData::GetUint64Value(uint64_t& value, MemberId id) const
 
 ResponseCode DynamicData::SetUint64Value(uint64_t value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        return SetFlatValue(value, id, TK_UINT64);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_UINT64 && id == MEMBER_ID_INVALID)
     {
@@ -2363,6 +2777,11 @@ ResponseCode DynamicData::SetUint64Value(uint64_t value, MemberId id)
 
 ResponseCode DynamicData::GetFloat32Value(float& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_FLOAT32);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_FLOAT32 && id == MEMBER_ID_INVALID)
     {
@@ -2412,6 +2831,11 @@ ResponseCode DynamicData::GetFloat32Value(float& value, MemberId id) const
 
 ResponseCode DynamicData::SetFloat32Value(float value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        return SetFlatValue(value, id, TK_FLOAT32);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_FLOAT32 && id == MEMBER_ID_INVALID)
     {
@@ -2477,6 +2901,11 @@ ResponseCode DynamicData::SetFloat32Value(float value, MemberId id)
 
 ResponseCode DynamicData::GetFloat64Value(double& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_FLOAT64);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_FLOAT64 && id == MEMBER_ID_INVALID)
     {
@@ -2526,6 +2955,11 @@ ResponseCode DynamicData::GetFloat64Value(double& value, MemberId id) const
 
 ResponseCode DynamicData::SetFloat64Value(double value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        return SetFlatValue(value, id, TK_FLOAT64);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_FLOAT64 && id == MEMBER_ID_INVALID)
     {
@@ -2590,6 +3024,11 @@ ResponseCode DynamicData::SetFloat64Value(double value, MemberId id)
 
 ResponseCode DynamicData::GetFloat128Value(long double& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_FLOAT128);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_FLOAT128 && id == MEMBER_ID_INVALID)
     {
@@ -2639,6 +3078,11 @@ ResponseCode DynamicData::GetFloat128Value(long double& value, MemberId id) cons
 
 ResponseCode DynamicData::SetFloat128Value(long double value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        return SetFlatValue(value, id, TK_FLOAT128);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_FLOAT128 && id == MEMBER_ID_INVALID)
     {
@@ -2703,6 +3147,11 @@ ResponseCode DynamicData::SetFloat128Value(long double value, MemberId id)
 
 ResponseCode DynamicData::GetChar8Value(char& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_CHAR8);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_CHAR8 && id == MEMBER_ID_INVALID)
     {
@@ -2752,6 +3201,11 @@ ResponseCode DynamicData::GetChar8Value(char& value, MemberId id) const
 
 ResponseCode DynamicData::SetChar8Value(char value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        return SetFlatValue(value, id, TK_CHAR8);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_CHAR8 && id == MEMBER_ID_INVALID)
     {
@@ -2816,6 +3270,11 @@ ResponseCode DynamicData::SetChar8Value(char value, MemberId id)
 
 ResponseCode DynamicData::GetChar16Value(wchar_t& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_CHAR16);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_CHAR16 && id == MEMBER_ID_INVALID)
     {
@@ -2865,6 +3324,11 @@ ResponseCode DynamicData::GetChar16Value(wchar_t& value, MemberId id) const
 
 ResponseCode DynamicData::SetChar16Value(wchar_t value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        return SetFlatValue(value, id, TK_CHAR16);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_CHAR16 && id == MEMBER_ID_INVALID)
     {
@@ -2930,6 +3394,11 @@ ResponseCode DynamicData::SetChar16Value(wchar_t value, MemberId id)
 
 ResponseCode DynamicData::GetByteValue(octet& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_BYTE);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_BYTE && id == MEMBER_ID_INVALID)
     {
@@ -2979,6 +3448,11 @@ ResponseCode DynamicData::GetByteValue(octet& value, MemberId id) const
 
 ResponseCode DynamicData::SetByteValue(octet value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        return SetFlatValue(value, id, TK_BYTE);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_BYTE && id == MEMBER_ID_INVALID)
     {
@@ -3043,6 +3517,11 @@ ResponseCode DynamicData::SetByteValue(octet value, MemberId id)
 
 ResponseCode DynamicData::GetBoolValue(bool& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_BOOLEAN);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_BOOLEAN && id == MEMBER_ID_INVALID)
     {
@@ -3110,6 +3589,11 @@ ResponseCode DynamicData::GetBoolValue(bool& value, MemberId id) const
 
 ResponseCode DynamicData::SetBoolValue(bool value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        return SetFlatValue(value, id, TK_BOOLEAN);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_BOOLEAN && id == MEMBER_ID_INVALID)
     {
@@ -3579,6 +4063,11 @@ ResponseCode DynamicData::SetWstringValue(const std::wstring& value, MemberId id
 
 ResponseCode DynamicData::GetEnumValue(uint32_t& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        return GetFlatValue(value, id, TK_ENUM);
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_ENUM && id == MEMBER_ID_INVALID)
     {
@@ -3628,6 +4117,17 @@ ResponseCode DynamicData::GetEnumValue(uint32_t& value, MemberId id) const
 
 ResponseCode DynamicData::SetEnumValue(const uint32_t& value, MemberId id /*= MEMBER_ID_INVALID*/)
 {
+    if (mLayout != nullptr)
+    {
+        const DynamicTypeLayout::Member* member = mLayout->GetMember(id);
+        if (member != nullptr && member->mKind == TK_ENUM &&
+            member->mType->mMemberById.find(value) != member->mType->mMemberById.end())
+        {
+            return SetFlatValue(value, id, TK_ENUM);
+        }
+        return ResponseCode::RETCODE_BAD_PARAMETER;
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_ENUM && id == MEMBER_ID_INVALID)
     {
@@ -3698,6 +4198,22 @@ ResponseCode DynamicData::SetEnumValue(const uint32_t& value, MemberId id /*= ME
 
 ResponseCode DynamicData::GetEnumValue(std::string& value, MemberId id) const
 {
+    if (mLayout != nullptr)
+    {
+        uint32_t enumValue(0);
+        if (GetFlatValue(enumValue, id, TK_ENUM) == ResponseCode::RETCODE_OK)
+        {
+            const DynamicTypeLayout::Member* member = mLayout->GetMember(id);
+            auto it = member->mType->mMemberById.find(enumValue);
+            if (it != member->mType->mMemberById.end())
+            {
+                value = it->second->GetName();
+                return ResponseCode::RETCODE_OK;
+            }
+        }
+        return ResponseCode::RETCODE_BAD_PARAMETER;
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_ENUM && id == MEMBER_ID_INVALID)
     {
@@ -3755,6 +4271,21 @@ ResponseCode DynamicData::GetEnumValue(std::string& value, MemberId id) const
 
 ResponseCode DynamicData::SetEnumValue(const std::string& value, MemberId id)
 {
+    if (mLayout != nullptr)
+    {
+        const DynamicTypeLayout::Member* member = mLayout->GetMember(id);
+        if (member != nullptr && member->mKind == TK_ENUM)
+        {
+            auto it = member->mType->mMemberByName.find(value);
+            if (it != member->mType->mMemberByName.end())
+            {
+                uint32_t enumValue = it->second->GetId();
+                return SetFlatValue(enumValue, id, TK_ENUM);
+            }
+        }
+        return ResponseCode::RETCODE_BAD_PARAMETER;
+    }
+
 #ifdef DYNAMIC_TYPES_CHECKING
     if (GetKind() == TK_ENUM && id == MEMBER_ID_INVALID)
     {
@@ -4692,6 +5223,12 @@ ResponseCode DynamicData::GetComplexValue(DynamicData** value, MemberId id) cons
     if (id != MEMBER_ID_INVALID && (GetKind() == TK_STRUCTURE || GetKind() == TK_UNION ||
         GetKind() == TK_SEQUENCE || GetKind() == TK_ARRAY || GetKind() == TK_MAP))
     {
+        if (mLayout != nullptr)
+        {
+            *value = CreateFlatMemberData(id);
+            return *value != nullptr ? ResponseCode::RETCODE_OK : ResponseCode::RETCODE_BAD_PARAMETER;
+        }
+
 #ifdef DYNAMIC_TYPES_CHECKING
         auto it = mComplexValues.find(id);
         if (it != mComplexValues.end())
@@ -5042,6 +5579,15 @@ bool DynamicData::deserialize(eprosima::fastcdr::Cdr &cdr)
     }
     case TK_STRUCTURE:
     {
+        if (mLayout != nullptr)
+        {
+            for (const DynamicTypeLayout::Operation& operation : mLayout->mOperations)
+            {
+                DeserializeFlatValues(cdr, operation.mKind, operation.mOffset, operation.mCount);
+            }
+            break;
+        }
+
 #ifdef DYNAMIC_TYPES_CHECKING
         //uint32_t size(static_cast<uint32_t>(mComplexValues.size())), memberId(MEMBER_ID_INVALID);
         for (uint32_t i = 0; i < mComplexValues.size(); ++i)
@@ -5300,6 +5846,19 @@ size_t DynamicData::getCdrSerializedSize(const DynamicData* data, size_t current
     }
     case TK_STRUCTURE:
     {
+        if (data->mLayout != nullptr)
+        {
+            for (const DynamicTypeLayout::Operation& operation : data->mLayout->mOperations)
+            {
+                size_t size = 0;
+                size_t alignment = 1;
+                GetCdrValueSize(operation.mKind, size, alignment);
+                current_alignment += operation.mCount * size +
+                    eprosima::fastcdr::Cdr::alignment(current_alignment, alignment);
+            }
+            break;
+        }
+
 #ifdef DYNAMIC_TYPES_CHECKING
         for (auto it = data->mComplexValues.begin(); it != data->mComplexValues.end(); ++it)
         {
@@ -5371,12 +5930,10 @@ size_t DynamicData::getKeyMaxCdrSerializedSize(const DynamicType_ptr type, size_
     // Structures check the the size of the key for their children
     if (type->GetKind() == TK_STRUCTURE)
     {
+        // Same members as serializeKey, which checks the key annotation of the type of each member.
         for (auto it = type->mMemberById.begin(); it != type->mMemberById.end(); ++it)
         {
-            if (it->second->GetKeyAnnotation())
-            {
-                current_alignment += getKeyMaxCdrSerializedSize(it->second->mDescriptor.mType, current_alignment);
-            }
+            current_alignment += getKeyMaxCdrSerializedSize(it->second->mDescriptor.mType, current_alignment);
         }
     }
     else if (type->mIsKeyDefined)
@@ -5721,6 +6278,15 @@ void DynamicData::serialize(eprosima::fastcdr::Cdr &cdr) const
     }
     case TK_STRUCTURE:
     {
+        if (mLayout != nullptr)
+        {
+            for (const DynamicTypeLayout::Operation& operation : mLayout->mOperations)
+            {
+                SerializeFlatValues(cdr, operation.mKind, operation.mOffset, operation.mCount);
+            }
+            break;
+        }
+
 #ifdef DYNAMIC_TYPES_CHECKING
         for (uint32_t idx = 0; idx < static_cast<uint32_t>(mComplexValues.size()); ++idx)
         {
@@ -5783,7 +6349,17 @@ void DynamicData::serialize(eprosima::fastcdr::Cdr &cdr) const
 void DynamicData::serializeKey(eprosima::fastcdr::Cdr &cdr) const
 {
     // Structures check the the size of the key for their children
-    if (mType->GetKind() == TK_STRUCTURE)
+    if (mLayout != nullptr)
+    {
+        for (const DynamicTypeLayout::Value& value : mLayout->mValues)
+        {
+            if (value.mType->mIsKeyDefined)
+            {
+                SerializeFlatValues(cdr, value.mKind, value.mOffset, 1);
+            }
+        }
+    }
+    else if (mType->GetKind() == TK_STRUCTURE)
     {
 #ifdef DYNAMIC_TYPES_CHECKING
         for (auto it = mComplexValues.begin(); it != mComplexValues.end(); ++it)
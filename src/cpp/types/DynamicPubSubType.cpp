@@ -26,23 +26,19 @@ namespace types {
 
 DynamicPubSubType::DynamicPubSubType()
     : mDynamicType(nullptr)
-    , m_keyBuffer(nullptr)
+    , m_keyBufferSize(0)
 {
 }
 
 DynamicPubSubType::DynamicPubSubType(DynamicType_ptr pType)
     : mDynamicType(pType)
-    , m_keyBuffer(nullptr)
+    , m_keyBufferSize(0)
 {
     UpdateDynamicTypeInfo();
 }
 
 DynamicPubSubType::~DynamicPubSubType()
 {
-    if (m_keyBuffer != nullptr)
-    {
-        free(m_keyBuffer);
-    }
 }
 
 void DynamicPubSubType::CleanDynamicType()
@@ -122,34 +118,15 @@ bool DynamicPubSubType::getKey(void* data, eprosima::fastrtps::rtps::InstanceHan
         return false;
     }
     DynamicData* pDynamicData = (DynamicData*)data;
-    size_t keyBufferSize = static_cast<uint32_t>(DynamicData::getKeyMaxCdrSerializedSize(mDynamicType));
 
-    if (m_keyBuffer == nullptr)
-    {
-        m_keyBuffer = (unsigned char*)malloc(keyBufferSize > 16 ? keyBufferSize : 16);
-        memset(m_keyBuffer, 0, keyBufferSize > 16 ? keyBufferSize : 16);
-    }
+    // The key is serialized on a local buffer, so the keys of several samples can be computed at the same time.
+    char stackBuffer[keyStackBufferSize];
+    char* keyBuffer = m_keyBufferSize > keyStackBufferSize ? getThreadKeyBuffer(m_keyBufferSize) : stackBuffer;
 
-    eprosima::fastcdr::FastBuffer fastbuffer((char*)m_keyBuffer, keyBufferSize);
+    eprosima::fastcdr::FastBuffer fastbuffer(keyBuffer, m_keyBufferSize);
     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);     // Object that serializes the data.
     pDynamicData->serializeKey(ser);
-    if (force_md5 || keyBufferSize > 16)
-    {
-        m_md5.init();
-        m_md5.update(m_keyBuffer, (unsigned int)ser.getSerializedDataLength());
-        m_md5.finalize();
-        for (uint8_t i = 0; i < 16; ++i)
-        {
-            handle->value[i] = m_md5.digest[i];
-        }
-    }
-    else
-    {
-        for (uint8_t i = 0; i < 16; ++i)
-        {
-            handle->value[i] = m_keyBuffer[i];
-        }
-    }
+    getKeyHash(keyBuffer, ser.getSerializedDataLength(), m_keyBufferSize, force_md5, handle);
     return true;
 }
 
@@ -200,6 +177,7 @@ void DynamicPubSubType::UpdateDynamicTypeInfo()
         }
 
         m_typeSize = static_cast<uint32_t>(DynamicData::getMaxCdrSerializedSize(mDynamicType) + 4);
+        m_keyBufferSize = DynamicData::getKeyMaxCdrSerializedSize(mDynamicType);
         setName(mDynamicType->GetName().c_str());
     }
 }
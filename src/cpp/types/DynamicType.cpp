@@ -16,6 +16,7 @@
 #include <fastrtps/types/DynamicType.h>
 #include <fastrtps/types/DynamicTypeBuilder.h>
 #include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeLayout.h>
 #include <fastrtps/types/TypeDescriptor.h>
 #include <fastrtps/types/DynamicTypeMember.h>
 #include <fastrtps/types/DynamicTypeMember.h>
@@ -32,11 +33,13 @@ DynamicType::DynamicType()
     , mName("")
     , mKind(TK_NONE)
     , mIsKeyDefined(false)
+    , mLayout(nullptr)
 {
 }
 
 DynamicType::DynamicType(const TypeDescriptor* descriptor)
     : mIsKeyDefined(false)
+    , mLayout(nullptr)
 {
     mDescriptor = new TypeDescriptor(descriptor);
     try
@@ -66,6 +69,7 @@ DynamicType::DynamicType(const DynamicTypeBuilder* other)
     , mName("")
     , mKind(TK_NONE)
     , mIsKeyDefined(false)
+    , mLayout(nullptr)
 {
     CopyFromBuilder(other);
 }
@@ -171,6 +175,12 @@ void DynamicType::Clear()
     }
     mMemberById.clear();
     mMemberByName.clear();
+
+    if (mLayout != nullptr)
+    {
+        delete mLayout;
+        mLayout = nullptr;
+    }
 }
 
 ResponseCode DynamicType::CopyFromBuilder(const DynamicTypeBuilder* other)
@@ -188,12 +198,13 @@ ResponseCode DynamicType::CopyFromBuilder(const DynamicTypeBuilder* other)
             AnnotationDescriptor* newDescriptor = new AnnotationDescriptor(*it);
             mAnnotation.push_back(newDescriptor);
         }
+        mIsKeyDefined = GetKeyAnnotation();
 
         for (auto it = other->mMemberById.begin(); it != other->mMemberById.end(); ++it)
         {
             DynamicTypeMember* newMember = new DynamicTypeMember(it->second);
             newMember->SetParent(this);
-            mIsKeyDefined = newMember->GetKeyAnnotation();
+            mIsKeyDefined |= newMember->GetKeyAnnotation();
             mMemberById.insert(std::make_pair(newMember->GetId(), newMember));
             mMemberByName.insert(std::make_pair(newMember->GetName(), newMember));
         }
@@ -20,6 +20,7 @@
 #include <fastrtps/types/DynamicType.h>
 #include <fastrtps/types/DynamicTypePtr.h>
 #include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/DynamicTypeLayout.h>
 #include <fastrtps/types/MemberDescriptor.h>
 #include <fastrtps/types/TypeNamesGenerator.h>
 #include <fastrtps/log/Log.h>
@@ -115,6 +116,7 @@ ResponseCode DynamicTypeBuilderFactory::DeleteInstance()
 }
 
 DynamicTypeBuilderFactory::DynamicTypeBuilderFactory()
+    : mFlatLayoutEnabled(false)
 {
 }
 
@@ -167,6 +169,10 @@ DynamicType_ptr DynamicTypeBuilderFactory::CreateType(const DynamicTypeBuilder*
     if (other != nullptr)
     {
         DynamicType_ptr pNewType = new DynamicType(other);
+        if (mFlatLayoutEnabled && pNewType->GetKind() == TK_STRUCTURE)
+        {
+            pNewType->mLayout = CreateLayout(pNewType);
+        }
         return pNewType;
     }
     else
@@ -813,6 +819,131 @@ bool DynamicTypeBuilderFactory::IsEmpty() const
 #endif
 }
 
+void DynamicTypeBuilderFactory::SetFlatLayoutEnabled(bool enabled)
+{
+    mFlatLayoutEnabled = enabled;
+}
+
+bool DynamicTypeBuilderFactory::IsFlatLayoutEnabled() const
+{
+    return mFlatLayoutEnabled;
+}
+
+// Size and alignment of the values stored in the buffer of a flat DynamicData.
+static bool GetFlatValueSize(TypeKind kind, size_t& size, size_t& alignment)
+{
+    switch (kind)
+    {
+    case TK_BOOLEAN:    {   size = sizeof(bool); alignment = alignof(bool); return true;    }
+    case TK_BYTE:       {   size = sizeof(octet); alignment = alignof(octet); return true;    }
+    case TK_CHAR8:      {   size = sizeof(char); alignment = alignof(char); return true;    }
+    case TK_CHAR16:     {   size = sizeof(wchar_t); alignment = alignof(wchar_t); return true;    }
+    case TK_INT16:      {   size = sizeof(int16_t); alignment = alignof(int16_t); return true;    }
+    case TK_UINT16:     {   size = sizeof(uint16_t); alignment = alignof(uint16_t); return true;    }
+    case TK_INT32:      {   size = sizeof(int32_t); alignment = alignof(int32_t); return true;    }
+    case TK_UINT32:     {   size = sizeof(uint32_t); alignment = alignof(uint32_t); return true;    }
+    case TK_ENUM:       {   size = sizeof(uint32_t); alignment = alignof(uint32_t); return true;    }
+    case TK_INT64:      {   size = sizeof(int64_t); alignment = alignof(int64_t); return true;    }
+    case TK_UINT64:     {   size = sizeof(uint64_t); alignment = alignof(uint64_t); return true;    }
+    case TK_FLOAT32:    {   size = sizeof(float); alignment = alignof(float); return true;    }
+    case TK_FLOAT64:    {   size = sizeof(double); alignment = alignof(double); return true;    }
+    case TK_FLOAT128:   {   size = sizeof(long double); alignment = alignof(long double); return true;    }
+    default:
+        break;
+    }
+    return false;
+}
+
+DynamicTypeLayout* DynamicTypeBuilderFactory::CreateLayout(const DynamicType_ptr type) const
+{
+    // Child structures keep the members of their base types in separated DynamicData.
+    if (type->GetKind() != TK_STRUCTURE || type->GetBaseType() != nullptr)
+    {
+        return nullptr;
+    }
+
+    DynamicTypeLayout* layout = new DynamicTypeLayout();
+    size_t offset = 0;
+    for (auto it = type->mMemberById.begin(); it != type->mMemberById.end(); ++it)
+    {
+        const MemberDescriptor* descriptor = it->second->GetDescriptor();
+        DynamicType_ptr memberType = descriptor->mType;
+        while (memberType != nullptr && memberType->GetKind() == TK_ALIAS)
+        {
+            memberType = memberType->GetBaseType();
+        }
+
+        size_t size = 0;
+        size_t alignment = 1;
+        const DynamicTypeLayout* nestedLayout = nullptr;
+        if (memberType != nullptr && memberType->GetKind() == TK_STRUCTURE)
+        {
+            nestedLayout = memberType->mLayout;
+            if (nestedLayout != nullptr)
+            {
+                size = nestedLayout->GetSize();
+                alignment = nestedLayout->GetAlignment();
+            }
+        }
+
+        if (memberType == nullptr || (nestedLayout == nullptr && !GetFlatValueSize(memberType->GetKind(), size,
+            alignment)))
+        {
+            // Strings, collections, unions... keep the generic storage.
+            delete layout;
+            return nullptr;
+        }
+
+        offset = (offset + alignment - 1) / alignment * alignment;
+
+        DynamicTypeLayout::Member member;
+        member.mId = it->first;
+        member.mName = descriptor->GetName();
+        member.mIndex = descriptor->GetIndex();
+        member.mKind = memberType->GetKind();
+        member.mType = memberType;
+        member.mLayout = nestedLayout;
+        member.mOffset = offset;
+        member.mSize = size;
+        layout->mMembers.push_back(member);
+
+        if (nestedLayout != nullptr)
+        {
+            for (const DynamicTypeLayout::Value& value : nestedLayout->mValues)
+            {
+                layout->mValues.push_back({ value.mKind, offset + value.mOffset, value.mType });
+            }
+        }
+        else
+        {
+            layout->mValues.push_back({ member.mKind, offset, memberType.get() });
+        }
+
+        offset += size;
+        layout->mAlignment = std::max(layout->mAlignment, alignment);
+    }
+    layout->mSize = (offset + layout->mAlignment - 1) / layout->mAlignment * layout->mAlignment;
+
+    // Consecutive values of the same kind are contiguous in the buffer and can be (de)serialized at once.
+    for (const DynamicTypeLayout::Value& value : layout->mValues)
+    {
+        size_t size = 0;
+        size_t alignment = 1;
+        GetFlatValueSize(value.mKind, size, alignment);
+        if (!layout->mOperations.empty() && layout->mOperations.back().mKind == value.mKind &&
+            layout->mOperations.back().mOffset + layout->mOperations.back().mCount * size == value.mOffset)
+        {
+            ++layout->mOperations.back().mCount;
+        }
+        else
+        {
+            layout->mOperations.push_back({ value.mKind, value.mOffset, 1 });
+        }
+    }
+
+    return layout;
+}
+
 void DynamicTypeBuilderFactory::BuildTypeIdentifier(const DynamicType_ptr type, TypeIdentifier& identifier,
         bool complete) const
 {
@@ -542,7 +542,8 @@ bool IPLocator::compareAddressAndPhysicalPort(const Locator_t &loc1, const Locat
 bool IPLocator::isMulticast(const Locator_t &locator)
 {
     if (locator.kind == LOCATOR_KIND_TCPv4
-            || locator.kind == LOCATOR_KIND_TCPv6)
+            || locator.kind == LOCATOR_KIND_TCPv6
+            || locator.kind == LOCATOR_KIND_SHM)
     {
         return false;
     }
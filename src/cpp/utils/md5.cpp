@@ -160,7 +160,7 @@ void MD5::encode(uint1 output[], const uint4 input[], size_type len)
 //////////////////////////////
 
 // apply MD5 algo on a block
-void MD5::transform(const uint1 block[blocksize])
+void MD5::transform(uint4 state[4], const uint1 block[blocksize])
 {
   uint4 a = state[0], b = state[1], c = state[2], d = state[3], x[16];
   decode (x, block, blocksize);
@@ -241,9 +241,6 @@ void MD5::transform(const uint1 block[blocksize])
   state[1] += b;
   state[2] += c;
   state[3] += d;
-
-  // Zeroize sensitive information.
-  memset(x, 0, sizeof x);
 }
 
 //////////////////////////////
@@ -270,11 +267,11 @@ void MD5::update(const unsigned char input[], size_type length)
   {
     // fill buffer first, transform
     memcpy(&buffer[index], input, firstpart);
-    transform(buffer);
+    transform(state, buffer);
 
     // transform chunks of blocksize (64 bytes)
     for (i = firstpart; i + blocksize <= length; i += blocksize)
-      transform(&input[i]);
+      transform(state, &input[i]);
 
     index = 0;
   }
@@ -333,6 +330,36 @@ MD5& MD5::finalize()
 
 //////////////////////////////
 
+// MD5 of a whole buffer. The full blocks are transformed straight from the
+// input, and the padding and length are appended to a copy of the last bytes.
+void MD5::hash(const unsigned char input[], size_type length, uint1 output[16])
+{
+  uint4 hashState[4] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476};
+
+  size_type i = 0;
+  for (; i + blocksize <= length; i += blocksize)
+    transform(hashState, &input[i]);
+
+  uint1 tail[2 * blocksize] = {0};
+  size_type remaining = length - i;
+  if (remaining > 0)
+    memcpy(tail, &input[i], remaining);
+  tail[remaining] = 0x80;
+
+  // the length in bits goes in the last 8 bytes of the last block
+  size_type tailLength = (remaining < 56) ? blocksize : 2 * blocksize;
+  uint4 bits[2] = {length << 3, length >> 29};
+  encode(&tail[tailLength - 8], bits, 8);
+
+  transform(hashState, tail);
+  if (tailLength > blocksize)
+    transform(hashState, &tail[blocksize]);
+
+  encode(output, hashState, 16);
+}
+
+//////////////////////////////
+
 // return hex representation of digest as string
 std::string MD5::hexdigest() const
 {
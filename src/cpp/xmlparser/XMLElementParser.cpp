@@ -313,6 +313,9 @@ XMLP_ret XMLParser::getXMLThroughputController(tinyxml2::XMLElement *elem,
             <xs:all minOccurs="0">
                 <xs:element name="bytesPerPeriod" type="uint32Type" minOccurs="0"/>
                 <xs:element name="periodMillisecs" type="uint32Type" minOccurs="0"/>
+                <xs:element name="kind" type="throughputControllerKindType" minOccurs="0"/>
+                <xs:element name="burstBytes" type="uint32Type" minOccurs="0"/>
+                <xs:element name="refillMillisecs" type="uint32Type" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
     */
@@ -334,6 +337,37 @@ XMLP_ret XMLParser::getXMLThroughputController(tinyxml2::XMLElement *elem,
             if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &throughputController.periodMillisecs, ident))
                 return XMLP_ret::XML_ERROR;
         }
+        else if (strcmp(name, KIND) == 0)
+        {
+            // kind - throughputControllerKindType
+            const char* text = p_aux0->GetText();
+            if (nullptr == text)
+            {
+                logError(XMLPARSER, "Node '" << KIND << "' without content");
+                return XMLP_ret::XML_ERROR;
+            }
+            if (strcmp(text, PERIODIC) == 0)
+                throughputController.kind = PERIODIC_THROUGHPUT_CONTROLLER;
+            else if (strcmp(text, TOKEN_BUCKET) == 0)
+                throughputController.kind = TOKEN_BUCKET_THROUGHPUT_CONTROLLER;
+            else
+            {
+                logError(XMLPARSER, "Node '" << KIND << "' bad content");
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, BURST_BYTES) == 0)
+        {
+            // burstBytes - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &throughputController.burstBytes, ident))
+                return XMLP_ret::XML_ERROR;
+        }
+        else if (strcmp(name, REFILL_MILLISECS) == 0)
+        {
+            // refillMillisecs - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &throughputController.refillMillisecs, ident))
+                return XMLP_ret::XML_ERROR;
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'portType'. Name: " << name);
@@ -1913,6 +1947,7 @@ XMLP_ret XMLParser::getXMLHistoryMemoryPolicy(tinyxml2::XMLElement *elem,
                 <xs:enumeration value="PREALLOCATED"/>
                 <xs:enumeration value="PREALLOCATED_WITH_REALLOC"/>
                 <xs:enumeration value="DYNAMIC"/>
+                <xs:enumeration value="POOLED_SIZE_CLASS"/>
             </xs:restriction>
         </xs:simpleType>
     */
@@ -1928,6 +1963,8 @@ XMLP_ret XMLParser::getXMLHistoryMemoryPolicy(tinyxml2::XMLElement *elem,
         historyMemoryPolicy = MemoryManagementPolicy::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
     else if (strcmp(text, DYNAMIC) == 0)
         historyMemoryPolicy = MemoryManagementPolicy::DYNAMIC_RESERVE_MEMORY_MODE;
+    else if (strcmp(text, POOLED_SIZE_CLASS) == 0)
+        historyMemoryPolicy = MemoryManagementPolicy::POOLED_SIZE_CLASS_MEMORY_MODE;
     else
     {
         logError(XMLPARSER, "Node '" << KIND << "' bad content");
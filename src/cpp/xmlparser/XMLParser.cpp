@@ -252,6 +252,7 @@ XMLP_ret XMLParser::parseXMLTransportData(tinyxml2::XMLElement* p_root)
                 <xs:element name="interfaceWhiteList" type="stringListType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="wan_addr" type="stringType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="output_port" type="uint16Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="batched_io" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="keep_alive_frequency_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="keep_alive_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="max_logical_port" type="uint16Type" minOccurs="0" maxOccurs="1"/>
@@ -261,6 +262,10 @@ XMLP_ret XMLParser::parseXMLTransportData(tinyxml2::XMLElement* p_root)
                 <xs:element name="listening_ports" type="portListType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="calculate_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="check_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="async_io" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="io_threads" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="send_coalescing_window_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="send_coalescing_bytes" type="uint32Type" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
     */
@@ -303,6 +308,12 @@ XMLP_ret XMLParser::parseXMLTransportData(tinyxml2::XMLElement* p_root)
                     return XMLP_ret::XML_ERROR;
                 pUDPv4Desc->m_output_udp_socket = static_cast<uint16_t>(iSocket);
             }
+            // Batched IO
+            if (nullptr != (p_aux0 = p_root->FirstChildElement(UDP_BATCHED_IO)))
+            {
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &pUDPv4Desc->batched_io, 0))
+                    return XMLP_ret::XML_ERROR;
+            }
         }
         else if (sType == UDPv6)
         {
@@ -318,6 +329,12 @@ XMLP_ret XMLParser::parseXMLTransportData(tinyxml2::XMLElement* p_root)
                     return XMLP_ret::XML_ERROR;
                 pUDPv6Desc->m_output_udp_socket = static_cast<uint16_t>(iSocket);
             }
+            // Batched IO
+            if (nullptr != (p_aux0 = p_root->FirstChildElement(UDP_BATCHED_IO)))
+            {
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &pUDPv6Desc->batched_io, 0))
+                    return XMLP_ret::XML_ERROR;
+            }
         }
         else if (sType == TCPv4)
         {
@@ -382,6 +399,7 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(tinyxml2::XMLElement* p_root, sp
                 <xs:element name="interfaceWhiteList" type="stringListType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="wan_addr" type="stringType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="output_port" type="uint16Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="batched_io" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="keep_alive_frequency_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="keep_alive_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="max_logical_port" type="uint16Type" minOccurs="0" maxOccurs="1"/>
@@ -455,12 +473,15 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(tinyxml2::XMLElement* p_root, sp
             }
         }
         else if (strcmp(name, TCP_WAN_ADDR) == 0 || strcmp(name, UDP_OUTPUT_PORT) == 0 ||
+            strcmp(name, UDP_BATCHED_IO) == 0 ||
             strcmp(name, TRANSPORT_ID) == 0 || strcmp(name, TYPE) == 0 ||
             strcmp(name, KEEP_ALIVE_FREQUENCY) == 0 || strcmp(name, KEEP_ALIVE_TIMEOUT) == 0 ||
             strcmp(name, MAX_LOGICAL_PORT) == 0 || strcmp(name, LOGICAL_PORT_RANGE) == 0 ||
             strcmp(name, LOGICAL_PORT_INCREMENT) == 0 || strcmp(name, LISTENING_PORTS) == 0 ||
             strcmp(name, CALCULATE_CRC) == 0 || strcmp(name, CHECK_CRC) == 0 ||
-            strcmp(name, ENABLE_TCP_NODELAY) == 0)
+            strcmp(name, ENABLE_TCP_NODELAY) == 0 || strcmp(name, TCP_ASYNC_IO) == 0 ||
+            strcmp(name, TCP_IO_THREADS) == 0 || strcmp(name, TCP_SEND_COALESCING_WINDOW) == 0 ||
+            strcmp(name, TCP_SEND_COALESCING_BYTES) == 0)
         {
             // Parsed outside of this method
         }
@@ -490,6 +511,10 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(tinyxml2::XMLElement* p_root,
                 </xs:sequence>
                 <xs:element name="calculate_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="check_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="async_io" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="io_threads" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="send_coalescing_window_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="send_coalescing_bytes" type="uint32Type" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
     */
@@ -579,6 +604,34 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(tinyxml2::XMLElement* p_root,
                     return XMLP_ret::XML_ERROR;
                 }
             }
+            else if (strcmp(name, TCP_ASYNC_IO) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &pTCPDesc->async_io, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            else if (strcmp(name, TCP_IO_THREADS) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pTCPDesc->io_threads, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            else if (strcmp(name, TCP_SEND_COALESCING_WINDOW) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pTCPDesc->send_coalescing_window_us, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            else if (strcmp(name, TCP_SEND_COALESCING_BYTES) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pTCPDesc->send_coalescing_bytes, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
             else if (strcmp(name, TCP_WAN_ADDR) == 0 || strcmp(name, TRANSPORT_ID) == 0 ||
                 strcmp(name, TYPE) == 0 || strcmp(name, SEND_BUFFER_SIZE) == 0 ||
                 strcmp(name, RECEIVE_BUFFER_SIZE) == 0 || strcmp(name, TTL) == 0 ||
@@ -1889,6 +1942,9 @@ XMLP_ret XMLParser::fillDataNode(tinyxml2::XMLElement* p_profile, DataNode<Parti
                 <xs:element name="throughputController" type="throughputControllerType" minOccurs="0"/>
                 <xs:element name="userTransports" type="stringListType" minOccurs="0"/>
                 <xs:element name="useBuiltinTransports" type="boolType" minOccurs="0"/>
+                <xs:element name="useIntraprocessDelivery" type="boolType" minOccurs="0"/>
+                <xs:element name="receiveWorkerThreads" type="uint32Type" minOccurs="0"/>
+                <xs:element name="asyncWriterThreads" type="uint32Type" minOccurs="0"/>
                 <xs:element name="propertiesPolicy" type="propertyPolicyType" minOccurs="0"/>
                 <xs:element name="name" type="stringType" minOccurs="0"/>
             </xs:all>
@@ -1985,6 +2041,24 @@ XMLP_ret XMLParser::fillDataNode(tinyxml2::XMLElement* p_profile, DataNode<Parti
             if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &participant_node.get()->rtps.useBuiltinTransports, ident))
                 return XMLP_ret::XML_ERROR;
         }
+        else if (strcmp(name, USE_INTRAPROCESS) == 0)
+        {
+            // useIntraprocessDelivery - boolType
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &participant_node.get()->rtps.useIntraprocessDelivery, ident))
+                return XMLP_ret::XML_ERROR;
+        }
+        else if (strcmp(name, RECEIVE_WORKER_THREADS) == 0)
+        {
+            // receiveWorkerThreads - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &participant_node.get()->rtps.receiveWorkerThreads, ident))
+                return XMLP_ret::XML_ERROR;
+        }
+        else if (strcmp(name, ASYNC_WRITER_THREADS) == 0)
+        {
+            // asyncWriterThreads - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &participant_node.get()->rtps.asyncWriterThreads, ident))
+                return XMLP_ret::XML_ERROR;
+        }
         else if (strcmp(name, PROPERTIES_POLICY) == 0)
         {
             // propertiesPolicy
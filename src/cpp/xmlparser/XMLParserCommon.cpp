@@ -36,6 +36,7 @@ const char* LOG = "log";
 const char* TRANSPORT_DESCRIPTOR = "transport_descriptor";
 const char* TRANSPORT_ID = "transport_id";
 const char* UDP_OUTPUT_PORT = "output_port";
+const char* UDP_BATCHED_IO = "batched_io";
 const char* TCP_WAN_ADDR = "wan_addr";
 const char* RECEIVE_BUFFER_SIZE = "receiveBufferSize";
 const char* SEND_BUFFER_SIZE = "sendBufferSize";
@@ -53,6 +54,10 @@ const char* METADATA_LOGICAL_PORT = "metadata_logical_port";
 const char* LISTENING_PORTS = "listening_ports";
 const char* CALCULATE_CRC = "calculate_crc";
 const char* CHECK_CRC = "check_crc";
+const char* TCP_ASYNC_IO = "async_io";
+const char* TCP_IO_THREADS = "io_threads";
+const char* TCP_SEND_COALESCING_WINDOW = "send_coalescing_window_us";
+const char* TCP_SEND_COALESCING_BYTES = "send_coalescing_bytes";
 
 const char* QOS_PROFILE = "qos_profile";
 const char* APPLICATION = "application";
@@ -76,6 +81,9 @@ const char* PART_ID = "participantID";
 const char* THROUGHPUT_CONT = "throughputController";
 const char* USER_TRANS = "userTransports";
 const char* USE_BUILTIN_TRANS = "useBuiltinTransports";
+const char* USE_INTRAPROCESS = "useIntraprocessDelivery";
+const char* RECEIVE_WORKER_THREADS = "receiveWorkerThreads";
+const char* ASYNC_WRITER_THREADS = "asyncWriterThreads";
 const char* PROPERTIES_POLICY = "propertiesPolicy";
 const char* NAME = "name";
 
@@ -102,6 +110,7 @@ const char* PROPAGATE = "propagate";
 const char* PREALLOCATED = "PREALLOCATED";
 const char* PREALLOCATED_WITH_REALLOC = "PREALLOCATED_WITH_REALLOC";
 const char* DYNAMIC = "DYNAMIC";
+const char* POOLED_SIZE_CLASS = "POOLED_SIZE_CLASS";
 const char* LOCATOR = "locator";
 const char* UDPv4_LOCATOR = "udpv4";
 const char* UDPv6_LOCATOR = "udpv6";
@@ -191,6 +200,10 @@ const char* DEPTH = "depth";
 const char* ALLOCATED_SAMPLES = "allocated_samples";
 const char* BYTES_PER_SECOND = "bytesPerPeriod";
 const char* PERIOD_MILLISECS = "periodMillisecs";
+const char* BURST_BYTES = "burstBytes";
+const char* REFILL_MILLISECS = "refillMillisecs";
+const char* PERIODIC = "PERIODIC";
+const char* TOKEN_BUCKET = "TOKEN_BUCKET";
 const char* PORT_BASE = "portBase";
 const char* DOMAIN_ID_GAIN = "domainIDGain";
 const char* PARTICIPANT_ID_GAIN = "participantIDGain";
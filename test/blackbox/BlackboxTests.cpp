@@ -25,6 +25,7 @@
 #include "PubSubReader.hpp"
 #include "PubSubWriter.hpp"
 #include "PubSubWriterReader.hpp"
+#include "types/FixedSizedType.h"
 
 #include <fastrtps/rtps/RTPSDomain.h>
 #include <fastrtps/rtps/writer/WriterListener.h>
@@ -35,6 +36,9 @@
 #include <fastrtps/rtps/common/Locator.h>
 #include <fastrtps/xmlparser/XMLParser.h>
 
+#include <fastcdr/FastBuffer.h>
+#include <fastcdr/Cdr.h>
+
 #include <thread>
 #include <memory>
 #include <cstdlib>
@@ -745,6 +749,288 @@ BLACKBOXTEST(BlackBox, AsyncPubSubAsReliableHelloworld)
     reader.block_for_all();
 }
 
+BLACKBOXTEST(BlackBox, PubSubAsNonReliableHelloworldIntraprocess)
+{
+    PubSubWriterReader<HelloWorldType> wreader(TEST_TOPIC_NAME);
+
+    wreader.intraprocess_delivery(true).history_depth(100).
+        reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(wreader.isInitialized());
+
+    // Wait for discovery.
+    wreader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    wreader.startReception(data);
+
+    // Send data
+    wreader.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Readers of the same process don't lose samples.
+    wreader.block_for_all();
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableHelloworldIntraprocess)
+{
+    PubSubWriterReader<HelloWorldType> wreader(TEST_TOPIC_NAME);
+
+    wreader.intraprocess_delivery(true).history_depth(100).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(wreader.isInitialized());
+
+    // Wait for discovery.
+    wreader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    wreader.startReception(data);
+
+    // Send data
+    wreader.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    wreader.block_for_all();
+}
+
+BLACKBOXTEST(BlackBox, AsyncPubSubAsReliableHelloworldIntraprocess)
+{
+    PubSubWriterReader<HelloWorldType> wreader(TEST_TOPIC_NAME);
+
+    wreader.intraprocess_delivery(true).history_depth(100).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).
+        asynchronously(eprosima::fastrtps::ASYNCHRONOUS_PUBLISH_MODE).init();
+
+    ASSERT_TRUE(wreader.isInitialized());
+
+    // Wait for discovery.
+    wreader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    wreader.startReception(data);
+
+    // Send data
+    wreader.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    wreader.block_for_all();
+}
+
+// Serializes FixedSized with the opposite endianness of the host, so its samples cannot be loaned in place.
+class SwappedFixedSizedType : public FixedSizedType
+{
+    public:
+
+        bool serialize(void* data, SerializedPayload_t* payload) override
+        {
+            FixedSized* fs = static_cast<FixedSized*>(data);
+            eprosima::fastcdr::FastBuffer fastbuffer((char*)payload->data, payload->max_size);
+            eprosima::fastcdr::Cdr ser(fastbuffer,
+                    eprosima::fastcdr::Cdr::DEFAULT_ENDIAN == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ?
+                    eprosima::fastcdr::Cdr::LITTLE_ENDIANNESS : eprosima::fastcdr::Cdr::BIG_ENDIANNESS,
+                    eprosima::fastcdr::Cdr::DDS_CDR);
+            payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+            ser.serialize_encapsulation();
+            fs->serialize(ser);
+            payload->length = (uint32_t)ser.getSerializedDataLength();
+            return true;
+        }
+
+        bool is_plain() const override
+        {
+            return false;
+        }
+};
+
+// Publisher and subscriber of FixedSizedType, each one in its own participant.
+class LoanPubSub : public PublisherListener, public SubscriberListener
+{
+    public:
+
+        LoanPubSub(const std::string& topic_name, TopicDataType* writer_type, TopicDataType* reader_type)
+            : writer_participant_(nullptr), reader_participant_(nullptr), publisher_(nullptr),
+            subscriber_(nullptr), publication_matched_(0), subscription_matched_(0)
+        {
+            ParticipantAttributes participant_attr;
+            participant_attr.rtps.builtin.domainId = (uint32_t)GET_PID() % 230;
+            writer_participant_ = Domain::createParticipant(participant_attr);
+            reader_participant_ = Domain::createParticipant(participant_attr);
+            EXPECT_TRUE(Domain::registerType(writer_participant_, writer_type));
+            EXPECT_TRUE(Domain::registerType(reader_participant_, reader_type));
+
+            std::ostringstream t;
+            t << topic_name << "_" << asio::ip::host_name() << "_" << GET_PID();
+
+            PublisherAttributes publisher_attr;
+            publisher_attr.topic.topicDataType = writer_type->getName();
+            publisher_attr.topic.topicName = t.str();
+            publisher_attr.topic.historyQos.depth = 10;
+            publisher_attr.qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+            publisher_ = Domain::createPublisher(writer_participant_, publisher_attr, this);
+
+            SubscriberAttributes subscriber_attr;
+            subscriber_attr.topic.topicDataType = reader_type->getName();
+            subscriber_attr.topic.topicName = t.str();
+            subscriber_attr.topic.historyQos.depth = 10;
+            subscriber_attr.qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+            subscriber_ = Domain::createSubscriber(reader_participant_, subscriber_attr, this);
+        }
+
+        ~LoanPubSub()
+        {
+            Domain::removeParticipant(writer_participant_);
+            Domain::removeParticipant(reader_participant_);
+        }
+
+        void onPublicationMatched(Publisher*, MatchingInfo& info) override
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            publication_matched_ += info.status == MATCHED_MATCHING ? 1 : -1;
+            cv_.notify_all();
+        }
+
+        void onSubscriptionMatched(Subscriber*, MatchingInfo& info) override
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            subscription_matched_ += info.status == MATCHED_MATCHING ? 1 : -1;
+            cv_.notify_all();
+        }
+
+        void onNewDataMessage(Subscriber*) override
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.notify_all();
+        }
+
+        bool wait_discovery()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            return cv_.wait_for(lock, std::chrono::seconds(10), [this]()
+                {
+                    return publication_matched_ > 0 && subscription_matched_ > 0;
+                });
+        }
+
+        bool wait_unread(uint64_t count)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            return cv_.wait_for(lock, std::chrono::seconds(10), [this, count]()
+                {
+                    return subscriber_->getUnreadCount() >= count;
+                });
+        }
+
+        Participant* writer_participant_;
+        Participant* reader_participant_;
+        Publisher* publisher_;
+        Subscriber* subscriber_;
+
+    private:
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        int publication_matched_;
+        int subscription_matched_;
+};
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableLoanedFixedSized)
+{
+    FixedSizedType writer_type, reader_type;
+    LoanPubSub pubsub(TEST_TOPIC_NAME, &writer_type, &reader_type);
+
+    ASSERT_NE(pubsub.publisher_, nullptr);
+    ASSERT_NE(pubsub.subscriber_, nullptr);
+    ASSERT_TRUE(writer_type.is_plain());
+    ASSERT_TRUE(pubsub.wait_discovery());
+
+    // A discarded loan is not sent.
+    void* discarded = pubsub.publisher_->loan_sample();
+    ASSERT_NE(discarded, nullptr);
+    static_cast<FixedSized*>(discarded)->index(100);
+    ASSERT_TRUE(pubsub.publisher_->discard_loan(discarded));
+    ASSERT_FALSE(pubsub.publisher_->discard_loan(discarded));
+
+    for (uint16_t i = 1; i <= 5; ++i)
+    {
+        void* sample = pubsub.publisher_->loan_sample();
+        ASSERT_NE(sample, nullptr);
+        static_cast<FixedSized*>(sample)->index(i);
+        ASSERT_TRUE(pubsub.publisher_->write(sample));
+    }
+
+    ASSERT_TRUE(pubsub.wait_unread(5));
+
+    std::vector<void*> loaned;
+    SampleInfo_t info;
+    for (uint16_t i = 1; i <= 5; ++i)
+    {
+        void* sample = nullptr;
+        ASSERT_TRUE(pubsub.subscriber_->take_loan(&sample, &info));
+        ASSERT_NE(sample, nullptr);
+        ASSERT_EQ(info.sampleKind, ALIVE);
+        ASSERT_EQ(static_cast<FixedSized*>(sample)->index(), i);
+        loaned.push_back(sample);
+    }
+
+    // Loaned samples are still valid while other samples are taken.
+    for (size_t i = 0; i < loaned.size(); ++i)
+    {
+        ASSERT_EQ(static_cast<FixedSized*>(loaned[i])->index(), i + 1);
+    }
+
+    void* sample = nullptr;
+    ASSERT_FALSE(pubsub.subscriber_->take_loan(&sample, &info));
+
+    for (void* loan : loaned)
+    {
+        ASSERT_TRUE(pubsub.subscriber_->return_loan(loan));
+    }
+    ASSERT_FALSE(pubsub.subscriber_->return_loan(loaned.front()));
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableLoanFallsBackToCopy)
+{
+    SwappedFixedSizedType writer_type;
+    FixedSizedType reader_type;
+    LoanPubSub pubsub(TEST_TOPIC_NAME, &writer_type, &reader_type);
+
+    ASSERT_NE(pubsub.publisher_, nullptr);
+    ASSERT_NE(pubsub.subscriber_, nullptr);
+    ASSERT_TRUE(pubsub.wait_discovery());
+
+    // The publisher type is not plain.
+    ASSERT_EQ(pubsub.publisher_->loan_sample(), nullptr);
+
+    for (uint16_t i = 1; i <= 5; ++i)
+    {
+        FixedSized data;
+        data.index(i);
+        ASSERT_TRUE(pubsub.publisher_->write(&data));
+    }
+
+    ASSERT_TRUE(pubsub.wait_unread(5));
+
+    // Samples with another endianness are deserialized into a copy instead of being discarded.
+    SampleInfo_t info;
+    for (uint16_t i = 1; i <= 5; ++i)
+    {
+        void* sample = nullptr;
+        ASSERT_TRUE(pubsub.subscriber_->take_loan(&sample, &info));
+        ASSERT_NE(sample, nullptr);
+        ASSERT_EQ(static_cast<FixedSized*>(sample)->index(), i);
+        ASSERT_TRUE(pubsub.subscriber_->return_loan(sample));
+    }
+
+    void* sample = nullptr;
+    ASSERT_FALSE(pubsub.subscriber_->take_loan(&sample, &info));
+}
+
 BLACKBOXTEST(BlackBox, ReqRepAsReliableHelloworld)
 {
     ReqRepAsReliableHelloWorldRequester requester;
@@ -39,6 +39,7 @@
 #include <list>
 #include <map>
 #include <condition_variable>
+#include <thread>
 #include <asio.hpp>
 #include <gtest/gtest.h>
 
@@ -355,6 +355,32 @@ class PubSubWriterReader
         return *this;
     }
 
+    PubSubWriterReader& intraprocess_delivery(bool enabled)
+    {
+        participant_attr_.rtps.useIntraprocessDelivery = enabled;
+        return *this;
+    }
+
+    PubSubWriterReader& reliability(const eprosima::fastrtps::ReliabilityQosPolicyKind kind)
+    {
+        publisher_attr_.qos.m_reliability.kind = kind;
+        subscriber_attr_.qos.m_reliability.kind = kind;
+        return *this;
+    }
+
+    PubSubWriterReader& history_depth(const int32_t depth)
+    {
+        publisher_attr_.topic.historyQos.depth = depth;
+        subscriber_attr_.topic.historyQos.depth = depth;
+        return *this;
+    }
+
+    PubSubWriterReader& asynchronously(const eprosima::fastrtps::PublishModeQosPolicyKind kind)
+    {
+        publisher_attr_.qos.m_publishMode.kind = kind;
+        return *this;
+    }
+
     private:
 
     void receive_one(eprosima::fastrtps::Subscriber* subscriber, bool& returnedValue)
@@ -31,12 +31,9 @@ Data1mbType::Data1mbType() {
     setName("Data1mb");
     m_typeSize = (uint32_t)Data1mb::getMaxCdrSerializedSize() + 4 /*encapsulation*/;
     m_isGetKeyDefined = Data1mb::isKeyDefined();
-    m_keyBuffer = (unsigned char*)malloc(Data1mb::getKeyMaxCdrSerializedSize()>16 ? Data1mb::getKeyMaxCdrSerializedSize() : 16);
 }
 
 Data1mbType::~Data1mbType() {
-    if(m_keyBuffer!=nullptr)
-        free(m_keyBuffer);
 }
 
 bool Data1mbType::serialize(void *data, SerializedPayload_t *payload) {
@@ -83,22 +80,13 @@ bool Data1mbType::getKey(void *data, InstanceHandle_t* handle, bool force_md5) {
     if(!m_isGetKeyDefined)
         return false;
     Data1mb* p_type = (Data1mb*) data;
-    eprosima::fastcdr::FastBuffer fastbuffer((char*)m_keyBuffer,Data1mb::getKeyMaxCdrSerializedSize()); 	// Object that manages the raw buffer.
+    size_t keyLength = Data1mb::getKeyMaxCdrSerializedSize();
+    char stackBuffer[keyStackBufferSize];
+    char* keyBuffer = keyLength > keyStackBufferSize ? getThreadKeyBuffer(keyLength) : stackBuffer;
+    eprosima::fastcdr::FastBuffer fastbuffer(keyBuffer, keyLength); 	// Object that manages the raw buffer.
     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS); 	// Object that serializes the data.
     p_type->serializeKey(ser);
-    if(force_md5 || Data1mb::getKeyMaxCdrSerializedSize()>16)	{
-        m_md5.init();
-        m_md5.update(m_keyBuffer,(unsigned int)ser.getSerializedDataLength());
-        m_md5.finalize();
-        for(uint8_t i = 0;i<16;++i)    	{
-            handle->value[i] = m_md5.digest[i];
-        }
-    }
-    else    {
-        for(uint8_t i = 0;i<16;++i)    	{
-            handle->value[i] = m_keyBuffer[i];
-        }
-    }
+    getKeyHash(keyBuffer, ser.getSerializedDataLength(), keyLength, force_md5, handle);
     return true;
 }
 
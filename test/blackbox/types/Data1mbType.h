@@ -47,8 +47,6 @@ public:
 	std::function<uint32_t()> getSerializedSizeProvider(void *data);
 	void* createData();
 	void deleteData(void * data);
-	MD5 m_md5;
-	unsigned char* m_keyBuffer;
 };
 
 #endif // _DATA1MBTYPE_H_
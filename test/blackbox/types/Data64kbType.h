@@ -45,8 +45,6 @@ public:
 	void* createData();
 	std::function<uint32_t()> getSerializedSizeProvider(void *data);
 	void deleteData(void * data);
-	MD5 m_md5;
-	unsigned char* m_keyBuffer;
 };
 
 #endif // _Data64kb_TYPE_H_
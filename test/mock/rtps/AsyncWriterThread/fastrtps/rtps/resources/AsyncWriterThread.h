@@ -19,6 +19,9 @@
 #ifndef _RTPS_RESOURCES_ASYNCWRITERTHREAD_H_
 #define _RTPS_RESOURCES_ASYNCWRITERTHREAD_H_
 
+#include <atomic>
+#include <cstdint>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -30,9 +33,16 @@ class AsyncWriterThread
 {
     public:
 
-        static void wakeUp(const RTPSParticipantImpl*) {}
+        static void wakeUp(const RTPSParticipantImpl*) { ++wakeUpCount(); }
+
+        static void wakeUp(const RTPSWriter*) { ++wakeUpCount(); }
 
-        static void wakeUp(const RTPSWriter*) {}
+        //! Number of times any writer or participant was woken up.
+        static std::atomic<uint32_t>& wakeUpCount()
+        {
+            static std::atomic<uint32_t> count(0);
+            return count;
+        }
 };
 
 } // namespace rtps
@@ -112,6 +112,17 @@ class DurabilityQosPolicy : private Parameter_t, public QosPolicy
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 /**
@@ -133,6 +144,17 @@ class DeadlineQosPolicy : private Parameter_t, public QosPolicy {
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 /**
@@ -154,6 +176,17 @@ class LatencyBudgetQosPolicy : private Parameter_t, public QosPolicy {
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 /**
@@ -192,6 +225,17 @@ class LivelinessQosPolicy : private Parameter_t, public QosPolicy {
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 /**
@@ -227,6 +271,17 @@ class ReliabilityQosPolicy : private Parameter_t, public QosPolicy
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 
@@ -258,6 +313,17 @@ class OwnershipQosPolicy : private Parameter_t, public QosPolicy {
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 /**
@@ -290,6 +356,17 @@ class DestinationOrderQosPolicy : private Parameter_t, public QosPolicy {
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 
@@ -312,6 +389,17 @@ class UserDataQosPolicy : private Parameter_t, public QosPolicy{
 		return true;
 	}
 
+    /**
+     * Reads QoS from the specified CDR message.
+     * @param msg Message from where the QoS Policy has to be taken.
+     * @param size Size of the QoS Policy field to read
+     * @return True if the parameter was correctly taken.
+     */
+    bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+	{
+		return true;
+	}
+
     /**
      * Returns raw data vector.
      * @return raw data as vector of octets.
@@ -348,6 +436,17 @@ class TimeBasedFilterQosPolicy : private Parameter_t, public QosPolicy {
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 /**
@@ -388,6 +487,17 @@ class PresentationQosPolicy : private Parameter_t, public QosPolicy
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 
@@ -411,6 +521,17 @@ class  PartitionQosPolicy : private Parameter_t, public QosPolicy
 		return true;
 	}
 
+    /**
+     * Reads QoS from the specified CDR message.
+     * @param msg Message from where the QoS Policy has to be taken.
+     * @param size Size of the QoS Policy field to read
+     * @return True if the parameter was correctly taken.
+     */
+    bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+	{
+		return true;
+	}
+
     /**
      * Appends a name to the list of partition names.
      * @param name Name to append.
@@ -456,6 +577,17 @@ class  TopicDataQosPolicy : private Parameter_t, public QosPolicy
 		return true;
 	}
 
+    /**
+     * Reads QoS from the specified CDR message.
+     * @param msg Message from where the QoS Policy has to be taken.
+     * @param size Size of the QoS Policy field to read
+     * @return True if the parameter was correctly taken.
+     */
+    bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+	{
+		return true;
+	}
+
     /**
      * Appends topic data.
      * @param oc Data octet.
@@ -500,6 +632,17 @@ class  GroupDataQosPolicy : private Parameter_t, public QosPolicy
 		return true;
 	}
 
+    /**
+     * Reads QoS from the specified CDR message.
+     * @param msg Message from where the QoS Policy has to be taken.
+     * @param size Size of the QoS Policy field to read
+     * @return True if the parameter was correctly taken.
+     */
+    bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+	{
+		return true;
+	}
+
     /**
      * Appends group data.
      * @param oc Data octet.
@@ -554,6 +697,17 @@ class HistoryQosPolicy : private Parameter_t, public QosPolicy {
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 /**
@@ -581,6 +735,17 @@ class ResourceLimitsQosPolicy : private Parameter_t, public QosPolicy {
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 
@@ -616,6 +781,17 @@ class DurabilityServiceQosPolicy : private Parameter_t, public QosPolicy {
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 /**
@@ -637,6 +813,17 @@ class LifespanQosPolicy : private Parameter_t, public QosPolicy {
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 /**
@@ -657,6 +844,17 @@ class OwnershipStrengthQosPolicy : private Parameter_t, public QosPolicy {
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 
@@ -680,6 +878,17 @@ class TransportPriorityQosPolicy : private Parameter_t , public QosPolicy{
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 /**
@@ -728,6 +937,17 @@ public:
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 enum TypeConsistencyKind : uint32_t
@@ -760,6 +980,17 @@ public:
 		{
 			return true;
 		}
+
+        /**
+         * Reads QoS from the specified CDR message.
+         * @param msg Message from where the QoS Policy has to be taken.
+         * @param size Size of the QoS Policy field to read
+         * @return True if the parameter was correctly taken.
+         */
+        bool readFromCDRMessage(rtps::CDRMessage_t* /*msg*/, uint32_t /*size*/)
+		{
+			return true;
+		}
 };
 
 /**
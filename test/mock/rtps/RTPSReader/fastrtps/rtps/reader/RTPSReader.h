@@ -45,12 +45,23 @@ class RTPSReader : public Endpoint
 
         MOCK_CONST_METHOD0(getGuid, const GUID_t&());
 
+        MOCK_METHOD1(acceptMsgDirectedTo, bool(EntityId_t&));
+
+        MOCK_METHOD1(acceptMsgFromWriter, bool(const GUID_t&));
+
         ReaderHistory* getHistory()
         {
             getHistory_mock();
             return history_;
         }
 
+        MOCK_METHOD2(change_removed_by_history_mock, bool(CacheChange_t*, WriterProxy*));
+
+        bool change_removed_by_history(CacheChange_t* change, WriterProxy* prox = nullptr)
+        {
+            return change_removed_by_history_mock(change, prox);
+        }
+
         ReaderHistory* history_;
 
         ReaderListener* listener_;
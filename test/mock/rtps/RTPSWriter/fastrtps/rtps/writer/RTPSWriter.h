@@ -23,6 +23,7 @@
 #include <fastrtps/rtps/Endpoint.h>
 #include <fastrtps/rtps/common/CacheChange.h>
 
+#include <atomic>
 #include <condition_variable>
 #include <gmock/gmock.h>
 
@@ -31,11 +32,16 @@ namespace fastrtps {
 namespace rtps {
 
 class WriterHistory;
+class AsyncWriterScheduler;
 
 class RTPSWriter : public Endpoint
 {
+    friend class AsyncWriterScheduler;
+
     public:
 
+        RTPSWriter() : async_scheduler_(nullptr), async_state_(0) {}
+
         virtual ~RTPSWriter() = default;
 
         virtual bool matched_reader_add(RemoteReaderAttributes& ratt) = 0;
@@ -47,7 +53,15 @@ class RTPSWriter : public Endpoint
 			
 		MOCK_METHOD1(set_separate_sending, void(bool));
 
+        virtual void send_any_unsent_changes() {}
+
         WriterHistory* history_;
+
+    private:
+
+        std::atomic<AsyncWriterScheduler*> async_scheduler_;
+
+        mutable std::atomic<uint32_t> async_state_;
 };
 
 } // namespace rtps
@@ -0,0 +1,55 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RemoteParticipantLeaseDuration.h
+ */
+
+#ifndef RTPSPARTICIPANTLEASEDURATION_H_
+#define RTPSPARTICIPANTLEASEDURATION_H_
+
+#include <fastrtps/rtps/common/Time_t.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class PDPSimple;
+class ParticipantProxyData;
+
+class RemoteParticipantLeaseDuration
+{
+    public:
+
+        RemoteParticipantLeaseDuration(PDPSimple* p_SPDP, ParticipantProxyData* pdata, double /*interval*/)
+            : mp_PDP(p_SPDP), mp_participantProxyData(pdata) {}
+
+        virtual ~RemoteParticipantLeaseDuration() {}
+
+        void cancel_timer() {}
+
+        bool update_interval(const Duration_t& /*interval*/) { return true; }
+
+        void restart_timer() {}
+
+        PDPSimple* mp_PDP;
+
+        ParticipantProxyData* mp_participantProxyData;
+};
+
+} //namespace rtps
+} //namespace fastrtps
+} //namespace eprosima
+
+#endif // RTPSPARTICIPANTLEASEDURATION_H_
@@ -0,0 +1,240 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryParsingBenchmark.cpp
+ * Measures the CPU cost of parsing the discovery data of a discovery storm: the DATA(p) of every participant and the
+ * DATA(w) and DATA(r) of all their endpoints. Each message is parsed both into a ParameterList_t, as it was done
+ * before decoding the proxy data directly, and into the proxy data. The heap allocations of both are also counted.
+ */
+
+#include <fastrtps/rtps/builtin/data/ParticipantProxyData.h>
+#include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
+#include <fastrtps/rtps/builtin/data/WriterProxyData.h>
+#include <fastrtps/qos/ParameterList.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+static std::atomic<uint64_t> g_allocations(0);
+
+void* operator new(size_t size)
+{
+    ++g_allocations;
+    void* p = malloc(size ? size : 1);
+    if(p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+static Locator_t make_locator(uint32_t host, uint32_t port)
+{
+    Locator_t locator;
+    locator.kind = LOCATOR_KIND_UDPv4;
+    locator.port = port;
+    IPLocator::setIPv4(locator, 192, 168, static_cast<octet>(host >> 8), static_cast<octet>(host));
+    return locator;
+}
+
+static GUID_t make_guid(uint32_t participant, uint32_t entity, octet kind)
+{
+    GUID_t guid;
+    guid.guidPrefix.value[0] = 0x01;
+    guid.guidPrefix.value[1] = 0x0f;
+    memcpy(&guid.guidPrefix.value[4], &participant, sizeof(participant));
+    guid.entityId.value[0] = static_cast<octet>(entity >> 16);
+    guid.entityId.value[1] = static_cast<octet>(entity >> 8);
+    guid.entityId.value[2] = static_cast<octet>(entity);
+    guid.entityId.value[3] = kind;
+    return guid;
+}
+
+static CDRMessage_t serialize(ParameterList_t& parameter_list)
+{
+    CDRMessage_t msg(RTPSMESSAGE_DEFAULT_SIZE);
+    ParameterList::writeParameterListToCDRMsg(&msg, &parameter_list, true);
+    return msg;
+}
+
+struct Storm
+{
+    std::vector<CDRMessage_t> participants;
+    std::vector<CDRMessage_t> writers;
+    std::vector<CDRMessage_t> readers;
+};
+
+static void generate(Storm& storm, uint32_t participants, uint32_t endpoints)
+{
+    for(uint32_t p = 0; p < participants; ++p)
+    {
+        ParticipantProxyData participant;
+        participant.m_guid = make_guid(p, 0x000001, 0xc1);
+        participant.m_key = participant.m_guid;
+        participant.m_participantName = "storm_participant_" + std::to_string(p);
+        participant.m_availableBuiltinEndpoints = 0x3f;
+        participant.m_metatrafficUnicastLocatorList.push_back(make_locator(p, 7410));
+        participant.m_metatrafficMulticastLocatorList.push_back(make_locator(0xefff, 7400));
+        participant.m_defaultUnicastLocatorList.push_back(make_locator(p, 7411));
+        participant.m_leaseDuration = Duration_t(20, 0);
+        ParameterList_t parameter_list = participant.AllQostoParameterList();
+        storm.participants.push_back(serialize(parameter_list));
+
+        for(uint32_t e = 0; e < endpoints; ++e)
+        {
+            std::string topic = "storm_topic_" + std::to_string(e % 100);
+            if(e % 2 == 0)
+            {
+                WriterProxyData writer;
+                writer.guid(make_guid(p, e, 0x02));
+                writer.key() = writer.guid();
+                writer.RTPSParticipantKey() = participant.m_guid;
+                writer.topicName(topic);
+                writer.typeName("StormType");
+                writer.unicastLocatorList().push_back(make_locator(p, 7411));
+                writer.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+                writer.m_qos.m_durability.kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+                ParameterList_t writer_list = writer.toParameterList();
+                storm.writers.push_back(serialize(writer_list));
+            }
+            else
+            {
+                ReaderProxyData reader;
+                reader.guid(make_guid(p, e, 0x07));
+                reader.key() = reader.guid();
+                reader.RTPSParticipantKey() = participant.m_guid;
+                reader.topicName(topic);
+                reader.typeName("StormType");
+                reader.unicastLocatorList().push_back(make_locator(p, 7411));
+                reader.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+                ParameterList_t reader_list = reader.toParameterList();
+                storm.readers.push_back(serialize(reader_list));
+            }
+        }
+    }
+}
+
+//! Parses the messages into a ParameterList_t, without loading the proxy data.
+static bool parse_list(std::vector<CDRMessage_t>& messages)
+{
+    bool ok = true;
+    for(CDRMessage_t& msg : messages)
+    {
+        msg.pos = 0;
+        ParameterList_t parameter_list;
+        ok &= ParameterList::readParameterListfromCDRMsg(&msg, &parameter_list, nullptr, true) > 0;
+    }
+    return ok;
+}
+
+//! Parses the messages into a proxy data object, reused as the discovery listeners reuse theirs.
+template<typename ProxyData, typename Reader>
+static bool parse_proxy(std::vector<CDRMessage_t>& messages, ProxyData& data, Reader read)
+{
+    bool ok = true;
+    for(CDRMessage_t& msg : messages)
+    {
+        msg.pos = 0;
+        data.clear();
+        ok &= read(data, msg);
+    }
+    return ok;
+}
+
+template<typename Functor>
+static void measure(const char* name, size_t messages, uint32_t rounds, Functor f)
+{
+    bool ok = true;
+    uint64_t allocations = g_allocations.load();
+    auto start = std::chrono::steady_clock::now();
+    for(uint32_t r = 0; r < rounds; ++r)
+    {
+        ok &= f();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    allocations = g_allocations.load() - allocations;
+
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    uint64_t parsed = static_cast<uint64_t>(messages) * rounds;
+    std::cout << name << "\t" << messages << "\t" << ns / rounds / 1000 << "\t" << ns / parsed << "\t" <<
+        static_cast<double>(allocations) / parsed << (ok ? "" : "\tERROR") << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t participants = argc > 1 ? static_cast<uint32_t>(atoi(argv[1])) : 500;
+    uint32_t endpoints = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 50;
+    uint32_t rounds = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 10;
+
+    Storm storm;
+    generate(storm, participants, endpoints);
+
+    ParticipantProxyData participant;
+    WriterProxyData writer;
+    ReaderProxyData reader;
+
+    std::cout << "Test\tMessages\tus/storm\tns/message\tallocations/message" << std::endl;
+
+    measure("DATA(p) list", storm.participants.size(), rounds, [&]()
+    {
+        return parse_list(storm.participants);
+    });
+    measure("DATA(p) proxy", storm.participants.size(), rounds, [&]()
+    {
+        return parse_proxy(storm.participants, participant, [](ParticipantProxyData& data, CDRMessage_t& msg)
+        {
+            return data.readFromCDRMessage(&msg);
+        });
+    });
+    measure("DATA(w) list", storm.writers.size(), rounds, [&]()
+    {
+        return parse_list(storm.writers);
+    });
+    measure("DATA(w) proxy", storm.writers.size(), rounds, [&]()
+    {
+        return parse_proxy(storm.writers, writer, [](WriterProxyData& data, CDRMessage_t& msg)
+        {
+            return data.readFromCDRMessage(&msg);
+        });
+    });
+    measure("DATA(r) list", storm.readers.size(), rounds, [&]()
+    {
+        return parse_list(storm.readers);
+    });
+    measure("DATA(r) proxy", storm.readers.size(), rounds, [&]()
+    {
+        return parse_proxy(storm.readers, reader, [](ReaderProxyData& data, CDRMessage_t& msg)
+        {
+            return data.readFromCDRMessage(&msg);
+        });
+    });
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FlowControllerBenchmark.cpp
+ * Measures the overhead of the throughput controllers as the rate of sent fragments grows.
+ * Fragments are offered every millisecond at the configured rate, and the controller allows exactly that rate.
+ * The time spent in the controller and the CPU time of the whole process, which includes the thread of the
+ * controllers, are reported per fragment.
+ */
+
+#include <rtps/flowcontrol/ThroughputController.h>
+#include <rtps/flowcontrol/TokenBucketController.h>
+#include <fastrtps/rtps/writer/ReaderLocator.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+static const uint32_t s_fragment_size = 1000;
+
+static void run(const char* name, FlowController& controller, uint32_t fragments_per_ms, uint32_t milliseconds)
+{
+    CacheChange_t change(fragments_per_ms * s_fragment_size);
+    change.sequenceNumber = {0, 1};
+    change.serializedPayload.length = fragments_per_ms * s_fragment_size;
+    change.setFragmentSize(s_fragment_size);
+
+    DynamicBitmap fragments(fragments_per_ms, true);
+
+    ReaderLocator locator;
+    RTPSWriterCollector<ReaderLocator*> collector;
+    std::chrono::steady_clock::duration in_controller(0);
+    uint64_t offered = 0;
+    uint64_t cleared = 0;
+
+    std::clock_t cpu_start = std::clock();
+    auto next = std::chrono::steady_clock::now();
+    for(uint32_t ms = 0; ms < milliseconds; ++ms)
+    {
+        collector.clear();
+        collector.add_change(&change, &locator, fragments);
+        offered += collector.size();
+
+        auto start = std::chrono::steady_clock::now();
+        controller(collector);
+        in_controller += std::chrono::steady_clock::now() - start;
+        cleared += collector.size();
+
+        next += std::chrono::milliseconds(1);
+        std::this_thread::sleep_until(next);
+    }
+    std::clock_t cpu_elapsed = std::clock() - cpu_start;
+
+    uint64_t ns_in_controller = std::chrono::duration_cast<std::chrono::nanoseconds>(in_controller).count();
+    uint64_t cpu_ns = static_cast<uint64_t>(cpu_elapsed) * 1000000000ull / CLOCKS_PER_SEC;
+
+    std::cout << name << "\t" << fragments_per_ms * 1000 << "\t" << offered << "\t" << cleared << "\t" <<
+        (cleared ? ns_in_controller / cleared : 0) << "\t" << (cleared ? cpu_ns / cleared : 0) << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t milliseconds = argc > 1 ? static_cast<uint32_t>(atoi(argv[1])) : 2000;
+    const uint32_t rates[] = {1, 10, 100, 1000};
+
+    std::cout << "Controller\tFragments/s\tOffered\tCleared\tns/fragment\tCPU ns/fragment" << std::endl;
+
+    for(uint32_t fragments_per_ms : rates)
+    {
+        // The controllers allow the offered rate, with a bucket of a few milliseconds.
+        uint32_t bytes_per_period = fragments_per_ms * s_fragment_size * 10;
+
+        {
+            ThroughputControllerDescriptor descriptor(bytes_per_period, 10);
+            ThroughputController controller(descriptor, static_cast<const RTPSWriter*>(nullptr));
+            run("Periodic", controller, fragments_per_ms, milliseconds);
+        }
+
+        {
+            ThroughputControllerDescriptor descriptor(bytes_per_period, 10, TOKEN_BUCKET_THROUGHPUT_CONTROLLER);
+            TokenBucketController controller(descriptor, static_cast<const RTPSWriter*>(nullptr));
+            run("TokenBucket", controller, fragments_per_ms, milliseconds);
+        }
+    }
+
+    return 0;
+}
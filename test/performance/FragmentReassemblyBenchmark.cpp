@@ -0,0 +1,177 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FragmentReassemblyBenchmark.cpp
+ * Measures the cost of reassembling large samples in a best effort reader. Each fragment is given to the reader
+ * as the message receiver does with a DATA_FRAG submessage, in order and in reverse order.
+ * It also measures the cost of tracking the fragments of a large sample that are pending to be sent to a reader.
+ */
+
+#include <fastrtps/rtps/RTPSDomain.h>
+#include <fastrtps/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastrtps/rtps/attributes/ReaderAttributes.h>
+#include <fastrtps/rtps/attributes/HistoryAttributes.h>
+#include <fastrtps/rtps/participant/RTPSParticipant.h>
+#include <fastrtps/rtps/reader/RTPSReader.h>
+#include <fastrtps/rtps/reader/ReaderListener.h>
+#include <fastrtps/rtps/history/ReaderHistory.h>
+#include <fastrtps/rtps/common/CacheChange.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+//! Counts the completed samples and returns them to the history.
+class CompletedListener : public ReaderListener
+{
+    public:
+
+        CompletedListener() : completed(0) {}
+
+        void onNewCacheChangeAdded(RTPSReader* reader, const CacheChange_t* const change) override
+        {
+            reader->getHistory()->remove_change(const_cast<CacheChange_t*>(change));
+            ++completed;
+        }
+
+        uint32_t completed;
+};
+
+static void reassemble(const char* name, RTPSReader* reader, const std::vector<octet>& sample,
+        uint16_t fragment_size, uint32_t samples, bool reverse, SequenceNumber_t& sequence_number)
+{
+    uint32_t sample_size = static_cast<uint32_t>(sample.size());
+    uint32_t fragments = (sample_size + fragment_size - 1) / fragment_size;
+
+    CacheChange_t incoming;
+    incoming.serializedPayload.max_size = fragment_size;
+    incoming.writerGUID.guidPrefix.value[0] = 1;
+    incoming.writerGUID.entityId = c_EntityId_Unknown;
+    incoming.writerGUID.entityId.value[3] = 0x03;
+
+    auto start = std::chrono::steady_clock::now();
+    for(uint32_t s = 0; s < samples; ++s)
+    {
+        ++sequence_number;
+        incoming.sequenceNumber = sequence_number;
+
+        for(uint32_t i = 0; i < fragments; ++i)
+        {
+            uint32_t index = reverse ? fragments - 1 - i : i;
+            uint32_t offset = index * fragment_size;
+            uint32_t length = sample_size - offset < fragment_size ? sample_size - offset : fragment_size;
+
+            incoming.serializedPayload.data = const_cast<octet*>(sample.data()) + offset;
+            incoming.serializedPayload.length = length;
+            incoming.setFragmentSize(fragment_size);
+            incoming.getDataFragments().assign(1, true);
+
+            reader->processDataFragMsg(&incoming, sample_size, index + 1);
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    incoming.serializedPayload.data = nullptr;
+
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    uint64_t total_fragments = static_cast<uint64_t>(fragments) * samples;
+    std::cout << name << "\t" << sample_size << "\t" << fragments << "\t" << samples << "\t" <<
+        ns / samples / 1000 << "\t" << ns / total_fragments << "\t" <<
+        (static_cast<uint64_t>(sample_size) * samples * 1000) / (ns ? ns : 1) << std::endl;
+}
+
+static void track_unsent(uint32_t sample_size, uint16_t fragment_size, uint32_t samples)
+{
+    CacheChange_t change(sample_size);
+    change.serializedPayload.length = sample_size;
+    change.setFragmentSize(fragment_size);
+    uint32_t fragments = change.getFragmentCount();
+
+    uint32_t completed = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(uint32_t s = 0; s < samples; ++s)
+    {
+        ChangeForReader_t for_reader(&change);
+        for(FragmentNumber_t fragment = 1; fragment <= fragments; ++fragment)
+        {
+            for_reader.markFragmentsAsSent(fragment);
+            if(for_reader.getUnsentFragments().none())
+            {
+                ++completed;
+            }
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    uint64_t total_fragments = static_cast<uint64_t>(fragments) * samples;
+    std::cout << "UnsentTracking\t" << sample_size << "\t" << fragments << "\t" << completed << "\t" <<
+        ns / samples / 1000 << "\t" << ns / total_fragments << "\t-" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t sample_size = argc > 1 ? static_cast<uint32_t>(atoi(argv[1])) : 16 * 1024 * 1024;
+    uint16_t fragment_size = argc > 2 ? static_cast<uint16_t>(atoi(argv[2])) : 1400;
+    uint32_t samples = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 20;
+
+    RTPSParticipantAttributes participant_attributes;
+    participant_attributes.builtin.use_SIMPLE_RTPSParticipantDiscoveryProtocol = false;
+    participant_attributes.builtin.use_WriterLivelinessProtocol = false;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(participant_attributes);
+    if(participant == nullptr)
+    {
+        std::cout << "Error creating the participant" << std::endl;
+        return 1;
+    }
+
+    HistoryAttributes history_attributes(PREALLOCATED_MEMORY_MODE, sample_size, 2, 0);
+    ReaderHistory history(history_attributes);
+    ReaderAttributes reader_attributes;
+    CompletedListener listener;
+    RTPSReader* reader = RTPSDomain::createRTPSReader(participant, reader_attributes, &history, &listener);
+    if(reader == nullptr)
+    {
+        std::cout << "Error creating the reader" << std::endl;
+        RTPSDomain::removeRTPSParticipant(participant);
+        return 1;
+    }
+
+    std::vector<octet> sample(sample_size);
+    for(uint32_t i = 0; i < sample_size; ++i)
+    {
+        sample[i] = static_cast<octet>(i);
+    }
+
+    std::cout << "Test\tSample size\tFragments\tSamples\tus/sample\tns/fragment\tMB/s" << std::endl;
+
+    SequenceNumber_t sequence_number;
+    reassemble("InOrder", reader, sample, fragment_size, samples, false, sequence_number);
+    reassemble("Reverse", reader, sample, fragment_size, samples, true, sequence_number);
+    track_unsent(sample_size, fragment_size, samples);
+
+    int result = listener.completed == 2 * samples ? 0 : 1;
+    if(result != 0)
+    {
+        std::cout << "Only " << listener.completed << " samples were completed" << std::endl;
+    }
+
+    RTPSDomain::removeRTPSReader(reader);
+    RTPSDomain::removeRTPSParticipant(participant);
+    return result;
+}
@@ -0,0 +1,214 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file KeyedHistoryBenchmark.cpp
+ * Measures the cost of writing a keyed sample as the number of instances grows. The subscriber lives in the
+ * same participant, so each write also goes through the keyed history of the subscriber.
+ */
+
+#include <fastrtps/Domain.h>
+#include <fastrtps/TopicDataType.h>
+#include <fastrtps/attributes/ParticipantAttributes.h>
+#include <fastrtps/attributes/PublisherAttributes.h>
+#include <fastrtps/attributes/SubscriberAttributes.h>
+#include <fastrtps/participant/Participant.h>
+#include <fastrtps/publisher/Publisher.h>
+#include <fastrtps/subscriber/Subscriber.h>
+#include <fastrtps/subscriber/SubscriberListener.h>
+#include <fastrtps/rtps/common/MatchingInfo.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+struct KeyedSample
+{
+    uint32_t key;
+    uint8_t data[60];
+};
+
+class KeyedSampleType : public TopicDataType
+{
+    public:
+
+        KeyedSampleType()
+        {
+            setName("KeyedSample");
+            m_typeSize = static_cast<uint32_t>(sizeof(KeyedSample)) + 4;
+            m_isGetKeyDefined = true;
+        }
+
+        bool serialize(void* data, SerializedPayload_t* payload) override
+        {
+            payload->data[0] = 0;
+            payload->data[1] = DEFAULT_ENDIAN == BIGEND ? CDR_BE : CDR_LE;
+            payload->data[2] = 0;
+            payload->data[3] = 0;
+            memcpy(payload->data + 4, data, sizeof(KeyedSample));
+            payload->length = m_typeSize;
+            return true;
+        }
+
+        bool deserialize(SerializedPayload_t* payload, void* data) override
+        {
+            memcpy(data, payload->data + 4, sizeof(KeyedSample));
+            return true;
+        }
+
+        std::function<uint32_t()> getSerializedSizeProvider(void*) override
+        {
+            uint32_t size = m_typeSize;
+            return [size]() { return size; };
+        }
+
+        void* createData() override { return new KeyedSample(); }
+
+        void deleteData(void* data) override { delete static_cast<KeyedSample*>(data); }
+
+        bool getKey(void* data, InstanceHandle_t* ihandle, bool) override
+        {
+            *ihandle = c_InstanceHandle_Unknown;
+            memcpy(ihandle->value, &static_cast<KeyedSample*>(data)->key, sizeof(uint32_t));
+            return true;
+        }
+};
+
+class MatchListener : public SubscriberListener
+{
+    public:
+
+        MatchListener() : matched_(false) {}
+
+        void onSubscriptionMatched(Subscriber*, MatchingInfo& info) override
+        {
+            if(info.status == MATCHED_MATCHING)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                matched_ = true;
+                cv_.notify_all();
+            }
+        }
+
+        bool wait_match()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            return cv_.wait_for(lock, std::chrono::seconds(10), [this]() { return matched_; });
+        }
+
+    private:
+
+        std::mutex mutex_;
+
+        std::condition_variable cv_;
+
+        bool matched_;
+};
+
+static void set_topic(TopicAttributes& topic, uint32_t instances)
+{
+    topic.topicKind = WITH_KEY;
+    topic.topicName = "KeyedHistoryBenchmark_" + std::to_string(instances);
+    topic.topicDataType = "KeyedSample";
+    topic.historyQos.kind = KEEP_LAST_HISTORY_QOS;
+    topic.historyQos.depth = 1;
+    topic.resourceLimitsQos.max_instances = static_cast<int32_t>(instances);
+    topic.resourceLimitsQos.max_samples_per_instance = 1;
+    topic.resourceLimitsQos.max_samples = static_cast<int32_t>(instances);
+    topic.resourceLimitsQos.allocated_samples = static_cast<int32_t>(instances);
+}
+
+static bool run(Participant* participant, uint32_t instances, uint32_t samples)
+{
+    PublisherAttributes pub_att;
+    set_topic(pub_att.topic, instances);
+    pub_att.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+    Publisher* publisher = Domain::createPublisher(participant, pub_att);
+
+    SubscriberAttributes sub_att;
+    set_topic(sub_att.topic, instances);
+    sub_att.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+    MatchListener listener;
+    Subscriber* subscriber = Domain::createSubscriber(participant, sub_att, &listener);
+
+    if(publisher == nullptr || subscriber == nullptr || !listener.wait_match())
+    {
+        std::cout << "Error creating the endpoints for " << instances << " instances" << std::endl;
+        return false;
+    }
+
+    KeyedSample sample;
+    memset(&sample, 0, sizeof(sample));
+
+    // Create all the instances before measuring.
+    for(uint32_t i = 0; i < instances; ++i)
+    {
+        sample.key = i;
+        publisher->write(&sample);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for(uint32_t i = 0; i < samples; ++i)
+    {
+        sample.key = i % instances;
+        publisher->write(&sample);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << instances << "\t" << samples << "\t" <<
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / samples << std::endl;
+
+    Domain::removeSubscriber(subscriber);
+    Domain::removePublisher(publisher);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t samples = argc > 1 ? static_cast<uint32_t>(atoi(argv[1])) : 200000;
+
+    ParticipantAttributes part_att;
+    part_att.rtps.setName("KeyedHistoryBenchmark");
+    Participant* participant = Domain::createParticipant(part_att);
+    if(participant == nullptr)
+    {
+        std::cout << "Error creating participant" << std::endl;
+        return 1;
+    }
+
+    KeyedSampleType type;
+    Domain::registerType(participant, &type);
+
+    std::cout << "Instances\tSamples\tns/sample" << std::endl;
+    const uint32_t instance_counts[] = {10, 100, 1000, 10000, 50000};
+    int result = 0;
+    for(uint32_t instances : instance_counts)
+    {
+        if(!run(participant, instances, samples))
+        {
+            result = 1;
+            break;
+        }
+    }
+
+    Domain::removeParticipant(participant);
+    return result;
+}
@@ -0,0 +1,109 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PersistenceBenchmark.cpp
+ * Measures the throughput of the SQLite3 persistence service when a writer stores and removes changes, as a
+ * transient writer does while its history rolls over. Every change is stored on its own transaction in the
+ * synchronous mode, and in grouped transactions in the write-behind mode. Both modes are measured with the default
+ * and the WAL journal modes.
+ */
+
+#include "rtps/persistence/PersistenceService.h"
+#include <fastrtps/rtps/attributes/PropertyPolicy.h>
+#include <fastrtps/rtps/common/CacheChange.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using namespace eprosima::fastrtps::rtps;
+
+static const char* const filename = "persistence_benchmark.db";
+
+static void remove_database()
+{
+    std::remove(filename);
+    std::remove((std::string(filename) + "-wal").c_str());
+    std::remove((std::string(filename) + "-shm").c_str());
+    std::remove((std::string(filename) + "-journal").c_str());
+}
+
+static void measure(const char* name, const char* journal_mode, bool write_behind, uint32_t num_changes,
+        uint32_t payload_size, uint32_t history_depth)
+{
+    remove_database();
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", filename);
+    policy.properties().emplace_back("dds.persistence.sqlite3.journal_mode", journal_mode);
+    policy.properties().emplace_back("dds.persistence.sqlite3.write_behind", write_behind ? "true" : "false");
+
+    IPersistenceService* service = PersistenceFactory::create_persistence_service(policy);
+    if (service == nullptr)
+    {
+        std::cout << name << "\tERROR" << std::endl;
+        return;
+    }
+
+    const std::string persistence_guid("BENCHMARK_WRITER");
+    CacheChange_t change;
+    change.kind = ALIVE;
+    change.writerGUID = GUID_t(GuidPrefix_t::unknown(), 1U);
+    change.serializedPayload.reserve(payload_size);
+    memset(change.serializedPayload.data, 0xAA, payload_size);
+    change.serializedPayload.length = payload_size;
+
+    bool ok = true;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 1; i <= num_changes; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ok &= service->add_writer_change_to_storage(persistence_guid, change);
+        if (i > history_depth)
+        {
+            change.sequenceNumber.low = i - history_depth;
+            ok &= service->remove_writer_change_from_storage(persistence_guid, change);
+        }
+    }
+    // Destroying the service waits for all queued modifications to be stored
+    delete service;
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    std::cout << name << "\t" << journal_mode << "\t" << num_changes << "\t" <<
+        static_cast<uint64_t>(num_changes / seconds) << (ok ? "" : "\tERROR") << std::endl;
+
+    remove_database();
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t num_changes = argc > 1 ? static_cast<uint32_t>(atoi(argv[1])) : 5000;
+    uint32_t payload_size = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 1024;
+    uint32_t history_depth = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 100;
+
+    std::cout << "Test\tJournal\tChanges\twrites/s" << std::endl;
+
+    measure("Synchronous", "DELETE", false, num_changes, payload_size, history_depth);
+    measure("Synchronous", "WAL", false, num_changes, payload_size, history_depth);
+    measure("Write-behind", "DELETE", true, num_changes, payload_size, history_depth);
+    measure("Write-behind", "WAL", true, num_changes, payload_size, history_depth);
+
+    return 0;
+}
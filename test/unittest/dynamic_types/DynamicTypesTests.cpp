@@ -30,6 +30,9 @@
 #include "idl/BasicPubSubTypes.h"
 #include <tinyxml2.h>
 
+#include <atomic>
+#include <thread>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::types;
 
@@ -3511,6 +3514,341 @@ TEST_F(DynamicTypesTests, DynamicType_multi_structure_unit_tests)
     ASSERT_TRUE(DynamicDataFactory::GetInstance()->IsEmpty());
 }
 
+TEST_F(DynamicTypesTests, DynamicType_flat_structure_unit_tests)
+{
+    {
+        DynamicTypeBuilderFactory::GetInstance()->SetFlatLayoutEnabled(true);
+
+        DynamicTypeBuilder_ptr base_type_builder = DynamicTypeBuilderFactory::GetInstance()->CreateInt32Builder();
+        ASSERT_TRUE(base_type_builder != nullptr);
+        auto base_type = base_type_builder->Build();
+
+        DynamicTypeBuilder_ptr base_type_builder2 = DynamicTypeBuilderFactory::GetInstance()->CreateInt64Builder();
+        ASSERT_TRUE(base_type_builder2 != nullptr);
+        auto base_type2 = base_type_builder2->Build();
+
+        DynamicTypeBuilder_ptr struct_type_builder = DynamicTypeBuilderFactory::GetInstance()->CreateStructBuilder();
+        ASSERT_TRUE(struct_type_builder != nullptr);
+
+        // Add members to the struct.
+        ASSERT_TRUE(struct_type_builder->AddMember(0, "int32", base_type) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(struct_type_builder->AddMember(1, "int64", base_type2) == ResponseCode::RETCODE_OK);
+
+        auto struct_type = struct_type_builder->Build();
+        ASSERT_TRUE(struct_type != nullptr);
+        ASSERT_TRUE(struct_type->GetLayout() != nullptr);
+
+        // Create the parent struct.
+        DynamicTypeBuilder_ptr parent_struct_type_builder = DynamicTypeBuilderFactory::GetInstance()->CreateStructBuilder();
+        ASSERT_TRUE(parent_struct_type_builder != nullptr);
+
+        // Add members to the parent struct.
+        ASSERT_TRUE(parent_struct_type_builder->AddMember(0, "child_struct", struct_type) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(parent_struct_type_builder->AddMember(1, "child_int64", base_type2) == ResponseCode::RETCODE_OK);
+
+        auto parent_struct_type = parent_struct_type_builder->Build();
+        ASSERT_TRUE(parent_struct_type != nullptr);
+        ASSERT_TRUE(parent_struct_type->GetLayout() != nullptr);
+
+        // Members that can't be stored inline keep the generic representation.
+        DynamicTypeBuilder_ptr string_struct_type_builder = DynamicTypeBuilderFactory::GetInstance()->CreateStructBuilder();
+        ASSERT_TRUE(string_struct_type_builder != nullptr);
+        ASSERT_TRUE(string_struct_type_builder->AddMember(0, "string",
+            DynamicTypeBuilderFactory::GetInstance()->CreateStringType()) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(string_struct_type_builder->ApplyAnnotation("@Key", "true") == ResponseCode::RETCODE_OK);
+        auto string_struct_type = string_struct_type_builder->Build();
+        ASSERT_TRUE(string_struct_type != nullptr);
+        ASSERT_TRUE(string_struct_type->GetLayout() == nullptr);
+
+        auto struct_data = DynamicDataFactory::GetInstance()->CreateData(parent_struct_type);
+        ASSERT_TRUE(struct_data != nullptr);
+        ASSERT_TRUE(struct_data->GetItemCount() == 2);
+        ASSERT_TRUE(struct_data->GetMemberIdByName("child_int64") == 1);
+
+        ASSERT_FALSE(struct_data->SetInt32Value(10, 1) == ResponseCode::RETCODE_OK);
+        ASSERT_FALSE(struct_data->SetInt64Value(10, 2) == ResponseCode::RETCODE_OK);
+        ASSERT_FALSE(struct_data->SetStringValue("", MEMBER_ID_INVALID) == ResponseCode::RETCODE_OK);
+
+        // Set and get the child values.
+        int64_t test1(234);
+        ASSERT_TRUE(struct_data->SetInt64Value(test1, 1) == ResponseCode::RETCODE_OK);
+        int64_t test2(0);
+        ASSERT_TRUE(struct_data->GetInt64Value(test2, 1) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(test1 == test2);
+
+        auto child_struct_data = struct_data->LoanValue(0);
+        ASSERT_TRUE(child_struct_data != nullptr);
+        ASSERT_TRUE(struct_data->LoanValue(0) == nullptr);
+
+        // Set and get the child values.
+        int32_t test3(234);
+        ASSERT_TRUE(child_struct_data->SetInt32Value(test3, 0) == ResponseCode::RETCODE_OK);
+        int32_t test4(0);
+        ASSERT_TRUE(child_struct_data->GetInt32Value(test4, 0) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(test3 == test4);
+        int64_t test5(234);
+        ASSERT_TRUE(child_struct_data->SetInt64Value(test5, 1) == ResponseCode::RETCODE_OK);
+        int64_t test6(0);
+        ASSERT_TRUE(child_struct_data->GetInt64Value(test6, 1) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(test5 == test6);
+
+        ASSERT_TRUE(struct_data->ReturnLoanedValue(child_struct_data) == ResponseCode::RETCODE_OK);
+        ASSERT_FALSE(struct_data->ReturnLoanedValue(child_struct_data) == ResponseCode::RETCODE_OK);
+
+        // The returned values are stored in the parent.
+        child_struct_data = struct_data->LoanValue(0);
+        ASSERT_TRUE(child_struct_data != nullptr);
+        ASSERT_TRUE(child_struct_data->GetInt32Value(0) == test3);
+        ASSERT_TRUE(child_struct_data->GetInt64Value(1) == test5);
+        ASSERT_TRUE(struct_data->ReturnLoanedValue(child_struct_data) == ResponseCode::RETCODE_OK);
+
+        // Serialize <-> Deserialize Test
+        DynamicPubSubType pubsubType(parent_struct_type);
+        uint32_t payloadSize = static_cast<uint32_t>(pubsubType.getSerializedSizeProvider(struct_data)());
+        SerializedPayload_t payload(payloadSize);
+        ASSERT_TRUE(pubsubType.serialize(struct_data, &payload));
+        ASSERT_TRUE(payload.length == payloadSize);
+
+        types::DynamicData* data2 = DynamicDataFactory::GetInstance()->CreateData(parent_struct_type);
+        ASSERT_TRUE(pubsubType.deserialize(&payload, data2));
+        ASSERT_TRUE(data2->Equals(struct_data));
+
+        // SERIALIZATION TEST
+        StructStructStruct seq;
+        StructStructStructPubSubType seqpb;
+
+        uint32_t payloadSize3 = static_cast<uint32_t>(pubsubType.getSerializedSizeProvider(struct_data)());
+        SerializedPayload_t dynamic_payload(payloadSize3);
+        ASSERT_TRUE(pubsubType.serialize(struct_data, &dynamic_payload));
+        ASSERT_TRUE(dynamic_payload.length == payloadSize3);
+        ASSERT_TRUE(seqpb.deserialize(&dynamic_payload, &seq));
+        ASSERT_TRUE(seq.child_int64() == test1);
+        ASSERT_TRUE(seq.child_struct().a() == test3);
+        ASSERT_TRUE(seq.child_struct().b() == test5);
+
+        uint32_t static_payloadSize = static_cast<uint32_t>(seqpb.getSerializedSizeProvider(&seq)());
+        SerializedPayload_t static_payload(static_payloadSize);
+        ASSERT_TRUE(seqpb.serialize(&seq, &static_payload));
+        ASSERT_TRUE(static_payload.length == static_payloadSize);
+        types::DynamicData* data3 = DynamicDataFactory::GetInstance()->CreateData(parent_struct_type);
+        ASSERT_TRUE(pubsubType.deserialize(&static_payload, data3));
+        ASSERT_TRUE(data3->Equals(struct_data));
+
+        // The same type built without the flat layout holds the same values.
+        DynamicTypeBuilderFactory::GetInstance()->SetFlatLayoutEnabled(false);
+        DynamicTypeBuilder_ptr tree_struct_type_builder = DynamicTypeBuilderFactory::GetInstance()->CreateStructBuilder();
+        ASSERT_TRUE(tree_struct_type_builder->AddMember(0, "int32", base_type) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(tree_struct_type_builder->AddMember(1, "int64", base_type2) == ResponseCode::RETCODE_OK);
+        DynamicTypeBuilder_ptr tree_parent_struct_type_builder =
+            DynamicTypeBuilderFactory::GetInstance()->CreateStructBuilder();
+        ASSERT_TRUE(tree_parent_struct_type_builder->AddMember(0, "child_struct",
+            tree_struct_type_builder->Build()) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(tree_parent_struct_type_builder->AddMember(1, "child_int64", base_type2) ==
+            ResponseCode::RETCODE_OK);
+        auto tree_parent_struct_type = tree_parent_struct_type_builder->Build();
+        ASSERT_TRUE(tree_parent_struct_type->GetLayout() == nullptr);
+
+        types::DynamicData* data4 = DynamicDataFactory::GetInstance()->CreateData(tree_parent_struct_type);
+        ASSERT_TRUE(pubsubType.deserialize(&payload, data4));
+        ASSERT_TRUE(data4->Equals(struct_data));
+        ASSERT_TRUE(struct_data->Equals(data4));
+
+        ASSERT_TRUE(struct_data->ClearAllValues() == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(struct_data->GetInt64Value(1) == 0);
+        ASSERT_FALSE(data2->Equals(struct_data));
+
+        ASSERT_TRUE(DynamicDataFactory::GetInstance()->DeleteData(data2) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(DynamicDataFactory::GetInstance()->DeleteData(data3) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(DynamicDataFactory::GetInstance()->DeleteData(data4) == ResponseCode::RETCODE_OK);
+
+        // Delete the structure
+        ASSERT_TRUE(DynamicDataFactory::GetInstance()->DeleteData(struct_data) == ResponseCode::RETCODE_OK);
+    }
+    ASSERT_TRUE(DynamicTypeBuilderFactory::GetInstance()->IsEmpty());
+    ASSERT_TRUE(DynamicDataFactory::GetInstance()->IsEmpty());
+}
+
+TEST_F(DynamicTypesTests, DynamicType_flat_structure_enum_unit_tests)
+{
+    {
+        DynamicTypeBuilderFactory::GetInstance()->SetFlatLayoutEnabled(true);
+
+        DynamicTypeBuilder_ptr enum_type_builder = DynamicTypeBuilderFactory::GetInstance()->CreateEnumBuilder();
+        ASSERT_TRUE(enum_type_builder != nullptr);
+        ASSERT_TRUE(enum_type_builder->AddEmptyMember(0, "DEFAULT") == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(enum_type_builder->AddEmptyMember(1, "FIRST") == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(enum_type_builder->AddEmptyMember(2, "SECOND") == ResponseCode::RETCODE_OK);
+        auto enum_type = enum_type_builder->Build();
+
+        DynamicTypeBuilder_ptr struct_type_builder = DynamicTypeBuilderFactory::GetInstance()->CreateStructBuilder();
+        ASSERT_TRUE(struct_type_builder != nullptr);
+        ASSERT_TRUE(struct_type_builder->AddMember(0, "bool", DynamicTypeBuilderFactory::GetInstance()->CreateBoolType())
+            == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(struct_type_builder->AddMember(1, "enum", enum_type) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(struct_type_builder->AddMember(2, "float64",
+            DynamicTypeBuilderFactory::GetInstance()->CreateFloat64Type()) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(struct_type_builder->AddMember(3, "char8", DynamicTypeBuilderFactory::GetInstance()->CreateChar8Type())
+            == ResponseCode::RETCODE_OK);
+
+        auto struct_type = struct_type_builder->Build();
+        ASSERT_TRUE(struct_type != nullptr);
+        ASSERT_TRUE(struct_type->GetLayout() != nullptr);
+
+        auto struct_data = DynamicDataFactory::GetInstance()->CreateData(struct_type);
+        ASSERT_TRUE(struct_data != nullptr);
+
+        // The values are checked against the kind of each member.
+        ASSERT_TRUE(struct_data->SetBoolValue(true, 0) == ResponseCode::RETCODE_OK);
+        ASSERT_FALSE(struct_data->SetUint32Value(2, 1) == ResponseCode::RETCODE_OK);
+        ASSERT_FALSE(struct_data->SetEnumValue(3, 1) == ResponseCode::RETCODE_OK);
+        ASSERT_FALSE(struct_data->SetEnumValue("THIRD", 1) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(struct_data->SetEnumValue("SECOND", 1) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(struct_data->SetFloat64Value(2.5, 2) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(struct_data->SetChar8Value('a', 3) == ResponseCode::RETCODE_OK);
+
+        ASSERT_TRUE(struct_data->GetBoolValue(0));
+        uint32_t enumValue(0);
+        ASSERT_TRUE(struct_data->GetEnumValue(enumValue, 1) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(enumValue == 2);
+        ASSERT_TRUE(struct_data->GetEnumValue(1) == "SECOND");
+        ASSERT_TRUE(struct_data->GetFloat64Value(2) == 2.5);
+        ASSERT_TRUE(struct_data->GetChar8Value(3) == 'a');
+
+        // Serialize <-> Deserialize Test
+        DynamicPubSubType pubsubType(struct_type);
+        uint32_t payloadSize = static_cast<uint32_t>(pubsubType.getSerializedSizeProvider(struct_data)());
+        SerializedPayload_t payload(payloadSize);
+        ASSERT_TRUE(pubsubType.serialize(struct_data, &payload));
+        ASSERT_TRUE(payload.length == payloadSize);
+
+        types::DynamicData* data2 = DynamicDataFactory::GetInstance()->CreateData(struct_type);
+        ASSERT_TRUE(pubsubType.deserialize(&payload, data2));
+        ASSERT_TRUE(data2->Equals(struct_data));
+
+        ASSERT_TRUE(data2->ClearValue(2) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(data2->GetFloat64Value(2) == 0.0);
+        ASSERT_TRUE(data2->GetEnumValue(1) == "SECOND");
+
+        ASSERT_TRUE(DynamicDataFactory::GetInstance()->DeleteData(data2) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(DynamicDataFactory::GetInstance()->DeleteData(struct_data) == ResponseCode::RETCODE_OK);
+    }
+    ASSERT_TRUE(DynamicTypeBuilderFactory::GetInstance()->IsEmpty());
+    ASSERT_TRUE(DynamicDataFactory::GetInstance()->IsEmpty());
+}
+
+TEST_F(DynamicTypesTests, DynamicType_keyed_structure_unit_tests)
+{
+    {
+        DynamicTypeBuilder_ptr key_type_builder = DynamicTypeBuilderFactory::GetInstance()->CreateInt32Builder();
+        ASSERT_TRUE(key_type_builder != nullptr);
+        ASSERT_TRUE(key_type_builder->ApplyAnnotation("@Key", "true") == ResponseCode::RETCODE_OK);
+        auto key_type = key_type_builder->Build();
+
+        DynamicTypeBuilder_ptr string_key_type_builder = DynamicTypeBuilderFactory::GetInstance()->CreateStringBuilder(1000);
+        ASSERT_TRUE(string_key_type_builder != nullptr);
+        ASSERT_TRUE(string_key_type_builder->ApplyAnnotation("@Key", "true") == ResponseCode::RETCODE_OK);
+        auto string_key_type = string_key_type_builder->Build();
+
+        // The key fits in the instance handle.
+        DynamicTypeBuilder_ptr struct_type_builder = DynamicTypeBuilderFactory::GetInstance()->CreateStructBuilder();
+        ASSERT_TRUE(struct_type_builder != nullptr);
+        ASSERT_TRUE(struct_type_builder->AddMember(0, "key", key_type) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(struct_type_builder->AddMember(1, "value",
+            DynamicTypeBuilderFactory::GetInstance()->CreateInt64Type()) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(struct_type_builder->ApplyAnnotation("@Key", "true") == ResponseCode::RETCODE_OK);
+        auto struct_type = struct_type_builder->Build();
+        ASSERT_TRUE(struct_type != nullptr);
+
+        // The key doesn't fit in the instance handle nor in the stack buffer of getKey.
+        DynamicTypeBuilder_ptr string_struct_type_builder = DynamicTypeBuilderFactory::GetInstance()->CreateStructBuilder();
+        ASSERT_TRUE(string_struct_type_builder != nullptr);
+        ASSERT_TRUE(string_struct_type_builder->AddMember(0, "key", key_type) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(string_struct_type_builder->AddMember(1, "name", string_key_type) == ResponseCode::RETCODE_OK);
+        ASSERT_TRUE(string_struct_type_builder->ApplyAnnotation("@Key", "true") == ResponseCode::RETCODE_OK);
+        auto string_struct_type = string_struct_type_builder->Build();
+        ASSERT_TRUE(string_struct_type != nullptr);
+
+        DynamicPubSubType pubsubType(struct_type);
+        DynamicPubSubType stringPubsubType(string_struct_type);
+        ASSERT_TRUE(pubsubType.m_isGetKeyDefined);
+        ASSERT_TRUE(stringPubsubType.m_isGetKeyDefined);
+
+        const int32_t numSamples = 16;
+        std::vector<types::DynamicData*> samples;
+        std::vector<types::DynamicData*> stringSamples;
+        std::vector<InstanceHandle_t> handles(numSamples);
+        std::vector<InstanceHandle_t> stringHandles(numSamples);
+        for (int32_t i = 0; i < numSamples; ++i)
+        {
+            types::DynamicData* data = DynamicDataFactory::GetInstance()->CreateData(struct_type);
+            ASSERT_TRUE(data->SetInt32Value(i, 0) == ResponseCode::RETCODE_OK);
+            ASSERT_TRUE(data->SetInt64Value(i * 10, 1) == ResponseCode::RETCODE_OK);
+            samples.push_back(data);
+            ASSERT_TRUE(pubsubType.getKey(data, &handles[i]));
+
+            types::DynamicData* stringData = DynamicDataFactory::GetInstance()->CreateData(string_struct_type);
+            ASSERT_TRUE(stringData->SetInt32Value(i, 0) == ResponseCode::RETCODE_OK);
+            ASSERT_TRUE(stringData->SetStringValue(std::string(500, static_cast<char>('a' + i)), 1) ==
+                ResponseCode::RETCODE_OK);
+            stringSamples.push_back(stringData);
+            ASSERT_TRUE(stringPubsubType.getKey(stringData, &stringHandles[i]));
+        }
+
+        // Small keys are copied in big endian.
+        InstanceHandle_t expected;
+        expected.value[3] = 5;
+        ASSERT_TRUE(handles[5] == expected);
+
+        // The value of the non key members doesn't change the handle.
+        ASSERT_TRUE(samples[5]->SetInt64Value(1234, 1) == ResponseCode::RETCODE_OK);
+        InstanceHandle_t handle;
+        ASSERT_TRUE(pubsubType.getKey(samples[5], &handle));
+        ASSERT_TRUE(handle == handles[5]);
+
+        // Forcing the MD5 changes the handle of small keys.
+        ASSERT_TRUE(pubsubType.getKey(samples[5], &handle, true));
+        ASSERT_FALSE(handle == handles[5]);
+
+        for (int32_t i = 1; i < numSamples; ++i)
+        {
+            ASSERT_FALSE(stringHandles[i] == stringHandles[i - 1]);
+        }
+
+        // Several threads can compute the keys with the same type at the same time.
+        std::atomic<bool> mismatch(false);
+        std::vector<std::thread> threads;
+        for (int32_t t = 0; t < numSamples; ++t)
+        {
+            threads.emplace_back([&, t]()
+            {
+                for (int32_t i = 0; i < 100; ++i)
+                {
+                    InstanceHandle_t threadHandle;
+                    if (!pubsubType.getKey(samples[t], &threadHandle) || !(threadHandle == handles[t]) ||
+                        !stringPubsubType.getKey(stringSamples[t], &threadHandle) ||
+                        !(threadHandle == stringHandles[t]))
+                    {
+                        mismatch = true;
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        ASSERT_FALSE(mismatch);
+
+        for (int32_t i = 0; i < numSamples; ++i)
+        {
+            ASSERT_TRUE(DynamicDataFactory::GetInstance()->DeleteData(samples[i]) == ResponseCode::RETCODE_OK);
+            ASSERT_TRUE(DynamicDataFactory::GetInstance()->DeleteData(stringSamples[i]) == ResponseCode::RETCODE_OK);
+        }
+    }
+    ASSERT_TRUE(DynamicTypeBuilderFactory::GetInstance()->IsEmpty());
+    ASSERT_TRUE(DynamicDataFactory::GetInstance()->IsEmpty());
+}
+
 TEST_F(DynamicTypesTests, DynamicType_union_unit_tests)
 {
     {
@@ -143,6 +143,72 @@ TEST_F(LogTests, multiple_verbosity_levels)
     ASSERT_EQ(3u, consumedEntries.size());
 }
 
+TEST_F(LogTests, formatted_logging)
+{
+    std::string text("text");
+    logWarningFmt(Formatted, "Sample {} of {} with {}", 1, 3u, text);
+    logErrorFmt(Formatted, "Unused {}, {} and {}", -2, 'c');
+    logErrorFmt(Formatted, "No placeholders", 4.5);
+    auto consumedEntries = HELPER_WaitForEntries(3);
+    ASSERT_EQ(3u, consumedEntries.size());
+
+    EXPECT_EQ("Sample 1 of 3 with text", consumedEntries[0].message);
+    EXPECT_EQ(Log::Kind::Warning, consumedEntries[0].kind);
+    EXPECT_STREQ("Formatted", consumedEntries[0].context.category);
+    EXPECT_FALSE(consumedEntries[0].timestamp.empty());
+    EXPECT_EQ("Unused -2, c and {}", consumedEntries[1].message);
+    EXPECT_EQ("No placeholders", consumedEntries[2].message);
+}
+
+TEST_F(LogTests, formatted_regex_filtering)
+{
+    Log::SetCategoryFilter(std::regex("(Good)"));
+    Log::SetErrorStringFilter(std::regex("(number 1)"));
+    logErrorFmt(GoodCategory, "Error number {}", 1);
+    logErrorFmt(GoodCategory, "Error number {}", 2);
+    logErrorFmt(BadCategory, "Error number {}", 1);
+    auto consumedEntries = HELPER_WaitForEntries(3);
+    ASSERT_EQ(1u, consumedEntries.size());
+}
+
+TEST_F(LogTests, formatted_and_text_verbosity_levels)
+{
+    Log::SetVerbosity(Log::Error);
+    logErrorFmt(VerbosityChecks, "This should be logged");
+    logWarningFmt(VerbosityChecks, "If you're seeing this, something went wrong");
+    logError(VerbosityChecks, "This should be logged too!");
+    auto consumedEntries = HELPER_WaitForEntries(3);
+    ASSERT_EQ(2u, consumedEntries.size());
+}
+
+TEST_F(LogTests, multithreaded_formatted_logging)
+{
+    vector<unique_ptr<thread>> threads;
+    for (int i = 0; i != 5; i++)
+    {
+        threads.emplace_back(new thread([i]{
+                    for (int j = 0; j != 20; j++)
+                    {
+                        logWarningFmt(Multithread, "I'm thread {}, entry {}", i, j);
+                    }
+                    }));
+    }
+
+    for (auto& thread: threads) {
+        thread->join();
+    }
+
+    auto consumedEntries = HELPER_WaitForEntries(100);
+    ASSERT_EQ(100u, consumedEntries.size());
+}
+
+TEST_F(LogTests, compile_time_category_filtering)
+{
+    static_assert(Log::CategoryIn("RTPS_HISTORY", "RTPS_READER", "RTPS_HISTORY"), "Category should be found");
+    static_assert(!Log::CategoryIn("RTPS_HISTORY", "RTPS_HISTORY_EXTRA", "RTPS"), "Category should not be found");
+    static_assert(!Log::CategoryIn("RTPS_HISTORY"), "Category should not be found");
+}
+
 std::vector<Log::Entry> LogTests::HELPER_WaitForEntries(uint32_t amount)
 {
     size_t entries = 0;
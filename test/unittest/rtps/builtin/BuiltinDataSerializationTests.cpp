@@ -0,0 +1,381 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/rtps/builtin/data/ParticipantProxyData.h>
+#include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
+#include <fastrtps/rtps/builtin/data/WriterProxyData.h>
+#include <fastrtps/rtps/messages/CDRMessage.h>
+#include <fastrtps/qos/ParameterList.h>
+#include <fastrtps/utils/IPLocator.h>
+#include <fastrtps/log/Log.h>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+static Locator_t make_locator(uint32_t port, octet last_address_byte)
+{
+    Locator_t locator;
+    locator.kind = LOCATOR_KIND_UDPv4;
+    locator.port = port;
+    IPLocator::setIPv4(locator, 192, 168, 1, last_address_byte);
+    return locator;
+}
+
+static GUID_t make_guid(octet prefix_byte, uint32_t entity_id)
+{
+    GUID_t guid;
+    for(octet i = 0; i < 12; ++i)
+    {
+        guid.guidPrefix.value[i] = static_cast<octet>(prefix_byte + i);
+    }
+    guid.entityId = entity_id;
+    return guid;
+}
+
+/*!
+ * Builds DATA(r) payloads by hand, to send parameters that the proxy data never writes.
+ */
+class ParameterListBuilder
+{
+    public:
+
+        ParameterListBuilder()
+            : msg_(RTPSMESSAGE_DEFAULT_SIZE)
+        {
+            msg_.msg_endian = LITTLEEND;
+            CDRMessage::addOctet(&msg_, 0);
+            CDRMessage::addOctet(&msg_, PL_CDR_LE);
+            CDRMessage::addUInt16(&msg_, 0);
+        }
+
+        ParameterListBuilder& add(ParameterId_t pid, uint16_t length, const std::vector<octet>& value)
+        {
+            CDRMessage::addUInt16(&msg_, pid);
+            CDRMessage::addUInt16(&msg_, length);
+            CDRMessage::addData(&msg_, value.data(), static_cast<uint32_t>(value.size()));
+            return *this;
+        }
+
+        ParameterListBuilder& add(ParameterId_t pid, const std::vector<octet>& value)
+        {
+            return add(pid, static_cast<uint16_t>(value.size()), value);
+        }
+
+        ParameterListBuilder& add_guid(ParameterId_t pid, const GUID_t& guid)
+        {
+            std::vector<octet> value(guid.guidPrefix.value, guid.guidPrefix.value + 12);
+            value.insert(value.end(), guid.entityId.value, guid.entityId.value + 4);
+            return add(pid, value);
+        }
+
+        ParameterListBuilder& add_string(ParameterId_t pid, const std::string& str)
+        {
+            CDRMessage::addUInt16(&msg_, pid);
+            uint32_t length_pos = msg_.pos;
+            CDRMessage::addUInt16(&msg_, 0);
+            CDRMessage::addString(&msg_, str);
+            uint32_t end_pos = msg_.pos;
+            msg_.pos = length_pos;
+            CDRMessage::addUInt16(&msg_, static_cast<uint16_t>(end_pos - length_pos - 2));
+            msg_.pos = end_pos;
+            return *this;
+        }
+
+        ParameterListBuilder& sentinel()
+        {
+            CDRMessage::addParameterSentinel(&msg_);
+            return *this;
+        }
+
+        //! Message ready to be parsed, optionally cut to the given length.
+        CDRMessage_t& message(uint32_t length = 0)
+        {
+            if(length != 0)
+            {
+                msg_.length = length;
+            }
+            msg_.pos = 0;
+            return msg_;
+        }
+
+    private:
+
+        CDRMessage_t msg_;
+};
+
+TEST(BuiltinDataSerializationTests, participant_proxy_data_round_trip)
+{
+    ParticipantProxyData out;
+    out.m_protocolVersion = c_ProtocolVersion;
+    out.m_guid = make_guid(1, 0x000001c1);
+    out.m_key = out.m_guid;
+    out.m_VendorId = c_VendorId_eProsima;
+    out.m_expectsInlineQos = true;
+    out.m_availableBuiltinEndpoints = DISC_BUILTIN_ENDPOINT_PARTICIPANT_ANNOUNCER |
+        DISC_BUILTIN_ENDPOINT_PUBLICATION_DETECTOR;
+    out.m_metatrafficUnicastLocatorList.push_back(make_locator(7410, 1));
+    out.m_metatrafficMulticastLocatorList.push_back(make_locator(7400, 2));
+    out.m_defaultUnicastLocatorList.push_back(make_locator(7411, 3));
+    out.m_defaultUnicastLocatorList.push_back(make_locator(7413, 4));
+    out.m_defaultMulticastLocatorList.push_back(make_locator(7401, 5));
+    out.m_participantName = "participant_proxy_data_round_trip";
+    out.m_leaseDuration = Duration_t(130, 500);
+    out.m_userData = { 'u', 's', 'e', 'r' };
+    out.m_properties.properties.push_back(std::make_pair("first", "value"));
+    out.m_properties.properties.push_back(std::make_pair("second", ""));
+
+    CDRMessage_t msg(RTPSMESSAGE_DEFAULT_SIZE);
+    ParameterList_t parameter_list = out.AllQostoParameterList();
+    ASSERT_TRUE(ParameterList::writeParameterListToCDRMsg(&msg, &parameter_list, true));
+    msg.pos = 0;
+
+    ParticipantProxyData in;
+    ASSERT_TRUE(in.readFromCDRMessage(&msg));
+    EXPECT_EQ(out.m_protocolVersion, in.m_protocolVersion);
+    EXPECT_EQ(out.m_guid, in.m_guid);
+    EXPECT_EQ(out.m_key, in.m_key);
+    EXPECT_EQ(out.m_VendorId, in.m_VendorId);
+    EXPECT_EQ(out.m_expectsInlineQos, in.m_expectsInlineQos);
+    EXPECT_EQ(out.m_availableBuiltinEndpoints, in.m_availableBuiltinEndpoints);
+    EXPECT_EQ(out.m_metatrafficUnicastLocatorList, in.m_metatrafficUnicastLocatorList);
+    EXPECT_EQ(out.m_metatrafficMulticastLocatorList, in.m_metatrafficMulticastLocatorList);
+    EXPECT_EQ(out.m_defaultUnicastLocatorList, in.m_defaultUnicastLocatorList);
+    EXPECT_EQ(out.m_defaultMulticastLocatorList, in.m_defaultMulticastLocatorList);
+    EXPECT_EQ(out.m_participantName, in.m_participantName);
+    EXPECT_EQ(out.m_leaseDuration, in.m_leaseDuration);
+    EXPECT_EQ(out.m_userData, in.m_userData);
+    EXPECT_EQ(out.m_properties.properties, in.m_properties.properties);
+}
+
+TEST(BuiltinDataSerializationTests, reader_proxy_data_round_trip)
+{
+    ReaderProxyData out;
+    out.guid(make_guid(2, 0x00000107));
+    out.key() = out.guid();
+    out.RTPSParticipantKey() = make_guid(2, 0x000001c1);
+    out.topicName("reader_topic");
+    out.typeName("reader_type");
+    out.topicKind(WITH_KEY);
+    out.m_expectsInlineQos = true;
+    out.unicastLocatorList().push_back(make_locator(7415, 6));
+    out.multicastLocatorList().push_back(make_locator(7402, 7));
+    out.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    out.m_qos.m_reliability.hasChanged = true;
+    out.m_qos.m_durability.kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+    out.m_qos.m_durability.hasChanged = true;
+    out.m_qos.m_deadline.period = Duration_t(3, 0);
+    out.m_qos.m_deadline.hasChanged = true;
+    out.m_qos.m_ownership.kind = EXCLUSIVE_OWNERSHIP_QOS;
+    out.m_qos.m_ownership.hasChanged = true;
+    out.m_qos.m_partition.push_back("partition_a");
+    out.m_qos.m_partition.push_back("partition_b");
+
+    CDRMessage_t msg(RTPSMESSAGE_DEFAULT_SIZE);
+    ParameterList_t parameter_list = out.toParameterList();
+    ASSERT_TRUE(ParameterList::writeParameterListToCDRMsg(&msg, &parameter_list, true));
+    msg.pos = 0;
+
+    ReaderProxyData in;
+    ASSERT_TRUE(in.readFromCDRMessage(&msg));
+    EXPECT_EQ(out.guid(), in.guid());
+    EXPECT_EQ(out.key(), in.key());
+    EXPECT_EQ(out.RTPSParticipantKey(), in.RTPSParticipantKey());
+    EXPECT_EQ(out.topicName(), in.topicName());
+    EXPECT_EQ(out.typeName(), in.typeName());
+    EXPECT_EQ(out.topicKind(), in.topicKind());
+    EXPECT_EQ(out.m_expectsInlineQos, in.m_expectsInlineQos);
+    EXPECT_EQ(out.unicastLocatorList(), in.unicastLocatorList());
+    EXPECT_EQ(out.multicastLocatorList(), in.multicastLocatorList());
+    EXPECT_EQ(out.m_qos.m_reliability.kind, in.m_qos.m_reliability.kind);
+    EXPECT_EQ(out.m_qos.m_durability.kind, in.m_qos.m_durability.kind);
+    EXPECT_EQ(out.m_qos.m_deadline.period, in.m_qos.m_deadline.period);
+    EXPECT_EQ(out.m_qos.m_ownership.kind, in.m_qos.m_ownership.kind);
+    EXPECT_EQ(out.m_qos.m_partition.getNames(), in.m_qos.m_partition.getNames());
+}
+
+TEST(BuiltinDataSerializationTests, writer_proxy_data_round_trip)
+{
+    WriterProxyData out;
+    out.guid(make_guid(3, 0x00000103));
+    out.key() = out.guid();
+    out.RTPSParticipantKey() = make_guid(3, 0x000001c1);
+    out.persistence_guid(make_guid(4, 0x00000203));
+    out.topicName("writer_topic");
+    out.typeName("writer_type");
+    out.unicastLocatorList().push_back(make_locator(7417, 8));
+    out.multicastLocatorList().push_back(make_locator(7403, 9));
+    out.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    out.m_qos.m_reliability.hasChanged = true;
+    out.m_qos.m_durability.kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+    out.m_qos.m_durability.hasChanged = true;
+    out.m_qos.m_liveliness.kind = MANUAL_BY_TOPIC_LIVELINESS_QOS;
+    out.m_qos.m_liveliness.lease_duration = Duration_t(10, 0);
+    out.m_qos.m_liveliness.hasChanged = true;
+    out.m_qos.m_ownershipStrength.value = 12;
+    out.m_qos.m_ownershipStrength.hasChanged = true;
+    out.m_qos.m_partition.push_back("partition_c");
+
+    CDRMessage_t msg(RTPSMESSAGE_DEFAULT_SIZE);
+    ParameterList_t parameter_list = out.toParameterList();
+    ASSERT_TRUE(ParameterList::writeParameterListToCDRMsg(&msg, &parameter_list, true));
+    msg.pos = 0;
+
+    WriterProxyData in;
+    ASSERT_TRUE(in.readFromCDRMessage(&msg));
+    EXPECT_EQ(out.guid(), in.guid());
+    EXPECT_EQ(out.key(), in.key());
+    EXPECT_EQ(out.RTPSParticipantKey(), in.RTPSParticipantKey());
+    EXPECT_EQ(out.persistence_guid(), in.persistence_guid());
+    EXPECT_EQ(out.topicName(), in.topicName());
+    EXPECT_EQ(out.typeName(), in.typeName());
+    EXPECT_EQ(NO_KEY, in.topicKind());
+    EXPECT_EQ(out.unicastLocatorList(), in.unicastLocatorList());
+    EXPECT_EQ(out.multicastLocatorList(), in.multicastLocatorList());
+    EXPECT_EQ(out.m_qos.m_reliability.kind, in.m_qos.m_reliability.kind);
+    EXPECT_EQ(out.m_qos.m_durability.kind, in.m_qos.m_durability.kind);
+    EXPECT_EQ(out.m_qos.m_liveliness.kind, in.m_qos.m_liveliness.kind);
+    EXPECT_EQ(out.m_qos.m_liveliness.lease_duration, in.m_qos.m_liveliness.lease_duration);
+    EXPECT_EQ(out.m_qos.m_ownershipStrength.value, in.m_qos.m_ownershipStrength.value);
+    EXPECT_EQ(out.m_qos.m_partition.getNames(), in.m_qos.m_partition.getNames());
+}
+
+TEST(BuiltinDataSerializationTests, unknown_and_vendor_specific_pids_are_skipped)
+{
+    GUID_t guid = make_guid(5, 0x00000107);
+    ParameterListBuilder builder;
+    builder.add(static_cast<ParameterId_t>(0x7777), { 1, 2, 3, 4, 5, 6, 7, 8 }).
+        add_guid(PID_ENDPOINT_GUID, guid).
+        add(static_cast<ParameterId_t>(0x8001), { 0xff, 0xff, 0xff, 0xff }).
+        add(PID_PAD, { 0, 0, 0, 0 }).
+        add_string(PID_TOPIC_NAME, "skipped_topic").
+        sentinel();
+
+    ReaderProxyData reader;
+    ASSERT_TRUE(reader.readFromCDRMessage(&builder.message()));
+    EXPECT_EQ(guid, reader.guid());
+    EXPECT_EQ("skipped_topic", reader.topicName());
+
+    WriterProxyData writer;
+    ASSERT_TRUE(writer.readFromCDRMessage(&builder.message()));
+    EXPECT_EQ(guid, writer.guid());
+    EXPECT_EQ("skipped_topic", writer.topicName());
+
+    ParticipantProxyData participant;
+    ASSERT_TRUE(participant.readFromCDRMessage(&builder.message()));
+}
+
+TEST(BuiltinDataSerializationTests, sentinel_ends_parameter_list)
+{
+    ParameterListBuilder builder;
+    builder.add_string(PID_TOPIC_NAME, "first_topic").
+        sentinel().
+        add_string(PID_TYPE_NAME, "ignored_type");
+
+    ReaderProxyData reader;
+    ASSERT_TRUE(reader.readFromCDRMessage(&builder.message()));
+    EXPECT_EQ("first_topic", reader.topicName());
+    EXPECT_TRUE(reader.typeName().empty());
+}
+
+TEST(BuiltinDataSerializationTests, missing_sentinel_is_rejected)
+{
+    ParameterListBuilder builder;
+    builder.add_string(PID_TOPIC_NAME, "topic");
+
+    ReaderProxyData reader;
+    EXPECT_FALSE(reader.readFromCDRMessage(&builder.message()));
+    WriterProxyData writer;
+    EXPECT_FALSE(writer.readFromCDRMessage(&builder.message()));
+    ParticipantProxyData participant;
+    EXPECT_FALSE(participant.readFromCDRMessage(&builder.message()));
+}
+
+TEST(BuiltinDataSerializationTests, truncated_parameter_is_rejected)
+{
+    ParameterListBuilder builder;
+    builder.add_guid(PID_ENDPOINT_GUID, make_guid(6, 0x00000107)).
+        add_string(PID_TOPIC_NAME, "truncated_topic").
+        sentinel();
+
+    // The message ends in the middle of the topic name.
+    uint32_t length = 4 + 4 + 16 + 4 + 8;
+
+    ReaderProxyData reader;
+    EXPECT_FALSE(reader.readFromCDRMessage(&builder.message(length)));
+    WriterProxyData writer;
+    EXPECT_FALSE(writer.readFromCDRMessage(&builder.message(length)));
+    ParticipantProxyData participant;
+    EXPECT_FALSE(participant.readFromCDRMessage(&builder.message(length)));
+}
+
+TEST(BuiltinDataSerializationTests, bad_parameter_length_is_rejected)
+{
+    // A GUID is always 16 bytes long.
+    {
+        ParameterListBuilder builder;
+        builder.add(PID_ENDPOINT_GUID, { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 }).sentinel();
+
+        ReaderProxyData reader;
+        EXPECT_FALSE(reader.readFromCDRMessage(&builder.message()));
+        WriterProxyData writer;
+        EXPECT_FALSE(writer.readFromCDRMessage(&builder.message()));
+    }
+
+    // A locator is always 24 bytes long.
+    {
+        ParameterListBuilder builder;
+        builder.add(PID_UNICAST_LOCATOR, std::vector<octet>(20, 0)).sentinel();
+
+        ReaderProxyData reader;
+        EXPECT_FALSE(reader.readFromCDRMessage(&builder.message()));
+        WriterProxyData writer;
+        EXPECT_FALSE(writer.readFromCDRMessage(&builder.message()));
+    }
+
+    {
+        ParameterListBuilder builder;
+        builder.add(PID_METATRAFFIC_UNICAST_LOCATOR, std::vector<octet>(20, 0)).sentinel();
+
+        ParticipantProxyData participant;
+        EXPECT_FALSE(participant.readFromCDRMessage(&builder.message()));
+    }
+
+    // Strings longer than their parameter.
+    {
+        ParameterListBuilder builder;
+        builder.add(PID_TOPIC_NAME, { 100, 0, 0, 0, 'a', 'b', 'c', 0 }).sentinel();
+
+        ReaderProxyData reader;
+        EXPECT_FALSE(reader.readFromCDRMessage(&builder.message()));
+    }
+
+    // The length of a parameter goes past the end of the message.
+    {
+        ParameterListBuilder builder;
+        builder.add(PID_TOPIC_NAME, 200, { 4, 0, 0, 0, 'a', 'b', 'c', 0 }).sentinel();
+
+        ReaderProxyData reader;
+        EXPECT_FALSE(reader.readFromCDRMessage(&builder.message()));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    Log::KillThread();
+    return ret;
+}
@@ -0,0 +1,337 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/rtps/builtin/discovery/participant/ProxyDataIndex.h>
+#include <fastrtps/rtps/builtin/data/ParticipantProxyData.h>
+#include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
+#include <fastrtps/rtps/builtin/data/WriterProxyData.h>
+#include <fastrtps/log/Log.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <set>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+static const char* const topic_names[] = { "topic_a", "topic_b", "topic_c" };
+static const char* const type_names[] = { "type_1", "type_2" };
+
+class ProxyDataIndexTests : public ::testing::Test
+{
+    protected:
+
+        ~ProxyDataIndexTests()
+        {
+            for(ParticipantProxyData* pdata : index.participants())
+            {
+                delete pdata;
+            }
+        }
+
+        ParticipantProxyData* new_participant()
+        {
+            ParticipantProxyData* pdata = new ParticipantProxyData();
+            pdata->m_guid.guidPrefix.value[0] = 1;
+            pdata->m_guid.guidPrefix.value[10] = static_cast<octet>(next_participant_ >> 8);
+            pdata->m_guid.guidPrefix.value[11] = static_cast<octet>(next_participant_);
+            pdata->m_guid.entityId = c_EntityId_RTPSParticipant;
+            ++next_participant_;
+            return pdata;
+        }
+
+        template<class ProxyData>
+        ProxyData* new_endpoint(const ParticipantProxyData* pdata, const std::string& topic_name,
+                const std::string& type_name)
+        {
+            ProxyData* data = new ProxyData();
+            GUID_t guid(pdata->m_guid.guidPrefix, ++next_entity_);
+            data->guid(guid);
+            data->topicName(topic_name);
+            data->typeName(type_name);
+            return data;
+        }
+
+        //! Checks the indexes against the endpoint lists of the registered participants.
+        void check_consistency()
+        {
+            size_t num_readers = 0;
+            size_t num_writers = 0;
+
+            for(ParticipantProxyData* pdata : index.participants())
+            {
+                ASSERT_EQ(pdata, index.findParticipant(pdata->m_guid.guidPrefix));
+
+                for(ReaderProxyData* rdata : pdata->m_readers)
+                {
+                    ++num_readers;
+                    ASSERT_EQ(rdata, index.findReader(rdata->guid()));
+                    const std::vector<ReaderProxyData*>* on_topic = index.readersOnTopic(rdata->topicName());
+                    ASSERT_NE(nullptr, on_topic);
+                    ASSERT_EQ(1, std::count(on_topic->begin(), on_topic->end(), rdata));
+                }
+
+                for(WriterProxyData* wdata : pdata->m_writers)
+                {
+                    ++num_writers;
+                    ASSERT_EQ(wdata, index.findWriter(wdata->guid()));
+                    const std::vector<WriterProxyData*>* on_topic = index.writersOnTopic(wdata->topicName());
+                    ASSERT_NE(nullptr, on_topic);
+                    ASSERT_EQ(1, std::count(on_topic->begin(), on_topic->end(), wdata));
+                }
+            }
+
+            // Nothing else is indexed by topic.
+            size_t indexed_readers = 0;
+            size_t indexed_writers = 0;
+            for(const char* topic : topic_names)
+            {
+                const std::vector<ReaderProxyData*>* readers = index.readersOnTopic(topic);
+                if(readers != nullptr)
+                {
+                    ASSERT_FALSE(readers->empty());
+                    indexed_readers += readers->size();
+                }
+
+                const std::vector<WriterProxyData*>* writers = index.writersOnTopic(topic);
+                if(writers != nullptr)
+                {
+                    ASSERT_FALSE(writers->empty());
+                    indexed_writers += writers->size();
+                }
+            }
+            ASSERT_EQ(num_readers, indexed_readers);
+            ASSERT_EQ(num_writers, indexed_writers);
+        }
+
+        ProxyDataIndex index;
+
+    private:
+
+        uint16_t next_participant_ = 0;
+
+        uint32_t next_entity_ = 0;
+};
+
+TEST_F(ProxyDataIndexTests, find_participant_by_prefix)
+{
+    ParticipantProxyData* first = new_participant();
+    ParticipantProxyData* second = new_participant();
+    index.addParticipant(first);
+    index.addParticipant(second);
+
+    EXPECT_EQ(first, index.findParticipant(first->m_guid.guidPrefix));
+    EXPECT_EQ(second, index.findParticipant(second->m_guid.guidPrefix));
+    ASSERT_EQ(2u, index.participants().size());
+    EXPECT_EQ(first, index.participants().front());
+
+    // Prefixes that only differ in one byte are different participants.
+    GuidPrefix_t unknown = first->m_guid.guidPrefix;
+    unknown.value[5] = 0xff;
+    EXPECT_EQ(nullptr, index.findParticipant(unknown));
+    EXPECT_EQ(nullptr, index.findParticipant(c_GuidPrefix_Unknown));
+
+    ASSERT_TRUE(index.removeParticipant(first));
+    EXPECT_EQ(nullptr, index.findParticipant(first->m_guid.guidPrefix));
+    EXPECT_EQ(second, index.findParticipant(second->m_guid.guidPrefix));
+    EXPECT_FALSE(index.removeParticipant(first));
+    delete first;
+}
+
+TEST_F(ProxyDataIndexTests, participant_endpoints_follow_participant)
+{
+    ParticipantProxyData* pdata = new_participant();
+    ReaderProxyData* rdata = new_endpoint<ReaderProxyData>(pdata, topic_names[0], type_names[0]);
+    WriterProxyData* wdata = new_endpoint<WriterProxyData>(pdata, topic_names[1], type_names[0]);
+    pdata->m_readers.push_back(rdata);
+    pdata->m_writers.push_back(wdata);
+
+    // Endpoints already in the participant are indexed when it is added.
+    index.addParticipant(pdata);
+    EXPECT_EQ(rdata, index.findReader(rdata->guid()));
+    EXPECT_EQ(wdata, index.findWriter(wdata->guid()));
+    check_consistency();
+
+    // And unindexed when it is removed, without touching its lists.
+    ASSERT_TRUE(index.removeParticipant(pdata));
+    EXPECT_EQ(nullptr, index.findReader(rdata->guid()));
+    EXPECT_EQ(nullptr, index.findWriter(wdata->guid()));
+    EXPECT_EQ(nullptr, index.readersOnTopic(topic_names[0]));
+    EXPECT_EQ(nullptr, index.writersOnTopic(topic_names[1]));
+    EXPECT_EQ(1u, pdata->m_readers.size());
+    EXPECT_EQ(1u, pdata->m_writers.size());
+    delete pdata;
+}
+
+TEST_F(ProxyDataIndexTests, remove_unknown_endpoint)
+{
+    ParticipantProxyData* pdata = new_participant();
+    index.addParticipant(pdata);
+
+    std::unique_ptr<ReaderProxyData> rdata(new_endpoint<ReaderProxyData>(pdata, topic_names[0], type_names[0]));
+    std::unique_ptr<WriterProxyData> wdata(new_endpoint<WriterProxyData>(pdata, topic_names[0], type_names[0]));
+    EXPECT_FALSE(index.removeReader(rdata.get()));
+    EXPECT_FALSE(index.removeWriter(wdata.get()));
+
+    // A copy with the same GUID is not the registered object.
+    ReaderProxyData* registered = new ReaderProxyData(*rdata);
+    index.addReader(pdata, registered);
+    EXPECT_FALSE(index.removeReader(rdata.get()));
+    EXPECT_EQ(registered, index.findReader(rdata->guid()));
+    check_consistency();
+}
+
+TEST_F(ProxyDataIndexTests, random_add_remove_keeps_indexes_consistent)
+{
+    std::mt19937 generator(2018);
+    auto random = [&generator](size_t max) { return std::uniform_int_distribution<size_t>(0, max - 1)(generator); };
+
+    for(int step = 0; step < 2000; ++step)
+    {
+        const std::vector<ParticipantProxyData*>& participants = index.participants();
+        size_t operation = participants.empty() ? 0 : random(6);
+
+        if(operation == 0)
+        {
+            ParticipantProxyData* pdata = new_participant();
+            for(size_t i = random(3); i > 0; --i)
+            {
+                pdata->m_readers.push_back(new_endpoint<ReaderProxyData>(pdata, topic_names[random(3)], type_names[random(2)]));
+            }
+            for(size_t i = random(3); i > 0; --i)
+            {
+                pdata->m_writers.push_back(new_endpoint<WriterProxyData>(pdata, topic_names[random(3)], type_names[random(2)]));
+            }
+            index.addParticipant(pdata);
+        }
+        else if(operation == 1)
+        {
+            ParticipantProxyData* pdata = participants[random(participants.size())];
+            ASSERT_TRUE(index.removeParticipant(pdata));
+            delete pdata;
+        }
+        else
+        {
+            ParticipantProxyData* pdata = participants[random(participants.size())];
+            if(operation == 2)
+            {
+                index.addReader(pdata, new_endpoint<ReaderProxyData>(pdata, topic_names[random(3)], type_names[random(2)]));
+            }
+            else if(operation == 3)
+            {
+                index.addWriter(pdata, new_endpoint<WriterProxyData>(pdata, topic_names[random(3)], type_names[random(2)]));
+            }
+            else if(operation == 4 && !pdata->m_readers.empty())
+            {
+                ReaderProxyData* rdata = pdata->m_readers[random(pdata->m_readers.size())];
+                ASSERT_TRUE(index.removeReader(rdata));
+                EXPECT_EQ(nullptr, index.findReader(rdata->guid()));
+                delete rdata;
+            }
+            else if(operation == 5 && !pdata->m_writers.empty())
+            {
+                WriterProxyData* wdata = pdata->m_writers[random(pdata->m_writers.size())];
+                ASSERT_TRUE(index.removeWriter(wdata));
+                EXPECT_EQ(nullptr, index.findWriter(wdata->guid()));
+                delete wdata;
+            }
+        }
+
+        check_consistency();
+        if(HasFatalFailure())
+        {
+            FAIL() << "Indexes inconsistent after step " << step;
+        }
+    }
+}
+
+/*!
+ * EDP pairing only visits the remote endpoints returned by readersOnTopic and writersOnTopic.
+ * This checks they are exactly the endpoints a full scan of every participant would pass the topic check of
+ * EDP::validMatching, including the ones with the same topic but another type, that must still be visited to
+ * be unmatched.
+ */
+TEST_F(ProxyDataIndexTests, topic_candidates_match_full_scan)
+{
+    for(int i = 0; i < 20; ++i)
+    {
+        ParticipantProxyData* pdata = new_participant();
+        index.addParticipant(pdata);
+        for(int j = 0; j < 6; ++j)
+        {
+            index.addReader(pdata, new_endpoint<ReaderProxyData>(pdata, topic_names[(i + j) % 3], type_names[j % 2]));
+            index.addWriter(pdata, new_endpoint<WriterProxyData>(pdata, topic_names[(i * j) % 3], type_names[(i + j) % 2]));
+        }
+    }
+
+    for(ParticipantProxyData* local : index.participants())
+    {
+        for(ReaderProxyData* rdata : local->m_readers)
+        {
+            std::set<WriterProxyData*> full_scan;
+            bool other_type_found = false;
+            for(ParticipantProxyData* pdata : index.participants())
+            {
+                for(WriterProxyData* wdata : pdata->m_writers)
+                {
+                    if(wdata->topicName() == rdata->topicName())
+                    {
+                        full_scan.insert(wdata);
+                        other_type_found |= wdata->typeName() != rdata->typeName();
+                    }
+                }
+            }
+
+            const std::vector<WriterProxyData*>* candidates = index.writersOnTopic(rdata->topicName());
+            ASSERT_NE(nullptr, candidates);
+            EXPECT_EQ(full_scan, std::set<WriterProxyData*>(candidates->begin(), candidates->end()));
+            EXPECT_EQ(full_scan.size(), candidates->size());
+            EXPECT_TRUE(other_type_found);
+        }
+
+        for(WriterProxyData* wdata : local->m_writers)
+        {
+            std::set<ReaderProxyData*> full_scan;
+            for(ParticipantProxyData* pdata : index.participants())
+            {
+                for(ReaderProxyData* rdata : pdata->m_readers)
+                {
+                    if(rdata->topicName() == wdata->topicName())
+                    {
+                        full_scan.insert(rdata);
+                    }
+                }
+            }
+
+            const std::vector<ReaderProxyData*>* candidates = index.readersOnTopic(wdata->topicName());
+            ASSERT_NE(nullptr, candidates);
+            EXPECT_EQ(full_scan, std::set<ReaderProxyData*>(candidates->begin(), candidates->end()));
+            EXPECT_EQ(full_scan.size(), candidates->size());
+        }
+    }
+
+    EXPECT_EQ(nullptr, index.readersOnTopic("unknown_topic"));
+    EXPECT_EQ(nullptr, index.writersOnTopic("unknown_topic"));
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    Log::KillThread();
+    return ret;
+}
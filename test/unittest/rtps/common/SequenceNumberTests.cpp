@@ -13,8 +13,10 @@
 // limitations under the License.
 
 #include <fastrtps/rtps/common/SequenceNumber.h>
+#include <fastrtps/rtps/common/FragmentNumber.h>
 
 #include <climits>
+#include <vector>
 #include <gtest/gtest.h>
 
 using namespace eprosima::fastrtps::rtps;
@@ -493,6 +495,142 @@ TEST(SequenceNumberSet, GetMaxSeqNumOperation)
     ASSERT_EQ(set.get_maxSeqNum(), expected_seq);
 }
 
+/*!
+ * @fn TEST(SequenceNumberSet, BitmapLayout)
+ * @brief This test checks the bitmap of the set has the layout of the messages.
+ */
+TEST(SequenceNumberSet, BitmapLayout)
+{
+    SequenceNumberSet_t set(SequenceNumber_t(0, 100));
+
+    ASSERT_TRUE(set.isSetEmpty());
+    ASSERT_EQ(0u, set.bitmap().num_bits());
+
+    ASSERT_TRUE(set.add(SequenceNumber_t(0, 100)));
+    ASSERT_TRUE(set.add(SequenceNumber_t(0, 133)));
+    ASSERT_FALSE(set.add(SequenceNumber_t(0, 99)));
+
+    ASSERT_EQ(34u, set.bitmap().num_bits());
+    ASSERT_EQ(2u, set.bitmap().num_words());
+    ASSERT_EQ(0x80000000u, set.bitmap().words()[0]);
+    ASSERT_EQ(0x40000000u, set.bitmap().words()[1]);
+    ASSERT_EQ(2u, set.get_size());
+}
+
+/*!
+ * @fn TEST(SequenceNumberSet, RemoveOperation)
+ * @brief This test checks removing sequence numbers updates the max sequence number.
+ */
+TEST(SequenceNumberSet, RemoveOperation)
+{
+    SequenceNumberSet_t set(SequenceNumber_t(1, 0));
+
+    ASSERT_TRUE(set.add(SequenceNumber_t(1, 3)));
+    ASSERT_TRUE(set.add(SequenceNumber_t(1, 200)));
+    ASSERT_TRUE(set.is_set(SequenceNumber_t(1, 200)));
+
+    set.remove(SequenceNumber_t(1, 200));
+
+    ASSERT_FALSE(set.is_set(SequenceNumber_t(1, 200)));
+    ASSERT_EQ(SequenceNumber_t(1, 3), set.get_maxSeqNum());
+    ASSERT_EQ(4u, set.bitmap().num_bits());
+
+    set.remove(SequenceNumber_t(1, 3));
+
+    ASSERT_TRUE(set.isSetEmpty());
+}
+
+/*!
+ * @fn TEST(SequenceNumberSet, AddRangeOperation)
+ * @brief This test checks ranges are clipped to the sequence numbers that fit in the set.
+ */
+TEST(SequenceNumberSet, AddRangeOperation)
+{
+    SequenceNumberSet_t set(SequenceNumber_t(0, UINT32_MAX - 9));
+
+    ASSERT_TRUE(set.add_range(SequenceNumber_t(0, UINT32_MAX - 5), SequenceNumber_t(1, 40)));
+    ASSERT_EQ(46u, set.get_size());
+    ASSERT_EQ(SequenceNumber_t(0, UINT32_MAX - 5), set.get_minSeqNum());
+    ASSERT_EQ(SequenceNumber_t(1, 39), set.get_maxSeqNum());
+
+    ASSERT_FALSE(set.add_range(SequenceNumber_t(0, 0), SequenceNumber_t(1, 1000)));
+    ASSERT_EQ(256u, set.get_size());
+    ASSERT_EQ(SequenceNumber_t(0, UINT32_MAX - 9), set.get_minSeqNum());
+    ASSERT_EQ(SequenceNumber_t(1, 245), set.get_maxSeqNum());
+
+    ASSERT_FALSE(set.add_range(SequenceNumber_t(2, 0), SequenceNumber_t(2, 10)));
+}
+
+/*!
+ * @fn TEST(SequenceNumberSet, ForEachOperation)
+ * @brief This test checks sequence numbers are visited in increasing order.
+ */
+TEST(SequenceNumberSet, ForEachOperation)
+{
+    SequenceNumberSet_t set(SequenceNumber_t(3, 10));
+    std::vector<SequenceNumber_t> expected = {
+        SequenceNumber_t(3, 10), SequenceNumber_t(3, 41), SequenceNumber_t(3, 42), SequenceNumber_t(3, 265)
+    };
+
+    for(auto it = expected.rbegin(); it != expected.rend(); ++it)
+    {
+        ASSERT_TRUE(set.add(*it));
+    }
+
+    std::vector<SequenceNumber_t> visited;
+    set.for_each([&visited](const SequenceNumber_t& seq)
+    {
+        visited.push_back(seq);
+    });
+
+    ASSERT_EQ(expected, visited);
+}
+
+/*!
+ * @fn TEST(SequenceNumberSet, BitmapSetOperation)
+ * @brief This test checks the set is filled from the bitmap of a message, ignoring bits after the valid ones.
+ */
+TEST(SequenceNumberSet, BitmapSetOperation)
+{
+    SequenceNumberSet_t set(SequenceNumber_t(0, 1));
+    uint32_t words[2] = {0x00000001u, 0xFFFFFFFFu};
+
+    ASSERT_TRUE(set.bitmap_set(36, words));
+    ASSERT_EQ(5u, set.get_size());
+    ASSERT_EQ(SequenceNumber_t(0, 32), set.get_minSeqNum());
+    ASSERT_EQ(SequenceNumber_t(0, 36), set.get_maxSeqNum());
+
+    ASSERT_FALSE(set.bitmap_set(257, words));
+}
+
+/*!
+ * @fn TEST(FragmentNumberSet, AddOperation)
+ * @brief This test checks the fragment numbers that fit in the set.
+ */
+TEST(FragmentNumberSet, AddOperation)
+{
+    FragmentNumberSet_t set(10);
+
+    ASSERT_FALSE(set.add(9));
+    ASSERT_TRUE(set.add(10));
+    ASSERT_TRUE(set.add(265));
+    ASSERT_FALSE(set.add(266));
+    ASSERT_EQ(265u, set.get_maxFragNum());
+
+    ASSERT_FALSE(set.add_range(200, 300));
+    ASSERT_EQ(67u, set.get_size());
+
+    set.remove(265);
+    ASSERT_EQ(264u, set.get_maxFragNum());
+
+    FragmentNumberSet_t other(100);
+    ASSERT_TRUE(other.add_range(100, 250));
+    set -= other;
+    ASSERT_EQ(16u, set.get_size());
+    ASSERT_FALSE(set.is_set(200));
+    ASSERT_TRUE(set.is_set(10));
+}
+
 int main(int argc, char **argv)
 {
     testing::InitGoogleTest(&argc, argv);
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 using namespace std;
+using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 
 static const unsigned int testPayloadSize = 1000;
@@ -39,12 +40,12 @@ class ThroughputControllerTests: public ::testing::Test
          testChanges.emplace_back(new CacheChange_t(testPayloadSize));
          testChanges.back()->sequenceNumber = {0, i+1};
          testChanges.back()->serializedPayload.length = testPayloadSize;
-         testChangesForUse.add_change(testChanges.back().get(), &mock, FragmentNumberSet_t());
+         testChangesForUse.add_change(testChanges.back().get(), &mock, DynamicBitmap());
 
          otherChanges.emplace_back(new CacheChange_t(testPayloadSize));
          otherChanges.back()->sequenceNumber = {0, i+1};
          otherChanges.back()->serializedPayload.length = testPayloadSize;
-         otherChangesForUse.add_change(otherChanges.back().get(), &mock, FragmentNumberSet_t());
+         otherChangesForUse.add_change(otherChanges.back().get(), &mock, DynamicBitmap());
       }
    }
 
@@ -72,9 +73,7 @@ TEST_F(ThroughputControllerTests, if_changes_are_fragmented_throughput_controlle
     // Given fragmented changes
     testChangesForUse.clear();
 
-    std::set<FragmentNumber_t> fragmentSet;
-    for(uint32_t i = 1; i <= 10; i++)
-        fragmentSet.insert(i);
+    DynamicBitmap fragmentSet(10, true);
 
     for(auto& change : testChanges)
     {
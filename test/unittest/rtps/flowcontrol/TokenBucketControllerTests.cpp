@@ -0,0 +1,194 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/flowcontrol/TokenBucketController.h>
+#include <fastrtps/rtps/writer/ReaderLocator.h>
+#include <fastrtps/rtps/resources/AsyncWriterThread.h>
+
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+static const unsigned int testPayloadSize = 1000;
+static const unsigned int bucketSize = 5500;
+static const unsigned int periodMillisecs = 100;
+static const unsigned int numberOfTestChanges = 10;
+
+static const ThroughputControllerDescriptor testDescriptor(bucketSize, periodMillisecs,
+        TOKEN_BUCKET_THROUGHPUT_CONTROLLER);
+
+class TokenBucketControllerTests: public ::testing::Test
+{
+    public:
+
+        TokenBucketControllerTests():
+            sController(testDescriptor, (const RTPSWriter*)nullptr)
+        {
+            for (unsigned int i = 0; i < numberOfTestChanges; i++)
+            {
+                testChanges.emplace_back(new CacheChange_t(testPayloadSize));
+                testChanges.back()->sequenceNumber = {0, i+1};
+                testChanges.back()->serializedPayload.length = testPayloadSize;
+                testChangesForUse.add_change(testChanges.back().get(), &mock, DynamicBitmap());
+
+                otherChanges.emplace_back(new CacheChange_t(testPayloadSize));
+                otherChanges.back()->sequenceNumber = {0, i+1};
+                otherChanges.back()->serializedPayload.length = testPayloadSize;
+                otherChangesForUse.add_change(otherChanges.back().get(), &mock, DynamicBitmap());
+            }
+        }
+
+        TokenBucketController sController;
+        ReaderLocator mock;
+        std::vector<std::unique_ptr<CacheChange_t>> testChanges;
+        std::vector<std::unique_ptr<CacheChange_t>> otherChanges;
+        RTPSWriterCollector<ReaderLocator*> testChangesForUse;
+        RTPSWriterCollector<ReaderLocator*> otherChangesForUse;
+};
+
+TEST_F(TokenBucketControllerTests, token_bucket_lets_only_the_burst_through)
+{
+    // When
+    sController(testChangesForUse);
+
+    // Then
+    ASSERT_EQ(bucketSize/testPayloadSize, testChangesForUse.size());
+    ASSERT_GE(sController.available_bytes(), bucketSize % testPayloadSize);
+}
+
+TEST_F(TokenBucketControllerTests, token_bucket_carries_over_multiple_attempts)
+{
+    // Given
+    sController(testChangesForUse);
+
+    // When
+    sController(otherChangesForUse);
+
+    // Then
+    ASSERT_EQ(0u, otherChangesForUse.size());
+}
+
+TEST_F(TokenBucketControllerTests, token_bucket_refills_after_its_period)
+{
+    // Given
+    sController(testChangesForUse);
+    ASSERT_EQ(5u, testChangesForUse.size());
+
+    // When
+    std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 20));
+
+    // Then
+    EXPECT_EQ(bucketSize, sController.available_bytes());
+    sController(otherChangesForUse);
+    EXPECT_EQ(5u, otherChangesForUse.size());
+}
+
+TEST_F(TokenBucketControllerTests, token_bucket_refills_proportionally_to_elapsed_time)
+{
+    // Given an empty bucket
+    sController(testChangesForUse);
+    while(sController.available_bytes() >= testPayloadSize)
+    {
+        sController(otherChangesForUse);
+    }
+
+    // When half the period elapses
+    std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs / 2));
+
+    // Then roughly half the bucket is available, but not all of it
+    uint32_t available = sController.available_bytes();
+    EXPECT_GE(available, bucketSize / 2 - testPayloadSize);
+    EXPECT_LT(available, bucketSize);
+}
+
+TEST_F(TokenBucketControllerTests, token_bucket_wakes_up_the_writer_only_when_drained)
+{
+    // The mock of AsyncWriterThread never accesses the writer.
+    TokenBucketController controller(testDescriptor, reinterpret_cast<const RTPSWriter*>(this));
+    uint32_t wakeUps = AsyncWriterThread::wakeUpCount();
+
+    // Given changes that fit in the bucket
+    testChangesForUse.clear();
+    for(unsigned int i = 0; i < 3; ++i)
+    {
+        testChangesForUse.add_change(testChanges[i].get(), &mock, DynamicBitmap());
+    }
+    controller(testChangesForUse);
+    ASSERT_EQ(3u, testChangesForUse.size());
+
+    // No wake up is scheduled
+    std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 20));
+    EXPECT_EQ(wakeUps, AsyncWriterThread::wakeUpCount());
+
+    // When the bucket drains
+    controller(otherChangesForUse);
+    ASSERT_EQ(5u, otherChangesForUse.size());
+
+    // Then a single wake up is scheduled, even if the controller runs several times
+    testChangesForUse.clear();
+    for(auto& change : testChanges)
+    {
+        testChangesForUse.add_change(change.get(), &mock, DynamicBitmap());
+    }
+    controller(testChangesForUse);
+    controller(testChangesForUse);
+    std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 20));
+    EXPECT_EQ(wakeUps + 1, AsyncWriterThread::wakeUpCount());
+}
+
+TEST_F(TokenBucketControllerTests, token_bucket_accounts_the_size_of_each_fragment)
+{
+    // Given fragmented changes of 1050 bytes. The last fragment has only 50 bytes.
+    testChangesForUse.clear();
+
+    DynamicBitmap fragmentSet(11, true);
+
+    for(auto& change : testChanges)
+    {
+        change->serializedPayload.length = 1050;
+        change->setFragmentSize(100);
+        testChangesForUse.add_change(change.get(), &mock, fragmentSet);
+    }
+
+    // When
+    sController(testChangesForUse);
+
+    // Then
+    // 5 changes take 5250 bytes, and 2 more fragments of the next one fit
+    ASSERT_EQ(57u, testChangesForUse.size());
+}
+
+TEST_F(TokenBucketControllerTests, token_bucket_clears_a_change_bigger_than_the_bucket_when_full)
+{
+    // Given
+    testChangesForUse.clear();
+    testChanges.front()->serializedPayload.length = bucketSize * 2;
+    testChangesForUse.add_change(testChanges.front().get(), &mock, DynamicBitmap());
+    testChangesForUse.add_change(testChanges.back().get(), &mock, DynamicBitmap());
+
+    // When
+    sController(testChangesForUse);
+
+    // Then
+    ASSERT_EQ(1u, testChangesForUse.size());
+    EXPECT_LT(sController.available_bytes(), testPayloadSize);
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
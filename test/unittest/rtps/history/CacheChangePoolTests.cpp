@@ -0,0 +1,182 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/rtps/history/CacheChangePool.h>
+#include <fastrtps/rtps/common/CacheChange.h>
+#include <rtps/history/SizeClassFreeList.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+TEST(SizeClassFreeListTests, push_pop_until_full)
+{
+    CacheChange_t changes[4];
+    SizeClassFreeList free_list(4);
+    CacheChange_t* ch = nullptr;
+
+    ASSERT_FALSE(free_list.pop(&ch));
+    for(CacheChange_t& change : changes)
+    {
+        ASSERT_TRUE(free_list.push(&change));
+    }
+    ASSERT_FALSE(free_list.push(&changes[0]));
+
+    for(CacheChange_t& change : changes)
+    {
+        ASSERT_TRUE(free_list.pop(&ch));
+        ASSERT_EQ(&change, ch);
+    }
+    ASSERT_FALSE(free_list.pop(&ch));
+}
+
+TEST(CacheChangePoolTests, pooled_size_class_rounds_and_reuses)
+{
+    CacheChangePool pool(10, 100, 0, POOLED_SIZE_CLASS_MEMORY_MODE);
+
+    CacheChange_t* small = nullptr;
+    ASSERT_TRUE(pool.reserve_Cache(&small, 100));
+    ASSERT_EQ(128u, small->serializedPayload.max_size);
+
+    CacheChange_t* big = nullptr;
+    ASSERT_TRUE(pool.reserve_Cache(&big, 1000000));
+    ASSERT_EQ(1048576u, big->serializedPayload.max_size);
+
+    pool.release_Cache(small);
+    pool.release_Cache(big);
+
+    // Released changes are given again to requests of their size class.
+    CacheChange_t* ch = nullptr;
+    ASSERT_TRUE(pool.reserve_Cache(&ch, 1048576));
+    ASSERT_EQ(big, ch);
+    pool.release_Cache(ch);
+    ASSERT_TRUE(pool.reserve_Cache(&ch, 65));
+    ASSERT_EQ(small, ch);
+    pool.release_Cache(ch);
+
+    ASSERT_EQ(2u, pool.get_allCachesSize());
+}
+
+TEST(CacheChangePoolTests, pooled_size_class_respects_maximum)
+{
+    CacheChangePool pool(1, 100, 2, POOLED_SIZE_CLASS_MEMORY_MODE);
+
+    CacheChange_t* changes[3] = {nullptr, nullptr, nullptr};
+    ASSERT_TRUE(pool.reserve_Cache(&changes[0], 100));
+    ASSERT_TRUE(pool.reserve_Cache(&changes[1], 100));
+    ASSERT_TRUE(pool.reserve_Cache(&changes[2], 100));
+    CacheChange_t* ch = nullptr;
+    ASSERT_FALSE(pool.reserve_Cache(&ch, 100));
+
+    // A free change of a smaller class is grown when the pool is full.
+    pool.release_Cache(changes[0]);
+    ASSERT_TRUE(pool.reserve_Cache(&ch, 5000));
+    ASSERT_EQ(changes[0], ch);
+    ASSERT_LE(5000u, ch->serializedPayload.max_size);
+
+    pool.release_Cache(ch);
+    pool.release_Cache(changes[1]);
+    pool.release_Cache(changes[2]);
+}
+
+TEST(CacheChangePoolTests, pooled_size_class_concurrent)
+{
+    CacheChangePool pool(10, 100, 0, POOLED_SIZE_CLASS_MEMORY_MODE);
+    const uint32_t sizes[] = {100, 1000, 100000};
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> threads;
+
+    for(uint32_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&pool, &sizes, &failed, t]()
+        {
+            for(uint32_t i = 0; i < 10000; ++i)
+            {
+                CacheChange_t* ch = nullptr;
+                uint32_t size = sizes[(i + t) % 3];
+                if(!pool.reserve_Cache(&ch, size) || ch->serializedPayload.max_size < size)
+                {
+                    failed = true;
+                    return;
+                }
+                // Detect two threads owning the same change.
+                ch->serializedPayload.data[0] = static_cast<octet>(t);
+                std::this_thread::yield();
+                if(ch->serializedPayload.data[0] != static_cast<octet>(t))
+                {
+                    failed = true;
+                }
+                pool.release_Cache(ch);
+            }
+        });
+    }
+
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_FALSE(failed);
+    ASSERT_GE(12u, pool.get_allCachesSize());
+}
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class CacheChangePoolSizeClassTests : public ::testing::Test
+{
+    protected:
+
+        CacheChange_t* allocate_sized(CacheChangePool& pool, uint32_t index, uint32_t dataSize)
+        {
+            return pool.allocateSized(index, dataSize);
+        }
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+TEST_F(CacheChangePoolSizeClassTests, full_pool_reuses_a_change_released_to_its_class)
+{
+    CacheChangePool pool(1, 100, 1, POOLED_SIZE_CLASS_MEMORY_MODE);
+
+    CacheChange_t* first = nullptr;
+    CacheChange_t* second = nullptr;
+    ASSERT_TRUE(pool.reserve_Cache(&first, 100));
+    ASSERT_TRUE(pool.reserve_Cache(&second, 100));
+    CacheChange_t* ch = nullptr;
+    ASSERT_FALSE(pool.reserve_Cache(&ch, 100));
+
+    // Another thread releases a change after the lock-free pop of reserve_Cache found the class empty.
+    // 100 bytes belong to the 128 bytes class, which is the second one.
+    pool.release_Cache(first);
+    ch = allocate_sized(pool, 1, 100);
+    ASSERT_EQ(first, ch);
+
+    pool.release_Cache(ch);
+    pool.release_Cache(second);
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
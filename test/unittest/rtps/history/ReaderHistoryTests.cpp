@@ -0,0 +1,242 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/rtps/history/ReaderHistory.h>
+#include <fastrtps/rtps/reader/RTPSReader.h>
+#include <fastrtps/log/Log.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class ReaderMock : public RTPSReader
+{
+    public:
+
+        ReaderMock()
+        {
+            ON_CALL(*this, change_removed_by_history_mock(_, _)).WillByDefault(Return(true));
+        }
+
+        bool matched_writer_add(RemoteWriterAttributes&) override { return true; }
+
+        bool matched_writer_remove(RemoteWriterAttributes&) override { return true; }
+};
+
+class TestReaderHistory : public ReaderHistory
+{
+    public:
+
+        TestReaderHistory(RTPSReader* reader, std::recursive_mutex* mutex)
+            : ReaderHistory(HistoryAttributes(PREALLOCATED_MEMORY_MODE, 16, 100, 0))
+        {
+            mp_reader = reader;
+            mp_mutex = mutex;
+        }
+
+        const std::vector<CacheChange_t*>& changes() const { return m_changes; }
+};
+
+class ReaderHistoryTests : public ::testing::Test
+{
+    protected:
+
+        ReaderHistoryTests()
+            : history(&reader, &mutex)
+        {
+        }
+
+        ~ReaderHistoryTests()
+        {
+            history.remove_all_changes();
+        }
+
+        CacheChange_t* new_change(uint32_t writer, int32_t sequence)
+        {
+            CacheChange_t* change = nullptr;
+            EXPECT_TRUE(history.reserve_Cache(&change, 0));
+            change->writerGUID.guidPrefix.value[0] = 1;
+            change->writerGUID.entityId = writer;
+            change->sequenceNumber = SequenceNumber_t(0, static_cast<uint32_t>(sequence));
+            return change;
+        }
+
+        //! The history is sorted by sequence number, and equal sequence numbers keep their arrival order.
+        void check_history(const std::vector<CacheChange_t*>& arrival_order)
+        {
+            std::vector<CacheChange_t*> expected(arrival_order);
+            std::stable_sort(expected.begin(), expected.end(), [](CacheChange_t* a, CacheChange_t* b)
+            {
+                return a->sequenceNumber < b->sequenceNumber;
+            });
+            ASSERT_EQ(expected, history.changes());
+
+            CacheChange_t* min_change = nullptr;
+            CacheChange_t* max_change = nullptr;
+            ASSERT_EQ(!expected.empty(), history.get_min_change(&min_change));
+            ASSERT_EQ(!expected.empty(), history.get_max_change(&max_change));
+            if(!expected.empty())
+            {
+                ASSERT_EQ(expected.front(), min_change);
+                ASSERT_EQ(expected.back(), max_change);
+            }
+        }
+
+        std::recursive_mutex mutex;
+        NiceMock<ReaderMock> reader;
+        TestReaderHistory history;
+};
+
+TEST_F(ReaderHistoryTests, changes_in_order_are_appended)
+{
+    std::vector<CacheChange_t*> added;
+    for(int32_t sequence = 1; sequence <= 10; ++sequence)
+    {
+        added.push_back(new_change(1, sequence));
+        ASSERT_TRUE(history.add_change(added.back()));
+        check_history(added);
+    }
+}
+
+TEST_F(ReaderHistoryTests, changes_out_of_order_are_inserted_in_place)
+{
+    std::vector<CacheChange_t*> added;
+    for(int32_t sequence : { 5, 1, 9, 3, 7, 2, 10, 4, 8, 6 })
+    {
+        added.push_back(new_change(1, sequence));
+        ASSERT_TRUE(history.add_change(added.back()));
+        check_history(added);
+    }
+}
+
+TEST_F(ReaderHistoryTests, writers_sharing_sequence_numbers_keep_arrival_order)
+{
+    std::vector<CacheChange_t*> added;
+    for(int32_t sequence : { 1, 2, 3 })
+    {
+        for(uint32_t writer : { 1u, 2u, 3u })
+        {
+            added.push_back(new_change(writer, sequence));
+            ASSERT_TRUE(history.add_change(added.back()));
+        }
+    }
+    // A late change of an already present sequence number goes after the ones received before.
+    added.push_back(new_change(4, 2));
+    ASSERT_TRUE(history.add_change(added.back()));
+    check_history(added);
+}
+
+TEST_F(ReaderHistoryTests, remove_change_matches_the_writer)
+{
+    std::vector<CacheChange_t*> added;
+    for(uint32_t writer : { 1u, 2u, 3u })
+    {
+        added.push_back(new_change(writer, 7));
+        ASSERT_TRUE(history.add_change(added.back()));
+    }
+
+    // The rest of the changes are removed when the test finishes.
+    EXPECT_CALL(reader, change_removed_by_history_mock(_, _)).Times(AnyNumber());
+
+    CacheChange_t* second_writer_change = added[1];
+    EXPECT_CALL(reader, change_removed_by_history_mock(second_writer_change, _)).WillOnce(Return(true));
+    ASSERT_TRUE(history.remove_change(second_writer_change));
+    added.erase(added.begin() + 1);
+    check_history(added);
+
+    // A change of the same sequence number from a writer that is not in the history is not found.
+    CacheChange_t* unknown_writer_change = new_change(4, 7);
+    EXPECT_CALL(reader, change_removed_by_history_mock(unknown_writer_change, _)).Times(0);
+    ASSERT_FALSE(history.remove_change(unknown_writer_change));
+    history.release_Cache(unknown_writer_change);
+    check_history(added);
+}
+
+TEST_F(ReaderHistoryTests, remove_change_keeps_order_and_bounds)
+{
+    std::vector<CacheChange_t*> added;
+    for(int32_t sequence = 1; sequence <= 5; ++sequence)
+    {
+        added.push_back(new_change(1, sequence));
+        ASSERT_TRUE(history.add_change(added.back()));
+    }
+
+    // Middle, front and back.
+    for(size_t index : { 2u, 0u, 2u })
+    {
+        ASSERT_TRUE(history.remove_change(added[index]));
+        added.erase(added.begin() + static_cast<std::ptrdiff_t>(index));
+        check_history(added);
+    }
+
+    ASSERT_TRUE(history.remove_change(added[0]));
+    ASSERT_TRUE(history.remove_change(added[1]));
+    added.clear();
+    check_history(added);
+}
+
+TEST_F(ReaderHistoryTests, random_insertions_and_removals_keep_the_history_sorted)
+{
+    std::mt19937 generator(20181016);
+    std::uniform_int_distribution<uint32_t> writer_distribution(1, 4);
+    std::uniform_int_distribution<int32_t> sequence_distribution(1, 30);
+    std::bernoulli_distribution remove_distribution(0.3);
+
+    std::vector<CacheChange_t*> added;
+    for(int step = 0; step < 2000; ++step)
+    {
+        if(!added.empty() && (added.size() == 90 || remove_distribution(generator)))
+        {
+            size_t index = std::uniform_int_distribution<size_t>(0, added.size() - 1)(generator);
+            ASSERT_TRUE(history.remove_change(added[index]));
+            added.erase(added.begin() + static_cast<std::ptrdiff_t>(index));
+        }
+        else
+        {
+            // A writer never sends the same sequence number twice.
+            uint32_t writer;
+            int32_t sequence;
+            do
+            {
+                writer = writer_distribution(generator);
+                sequence = sequence_distribution(generator);
+            }
+            while(std::any_of(added.begin(), added.end(), [&](CacheChange_t* change)
+            {
+                return change->writerGUID.entityId == EntityId_t(writer) &&
+                    change->sequenceNumber == SequenceNumber_t(0, static_cast<uint32_t>(sequence));
+            }));
+
+            added.push_back(new_change(writer, sequence));
+            ASSERT_TRUE(history.add_change(added.back()));
+        }
+        check_history(added);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Log::SetVerbosity(Log::Error);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,158 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/rtps/messages/ReaderRoutes.h>
+#include <fastrtps/rtps/reader/RTPSReader.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+using namespace eprosima::fastrtps::rtps;
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+class ReaderMock : public RTPSReader
+{
+    public:
+
+        ReaderMock(uint32_t entity_id, bool accepts_unknown)
+        {
+            guid_.guidPrefix.value[0] = 1;
+            guid_.entityId = entity_id;
+            ON_CALL(*this, getGuid()).WillByDefault(ReturnRef(guid_));
+            ON_CALL(*this, acceptMsgDirectedTo(_)).WillByDefault(Return(accepts_unknown));
+            ON_CALL(*this, acceptMsgFromWriter(_)).WillByDefault(Return(false));
+        }
+
+        bool matched_writer_add(RemoteWriterAttributes&) override { return true; }
+
+        bool matched_writer_remove(RemoteWriterAttributes&) override { return true; }
+
+        GUID_t guid_;
+};
+
+class ReaderRoutesTests : public ::testing::Test
+{
+    protected:
+
+        ReaderRoutesTests()
+            : first_writer(writer_guid(0x100))
+            , second_writer(writer_guid(0x200))
+        {
+        }
+
+        static GUID_t writer_guid(uint32_t entity_id)
+        {
+            GuidPrefix_t prefix;
+            prefix.value[0] = 2;
+            return GUID_t(prefix, entity_id);
+        }
+
+        std::vector<RTPSReader*> route(const GUID_t& writer, uint32_t generation)
+        {
+            return routes.destinationReaders(c_EntityId_Unknown, writer, generation);
+        }
+
+        ReaderRoutes routes;
+        GUID_t first_writer;
+        GUID_t second_writer;
+};
+
+TEST_F(ReaderRoutesTests, directed_submessages_go_to_the_reader_with_that_entity_id)
+{
+    NiceMock<ReaderMock> first(0x10, true);
+    NiceMock<ReaderMock> second(0x20, false);
+    routes.addReader(&first);
+    routes.addReader(&second);
+
+    EXPECT_CALL(first, acceptMsgFromWriter(_)).Times(0);
+    EXPECT_CALL(second, acceptMsgFromWriter(_)).Times(0);
+
+    ASSERT_TRUE(routes.hasReaders(0x10));
+    ASSERT_TRUE(routes.hasReaders(c_EntityId_Unknown));
+    ASSERT_FALSE(routes.hasReaders(0x30));
+    ASSERT_EQ(routes.destinationReaders(0x10, first_writer, 0), std::vector<RTPSReader*>{&first});
+    ASSERT_EQ(routes.destinationReaders(0x20, first_writer, 0), std::vector<RTPSReader*>{&second});
+    ASSERT_TRUE(routes.destinationReaders(0x30, first_writer, 0).empty());
+}
+
+TEST_F(ReaderRoutesTests, other_submessages_go_to_the_readers_matched_with_the_writer)
+{
+    NiceMock<ReaderMock> first(0x10, true);
+    NiceMock<ReaderMock> second(0x20, true);
+    NiceMock<ReaderMock> not_accepting_unknown(0x30, false);
+    routes.addReader(&first);
+    routes.addReader(&second);
+    routes.addReader(&not_accepting_unknown);
+
+    // Each reader is asked once per writer, then the route is reused.
+    EXPECT_CALL(first, acceptMsgFromWriter(first_writer)).WillOnce(Return(true));
+    EXPECT_CALL(first, acceptMsgFromWriter(second_writer)).WillOnce(Return(false));
+    EXPECT_CALL(second, acceptMsgFromWriter(first_writer)).WillOnce(Return(true));
+    EXPECT_CALL(second, acceptMsgFromWriter(second_writer)).WillOnce(Return(true));
+    EXPECT_CALL(not_accepting_unknown, acceptMsgFromWriter(_)).Times(0);
+
+    for(int i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(route(first_writer, 0), (std::vector<RTPSReader*>{&first, &second}));
+        ASSERT_EQ(route(second_writer, 0), std::vector<RTPSReader*>{&second});
+    }
+}
+
+TEST_F(ReaderRoutesTests, unmatching_a_writer_invalidates_its_route)
+{
+    NiceMock<ReaderMock> reader(0x10, true);
+    routes.addReader(&reader);
+
+    EXPECT_CALL(reader, acceptMsgFromWriter(first_writer))
+        .WillOnce(Return(true))
+        .WillOnce(Return(false));
+
+    ASSERT_EQ(route(first_writer, 0), std::vector<RTPSReader*>{&reader});
+
+    // The reader unmatches the writer, which changes the matching generation of the participant.
+    ASSERT_TRUE(route(first_writer, 1).empty());
+    ASSERT_TRUE(route(first_writer, 1).empty());
+}
+
+TEST_F(ReaderRoutesTests, associating_and_removing_readers_invalidates_the_routes)
+{
+    NiceMock<ReaderMock> first(0x10, true);
+    NiceMock<ReaderMock> second(0x20, true);
+    ON_CALL(first, acceptMsgFromWriter(first_writer)).WillByDefault(Return(true));
+    ON_CALL(second, acceptMsgFromWriter(first_writer)).WillByDefault(Return(true));
+
+    routes.addReader(&first);
+    ASSERT_EQ(route(first_writer, 0), std::vector<RTPSReader*>{&first});
+
+    routes.addReader(&second);
+    ASSERT_EQ(route(first_writer, 0), (std::vector<RTPSReader*>{&first, &second}));
+    ASSERT_EQ(routes.destinationReaders(0x20, first_writer, 0), std::vector<RTPSReader*>{&second});
+
+    routes.removeReader(&first);
+    ASSERT_EQ(route(first_writer, 0), std::vector<RTPSReader*>{&second});
+    ASSERT_TRUE(routes.destinationReaders(0x10, first_writer, 0).empty());
+
+    routes.removeReader(&second);
+    ASSERT_TRUE(route(first_writer, 0).empty());
+    ASSERT_FALSE(routes.hasReaders(c_EntityId_Unknown));
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
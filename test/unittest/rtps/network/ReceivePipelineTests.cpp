@@ -0,0 +1,256 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/network/ReceivePipeline.h>
+#include <fastrtps/rtps/messages/MessageReceiver.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+static const uint32_t s_data_message_size = 44;
+
+// RTPS header followed by a little endian DATA submessage without payload.
+static void fill_data_message(octet* buffer, octet participant, octet writer, uint32_t sequence)
+{
+    memset(buffer, 0, s_data_message_size);
+    memcpy(buffer, "RTPS", 4);
+    buffer[4] = 2;
+    buffer[5] = 2;
+    buffer[8] = participant;
+    buffer[20] = 0x15;
+    buffer[21] = 0x01;
+    buffer[22] = 20;
+    buffer[34] = writer;
+    buffer[35] = 0x02;
+    memcpy(buffer + 40, &sequence, sizeof(sequence));
+}
+
+class RecordingReceiver : public MessageReceiver
+{
+    public:
+
+        RecordingReceiver(uint32_t index, std::vector<std::pair<uint32_t, uint32_t>>* log, std::mutex* mutex)
+            : MessageReceiver(nullptr, nullptr)
+            , index_(index)
+            , log_(log)
+            , mutex_(mutex)
+        {
+        }
+
+        void processCDRMsg(const Locator_t&, CDRMessage_t* msg) override
+        {
+            ASSERT_EQ(s_data_message_size, msg->length);
+            uint32_t writer = static_cast<uint32_t>(msg->buffer[8] << 8 | msg->buffer[34]);
+            uint32_t sequence = 0;
+            memcpy(&sequence, msg->buffer + 40, sizeof(sequence));
+
+            std::lock_guard<std::mutex> lock(*mutex_);
+            log_->emplace_back(writer, sequence);
+            workers_[writer] = index_;
+        }
+
+        static std::map<uint32_t, uint32_t> workers_;
+
+    private:
+
+        uint32_t index_;
+        std::vector<std::pair<uint32_t, uint32_t>>* log_;
+        std::mutex* mutex_;
+};
+
+std::map<uint32_t, uint32_t> RecordingReceiver::workers_;
+
+TEST(ReceivePipelineTests, sender_key_identifies_writer)
+{
+    octet first[s_data_message_size];
+    octet second[s_data_message_size];
+
+    fill_data_message(first, 1, 1, 1);
+    fill_data_message(second, 1, 1, 2);
+    ASSERT_EQ(ReceivePipeline::sender_key(first, s_data_message_size),
+            ReceivePipeline::sender_key(second, s_data_message_size));
+
+    fill_data_message(second, 1, 2, 1);
+    ASSERT_NE(ReceivePipeline::sender_key(first, s_data_message_size),
+            ReceivePipeline::sender_key(second, s_data_message_size));
+
+    fill_data_message(second, 2, 1, 1);
+    ASSERT_NE(ReceivePipeline::sender_key(first, s_data_message_size),
+            ReceivePipeline::sender_key(second, s_data_message_size));
+
+    // Truncated messages are accepted.
+    ReceivePipeline::sender_key(first, 22);
+    ReceivePipeline::sender_key(first, 4);
+}
+
+TEST(ReceivePipelineTests, keeps_order_of_each_writer)
+{
+    const uint32_t num_workers = 4;
+    const uint32_t num_writers = 16;
+    const uint32_t samples = 2000;
+
+    std::vector<std::pair<uint32_t, uint32_t>> log;
+    std::mutex mutex;
+    std::vector<RecordingReceiver*> receivers;
+    for(uint32_t i = 0; i < num_workers; ++i)
+    {
+        receivers.push_back(new RecordingReceiver(i, &log, &mutex));
+    }
+    std::vector<MessageReceiver*> base_receivers(receivers.begin(), receivers.end());
+
+    {
+        ReceivePipeline pipeline(num_workers);
+        ASSERT_EQ(num_workers, pipeline.num_workers());
+
+        Locator_t locator;
+        octet buffer[s_data_message_size];
+        for(uint32_t sequence = 0; sequence < samples; ++sequence)
+        {
+            for(uint32_t writer = 0; writer < num_writers; ++writer)
+            {
+                fill_data_message(buffer, static_cast<octet>(writer % 3), static_cast<octet>(writer), sequence);
+                pipeline.push(base_receivers.data(), buffer, s_data_message_size, locator);
+            }
+        }
+
+        for(;;)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(log.size() == samples * num_writers)
+                {
+                    break;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    std::map<uint32_t, uint32_t> next;
+    for(const auto& entry : log)
+    {
+        ASSERT_EQ(next[entry.first], entry.second);
+        ++next[entry.first];
+    }
+    ASSERT_EQ(num_writers, next.size());
+
+    // Writers are spread among the workers.
+    std::map<uint32_t, uint32_t> writers_per_worker;
+    for(const auto& writer : RecordingReceiver::workers_)
+    {
+        ++writers_per_worker[writer.second];
+    }
+    ASSERT_LT(1u, writers_per_worker.size());
+
+    for(RecordingReceiver* receiver : receivers)
+    {
+        delete receiver;
+    }
+}
+
+class BlockingReceiver : public MessageReceiver
+{
+    public:
+
+        BlockingReceiver()
+            : MessageReceiver(nullptr, nullptr)
+            , processing_(false)
+            , released_(false)
+        {
+        }
+
+        void processCDRMsg(const Locator_t&, CDRMessage_t*) override
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            processing_ = true;
+            changed_.notify_all();
+            changed_.wait(lock, [this]() { return released_; });
+        }
+
+        void wait_processing()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            changed_.wait(lock, [this]() { return processing_; });
+        }
+
+        void release()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            released_ = true;
+            changed_.notify_all();
+        }
+
+    private:
+
+        std::mutex mutex_;
+        std::condition_variable changed_;
+        bool processing_;
+        bool released_;
+};
+
+TEST(ReceivePipelineTests, stop_releases_blocked_push)
+{
+    BlockingReceiver receiver;
+    MessageReceiver* receivers[] = { &receiver };
+    ReceivePipeline pipeline(1);
+
+    Locator_t locator;
+    octet buffer[s_data_message_size];
+    fill_data_message(buffer, 1, 1, 0);
+
+    // The worker blocks on the first datagram, and the rest fill its queue.
+    pipeline.push(receivers, buffer, s_data_message_size, locator);
+    receiver.wait_processing();
+    std::atomic<uint32_t> pushed(0);
+    std::thread receiving_thread([&]()
+    {
+        for(;;)
+        {
+            pipeline.push(receivers, buffer, s_data_message_size, locator);
+            if(++pushed == 1000)
+            {
+                break;
+            }
+        }
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_LT(pushed.load(), 1000u);
+
+    // The worker is still blocked, so stop waits for it. The receiving thread is released meanwhile.
+    std::thread stopping_thread([&pipeline]() { pipeline.stop(); });
+    receiving_thread.join();
+    ASSERT_EQ(1000u, pushed.load());
+
+    receiver.release();
+    stopping_thread.join();
+
+    // Pushing to a stopped pipeline does nothing.
+    pipeline.push(receivers, buffer, s_data_message_size, locator);
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -17,6 +17,7 @@
 #include <fastrtps/rtps/history/CacheChangePool.h>
 
 #include <climits>
+#include <cstring>
 #include <gtest/gtest.h>
 
 using namespace eprosima::fastrtps::rtps;
@@ -164,6 +165,88 @@ TEST_F(PersistenceTest, Reader)
     ASSERT_EQ(seq_map_loaded, seq_map);
 }
 
+/*!
+* @fn TEST_F(PersistenceTest, WriteBehind)
+* @brief This test checks that modifications queued by the write-behind mode are stored, both when loading and
+* when the service is destroyed.
+*/
+TEST_F(PersistenceTest, WriteBehind)
+{
+    const std::string writer_guid("TEST_WRITER");
+    const std::string reader_guid("TEST_READER");
+    const uint32_t num_changes = 100;
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", "test.db");
+    policy.properties().emplace_back("dds.persistence.sqlite3.journal_mode", "wal");
+    policy.properties().emplace_back("dds.persistence.sqlite3.write_behind", "true");
+    policy.properties().emplace_back("dds.persistence.sqlite3.max_latency_ms", "1000");
+    policy.properties().emplace_back("dds.persistence.sqlite3.batch_size", "16");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    CacheChangePool pool(num_changes, 128, 0, MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE);
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    std::vector<CacheChange_t*> changes;
+    std::map<GUID_t, SequenceNumber_t> seq_map_loaded;
+    octet payload[4] = { 1, 2, 3, 4 };
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.reserve(sizeof(payload));
+    memcpy(change.serializedPayload.data, payload, sizeof(payload));
+    change.serializedPayload.length = sizeof(payload);
+
+    // Queued changes should be visible as soon as they are loaded, well before the maximum latency
+    for (uint32_t i = 1; i <= num_changes; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->add_writer_change_to_storage(writer_guid, change));
+    }
+    change.sequenceNumber.low = 1;
+    ASSERT_TRUE(service->remove_writer_change_from_storage(writer_guid, change));
+    ASSERT_TRUE(service->update_writer_seq_on_storage(reader_guid, guid, SequenceNumber_t(0, 10)));
+
+    changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(writer_guid, guid, changes, &pool));
+    ASSERT_EQ(changes.size(), num_changes - 1);
+    ASSERT_EQ(changes.front()->sequenceNumber, SequenceNumber_t(0, 2));
+    ASSERT_EQ(changes.front()->serializedPayload.length, sizeof(payload));
+    ASSERT_EQ(memcmp(changes.front()->serializedPayload.data, payload, sizeof(payload)), 0);
+    for (CacheChange_t* loaded : changes)
+    {
+        pool.release_Cache(loaded);
+    }
+
+    ASSERT_TRUE(service->load_reader_from_storage(reader_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded[guid], SequenceNumber_t(0, 10));
+
+    // Pending modifications should be stored when the service is destroyed
+    change.sequenceNumber.low = 2;
+    ASSERT_TRUE(service->remove_writer_change_from_storage(writer_guid, change));
+    ASSERT_TRUE(service->update_writer_seq_on_storage(reader_guid, guid, SequenceNumber_t(0, 20)));
+    delete service;
+    service = nullptr;
+
+    PropertyPolicy sync_policy;
+    sync_policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    sync_policy.properties().emplace_back("dds.persistence.sqlite3.filename", "test.db");
+    service = PersistenceFactory::create_persistence_service(sync_policy);
+    ASSERT_NE(service, nullptr);
+
+    changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(writer_guid, guid, changes, &pool));
+    ASSERT_EQ(changes.size(), num_changes - 2);
+    ASSERT_EQ(changes.front()->sequenceNumber, SequenceNumber_t(0, 3));
+
+    seq_map_loaded.clear();
+    ASSERT_TRUE(service->load_reader_from_storage(reader_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded[guid], SequenceNumber_t(0, 20));
+}
+
 int main(int argc, char **argv)
 {
     testing::InitGoogleTest(&argc, argv);
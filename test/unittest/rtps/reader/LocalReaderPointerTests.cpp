@@ -0,0 +1,77 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <rtps/reader/LocalReaderPointer.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace eprosima::fastrtps::rtps;
+
+// The pointer never dereferences the reader, so any address is valid for these tests.
+static RTPSReader* const dummy_reader = reinterpret_cast<RTPSReader*>(0x1000);
+
+TEST(LocalReaderPointerTests, instance_gives_access_while_active)
+{
+    LocalReaderPointer pointer(dummy_reader);
+
+    LocalReaderPointer::Instance instance(pointer);
+    ASSERT_TRUE(static_cast<bool>(instance));
+    ASSERT_EQ(dummy_reader, instance.operator->());
+}
+
+TEST(LocalReaderPointerTests, instance_is_empty_after_deactivation)
+{
+    LocalReaderPointer pointer(dummy_reader);
+    pointer.deactivate();
+
+    LocalReaderPointer::Instance instance(pointer);
+    ASSERT_FALSE(static_cast<bool>(instance));
+}
+
+TEST(LocalReaderPointerTests, deactivate_waits_for_instances)
+{
+    LocalReaderPointer pointer(dummy_reader);
+    std::atomic<bool> deactivated(false);
+
+    std::unique_ptr<LocalReaderPointer::Instance> instance(new LocalReaderPointer::Instance(pointer));
+    ASSERT_TRUE(static_cast<bool>(*instance));
+
+    std::thread deactivator([&]()
+    {
+        pointer.deactivate();
+        deactivated = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_FALSE(deactivated);
+
+    // New instances are empty while waiting.
+    {
+        LocalReaderPointer::Instance other(pointer);
+        ASSERT_FALSE(static_cast<bool>(other));
+    }
+
+    instance.reset();
+    deactivator.join();
+    ASSERT_TRUE(deactivated);
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,370 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/resources/AsyncWriterScheduler.h>
+#include <fastrtps/rtps/writer/RTPSWriter.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+static const std::chrono::seconds s_timeout(5);
+
+//! Records in a shared log each time it is sent. Sending can be blocked until released.
+class TestWriter : public RTPSWriter
+{
+    public:
+
+        TestWriter(std::mutex& mutex, std::condition_variable& cv, std::vector<int>& log, int id)
+            : mutex_(mutex)
+            , cv_(cv)
+            , log_(log)
+            , id_(id)
+            , blocked_(false)
+            , sending_(false)
+            , sends_(0)
+        {
+        }
+
+        bool matched_reader_add(RemoteReaderAttributes&) override { return true; }
+
+        bool matched_reader_remove(RemoteReaderAttributes&) override { return true; }
+
+        void send_any_unsent_changes() override
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            EXPECT_FALSE(sending_);
+            sending_ = true;
+            log_.push_back(id_);
+            ++sends_;
+            cv_.notify_all();
+            cv_.wait(lock, [this]() { return !blocked_; });
+            sending_ = false;
+        }
+
+        //! Makes the following sends wait until released. Call with the mutex taken.
+        void block_nts() { blocked_ = true; }
+
+        void release()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            blocked_ = false;
+            cv_.notify_all();
+        }
+
+        //! Call with the mutex taken.
+        bool sending_nts() const { return sending_; }
+
+        //! Call with the mutex taken.
+        unsigned int sends_nts() const { return sends_; }
+
+    private:
+
+        std::mutex& mutex_;
+        std::condition_variable& cv_;
+        std::vector<int>& log_;
+        int id_;
+        bool blocked_;
+        bool sending_;
+        unsigned int sends_;
+};
+
+//! Removes itself from its scheduler the first time it is sent, and optionally deletes itself afterwards.
+class SelfRemovingWriter : public RTPSWriter
+{
+    public:
+
+        SelfRemovingWriter(AsyncWriterScheduler& scheduler, std::mutex& mutex, std::condition_variable& cv,
+                bool& removed, bool delete_itself = false)
+            : scheduler_(scheduler)
+            , mutex_(mutex)
+            , cv_(cv)
+            , removed_(removed)
+            , delete_itself_(delete_itself)
+        {
+        }
+
+        bool matched_reader_add(RemoteReaderAttributes&) override { return true; }
+
+        bool matched_reader_remove(RemoteReaderAttributes&) override { return true; }
+
+        void send_any_unsent_changes() override
+        {
+            bool removed = scheduler_.remove_writer(*this);
+            std::mutex& mutex = mutex_;
+            std::condition_variable& cv = cv_;
+            bool& removed_flag = removed_;
+
+            if(delete_itself_)
+            {
+                delete this;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            removed_flag = removed;
+            cv.notify_all();
+        }
+
+    private:
+
+        AsyncWriterScheduler& scheduler_;
+        std::mutex& mutex_;
+        std::condition_variable& cv_;
+        bool& removed_;
+        bool delete_itself_;
+};
+
+class AsyncWriterSchedulerTests : public ::testing::Test
+{
+    public:
+
+        std::unique_ptr<TestWriter> make_writer(int id)
+        {
+            return std::unique_ptr<TestWriter>(new TestWriter(mutex, cv, log, id));
+        }
+
+        template<class Predicate>
+        bool wait(Predicate predicate)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            return cv.wait_for(lock, s_timeout, predicate);
+        }
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<int> log;
+};
+
+TEST_F(AsyncWriterSchedulerTests, WakeUpSendsTheWriter)
+{
+    AsyncWriterScheduler scheduler(1);
+    auto writer = make_writer(1);
+    scheduler.add_writer(*writer, 0);
+
+    AsyncWriterScheduler::wake_up(*writer);
+
+    ASSERT_TRUE(wait([&]() { return writer->sends_nts() == 1; }));
+    EXPECT_TRUE(scheduler.remove_writer(*writer));
+    EXPECT_EQ(0u, scheduler.num_writers());
+}
+
+TEST_F(AsyncWriterSchedulerTests, WakeUpOfUnmanagedWriterIsIgnored)
+{
+    AsyncWriterScheduler scheduler(1);
+    auto writer = make_writer(1);
+
+    AsyncWriterScheduler::wake_up(*writer);
+    EXPECT_FALSE(scheduler.remove_writer(*writer));
+
+    scheduler.add_writer(*writer, 0);
+    ASSERT_TRUE(scheduler.remove_writer(*writer));
+    AsyncWriterScheduler::wake_up(*writer);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(0u, writer->sends_nts());
+}
+
+TEST_F(AsyncWriterSchedulerTests, WakeUpsWhileSendingAreCoalesced)
+{
+    AsyncWriterScheduler scheduler(2);
+    auto writer = make_writer(1);
+    scheduler.add_writer(*writer, 0);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        writer->block_nts();
+    }
+    AsyncWriterScheduler::wake_up(*writer);
+    ASSERT_TRUE(wait([&]() { return writer->sending_nts(); }));
+
+    for(int i = 0; i < 100; ++i)
+    {
+        AsyncWriterScheduler::wake_up(*writer);
+    }
+    writer->release();
+
+    // Sent once more for all the wake ups received while it was being sent.
+    ASSERT_TRUE(wait([&]() { return writer->sends_nts() == 2 && !writer->sending_nts(); }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        EXPECT_EQ(2u, writer->sends_nts());
+    }
+
+    scheduler.remove_writer(*writer);
+}
+
+TEST_F(AsyncWriterSchedulerTests, SlowWriterDoesNotDelayOthers)
+{
+    AsyncWriterScheduler scheduler(2);
+    auto slow = make_writer(1);
+    auto fast = make_writer(2);
+    scheduler.add_writer(*slow, 0);
+    scheduler.add_writer(*fast, 0);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        slow->block_nts();
+    }
+    AsyncWriterScheduler::wake_up(*slow);
+    ASSERT_TRUE(wait([&]() { return slow->sending_nts(); }));
+
+    AsyncWriterScheduler::wake_up(*fast);
+    EXPECT_TRUE(wait([&]() { return fast->sends_nts() == 1; }));
+
+    slow->release();
+    scheduler.remove_writer(*slow);
+    scheduler.remove_writer(*fast);
+}
+
+TEST_F(AsyncWriterSchedulerTests, HigherPriorityWritersAreSentFirst)
+{
+    AsyncWriterScheduler scheduler(1);
+    auto blocker = make_writer(0);
+    auto low = make_writer(1);
+    auto high = make_writer(2);
+    auto other_low = make_writer(3);
+    scheduler.add_writer(*blocker, 0);
+    scheduler.add_writer(*low, 0);
+    scheduler.add_writer(*high, 10);
+    scheduler.add_writer(*other_low, 0);
+
+    // The only thread is kept busy while the rest are woken up.
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        blocker->block_nts();
+    }
+    AsyncWriterScheduler::wake_up(*blocker);
+    ASSERT_TRUE(wait([&]() { return blocker->sending_nts(); }));
+
+    AsyncWriterScheduler::wake_up(*low);
+    AsyncWriterScheduler::wake_up(*other_low);
+    AsyncWriterScheduler::wake_up(*high);
+    blocker->release();
+
+    ASSERT_TRUE(wait([&]() { return log.size() == 4; }));
+    EXPECT_EQ((std::vector<int>{0, 2, 1, 3}), log);
+
+    scheduler.remove_writer(*blocker);
+    scheduler.remove_writer(*low);
+    scheduler.remove_writer(*high);
+    scheduler.remove_writer(*other_low);
+}
+
+TEST_F(AsyncWriterSchedulerTests, RemoveWaitsUntilTheWriterIsSent)
+{
+    AsyncWriterScheduler scheduler(1);
+    auto writer = make_writer(1);
+    scheduler.add_writer(*writer, 0);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        writer->block_nts();
+    }
+    AsyncWriterScheduler::wake_up(*writer);
+    ASSERT_TRUE(wait([&]() { return writer->sending_nts(); }));
+
+    std::thread releaser([&]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        writer->release();
+    });
+
+    EXPECT_TRUE(scheduler.remove_writer(*writer));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        EXPECT_FALSE(writer->sending_nts());
+    }
+    releaser.join();
+}
+
+TEST_F(AsyncWriterSchedulerTests, WriterIsNeverSentByTwoThreads)
+{
+    AsyncWriterScheduler scheduler(4);
+    auto writer = make_writer(1);
+    scheduler.add_writer(*writer, 0);
+
+    // TestWriter checks it is not being sent when a send starts.
+    std::vector<std::thread> wakers;
+    for(int i = 0; i < 4; ++i)
+    {
+        wakers.emplace_back([&writer]()
+        {
+            for(int j = 0; j < 1000; ++j)
+            {
+                AsyncWriterScheduler::wake_up(*writer);
+            }
+        });
+    }
+    for(std::thread& waker : wakers)
+    {
+        waker.join();
+    }
+
+    EXPECT_TRUE(scheduler.remove_writer(*writer));
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_GE(writer->sends_nts(), 1u);
+}
+
+TEST_F(AsyncWriterSchedulerTests, LastWriterRemovedFromItsOwnThread)
+{
+    AsyncWriterScheduler scheduler(2);
+    bool removed = false;
+    SelfRemovingWriter self_removing(scheduler, mutex, cv, removed);
+    scheduler.add_writer(self_removing, 0);
+
+    AsyncWriterScheduler::wake_up(self_removing);
+    ASSERT_TRUE(wait([&]() { return removed; }));
+    EXPECT_EQ(0u, scheduler.num_writers());
+
+    // The threads keep serving new writers, and the destructor stops them.
+    auto writer = make_writer(1);
+    scheduler.add_writer(*writer, 0);
+    AsyncWriterScheduler::wake_up(*writer);
+    ASSERT_TRUE(wait([&]() { return writer->sends_nts() == 1; }));
+    EXPECT_TRUE(scheduler.remove_writer(*writer));
+}
+
+TEST_F(AsyncWriterSchedulerTests, WriterDeletedFromItsOwnSend)
+{
+    AsyncWriterScheduler scheduler(1);
+    auto writer = make_writer(1);
+    scheduler.add_writer(*writer, 0);
+
+    bool removed = false;
+    SelfRemovingWriter* self_deleting = new SelfRemovingWriter(scheduler, mutex, cv, removed, true);
+    scheduler.add_writer(*self_deleting, 0);
+
+    // The scheduler must not touch the writer once its send returns.
+    AsyncWriterScheduler::wake_up(*self_deleting);
+    ASSERT_TRUE(wait([&]() { return removed; }));
+    EXPECT_EQ(1u, scheduler.num_writers());
+
+    AsyncWriterScheduler::wake_up(*writer);
+    ASSERT_TRUE(wait([&]() { return writer->sends_nts() == 1; }));
+    EXPECT_TRUE(scheduler.remove_writer(*writer));
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -16,6 +16,8 @@
 #include "mock/MockParentEvent.h"
 #include <thread>
 #include <random>
+#include <memory>
+#include <vector>
 #include <gtest/gtest.h>
 
 class TimedEventEnvironment : public ::testing::Environment
@@ -685,6 +687,66 @@ TEST(TimedEventMultithread, EventNonAutoDestruc_FourAutoRestart)
     ASSERT_EQ(MockEvent::destructed_, 1);
 }
 
+/*!
+ * @fn TEST(TimedEvent, EventNonAutoDestruc_ManyEventsExpireInBatch)
+ * @brief This test checks that a large number of events armed at the same time all expire once,
+ * while half of them are cancelled.
+ */
+TEST(TimedEvent, EventNonAutoDestruc_ManyEventsExpireInBatch)
+{
+    const int num_events = 2000;
+    std::vector<std::unique_ptr<MockEvent>> events;
+
+    for(int i = 0; i < num_events; ++i)
+    {
+        events.emplace_back(new MockEvent(env->service_, *env->thread_, 50 + (i % 10), false));
+    }
+
+    for(auto& event : events)
+    {
+        event->restart_timer();
+    }
+
+    for(int i = 0; i < num_events; i += 2)
+    {
+        events[i]->cancel_timer();
+    }
+
+    for(auto& event : events)
+    {
+        ASSERT_TRUE(event->wait(1000));
+    }
+
+    for(int i = 0; i < num_events; ++i)
+    {
+        ASSERT_EQ(events[i]->successed_.load(std::memory_order_relaxed), i % 2);
+        ASSERT_EQ(events[i]->cancelled_.load(std::memory_order_relaxed), 1 - i % 2);
+    }
+}
+
+/*!
+ * @fn TEST(TimedEvent, EventNonAutoDestruc_LongIntervalNotEarly)
+ * @brief This test checks that events beyond the first level of the timer wheel
+ * expire after their interval and not before.
+ */
+TEST(TimedEvent, EventNonAutoDestruc_LongIntervalNotEarly)
+{
+    MockEvent short_event(env->service_, *env->thread_, 20, false);
+    MockEvent long_event(env->service_, *env->thread_, 700, false);
+
+    auto start = std::chrono::steady_clock::now();
+    long_event.restart_timer();
+    short_event.restart_timer();
+
+    short_event.wait();
+    ASSERT_EQ(long_event.successed_.load(std::memory_order_relaxed), 0);
+
+    long_event.wait();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_GE(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(), 700);
+    ASSERT_EQ(long_event.successed_.load(std::memory_order_relaxed), 1);
+}
+
 int main(int argc, char **argv)
 {
     testing::InitGoogleTest(&argc, argv);
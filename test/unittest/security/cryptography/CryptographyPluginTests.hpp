@@ -24,6 +24,7 @@
 #include <openssl/rand.h>
 #include <cstdlib>
 #include <cstring>
+#include <set>
 
 class CryptographyPluginTest : public ::testing::Test
 {
@@ -422,14 +423,20 @@ TEST_F(CryptographyPluginTest, transform_RTPSMessage)
     //Perform sample message exchange
     receivers.clear();
 
-    //Send message to intended participant
+    //Send message to intended participant, going through several sessions (maxblockspersession is 16)
     receivers.push_back(ParticipantA_remote);
     receivers.push_back(unintended_remote);
-    ASSERT_TRUE(CryptoPlugin->cryptotransform()->encode_rtps_message(encoded_rtps_message, plain_rtps_message,*ParticipantA,receivers,exception));
-    encoded_rtps_message.pos = 0;
-    ASSERT_TRUE(CryptoPlugin->cryptotransform()->decode_rtps_message(decoded_rtps_message,encoded_rtps_message,*ParticipantB,*ParticipantB_remote,exception));
-    ASSERT_TRUE(plain_rtps_message.length == decoded_rtps_message.length);
-    ASSERT_TRUE(memcmp(plain_rtps_message.buffer, decoded_rtps_message.buffer, decoded_rtps_message.length) == 0);
+    for(int i=0;i<50;i++)
+    {
+        ASSERT_TRUE(CryptoPlugin->cryptotransform()->encode_rtps_message(encoded_rtps_message, plain_rtps_message,*ParticipantA,receivers,exception));
+        encoded_rtps_message.pos = 0;
+        ASSERT_TRUE(CryptoPlugin->cryptotransform()->decode_rtps_message(decoded_rtps_message,encoded_rtps_message,*ParticipantB,*ParticipantB_remote,exception));
+        ASSERT_TRUE(plain_rtps_message.length == decoded_rtps_message.length);
+        ASSERT_TRUE(memcmp(plain_rtps_message.buffer, decoded_rtps_message.buffer, decoded_rtps_message.length) == 0);
+        plain_rtps_message.pos = 0;
+        encoded_rtps_message.pos = 0;
+        decoded_rtps_message.pos = 0;
+    }
 
 
     CryptoPlugin->keyfactory()->unregister_participant(unintended_remote,exception);
@@ -1426,4 +1433,121 @@ TEST_F(CryptographyPluginTest, transform_preprocess_secure_submessage)
     delete i_handle;
 }
 
+TEST_F(CryptographyPluginTest, transform_KeyExchangeInitializationVectors)
+{
+    // The key exchange writer and reader of both participants encrypt with the same key material, derived from the
+    // shared secret. None of them can use an IV already used by another one.
+
+    eprosima::fastrtps::rtps::security::PKIIdentityHandle* i_handle = new eprosima::fastrtps::rtps::security::PKIIdentityHandle();
+    eprosima::fastrtps::rtps::security::AccessPermissionsHandle* perm_handle = new eprosima::fastrtps::rtps::security::AccessPermissionsHandle();
+    eprosima::fastrtps::rtps::PropertySeq prop_handle;
+    eprosima::fastrtps::rtps::security::ParticipantSecurityAttributes part_sec_attr;
+    eprosima::fastrtps::rtps::security::SharedSecretHandle* shared_secret = new eprosima::fastrtps::rtps::security::SharedSecretHandle();
+
+    eprosima::fastrtps::rtps::security::SecurityException exception;
+
+    part_sec_attr.is_rtps_protected = true;
+    part_sec_attr.plugin_participant_attributes = PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ENCRYPTED |
+        PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ORIGIN_AUTHENTICATED;
+
+    // Several sessions are used by each handle
+    eprosima::fastrtps::rtps::Property prop;
+    prop.name("dds.sec.crypto.maxblockspersession");
+    prop.value("16");
+    prop_handle.push_back(prop);
+
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle *participant_A = CryptoPlugin->keyfactory()->register_local_participant(*i_handle, *perm_handle, prop_handle, part_sec_attr, exception);
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle *participant_B = CryptoPlugin->keyfactory()->register_local_participant(*i_handle, *perm_handle, prop_handle, part_sec_attr, exception);
+    ASSERT_TRUE(participant_A != nullptr);
+    ASSERT_TRUE(participant_B != nullptr);
+
+    //Fill shared secret with dummy values
+    std::vector<uint8_t> dummy_data, challenge_1, challenge_2;
+    eprosima::fastrtps::rtps::security::SharedSecret::BinaryData binary_data;
+    challenge_1.resize(8);
+    challenge_2.resize(8);
+
+    RAND_bytes(challenge_1.data(),8);
+    binary_data.name("Challenge1");
+    binary_data.value(challenge_1);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    RAND_bytes(challenge_2.data(),8);
+    binary_data.name("Challenge2");
+    binary_data.value(challenge_2);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    dummy_data.resize(32);
+    RAND_bytes(dummy_data.data(),32);
+    binary_data.name("SharedSecret");
+    binary_data.value(dummy_data);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle *ParticipantA_remote =CryptoPlugin->keyfactory()->register_matched_remote_participant(*participant_A,*i_handle,*perm_handle,*shared_secret, exception);
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle *ParticipantB_remote =CryptoPlugin->keyfactory()->register_matched_remote_participant(*participant_B,*i_handle,*perm_handle,*shared_secret, exception);
+    ASSERT_TRUE(ParticipantA_remote != nullptr);
+    ASSERT_TRUE(ParticipantB_remote != nullptr);
+
+    eprosima::fastrtps::rtps::security::AESGCMGMAC_ParticipantCryptoHandle& P_A = eprosima::fastrtps::rtps::security::AESGCMGMAC_ParticipantCryptoHandle::narrow(*ParticipantA_remote);
+    eprosima::fastrtps::rtps::security::AESGCMGMAC_ParticipantCryptoHandle& P_B = eprosima::fastrtps::rtps::security::AESGCMGMAC_ParticipantCryptoHandle::narrow(*ParticipantB_remote);
+    ASSERT_TRUE(P_A->Writers.size() == 1);
+    ASSERT_TRUE(P_A->Readers.size() == 1);
+    ASSERT_TRUE(P_B->Writers.size() == 1);
+    ASSERT_TRUE(P_B->Readers.size() == 1);
+    ASSERT_TRUE(P_A->Participant2ParticipantKxKeyMaterial.at(0).master_sender_key ==
+        P_B->Participant2ParticipantKxKeyMaterial.at(0).master_sender_key);
+    ASSERT_TRUE(P_A->Participant2ParticipantKxKeyMaterial.at(0).master_salt ==
+        P_B->Participant2ParticipantKxKeyMaterial.at(0).master_salt);
+
+    char message[] = "My goose is cooked"; //Length 18
+    eprosima::fastrtps::rtps::CDRMessage_t plain_payload;
+    memcpy(plain_payload.buffer, message, 18);
+    plain_payload.length = 18;
+
+    // The session key only depends on the shared key material and the session id, which is part of the IV.
+    // So no (key, IV) pair repeats as long as no IV repeats.
+    std::set<std::array<uint8_t, 12>> used_ivs;
+    const uint32_t messages_per_handle = 100;
+    const size_t iv_position = 4 + 4 + 4; // Submessage header, transformation kind, transformation key id
+
+    std::vector<eprosima::fastrtps::rtps::security::DatawriterCryptoHandle*> writers = { P_A->Writers.at(0), P_B->Writers.at(0) };
+    std::vector<eprosima::fastrtps::rtps::security::DatareaderCryptoHandle*> readers = { P_A->Readers.at(0), P_B->Readers.at(0) };
+    for(uint32_t i = 0; i < messages_per_handle; ++i)
+    {
+        for(auto writer : writers)
+        {
+            std::vector<eprosima::fastrtps::rtps::security::DatareaderCryptoHandle*> receivers;
+            eprosima::fastrtps::rtps::CDRMessage_t encoded_payload;
+            plain_payload.pos = 0;
+            ASSERT_TRUE(CryptoPlugin->cryptotransform()->encode_datawriter_submessage(encoded_payload, plain_payload, *writer, receivers, exception));
+
+            std::array<uint8_t, 12> iv;
+            memcpy(iv.data(), &encoded_payload.buffer[iv_position], 12);
+            ASSERT_TRUE(used_ivs.insert(iv).second);
+        }
+
+        for(auto reader : readers)
+        {
+            std::vector<eprosima::fastrtps::rtps::security::DatawriterCryptoHandle*> receivers;
+            eprosima::fastrtps::rtps::CDRMessage_t encoded_payload;
+            plain_payload.pos = 0;
+            ASSERT_TRUE(CryptoPlugin->cryptotransform()->encode_datareader_submessage(encoded_payload, plain_payload, *reader, receivers, exception));
+
+            std::array<uint8_t, 12> iv;
+            memcpy(iv.data(), &encoded_payload.buffer[iv_position], 12);
+            ASSERT_TRUE(used_ivs.insert(iv).second);
+        }
+    }
+    ASSERT_TRUE(used_ivs.size() == 4 * messages_per_handle);
+
+    CryptoPlugin->keyfactory()->unregister_participant(participant_A, exception);
+    CryptoPlugin->keyfactory()->unregister_participant(ParticipantA_remote, exception);
+    CryptoPlugin->keyfactory()->unregister_participant(participant_B, exception);
+    CryptoPlugin->keyfactory()->unregister_participant(ParticipantB_remote, exception);
+
+    delete shared_secret;
+    delete perm_handle;
+    delete i_handle;
+}
+
 #endif
@@ -0,0 +1,436 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/Semaphore.h>
+#include <fastrtps/transport/SharedMemTransport.h>
+#include <transport/shared_mem/SharedMemPort.h>
+#include <fastrtps/log/Log.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include <memory>
+#include <MockReceiverResource.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+static uint16_t g_default_port = 0;
+
+uint16_t get_port()
+{
+    uint16_t port = static_cast<uint16_t>(getpid());
+
+    if(4000 > port)
+    {
+        port += 4000;
+    }
+
+    return port;
+}
+
+class SharedMemTests: public ::testing::Test
+{
+    public:
+        SharedMemTests()
+        {
+            descriptor.maxMessageSize = 5000;
+            descriptor.port_queue_capacity = 16;
+        }
+
+        SharedMemTransportDescriptor descriptor;
+};
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+class SharedMemPortTests: public SharedMemTests
+{
+    public:
+
+        //! Reserves a slot the way a producer does, without publishing it.
+        static bool reserve(SharedMemPort& port, uint64_t& position)
+        {
+            return port.reserve(position);
+        }
+
+        static bool publish(SharedMemPort& port, uint64_t position, const octet* data, uint32_t size)
+        {
+            return port.publish(position, data, size);
+        }
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+TEST_F(SharedMemTests, locators_with_kind_shm_supported)
+{
+    // Given
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t supportedLocator;
+    supportedLocator.kind = LOCATOR_KIND_SHM;
+    Locator_t unsupportedLocator;
+    unsupportedLocator.kind = LOCATOR_KIND_UDPv4;
+
+    // Then
+    ASSERT_TRUE(transportUnderTest.IsLocatorSupported(supportedLocator));
+    ASSERT_FALSE(transportUnderTest.IsLocatorSupported(unsupportedLocator));
+}
+
+TEST_F(SharedMemTests, default_locators_are_local)
+{
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    LocatorList_t locators;
+    ASSERT_TRUE(transportUnderTest.getDefaultUnicastLocators(locators, g_default_port));
+    ASSERT_EQ(locators.size(), 1u);
+    ASSERT_TRUE(transportUnderTest.is_local_locator(*locators.begin()));
+    ASSERT_TRUE(transportUnderTest.IsLocatorAllowed(*locators.begin()));
+
+    // A locator from another shared memory namespace is not reachable.
+    Locator_t remoteHostLocator = *locators.begin();
+    remoteHostLocator.address[0] ^= 0xFF;
+    ASSERT_FALSE(transportUnderTest.is_local_locator(remoteHostLocator));
+    ASSERT_FALSE(transportUnderTest.IsLocatorAllowed(remoteHostLocator));
+
+    LocatorList_t multicast;
+    transportUnderTest.getDefaultMetatrafficMulticastLocators(multicast, g_default_port);
+    ASSERT_TRUE(multicast.empty());
+}
+
+TEST_F(SharedMemTests, opening_and_closing_input_channel)
+{
+    // Given
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t inputLocator;
+    inputLocator.kind = LOCATOR_KIND_SHM;
+    inputLocator.port = g_default_port;
+
+    // Then
+    ASSERT_FALSE (transportUnderTest.IsInputChannelOpen(inputLocator));
+    ASSERT_TRUE  (transportUnderTest.OpenInputChannel(inputLocator, nullptr, 0x8FFF));
+    ASSERT_TRUE  (transportUnderTest.IsInputChannelOpen(inputLocator));
+    ASSERT_TRUE  (transportUnderTest.CloseInputChannel(inputLocator));
+    ASSERT_FALSE (transportUnderTest.IsInputChannelOpen(inputLocator));
+    ASSERT_FALSE (transportUnderTest.CloseInputChannel(inputLocator));
+}
+
+TEST_F(SharedMemTests, port_cannot_be_opened_twice)
+{
+    SharedMemTransport firstTransport(descriptor);
+    ASSERT_TRUE(firstTransport.init());
+    SharedMemTransport secondTransport(descriptor);
+    ASSERT_TRUE(secondTransport.init());
+
+    Locator_t inputLocator;
+    inputLocator.kind = LOCATOR_KIND_SHM;
+    inputLocator.port = g_default_port;
+
+    ASSERT_TRUE(firstTransport.OpenInputChannel(inputLocator, nullptr, 0x8FFF));
+    ASSERT_FALSE(secondTransport.OpenInputChannel(inputLocator, nullptr, 0x8FFF));
+    ASSERT_TRUE(firstTransport.CloseInputChannel(inputLocator));
+    ASSERT_TRUE(secondTransport.OpenInputChannel(inputLocator, nullptr, 0x8FFF));
+    ASSERT_TRUE(secondTransport.CloseInputChannel(inputLocator));
+}
+
+TEST_F(SharedMemTests, send_and_receive_between_transports)
+{
+    SharedMemTransport receiverTransport(descriptor);
+    ASSERT_TRUE(receiverTransport.init());
+    SharedMemTransport senderTransport(descriptor);
+    ASSERT_TRUE(senderTransport.init());
+
+    LocatorList_t locators;
+    ASSERT_TRUE(receiverTransport.getDefaultUnicastLocators(locators, g_default_port));
+    Locator_t inputLocator = *locators.begin();
+
+    Locator_t outputLocator;
+    outputLocator.kind = LOCATOR_KIND_SHM;
+
+    MockReceiverResource receiver(receiverTransport, inputLocator);
+    MockMessageReceiver *msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    ASSERT_TRUE(receiverTransport.IsInputChannelOpen(inputLocator));
+    ASSERT_TRUE(senderTransport.OpenOutputChannel(outputLocator));
+    octet message[5] = { 'H','e','l','l','o' };
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+    {
+        EXPECT_EQ(memcmp(message,msg_recv->data,5), 0);
+        sem.post();
+    };
+
+    msg_recv->setCallback(recCallback);
+
+    ASSERT_TRUE(senderTransport.Send(message, 5, outputLocator, inputLocator));
+    sem.wait();
+    ASSERT_TRUE(senderTransport.CloseOutputChannel(outputLocator));
+}
+
+TEST_F(SharedMemTests, send_keeps_message_order)
+{
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    LocatorList_t locators;
+    ASSERT_TRUE(transportUnderTest.getDefaultUnicastLocators(locators, g_default_port));
+    Locator_t inputLocator = *locators.begin();
+
+    Locator_t outputLocator;
+    outputLocator.kind = LOCATOR_KIND_SHM;
+
+    MockReceiverResource receiver(transportUnderTest, inputLocator);
+    MockMessageReceiver *msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(outputLocator));
+
+    const octet num_messages = 200;
+    octet expected = 0;
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+    {
+        EXPECT_EQ(msg_recv->data[0], expected);
+        if (++expected == num_messages)
+        {
+            sem.post();
+        }
+    };
+
+    msg_recv->setCallback(recCallback);
+
+    // The queue is smaller than the number of messages, so the sender retries when it is full.
+    for (octet i = 0; i < num_messages; ++i)
+    {
+        while (!transportUnderTest.Send(&i, 1, outputLocator, inputLocator))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    sem.wait();
+    ASSERT_TRUE(transportUnderTest.CloseOutputChannel(outputLocator));
+}
+
+TEST_F(SharedMemTests, send_is_rejected_if_buffer_size_is_bigger_to_size_specified_in_descriptor)
+{
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    LocatorList_t locators;
+    ASSERT_TRUE(transportUnderTest.getDefaultUnicastLocators(locators, g_default_port));
+    Locator_t inputLocator = *locators.begin();
+
+    Locator_t outputLocator;
+    outputLocator.kind = LOCATOR_KIND_SHM;
+
+    ASSERT_TRUE(transportUnderTest.OpenInputChannel(inputLocator, nullptr, 0x8FFF));
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(outputLocator));
+
+    std::vector<octet> sendBufferWrongSize(descriptor.maxMessageSize + 1);
+    ASSERT_FALSE(transportUnderTest.Send(sendBufferWrongSize.data(), (uint32_t)sendBufferWrongSize.size(),
+        outputLocator, inputLocator));
+
+    ASSERT_TRUE(transportUnderTest.CloseOutputChannel(outputLocator));
+    ASSERT_TRUE(transportUnderTest.CloseInputChannel(inputLocator));
+}
+
+TEST_F(SharedMemTests, send_to_closed_port_fails)
+{
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    LocatorList_t locators;
+    ASSERT_TRUE(transportUnderTest.getDefaultUnicastLocators(locators, g_default_port));
+    Locator_t inputLocator = *locators.begin();
+
+    Locator_t outputLocator;
+    outputLocator.kind = LOCATOR_KIND_SHM;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(outputLocator));
+
+    octet message[5] = { 'H','e','l','l','o' };
+    ASSERT_FALSE(transportUnderTest.Send(message, 5, outputLocator, inputLocator));
+
+    ASSERT_TRUE(transportUnderTest.OpenInputChannel(inputLocator, nullptr, 0x8FFF));
+    ASSERT_TRUE(transportUnderTest.Send(message, 5, outputLocator, inputLocator));
+    ASSERT_TRUE(transportUnderTest.CloseInputChannel(inputLocator));
+    ASSERT_FALSE(transportUnderTest.Send(message, 5, outputLocator, inputLocator));
+
+    ASSERT_TRUE(transportUnderTest.CloseOutputChannel(outputLocator));
+}
+
+TEST_F(SharedMemTests, participants_sharing_a_port_number_use_different_segments)
+{
+    SharedMemTransport firstTransport(descriptor);
+    ASSERT_TRUE(firstTransport.init());
+    SharedMemTransport secondTransport(descriptor);
+    ASSERT_TRUE(secondTransport.init());
+
+    LocatorList_t locators;
+    ASSERT_TRUE(firstTransport.getDefaultUnicastLocators(locators, g_default_port));
+    Locator_t firstLocator = *locators.begin();
+    SharedMemTransport::SetParticipantScope(firstLocator, 0, 1);
+    Locator_t secondLocator = firstLocator;
+    SharedMemTransport::SetParticipantScope(secondLocator, 0, 2);
+    Locator_t otherDomainLocator = firstLocator;
+    SharedMemTransport::SetParticipantScope(otherDomainLocator, 1, 1);
+
+    ASSERT_EQ(SharedMemTransport::GetDomainId(otherDomainLocator), 1u);
+    ASSERT_EQ(SharedMemTransport::GetParticipantId(secondLocator), 2u);
+    ASSERT_TRUE(firstTransport.is_local_locator(secondLocator));
+    ASSERT_FALSE(firstTransport.DoInputLocatorsMatch(firstLocator, secondLocator));
+    ASSERT_NE(SharedMemPort::segment_name(0, 1, g_default_port), SharedMemPort::segment_name(0, 2, g_default_port));
+    ASSERT_NE(SharedMemPort::segment_name(0, 1, g_default_port), SharedMemPort::segment_name(1, 1, g_default_port));
+
+    ASSERT_TRUE(firstTransport.OpenInputChannel(firstLocator, nullptr, 0x8FFF));
+    ASSERT_TRUE(secondTransport.OpenInputChannel(secondLocator, nullptr, 0x8FFF));
+    ASSERT_TRUE(secondTransport.OpenInputChannel(otherDomainLocator, nullptr, 0x8FFF));
+    ASSERT_FALSE(secondTransport.OpenInputChannel(firstLocator, nullptr, 0x8FFF));
+
+    ASSERT_TRUE(firstTransport.CloseInputChannel(firstLocator));
+    ASSERT_TRUE(secondTransport.CloseInputChannel(secondLocator));
+    ASSERT_TRUE(secondTransport.CloseInputChannel(otherDomainLocator));
+}
+
+TEST_F(SharedMemPortTests, dead_producer_does_not_block_the_port)
+{
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    LocatorList_t locators;
+    ASSERT_TRUE(transportUnderTest.getDefaultUnicastLocators(locators, g_default_port));
+    Locator_t inputLocator = *locators.begin();
+
+    Locator_t outputLocator;
+    outputLocator.kind = LOCATOR_KIND_SHM;
+
+    MockReceiverResource receiver(transportUnderTest, inputLocator);
+    MockMessageReceiver *msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(outputLocator));
+
+    // A producer process crashes after reserving a slot and before publishing it.
+    pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        std::unique_ptr<SharedMemPort> port = SharedMemPort::open(0, 0, g_default_port);
+        uint64_t position;
+        _exit(port && reserve(*port, position) ? 0 : 1);
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+
+    // Messages behind the lost one are delivered, and the slot is reused once the ring wraps around.
+    const octet num_messages = static_cast<octet>(descriptor.port_queue_capacity * 3);
+    octet expected = 0;
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+    {
+        EXPECT_EQ(msg_recv->data[0], expected);
+        if (++expected == num_messages)
+        {
+            sem.post();
+        }
+    };
+
+    msg_recv->setCallback(recCallback);
+
+    for (octet i = 0; i < num_messages; ++i)
+    {
+        while (!transportUnderTest.Send(&i, 1, outputLocator, inputLocator))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    sem.wait();
+    ASSERT_TRUE(transportUnderTest.CloseOutputChannel(outputLocator));
+}
+
+TEST_F(SharedMemPortTests, segment_of_crashed_listener_is_reclaimed)
+{
+    pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        // Exits without closing the port, leaving the segment behind.
+        std::unique_ptr<SharedMemPort> port = SharedMemPort::create(0, 0, g_default_port, 4, 16);
+        _exit(port ? 0 : 1);
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+
+    ASSERT_EQ(SharedMemPort::open(0, 0, g_default_port), nullptr);
+    std::unique_ptr<SharedMemPort> port = SharedMemPort::create(0, 0, g_default_port, 4, 16);
+    ASSERT_NE(port, nullptr);
+    ASSERT_NE(SharedMemPort::open(0, 0, g_default_port), nullptr);
+}
+
+TEST_F(SharedMemPortTests, stalled_producer_is_skipped_and_gives_back_its_slot)
+{
+    std::unique_ptr<SharedMemPort> consumer = SharedMemPort::create(0, 0, g_default_port, 4, 16);
+    ASSERT_NE(consumer, nullptr);
+    std::unique_ptr<SharedMemPort> producer = SharedMemPort::open(0, 0, g_default_port);
+    ASSERT_NE(producer, nullptr);
+
+    uint64_t stalled;
+    ASSERT_TRUE(reserve(*producer, stalled));
+    octet message = 1;
+    ASSERT_TRUE(producer->push(&message, 1));
+
+    std::vector<octet> received;
+    auto collect = [&](const octet* data, uint32_t size)
+    {
+        ASSERT_EQ(size, 1u);
+        received.push_back(*data);
+    };
+
+    // The producer is alive, so the consumer waits for it before skipping the slot.
+    ASSERT_EQ(consumer->pop_all(collect), 0u);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    ASSERT_EQ(consumer->pop_all(collect), 1u);
+    ASSERT_EQ(received, std::vector<octet>{1});
+
+    // Publishing too late drops the message and gives the slot back.
+    octet late = 0xFF;
+    ASSERT_FALSE(publish(*producer, stalled, &late, 1));
+
+    received.clear();
+    for (octet i = 0; i < 8; ++i)
+    {
+        ASSERT_TRUE(producer->push(&i, 1));
+        ASSERT_EQ(consumer->pop_all(collect), 1u);
+    }
+    ASSERT_EQ(received, (std::vector<octet>{0, 1, 2, 3, 4, 5, 6, 7}));
+}
+
+int main(int argc, char **argv)
+{
+    Log::SetVerbosity(Log::Warning);
+    g_default_port = get_port();
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -14,6 +14,8 @@
 
 #include <fastrtps/utils/Semaphore.h>
 #include <fastrtps/transport/TCPv4Transport.h>
+#include <fastrtps/transport/tcp/RTCPMessageManager.h>
+#include <fastrtps/transport/tcp/RTCPHeader.h>
 #include "mock/MockTCPv4Transport.h"
 #include <gtest/gtest.h>
 #include <thread>
@@ -236,6 +238,197 @@ TEST_F(TCPv4Tests, send_and_receive_between_ports)
     }
     ASSERT_TRUE(sendTransportUnderTest.CloseOutputChannel(outputLocator));
 }
+
+TEST_F(TCPv4Tests, send_and_receive_between_ports_with_async_io)
+{
+    TCPv4TransportDescriptor recvDescriptor;
+    recvDescriptor.add_listener_port(g_default_port);
+    recvDescriptor.wait_for_tcp_negotiation = true;
+    recvDescriptor.async_io = true;
+    TCPv4Transport receiveTransportUnderTest(recvDescriptor);
+    receiveTransportUnderTest.init();
+
+    TCPv4TransportDescriptor sendDescriptor;
+    sendDescriptor.wait_for_tcp_negotiation = true;
+    sendDescriptor.async_io = true;
+    TCPv4Transport sendTransportUnderTest(sendDescriptor);
+    sendTransportUnderTest.init();
+
+    Locator_t inputLocator;
+    inputLocator.kind = LOCATOR_KIND_TCPv4;
+    inputLocator.port = g_default_port;
+    IPLocator::setIPv4(inputLocator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(inputLocator, 7410);
+
+    Locator_t outputLocator;
+    outputLocator.kind = LOCATOR_KIND_TCPv4;
+    IPLocator::setIPv4(outputLocator, 127, 0, 0, 1);
+    outputLocator.port = g_default_port;
+    IPLocator::setLogicalPort(outputLocator, 7410);
+
+    {
+        MockReceiverResource receiver(receiveTransportUnderTest, inputLocator);
+        MockMessageReceiver *msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+        ASSERT_TRUE(receiveTransportUnderTest.IsInputChannelOpen(inputLocator));
+
+        ASSERT_TRUE(sendTransportUnderTest.OpenOutputChannel(outputLocator));
+        octet message[5] = { 'H','e','l','l','o' };
+        const int num_messages = 10;
+
+        // Several messages may arrive in the same read, and all of them have to be delivered.
+        Semaphore sem;
+        std::function<void()> recCallback = [&]()
+        {
+            EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+            sem.post();
+        };
+
+        msg_recv->setCallback(recCallback);
+
+        bool sent = sendTransportUnderTest.Send(message, 5, outputLocator, inputLocator);
+        while (!sent)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            sent = sendTransportUnderTest.Send(message, 5, outputLocator, inputLocator);
+        }
+        for (int i = 1; i < num_messages; ++i)
+        {
+            EXPECT_TRUE(sendTransportUnderTest.Send(message, 5, outputLocator, inputLocator));
+        }
+
+        for (int i = 0; i < num_messages; ++i)
+        {
+            sem.wait();
+        }
+    }
+    ASSERT_TRUE(sendTransportUnderTest.CloseOutputChannel(outputLocator));
+}
+
+TEST_F(TCPv4Tests, send_and_receive_coalesced_messages)
+{
+    TCPv4TransportDescriptor recvDescriptor;
+    recvDescriptor.add_listener_port(g_default_port);
+    recvDescriptor.wait_for_tcp_negotiation = true;
+    TCPv4Transport receiveTransportUnderTest(recvDescriptor);
+    receiveTransportUnderTest.init();
+
+    TCPv4TransportDescriptor sendDescriptor;
+    sendDescriptor.wait_for_tcp_negotiation = true;
+    sendDescriptor.send_coalescing_window_us = 1000;
+    sendDescriptor.send_coalescing_bytes = 64;
+    TCPv4Transport sendTransportUnderTest(sendDescriptor);
+    sendTransportUnderTest.init();
+
+    Locator_t inputLocator;
+    inputLocator.kind = LOCATOR_KIND_TCPv4;
+    inputLocator.port = g_default_port;
+    IPLocator::setIPv4(inputLocator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(inputLocator, 7410);
+
+    Locator_t outputLocator;
+    outputLocator.kind = LOCATOR_KIND_TCPv4;
+    IPLocator::setIPv4(outputLocator, 127, 0, 0, 1);
+    outputLocator.port = g_default_port;
+    IPLocator::setLogicalPort(outputLocator, 7410);
+
+    {
+        MockReceiverResource receiver(receiveTransportUnderTest, inputLocator);
+        MockMessageReceiver *msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+        ASSERT_TRUE(receiveTransportUnderTest.IsInputChannelOpen(inputLocator));
+
+        ASSERT_TRUE(sendTransportUnderTest.OpenOutputChannel(outputLocator));
+        octet message[5] = { 'H','e','l','l','o' };
+        const int num_messages = 30;
+
+        // Some messages are written when the queue reaches 64 bytes and the rest when the window expires.
+        Semaphore sem;
+        std::function<void()> recCallback = [&]()
+        {
+            EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+            sem.post();
+        };
+
+        msg_recv->setCallback(recCallback);
+
+        bool sent = sendTransportUnderTest.Send(message, 5, outputLocator, inputLocator);
+        while (!sent)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            sent = sendTransportUnderTest.Send(message, 5, outputLocator, inputLocator);
+        }
+        for (int i = 1; i < num_messages; ++i)
+        {
+            EXPECT_TRUE(sendTransportUnderTest.Send(message, 5, outputLocator, inputLocator));
+        }
+
+        for (int i = 0; i < num_messages; ++i)
+        {
+            sem.wait();
+        }
+    }
+    ASSERT_TRUE(sendTransportUnderTest.CloseOutputChannel(outputLocator));
+}
+
+TEST_F(TCPv4Tests, coalesced_send_fails_when_the_peer_closes_the_connection)
+{
+    TCPv4TransportDescriptor sendDescriptor;
+    sendDescriptor.wait_for_tcp_negotiation = true;
+    sendDescriptor.send_coalescing_window_us = 1000;
+    sendDescriptor.send_coalescing_bytes = 64;
+    TCPv4Transport sendTransportUnderTest(sendDescriptor);
+    sendTransportUnderTest.init();
+
+    Locator_t inputLocator;
+    inputLocator.kind = LOCATOR_KIND_TCPv4;
+    inputLocator.port = g_default_port;
+    IPLocator::setIPv4(inputLocator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(inputLocator, 7410);
+
+    Locator_t outputLocator;
+    outputLocator.kind = LOCATOR_KIND_TCPv4;
+    IPLocator::setIPv4(outputLocator, 127, 0, 0, 1);
+    outputLocator.port = g_default_port;
+    IPLocator::setLogicalPort(outputLocator, 7410);
+
+    octet message[5] = { 'H','e','l','l','o' };
+    {
+        TCPv4TransportDescriptor recvDescriptor;
+        recvDescriptor.add_listener_port(g_default_port);
+        recvDescriptor.wait_for_tcp_negotiation = true;
+        TCPv4Transport receiveTransportUnderTest(recvDescriptor);
+        receiveTransportUnderTest.init();
+
+        MockReceiverResource receiver(receiveTransportUnderTest, inputLocator);
+        MockMessageReceiver *msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+        ASSERT_TRUE(receiveTransportUnderTest.IsInputChannelOpen(inputLocator));
+
+        Semaphore sem;
+        std::function<void()> recCallback = [&]()
+        {
+            sem.post();
+        };
+        msg_recv->setCallback(recCallback);
+
+        ASSERT_TRUE(sendTransportUnderTest.OpenOutputChannel(outputLocator));
+        bool sent = sendTransportUnderTest.Send(message, 5, outputLocator, inputLocator);
+        while (!sent)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            sent = sendTransportUnderTest.Send(message, 5, outputLocator, inputLocator);
+        }
+        sem.wait();
+    }
+
+    // The peer is gone. Writing the queued messages fails, the channel is closed and the sends are rejected.
+    bool rejected = false;
+    for (int i = 0; i < 500 && !rejected; ++i)
+    {
+        rejected = !sendTransportUnderTest.Send(message, 5, outputLocator, inputLocator);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_TRUE(rejected);
+    ASSERT_TRUE(sendTransportUnderTest.CloseOutputChannel(outputLocator));
+}
 #endif
 
 TEST_F(TCPv4Tests, send_is_rejected_if_buffer_size_is_bigger_to_size_specified_in_descriptor)
@@ -822,6 +1015,176 @@ TEST_F(TCPv4Tests, shrink_locator_lists)
 
 }
 
+TEST_F(TCPv4Tests, buffer_crc_matches_bytewise_crc)
+{
+    std::vector<octet> buffer(70000);
+    for (size_t i = 0; i < buffer.size(); ++i)
+    {
+        buffer[i] = static_cast<octet>(i * 131 + (i >> 8));
+    }
+
+    // Different lengths and misalignments, and initial values close to the overflow.
+    for (uint32_t initial : { 0u, 1u, 0xfffffff0u, 0xffffffffu })
+    {
+        for (size_t offset : { 0u, 1u, 7u })
+        {
+            for (size_t size : { 0u, 1u, 15u, 16u, 17u, 1023u, 65000u })
+            {
+                uint32_t expected = initial;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    RTCPMessageManager::addToCRC(expected, buffer[offset + i]);
+                }
+                EXPECT_EQ(expected, RTCPMessageManager::addToCRC(initial, &buffer[offset], size));
+                EXPECT_EQ(expected, RTCPMessageManager::addToCRCWordwise(initial, &buffer[offset], size));
+            }
+        }
+    }
+
+    // Enough 0xff to overflow several times.
+    std::vector<octet> ones(20000000, 0xff);
+    uint32_t expected = 0;
+    for (octet value : ones)
+    {
+        RTCPMessageManager::addToCRC(expected, value);
+    }
+    EXPECT_EQ(expected, RTCPMessageManager::addToCRC(0, ones.data(), ones.size()));
+    EXPECT_EQ(expected, RTCPMessageManager::addToCRCWordwise(0, ones.data(), ones.size()));
+}
+
+TEST_F(TCPv4Tests, control_header_flags_round_trip)
+{
+    for (octet value = 0; value < 16; ++value)
+    {
+        bool endianess = (value & 1) != 0;
+        bool has_payload = (value & 2) != 0;
+        bool requires_response = (value & 4) != 0;
+        bool skip_crc = (value & 8) != 0;
+
+        TCPControlMsgHeader header;
+        header.setFlags(endianess, has_payload, requires_response);
+        header.setSkipCRC(skip_crc);
+        EXPECT_EQ(endianess, header.getEndianess());
+        EXPECT_EQ(has_payload, header.getHasPayload());
+        EXPECT_EQ(requires_response, header.getRequiresResponse());
+        EXPECT_EQ(skip_crc, header.getSkipCRC());
+
+        // Each setter only changes its own flag.
+        header.setEndianess(endianess ? BIGEND : LITTLEEND);
+        EXPECT_EQ(!endianess, header.getEndianess());
+        EXPECT_EQ(has_payload, header.getHasPayload());
+        EXPECT_EQ(requires_response, header.getRequiresResponse());
+        EXPECT_EQ(skip_crc, header.getSkipCRC());
+
+        header.setHasPayload(!has_payload);
+        EXPECT_EQ(!endianess, header.getEndianess());
+        EXPECT_EQ(!has_payload, header.getHasPayload());
+        EXPECT_EQ(requires_response, header.getRequiresResponse());
+        EXPECT_EQ(skip_crc, header.getSkipCRC());
+
+        header.setRequiresResponse(!requires_response);
+        EXPECT_EQ(!endianess, header.getEndianess());
+        EXPECT_EQ(!has_payload, header.getHasPayload());
+        EXPECT_EQ(!requires_response, header.getRequiresResponse());
+        EXPECT_EQ(skip_crc, header.getSkipCRC());
+
+        header.setSkipCRC(!skip_crc);
+        EXPECT_EQ(!endianess, header.getEndianess());
+        EXPECT_EQ(!has_payload, header.getHasPayload());
+        EXPECT_EQ(!requires_response, header.getRequiresResponse());
+        EXPECT_EQ(!skip_crc, header.getSkipCRC());
+    }
+}
+
+// Gives access to the channels of the transport to check what was negotiated on them.
+class CRCNegotiationTCPv4Transport : public TCPv4Transport
+{
+    public:
+
+        CRCNegotiationTCPv4Transport(const TCPv4TransportDescriptor& descriptor)
+            : TCPv4Transport(descriptor)
+        {
+        }
+
+        //! Number of bound channels, and how many of them skip the CRC.
+        void count_channels(size_t& channels, size_t& skipping_crc)
+        {
+            std::unique_lock<std::mutex> scopedLock(mSocketsMapMutex);
+            channels = mChannelResources.size();
+            skipping_crc = 0;
+            for (auto& channel : mChannelResources)
+            {
+                if (channel.second->GetSkipCRC())
+                {
+                    ++skipping_crc;
+                }
+            }
+        }
+};
+
+TEST_F(TCPv4Tests, skip_crc_negotiation)
+{
+    // Only the side that doesn't check the CRC lets its peer skip it.
+    for (bool sender_checks_crc : { true, false })
+    {
+        TCPv4TransportDescriptor recvDescriptor;
+        recvDescriptor.add_listener_port(g_default_port);
+        recvDescriptor.wait_for_tcp_negotiation = true;
+        recvDescriptor.check_crc = !sender_checks_crc;
+        CRCNegotiationTCPv4Transport receiveTransportUnderTest(recvDescriptor);
+        receiveTransportUnderTest.init();
+
+        TCPv4TransportDescriptor sendDescriptor;
+        sendDescriptor.wait_for_tcp_negotiation = true;
+        sendDescriptor.check_crc = sender_checks_crc;
+        CRCNegotiationTCPv4Transport sendTransportUnderTest(sendDescriptor);
+        sendTransportUnderTest.init();
+
+        Locator_t inputLocator;
+        inputLocator.kind = LOCATOR_KIND_TCPv4;
+        inputLocator.port = g_default_port;
+        IPLocator::setIPv4(inputLocator, 127, 0, 0, 1);
+        IPLocator::setLogicalPort(inputLocator, 7410);
+
+        Locator_t outputLocator = inputLocator;
+
+        {
+            MockReceiverResource receiver(receiveTransportUnderTest, inputLocator);
+            MockMessageReceiver *msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+            ASSERT_TRUE(receiveTransportUnderTest.IsInputChannelOpen(inputLocator));
+
+            ASSERT_TRUE(sendTransportUnderTest.OpenOutputChannel(outputLocator));
+            octet message[5] = { 'H','e','l','l','o' };
+
+            // A receiver that checks the CRC would drop the message if the sender skipped it.
+            Semaphore sem;
+            std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                sem.post();
+            };
+            msg_recv->setCallback(recCallback);
+
+            while (!sendTransportUnderTest.Send(message, 5, outputLocator, inputLocator))
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+            sem.wait();
+
+            size_t channels = 0;
+            size_t skipping_crc = 0;
+            sendTransportUnderTest.count_channels(channels, skipping_crc);
+            EXPECT_EQ(1u, channels);
+            EXPECT_EQ(sender_checks_crc ? 1u : 0u, skipping_crc);
+
+            receiveTransportUnderTest.count_channels(channels, skipping_crc);
+            EXPECT_EQ(1u, channels);
+            EXPECT_EQ(sender_checks_crc ? 0u : 1u, skipping_crc);
+        }
+        ASSERT_TRUE(sendTransportUnderTest.CloseOutputChannel(outputLocator));
+    }
+}
+
 void TCPv4Tests::HELPER_SetDescriptorDefaults()
 {
     descriptor.add_listener_port(g_default_port);
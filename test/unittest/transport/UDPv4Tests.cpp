@@ -215,6 +215,57 @@ TEST_F(UDPv4Tests, send_to_loopback)
 }
 #endif
 
+#if defined(__linux__)
+TEST_F(UDPv4Tests, send_and_receive_batch_between_ports)
+{
+    descriptor.batched_io = true;
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    Locator_t inputLocators[2];
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        inputLocators[i].port = g_default_port + 2 + i;
+        inputLocators[i].kind = LOCATOR_KIND_UDPv4;
+        IPLocator::setIPv4(inputLocators[i], 127, 0, 0, 1);
+    }
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.port = g_default_port + 1;
+    outputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+
+    MockReceiverResource receiver0(transportUnderTest, inputLocators[0]);
+    MockMessageReceiver *msg_recv0 = dynamic_cast<MockMessageReceiver*>(receiver0.CreateMessageReceiver());
+    MockReceiverResource receiver1(transportUnderTest, inputLocators[1]);
+    MockMessageReceiver *msg_recv1 = dynamic_cast<MockMessageReceiver*>(receiver1.CreateMessageReceiver());
+
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(outputChannelLocator));
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(inputLocators[0]));
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(inputLocators[1]));
+    octet message[5] = { 'H','e','l','l','o' };
+
+    Semaphore sem;
+    msg_recv0->setCallback([&]()
+    {
+        EXPECT_EQ(memcmp(message,msg_recv0->data,5), 0);
+        sem.post();
+    });
+    msg_recv1->setCallback([&]()
+    {
+        EXPECT_EQ(memcmp(message,msg_recv1->data,5), 0);
+        sem.post();
+    });
+
+    LocatorList_t destinations;
+    destinations.push_back(inputLocators[0]);
+    destinations.push_back(inputLocators[1]);
+    EXPECT_TRUE(transportUnderTest.SendBatch(message, 5, outputChannelLocator, destinations));
+    sem.wait();
+    sem.wait();
+    ASSERT_TRUE(transportUnderTest.CloseOutputChannel(outputChannelLocator));
+}
+#endif
+
 TEST_F(UDPv4Tests, send_is_rejected_if_buffer_size_is_bigger_to_size_specified_in_descriptor)
 {
     // Given
@@ -0,0 +1,130 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/DynamicBitmap.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace eprosima::fastrtps;
+
+static std::vector<uint32_t> bits_set(const DynamicBitmap& bitmap)
+{
+    std::vector<uint32_t> bits;
+    bitmap.for_each_set([&bits](uint32_t bit) { bits.push_back(bit); });
+    return bits;
+}
+
+TEST(DynamicBitmapTests, assign_sets_only_the_bits_of_the_size)
+{
+    DynamicBitmap bitmap(130, true);
+    ASSERT_EQ(130u, bitmap.size());
+    ASSERT_EQ(130u, bitmap.count());
+    ASSERT_TRUE(bitmap.all());
+    ASSERT_FALSE(bitmap.test(130));
+    ASSERT_EQ(130u, bitmap.find_first_unset());
+
+    bitmap.assign(70, false);
+    ASSERT_EQ(70u, bitmap.size());
+    ASSERT_TRUE(bitmap.none());
+    ASSERT_EQ(70u, bitmap.find_first_set());
+
+    bitmap.clear();
+    ASSERT_EQ(0u, bitmap.size());
+    ASSERT_TRUE(bitmap.all());
+    ASSERT_TRUE(bitmap.none());
+}
+
+TEST(DynamicBitmapTests, set_and_reset_keep_the_count)
+{
+    DynamicBitmap bitmap(100);
+    ASSERT_TRUE(bitmap.set(0));
+    ASSERT_TRUE(bitmap.set(64));
+    ASSERT_TRUE(bitmap.set(99));
+    ASSERT_FALSE(bitmap.set(64));
+    ASSERT_FALSE(bitmap.set(100));
+    ASSERT_EQ(3u, bitmap.count());
+    ASSERT_TRUE(bitmap.test(64));
+
+    ASSERT_TRUE(bitmap.reset(64));
+    ASSERT_FALSE(bitmap.reset(64));
+    ASSERT_FALSE(bitmap.reset(100));
+    ASSERT_EQ(2u, bitmap.count());
+    ASSERT_EQ((std::vector<uint32_t>{0, 99}), bits_set(bitmap));
+}
+
+TEST(DynamicBitmapTests, ranges_return_the_bits_changed)
+{
+    DynamicBitmap bitmap(200);
+    bitmap.set(70);
+    ASSERT_EQ(127u, bitmap.set_range(10, 138));
+    ASSERT_EQ(128u, bitmap.count());
+    ASSERT_EQ(10u, bitmap.find_first_set());
+    ASSERT_EQ(138u, bitmap.find_first_unset(10));
+
+    // Bits out of the bitmap are ignored.
+    ASSERT_EQ(10u, bitmap.set_range(190, 300));
+    ASSERT_EQ(138u, bitmap.count());
+    ASSERT_EQ(200u, bitmap.find_first_unset(190));
+
+    ASSERT_EQ(64u, bitmap.reset_range(0, 74));
+    ASSERT_EQ(74u, bitmap.count());
+    ASSERT_EQ(74u, bitmap.find_first_set());
+    ASSERT_EQ(0u, bitmap.set_range(5, 5));
+    ASSERT_EQ(0u, bitmap.reset_range(150, 100));
+}
+
+TEST(DynamicBitmapTests, find_first_skips_whole_words)
+{
+    DynamicBitmap bitmap(1000, true);
+    ASSERT_EQ(1000u, bitmap.find_first_unset());
+    bitmap.reset(777);
+    ASSERT_EQ(777u, bitmap.find_first_unset());
+    ASSERT_EQ(777u, bitmap.find_first_unset(700));
+    ASSERT_EQ(1000u, bitmap.find_first_unset(778));
+    ASSERT_EQ(778u, bitmap.find_first_set(777));
+    ASSERT_EQ(1000u, bitmap.find_first_set(1000));
+
+    bitmap.reset_range(0, 1000);
+    ASSERT_EQ(1000u, bitmap.find_first_set());
+    bitmap.set(999);
+    ASSERT_EQ(999u, bitmap.find_first_set(1));
+}
+
+TEST(DynamicBitmapTests, completion_in_any_order)
+{
+    const uint32_t size = 12000;
+    DynamicBitmap forward(size);
+    DynamicBitmap backward(size);
+    for(uint32_t i = 0; i < size; ++i)
+    {
+        ASSERT_FALSE(forward.all());
+        ASSERT_FALSE(backward.all());
+        forward.set(i);
+        backward.set(size - 1 - i);
+    }
+    ASSERT_TRUE(forward.all());
+    ASSERT_TRUE(backward.all());
+    ASSERT_EQ(forward, backward);
+
+    backward.reset(5000);
+    ASSERT_NE(forward, backward);
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,133 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/md5.h>
+#include <fastrtps/TopicDataType.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+// Exposes the helpers that getKey implementations use.
+class KeyHashType : public TopicDataType
+{
+    public:
+        bool serialize(void*, SerializedPayload_t*) override { return false; }
+        bool deserialize(SerializedPayload_t*, void*) override { return false; }
+        std::function<uint32_t()> getSerializedSizeProvider(void*) override { return []() { return 0u; }; }
+        void* createData() override { return nullptr; }
+        void deleteData(void*) override {}
+        bool getKey(void*, InstanceHandle_t*, bool) override { return false; }
+
+        using TopicDataType::getKeyHash;
+        using TopicDataType::getThreadKeyBuffer;
+};
+
+static std::string hex(const unsigned char digest[16])
+{
+    char buf[33];
+    for (int i = 0; i < 16; ++i)
+    {
+        snprintf(buf + i * 2, 3, "%02x", digest[i]);
+    }
+    return std::string(buf, 32);
+}
+
+TEST(MD5Tests, RFC1321TestSuite)
+{
+    const char* inputs[] = { "", "a", "abc", "message digest", "abcdefghijklmnopqrstuvwxyz",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+        "12345678901234567890123456789012345678901234567890123456789012345678901234567890" };
+    const char* digests[] = { "d41d8cd98f00b204e9800998ecf8427e", "0cc175b9c0f1b6a831c399e269772661",
+        "900150983cd24fb0d6963f7d28e17f72", "f96b697d7cb7938d525a2f31aaf161d0", "c3fcd3d76192e4007dfb496cca67e13b",
+        "d174ab98d277d9f5a5611c2c9f419d9f", "57edf4a22be3c955ac49da2e2107b67a" };
+
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i)
+    {
+        ASSERT_EQ(md5(inputs[i]), digests[i]);
+
+        unsigned char digest[16];
+        MD5::hash(reinterpret_cast<const unsigned char*>(inputs[i]),
+            static_cast<MD5::size_type>(strlen(inputs[i])), digest);
+        ASSERT_EQ(hex(digest), digests[i]);
+    }
+}
+
+TEST(MD5Tests, HashMatchesIncrementalDigest)
+{
+    std::vector<unsigned char> data(300);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<unsigned char>(i * 31 + 7);
+    }
+
+    // Covers the lengths around the block and the padding boundaries.
+    for (MD5::size_type length = 0; length <= data.size(); ++length)
+    {
+        MD5 incremental;
+        incremental.update(data.data(), length / 2);
+        incremental.update(data.data() + length / 2, length - length / 2);
+        incremental.finalize();
+
+        unsigned char digest[16];
+        MD5::hash(data.data(), length, digest);
+        ASSERT_EQ(memcmp(digest, incremental.digest, 16), 0) << "Length " << length;
+    }
+}
+
+TEST(MD5Tests, KeyHash)
+{
+    const char key[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    InstanceHandle_t handle;
+    memset(handle.value, 0xFF, 16);
+
+    // Keys that fit in the handle are copied.
+    KeyHashType::getKeyHash(key, sizeof(key), sizeof(key), false, &handle);
+    ASSERT_EQ(memcmp(handle.value, key, sizeof(key)), 0);
+    for (size_t i = sizeof(key); i < 16; ++i)
+    {
+        ASSERT_EQ(handle.value[i], 0);
+    }
+
+    unsigned char digest[16];
+    MD5::hash(reinterpret_cast<const unsigned char*>(key), sizeof(key), digest);
+
+    KeyHashType::getKeyHash(key, sizeof(key), sizeof(key), true, &handle);
+    ASSERT_EQ(memcmp(handle.value, digest, 16), 0);
+
+    // The handle of keys that could be bigger than 16 bytes is always the MD5.
+    KeyHashType::getKeyHash(key, sizeof(key), 17, false, &handle);
+    ASSERT_EQ(memcmp(handle.value, digest, 16), 0);
+}
+
+TEST(MD5Tests, ThreadKeyBuffer)
+{
+    char* buffer = KeyHashType::getThreadKeyBuffer(1024);
+    ASSERT_NE(buffer, nullptr);
+    ASSERT_EQ(KeyHashType::getThreadKeyBuffer(512), buffer);
+
+    char* otherBuffer = nullptr;
+    std::thread thread([&otherBuffer]() { otherBuffer = KeyHashType::getThreadKeyBuffer(1024); });
+    thread.join();
+    ASSERT_NE(otherBuffer, buffer);
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
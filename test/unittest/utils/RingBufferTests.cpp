@@ -0,0 +1,106 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/RingBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+
+using namespace eprosima::fastrtps;
+
+static void check_equal(const RingBuffer<int>& buffer, const std::deque<int>& expected)
+{
+    ASSERT_EQ(expected.size(), buffer.size());
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), buffer.begin()));
+}
+
+TEST(RingBufferTests, push_back_respects_max_size)
+{
+    RingBuffer<int> buffer(3);
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_TRUE(buffer.push_back(1));
+    ASSERT_TRUE(buffer.push_back(2));
+    ASSERT_TRUE(buffer.push_back(3));
+    ASSERT_TRUE(buffer.full());
+    ASSERT_FALSE(buffer.push_back(4));
+    check_equal(buffer, {1, 2, 3});
+}
+
+TEST(RingBufferTests, wraps_around)
+{
+    RingBuffer<int> buffer(4);
+    std::deque<int> expected;
+
+    for(int i = 0; i < 20; ++i)
+    {
+        if(buffer.full())
+        {
+            buffer.pop_front();
+            expected.pop_front();
+        }
+        ASSERT_TRUE(buffer.push_back(i));
+        expected.push_back(i);
+        check_equal(buffer, expected);
+        ASSERT_EQ(expected.front(), buffer.front());
+        ASSERT_EQ(expected.back(), buffer.back());
+    }
+}
+
+TEST(RingBufferTests, ordered_insert_and_erase)
+{
+    RingBuffer<int> buffer(16);
+    std::deque<int> expected;
+
+    // Wrap the buffer before inserting in the middle.
+    for(int i = 0; i < 6; ++i)
+    {
+        buffer.push_back(-1);
+        buffer.pop_front();
+    }
+
+    const int values[] = {50, 10, 30, 20, 60, 40, 0, 70, 35, 15};
+    for(int value : values)
+    {
+        buffer.insert(std::upper_bound(buffer.begin(), buffer.end(), value), value);
+        expected.insert(std::upper_bound(expected.begin(), expected.end(), value), value);
+        check_equal(buffer, expected);
+    }
+
+    const int removed[] = {0, 70, 30, 15, 50, 10};
+    for(int value : removed)
+    {
+        auto it = std::lower_bound(buffer.begin(), buffer.end(), value);
+        ASSERT_EQ(value, *it);
+        buffer.erase(it);
+        expected.erase(std::lower_bound(expected.begin(), expected.end(), value));
+        check_equal(buffer, expected);
+    }
+}
+
+TEST(RingBufferTests, insert_fails_when_full)
+{
+    RingBuffer<int> buffer(2);
+    buffer.push_back(1);
+    buffer.push_back(3);
+    ASSERT_TRUE(buffer.end() == buffer.insert(buffer.begin() + 1, 2));
+    check_equal(buffer, {1, 3});
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
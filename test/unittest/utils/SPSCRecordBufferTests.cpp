@@ -0,0 +1,141 @@
+// Copyright 2018 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/SPSCRecordBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+
+static bool produce(SPSCRecordBuffer& buffer, uint32_t value, size_t size)
+{
+    void* record = buffer.reserve(size);
+    if(record == nullptr)
+    {
+        return false;
+    }
+    memset(record, static_cast<int>(value & 0xFF), size);
+    memcpy(record, &value, sizeof(value));
+    buffer.commit();
+    return true;
+}
+
+TEST(SPSCRecordBufferTests, capacity_is_rounded_up)
+{
+    SPSCRecordBuffer buffer(1000);
+    ASSERT_EQ(1024u, buffer.capacity());
+    ASSERT_TRUE(buffer.empty());
+}
+
+TEST(SPSCRecordBufferTests, records_are_consumed_in_order)
+{
+    SPSCRecordBuffer buffer(1024);
+    ASSERT_TRUE(produce(buffer, 1, 8));
+    ASSERT_TRUE(produce(buffer, 2, 100));
+    ASSERT_TRUE(produce(buffer, 3, 4));
+    ASSERT_FALSE(buffer.empty());
+
+    std::vector<uint32_t> values;
+    ASSERT_EQ(3u, buffer.consume([&values](void* record)
+    {
+        uint32_t value;
+        memcpy(&value, record, sizeof(value));
+        values.push_back(value);
+    }));
+    ASSERT_EQ((std::vector<uint32_t>{1, 2, 3}), values);
+    ASSERT_TRUE(buffer.empty());
+}
+
+TEST(SPSCRecordBufferTests, reserve_fails_when_full)
+{
+    SPSCRecordBuffer buffer(256);
+    uint32_t produced = 0;
+    while(produce(buffer, produced, 40))
+    {
+        ++produced;
+    }
+    ASSERT_GT(produced, 0u);
+    ASSERT_EQ(nullptr, buffer.reserve(buffer.capacity()));
+
+    ASSERT_EQ(produced, buffer.consume([](void*) {}));
+    ASSERT_TRUE(produce(buffer, 0, 40));
+}
+
+TEST(SPSCRecordBufferTests, records_wrap_around)
+{
+    SPSCRecordBuffer buffer(256);
+    uint32_t next_produced = 0;
+    uint32_t next_consumed = 0;
+    for(uint32_t i = 0; i < 100; ++i)
+    {
+        // Sizes not dividing the capacity force records to skip the end of the storage.
+        while(produce(buffer, next_produced, 24 + (next_produced % 3) * 16))
+        {
+            ++next_produced;
+        }
+        buffer.consume([&next_consumed](void* record)
+        {
+            uint32_t value;
+            memcpy(&value, record, sizeof(value));
+            ASSERT_EQ(next_consumed, value);
+            ++next_consumed;
+        });
+    }
+    ASSERT_EQ(next_produced, next_consumed);
+}
+
+TEST(SPSCRecordBufferTests, concurrent_producer_and_consumer)
+{
+    const uint32_t count = 100000;
+    SPSCRecordBuffer buffer(4096);
+
+    std::thread producer([&buffer, count]()
+    {
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            while(!produce(buffer, i, 8 + (i % 7) * 8))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t next_consumed = 0;
+    bool in_order = true;
+    while(next_consumed < count)
+    {
+        buffer.consume([&next_consumed, &in_order](void* record)
+        {
+            uint32_t value;
+            memcpy(&value, record, sizeof(value));
+            in_order = in_order && value == next_consumed;
+            ++next_consumed;
+        });
+    }
+
+    producer.join();
+    ASSERT_TRUE(in_order);
+    ASSERT_TRUE(buffer.empty());
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
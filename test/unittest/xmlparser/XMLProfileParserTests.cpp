@@ -268,6 +268,9 @@ TEST_F(XMLProfileParserTests, XMLParserPublisher)
     //EXPECT_EQ(loc_list_it->get_port(), 2021);
     EXPECT_EQ(publisher_atts.throughputController.bytesPerPeriod, 9236u);
     EXPECT_EQ(publisher_atts.throughputController.periodMillisecs, 234u);
+    EXPECT_EQ(publisher_atts.throughputController.kind, TOKEN_BUCKET_THROUGHPUT_CONTROLLER);
+    EXPECT_EQ(publisher_atts.throughputController.burstBytes, 18472u);
+    EXPECT_EQ(publisher_atts.throughputController.refillMillisecs, 5u);
     EXPECT_EQ(publisher_atts.historyMemoryPolicy, DYNAMIC_RESERVE_MEMORY_MODE);
     EXPECT_EQ(publisher_atts.getUserDefinedID(), 67);
     EXPECT_EQ(publisher_atts.getEntityID(), 87);
@@ -335,6 +338,9 @@ TEST_F(XMLProfileParserTests, XMLParserDefaultPublisherProfile)
     //EXPECT_EQ(loc_list_it->get_port(), 2021);
     EXPECT_EQ(publisher_atts.throughputController.bytesPerPeriod, 9236u);
     EXPECT_EQ(publisher_atts.throughputController.periodMillisecs, 234u);
+    EXPECT_EQ(publisher_atts.throughputController.kind, TOKEN_BUCKET_THROUGHPUT_CONTROLLER);
+    EXPECT_EQ(publisher_atts.throughputController.burstBytes, 18472u);
+    EXPECT_EQ(publisher_atts.throughputController.refillMillisecs, 5u);
     EXPECT_EQ(publisher_atts.historyMemoryPolicy, DYNAMIC_RESERVE_MEMORY_MODE);
     EXPECT_EQ(publisher_atts.getUserDefinedID(), 67);
     EXPECT_EQ(publisher_atts.getEntityID(), 87);